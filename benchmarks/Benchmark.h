@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+// Helpers shared by the benchmark executables. They're plain programs that print one line per
+// measurement, build them with -DES_BUILD_BENCHMARKS=ON and run them from a release build.
+
+namespace Benchmark
+{
+	inline double now()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// runs work until at least minSeconds have passed and returns the average seconds per run
+	template<typename Work>
+	double timeRuns(Work work, double minSeconds = 0.5)
+	{
+		work(); // warm up
+		int runs = 0;
+		const double start = now();
+		double elapsed;
+		do
+		{
+			work();
+			runs++;
+			elapsed = now() - start;
+		}while(elapsed < minSeconds);
+
+		return elapsed / runs;
+	}
+
+	// times a single run, for things that can only be done once (like filling a cache for the first time)
+	template<typename Work>
+	double timeOnce(Work work)
+	{
+		const double start = now();
+		work();
+		return now() - start;
+	}
+
+	inline void report(const std::string& name, double value, const char* unit)
+	{
+		printf("%-64s %14.2f %s\n", name.c_str(), value, unit);
+		fflush(stdout);
+	}
+}
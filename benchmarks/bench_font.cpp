@@ -0,0 +1,102 @@
+// Wrapping and laying out game descriptions the way the detailed game list's description does it
+// (TextComponent: sizeWrappedText, wrapText and buildTextCache), with nothing loaded yet, with the glyphs
+// loaded but no layouts cached, and with every layout cached.
+// Glyphs live in OpenGL textures, so this opens a small window for a context.
+//
+// usage: bench_font [gamelist.xml ...]
+// Descriptions come from the given gamelists, benchmarks/data/descriptions.xml by default
+// (the executables end up in the top directory, run it from there).
+
+#include "Benchmark.h"
+#include "Log.h"
+#include "Renderer.h"
+#include "Settings.h"
+#include "resources/Font.h"
+#include "pugixml/pugixml.hpp"
+#include <sstream>
+#include <vector>
+
+static void layoutAll(Font& font, const std::vector<std::string>& descriptions, float width)
+{
+	for(auto it = descriptions.begin(); it != descriptions.end(); it++)
+	{
+		font.sizeWrappedText(*it, width);
+		delete font.buildTextCache(font.wrapText(*it, width), Eigen::Vector2f(0, 0), 0x777777FF, width, ALIGN_LEFT, 1.5f);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<std::string> gamelists;
+	for(int i = 1; i < argc; i++)
+		gamelists.push_back(argv[i]);
+	if(gamelists.empty())
+		gamelists.push_back("benchmarks/data/descriptions.xml");
+
+	std::vector<std::string> descriptions;
+	size_t chars = 0;
+	for(auto it = gamelists.begin(); it != gamelists.end(); it++)
+	{
+		pugi::xml_document doc;
+		if(!doc.load_file(it->c_str()))
+		{
+			fprintf(stderr, "Could not read %s\n", it->c_str());
+			return 1;
+		}
+
+		for(pugi::xml_node game = doc.child("gameList").child("game"); game; game = game.next_sibling("game"))
+		{
+			const std::string desc = game.child("desc").text().get();
+			if(!desc.empty())
+			{
+				descriptions.push_back(desc);
+				chars += desc.size();
+			}
+		}
+	}
+
+	if(descriptions.empty())
+	{
+		fprintf(stderr, "No descriptions found\n");
+		return 1;
+	}
+
+	Log::setReportingLevel(LogWarning);
+	Settings::getInstance()->setBool("Windowed", true);
+	if(!Renderer::init(1280, 720))
+	{
+		fprintf(stderr, "Could not create an OpenGL context\n");
+		return 1;
+	}
+
+	{
+		std::shared_ptr<Font> font = Font::get(FONT_SIZE_SMALL);
+		const float width = Renderer::getScreenWidth() * 0.48f; // the description's width in the detailed view
+
+		std::stringstream label;
+		label << descriptions.size() << " descriptions (" << chars / 1024 << " KB): ";
+
+		// nothing loaded, every glyph is rendered on the way
+		double seconds = Benchmark::timeOnce([&] { layoutAll(*font, descriptions, width); });
+		Benchmark::report(label.str() + "cold", seconds * 1000, "ms");
+
+		// glyphs loaded, but a different width every time so no layout is cached
+		float uncachedWidth = width;
+		seconds = Benchmark::timeRuns([&] { layoutAll(*font, descriptions, uncachedWidth += 1.0f); });
+		Benchmark::report(label.str() + "glyphs loaded, layout not cached", seconds * 1000, "ms");
+
+		// everything cached (as long as it fits in the layout cache)
+		seconds = Benchmark::timeRuns([&] { layoutAll(*font, descriptions, width); });
+		Benchmark::report(label.str() + "warm", seconds * 1000, "ms");
+
+		// just the line breaking
+		seconds = Benchmark::timeRuns([&] {
+			for(auto it = descriptions.begin(); it != descriptions.end(); it++)
+				font->wrapText(*it, width);
+		});
+		Benchmark::report(label.str() + "wrapText only", seconds * 1000, "ms");
+	}
+
+	Renderer::deinit();
+	return 0;
+}
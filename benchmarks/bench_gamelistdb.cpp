@@ -0,0 +1,207 @@
+// GamelistDB on a generated collection: listing a big folder, reading and writing metadata, searching.
+// bench_gamelistdb uses the tuned connections (WAL, see tune_connection), bench_gamelistdb_defaults is the
+// same program with GamelistDB built with GAMELISTDB_DEFAULT_PRAGMAS.  Both use the SQLite in external/.
+//
+// usage: bench_gamelistdb [number of games, default 100000]
+// Everything lives in a temporary directory (HOME points there, so that's where the database goes).
+
+#include "Benchmark.h"
+#include "GamelistDB.h"
+#include "SystemData.h"
+#include "SystemManager.h"
+#include "MetaData.h"
+#include "Log.h"
+#include <boost/filesystem.hpp>
+#include <atomic>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#ifdef GAMELISTDB_DEFAULT_PRAGMAS
+	#define VARIANT "default pragmas"
+#else
+	#define VARIANT "tuned"
+#endif
+
+namespace fs = boost::filesystem;
+
+static const char* GENRES[] = { "Platform", "Shooter", "Racing", "Puzzle", "Fighting", "Sports", "RPG", "Action" };
+static const char* WORDS[] = { "super", "mega", "dragon", "star", "fighter", "quest", "world", "legend", "racer", "kid",
+	"ninja", "castle", "space", "island", "turbo", "dungeon", "soccer", "tetris", "bubble", "metal" };
+static const char* SYLLABLES[] = { "ka", "ro", "mi", "ta", "ne", "zo", "gu", "shi", "ba", "le", "von", "dar", "el", "tor",
+	"qu", "is", "an", "pe", "lo", "rix", "sa", "mu", "fen", "go", "hal", "di", "wu", "ce", "jo", "yor" };
+
+// one in ten is one of the common words above (each in about one game in seven), the rest are
+// made up ones from a vocabulary of a few thousand
+static std::string word(unsigned int n)
+{
+	if(n % 10 == 0)
+		return WORDS[(n / 10) % 20];
+
+	n = (n * 2654435761u) % 27000;
+	std::string w = SYLLABLES[n % 30];
+	w += SYLLABLES[(n / 30) % 30];
+	if(n >= 900)
+		w += SYLLABLES[(n / 900) % 30];
+	return w;
+}
+
+static std::string gameName(int i)
+{
+	std::stringstream ss;
+	ss << word(i) << " " << word(i / 7 + 11) << " " << word(i / 3 + 5);
+	if(i % 4 == 0)
+		ss << " " << (i % 9 + 2);
+	return ss.str();
+}
+
+static std::string gameDesc(int i)
+{
+	std::stringstream ss;
+	ss << "The " << gameName(i) << " returns";
+	for(int w = 0; w < 24; w++)
+		ss << " " << word(i * 31 + w * 7);
+	ss << ".";
+	return ss.str();
+}
+
+static void setEnv(const char* name, const std::string& value)
+{
+#ifdef WIN32
+	_putenv_s(name, value.c_str());
+#else
+	setenv(name, value.c_str(), 1);
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+	const int games = argc > 1 ? atoi(argv[1]) : 100000;
+
+	const fs::path dir = fs::temp_directory_path() / fs::unique_path("es-bench-%%%%%%%%");
+	const fs::path roms = dir / "roms";
+	fs::create_directories(roms);
+	fs::create_directories(dir / ".emulationstation");
+	setEnv("HOME", dir.generic_string());
+	Log::open();
+
+	for(int i = 0; i < games; i++)
+		std::ofstream((roms / (gameName(i) + " (" + std::to_string(i) + ").rom")).string());
+
+	std::stringstream label;
+	label << VARIANT << ", " << games << " games: ";
+
+	try
+	{
+		GamelistDB& db = SystemManager::getInstance()->database();
+		db.addSystem("bench");
+		SystemData* system = new SystemData("bench", "Benchmark", roms.generic_string(), { ".rom" }, "true", { }, "bench", "");
+
+		double seconds = Benchmark::timeOnce([&] { db.addMissingFiles(system); });
+		Benchmark::report(label.str() + "scan", seconds * 1000, "ms");
+
+		const std::vector<FileData> files = db.getChildrenOf(".", system, true, false, false);
+		if((int)files.size() != games)
+			throw std::runtime_error("the scan didn't find every game");
+
+		// fill in metadata like a scrape would, queued and committed in batches by the writer
+		seconds = Benchmark::timeOnce([&] {
+			for(int i = 0; i < games; i++)
+			{
+				MetaDataMap md(GAME_METADATA);
+				md.set(MD_SLOT_NAME, gameName(i));
+				md.set(MD_SLOT_DESC, gameDesc(i));
+				md.set(MD_SLOT_GENRE, GENRES[i % 8]);
+				md.set(MD_SLOT_DEVELOPER, word(i % 50));
+				md.set(MD_SLOT_RATING, (i % 10) / 10.0f);
+				md.set(MD_SLOT_PLAYERS, 1 + i % 4);
+				db.setFileData(files[i].getFileID(), "bench", GAME, md);
+			}
+			db.flushWrites();
+		});
+		Benchmark::report(label.str() + "setFileData, all games + flush", seconds * 1000, "ms");
+
+		// the whole folder in each sort order, like opening the game list
+		const std::vector<FileSort>& sorts = getFileSorts();
+		size_t sort = 0;
+		seconds = Benchmark::timeRuns([&] {
+			db.getChildrenOf(".", system, true, true, false, &sorts.at(sort++ % sorts.size()));
+		});
+		Benchmark::report(label.str() + "getChildrenOf", seconds * 1000, "ms");
+
+		// random games, like moving the cursor around the list
+		std::mt19937 random(42);
+		seconds = Benchmark::timeRuns([&] {
+			db.getFileData(files[random() % games].getFileID(), "bench");
+		});
+		Benchmark::report(label.str() + "getFileData", seconds * 1000000, "us");
+
+		// typing a search one letter at a time (BasicGameListView asks for SEARCH_RESULT_LIMIT results, 500),
+		// then a second word, one of the made up words and a word nothing has; each also without a limit
+		const char* searches[] = { "s", "su", "sup", "supe", "super", "super d", "super dra", "karo", "qqq" };
+		for(const char* text : searches)
+		{
+			size_t matches = 0;
+			seconds = Benchmark::timeRuns([&] { db.searchFiles(system, text, 500); });
+			Benchmark::report(label.str() + "searchFiles \"" + text + "\", 500", seconds * 1000, "ms");
+			seconds = Benchmark::timeRuns([&] { matches = db.searchFiles(system, text).size(); });
+			Benchmark::report(label.str() + "searchFiles \"" + text + "\", all " + std::to_string(matches), seconds * 1000, "ms");
+		}
+
+		// a "search:" filter without subfilters, by relevance and by name
+		const char* filters[] = { "search:\"s\"*", "search:\"super\"*" };
+		for(const char* filter : filters)
+		{
+			seconds = Benchmark::timeRuns([&] { db.getChildrenOfFilter("./search", system, false, filter, 500, false, NULL); });
+			Benchmark::report(label.str() + "filter " + filter + ", 500 by rank", seconds * 1000, "ms");
+			seconds = Benchmark::timeRuns([&] { db.getChildrenOfFilter("./search", system, false, filter, 500, false, &sorts.at(0)); });
+			Benchmark::report(label.str() + "filter " + filter + ", 500 by name", seconds * 1000, "ms");
+		}
+
+		// one edit at a time, each committed before the next (like GuiMetaDataEd)
+		int edit = 0;
+		seconds = Benchmark::timeRuns([&] {
+			const FileData& file = files[random() % games];
+			MetaDataMap md = db.getFileData(file.getFileID(), "bench");
+			md.set(MD_SLOT_PLAYCOUNT, ++edit);
+			db.setFileData(file.getFileID(), "bench", GAME, md);
+			db.flushWrites();
+		});
+		Benchmark::report(label.str() + "setFileData + flush", seconds * 1000, "ms");
+
+		// the same with a background thread reading the whole table (like an export or prefetching)
+		std::atomic<bool> stop(false);
+		std::atomic<int> reads(0);
+		std::thread reader([&] {
+			while(!stop)
+			{
+				db.withReadConnection([] (sqlite3* conn) {
+					sqlite3_exec(conn, "SELECT COUNT(*), SUM(LENGTH(name)) FROM files", NULL, NULL, NULL);
+				});
+				reads++;
+			}
+		});
+		int edits = 0;
+		seconds = Benchmark::timeRuns([&] {
+			const FileData& file = files[random() % games];
+			MetaDataMap md = db.getFileData(file.getFileID(), "bench");
+			md.set(MD_SLOT_PLAYCOUNT, ++edit);
+			db.setFileData(file.getFileID(), "bench", GAME, md);
+			db.flushWrites();
+			edits++;
+		});
+		stop = true;
+		reader.join();
+		Benchmark::report(label.str() + "setFileData + flush, reader running", seconds * 1000, "ms");
+		Benchmark::report(label.str() + "background reads meanwhile", reads / (seconds * edits), "reads/s");
+	}catch(std::exception& e)
+	{
+		fprintf(stderr, "%s\n", e.what());
+	}
+
+	delete SystemManager::getInstance();
+	Log::close();
+	fs::remove_all(dir);
+	return 0;
+}
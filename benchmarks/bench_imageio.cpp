@@ -0,0 +1,55 @@
+// MB/s of the per-pixel work done on every decoded image: the BGRA -> RGBA swizzle in
+// ImageIO::loadFromMemoryRGBA32 and the row swaps in ImageIO::flipPixelsVert.
+// bench_imageio_scalar is the same program with ImageIO built without its SSE2/NEON paths.
+
+#include "Benchmark.h"
+#include "ImageIO.h"
+#include <vector>
+#include <sstream>
+
+#ifdef IMAGEIO_NO_SIMD
+	#define VARIANT "scalar"
+#else
+	#define VARIANT "simd"
+#endif
+
+static void benchImage(const char* name, size_t width, size_t height)
+{
+	const size_t bytes = width * height * 4;
+	std::vector<unsigned char> src(bytes);
+	std::vector<unsigned char> dst(bytes);
+	for(size_t i = 0; i < bytes; i++)
+		src[i] = (unsigned char)(i * 7);
+
+	std::stringstream label;
+	label << VARIANT << " " << name << " (" << width << "x" << height << ")";
+
+	// a row at a time, like loadFromMemoryRGBA32 does
+	double seconds = Benchmark::timeRuns([&] {
+		for(size_t y = 0; y < height; y++)
+			ImageIO::swizzleRedBlue(src.data() + y * width * 4, dst.data() + y * width * 4, width);
+	});
+	Benchmark::report(label.str() + " swizzle", bytes / seconds / (1024 * 1024), "MB/s");
+
+	seconds = Benchmark::timeRuns([&] {
+		ImageIO::flipPixelsVert(dst.data(), width, height);
+	});
+	Benchmark::report(label.str() + " flip", bytes / seconds / (1024 * 1024), "MB/s");
+
+	// an odd width leaves a few pixels of every row to the plain loop
+	const size_t oddWidth = width - 1;
+	seconds = Benchmark::timeRuns([&] {
+		for(size_t y = 0; y < height; y++)
+			ImageIO::swizzleRedBlue(src.data() + y * oddWidth * 4, dst.data() + y * oddWidth * 4, oddWidth);
+	});
+	std::stringstream oddLabel;
+	oddLabel << VARIANT << " " << name << " (" << oddWidth << "x" << height << ") swizzle";
+	Benchmark::report(oddLabel.str(), oddWidth * height * 4 / seconds / (1024 * 1024), "MB/s");
+}
+
+int main(int argc, char* argv[])
+{
+	benchImage("1080p screenshot", 1920, 1080);
+	benchImage("box art", 400, 560);
+	return 0;
+}
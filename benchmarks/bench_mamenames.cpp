@@ -0,0 +1,68 @@
+// Lookups per second of PlatformIds::getCleanMameName (a binary search over the sorted MameNameMap.cpp table)
+// against the linear scan it used to do, for arcade short names and for names that aren't in the table
+// (every file of a system that uses the MAME names ends up here when it has no name yet).
+
+#include "Benchmark.h"
+#include "PlatformId.h"
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+extern const char* mameNameToRealName[];
+extern const unsigned int mameNameCount;
+
+// what getCleanMameName did before the table was sorted
+static const char* linearCleanMameName(const char* from)
+{
+	const char** mameNames = mameNameToRealName;
+
+	while(*mameNames != NULL && strcmp(from, *mameNames) != 0)
+		mameNames += 2;
+
+	if(*mameNames)
+		return *(mameNames + 1);
+
+	return from;
+}
+
+static volatile size_t sFound; // keeps the lookups from being optimized away
+
+template<typename Lookup>
+static void benchLookups(const char* name, const std::vector<std::string>& names, Lookup lookup)
+{
+	size_t next = 0;
+	size_t found = 0;
+	const int batch = 100;
+	const double seconds = Benchmark::timeRuns([&] {
+		for(int i = 0; i < batch; i++)
+		{
+			const char* from = names[next++ % names.size()].c_str();
+			if(lookup(from) != from)
+				found++;
+		}
+	});
+	sFound = found;
+	Benchmark::report(name, batch / seconds, "lookups/s");
+}
+
+int main(int argc, char* argv[])
+{
+	// short names from all over the table, in random order
+	std::mt19937 random(42);
+	std::vector<std::string> known;
+	for(int i = 0; i < 1000; i++)
+		known.push_back(mameNameToRealName[(random() % mameNameCount) * 2]);
+
+	// file names that aren't short names
+	std::vector<std::string> unknown;
+	for(int i = 0; i < 1000; i++)
+		unknown.push_back("Some Game (USA) (Rev " + std::to_string(i) + ")");
+
+	printf("%u names in the table\n", mameNameCount);
+	benchLookups("binary search, known names", known, PlatformIds::getCleanMameName);
+	benchLookups("linear scan, known names", known, linearCleanMameName);
+	benchLookups("binary search, unknown names", unknown, PlatformIds::getCleanMameName);
+	benchLookups("linear scan, unknown names", unknown, linearCleanMameName);
+	return 0;
+}
@@ -0,0 +1,115 @@
+// Memory and access time of 50k game MetaDataMaps, the size of a big collection.
+// bench_metadata uses es-app/src/MetaData.h, bench_metadata_stringmap is the same program built
+// against the old std::map<std::string, std::string> layout in stringmap/.
+
+#include "Benchmark.h"
+#include "MetaData.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#ifdef METADATA_STRINGMAP
+	#define VARIANT "string map"
+#else
+	#define VARIANT "typed slots"
+#endif
+
+#define ENTRIES 50000
+
+// live heap bytes, every allocation carries its size in front of it
+static std::atomic<size_t> sHeapBytes(0);
+static const size_t HEADER = 16; // keeps the alignment malloc gives us
+
+void* operator new(size_t size)
+{
+	char* p = (char*)malloc(size + HEADER);
+	if(!p)
+		throw std::bad_alloc();
+	*(size_t*)p = size;
+	sHeapBytes += size;
+	return p + HEADER;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if(!ptr)
+		return;
+	char* p = (char*)ptr - HEADER;
+	sHeapBytes -= *(size_t*)p;
+	free(p);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+
+// what the scanner and the gamelist import set on a typical scraped game
+static MetaDataMap makeEntry(int i)
+{
+	MetaDataMap md(GAME_METADATA);
+	md.set("name", "Some Game Title " + std::to_string(i));
+	md.set("desc", "A fairly typical description of a game that goes on for a couple of sentences. " + std::to_string(i));
+	md.set("image", "/home/pi/.emulationstation/downloaded_images/snes/Some Game Title " + std::to_string(i) + "-image.jpg");
+	md.set("rating", "0.8");
+	md.set("releasedate", "1991-06-23 00:00:00");
+	md.set("developer", "Some Developer");
+	md.set("publisher", "Some Publisher");
+	md.set("genre", "Platform");
+	md.set("players", "2");
+	md.set("playcount", "3");
+	return md;
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<MetaDataMap> entries;
+	entries.reserve(ENTRIES);
+	const size_t heapBefore = sHeapBytes;
+
+	double seconds = Benchmark::timeOnce([&] {
+		for(int i = 0; i < ENTRIES; i++)
+			entries.push_back(makeEntry(i));
+	});
+	Benchmark::report(VARIANT " build 50k", seconds * 1000, "ms");
+	Benchmark::report(VARIANT " memory per entry", (double)(sHeapBytes - heapBefore) / ENTRIES + sizeof(MetaDataMap), "bytes");
+
+	// the game list copies an entry's metadata every time it's shown
+	std::vector<MetaDataMap> copies;
+	copies.reserve(ENTRIES);
+	const size_t heapBeforeCopies = sHeapBytes;
+	seconds = Benchmark::timeOnce([&] {
+		copies.insert(copies.end(), entries.begin(), entries.end());
+	});
+	Benchmark::report(VARIANT " copy 50k", seconds * 1000, "ms");
+	Benchmark::report(VARIANT " memory per copy", (double)(sHeapBytes - heapBeforeCopies) / ENTRIES + sizeof(MetaDataMap), "bytes");
+
+	// what the detailed view reads for its info panel, 4 passes over every entry = 200k entry reads
+	long long sum = 0;
+	seconds = Benchmark::timeOnce([&] {
+		for(int pass = 0; pass < 4; pass++)
+		{
+			for(auto it = copies.begin(); it != copies.end(); it++)
+			{
+				sum += it->get<int>("playcount") + it->get<int>("players");
+				sum += (long long)(it->get<float>("rating") * 10);
+				sum += it->get<boost::posix_time::ptime>("releasedate").date().year();
+				sum += it->get("name").size() + it->get("desc").size() + it->get("genre").size();
+			}
+		}
+	});
+	Benchmark::report(VARIANT " 200k typed reads", seconds * 1000, "ms");
+
+	// string reads only, what sorting and exporting do
+	seconds = Benchmark::timeOnce([&] {
+		for(auto it = copies.begin(); it != copies.end(); it++)
+		{
+			const std::vector<MetaDataDecl>& mdd = it->getMDD();
+			for(auto decl = mdd.begin(); decl != mdd.end(); decl++)
+				sum += it->get(decl->key).size();
+		}
+	});
+	Benchmark::report(VARIANT " 50k reads of every field", seconds * 1000, "ms");
+
+	printf("(checksum %lld)\n", sum);
+	return 0;
+}
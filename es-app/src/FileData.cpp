@@ -93,7 +93,7 @@ const std::string& FileData::getName() const
 {
 	// try and cache what's in the DB
 	if(mNameCache.empty())
-		mNameCache = get_metadata().get<std::string>("name");
+		mNameCache = get_metadata().get(MD_SLOT_NAME);
 
 	// nothing was in the DB...use the clean version of our path
 	if(mNameCache.empty())
@@ -128,6 +128,12 @@ void FileData::set_metadata(const MetaDataMap& metadata) const
 	SystemManager::getInstance()->database().setFileData(mFileID, getSystemID(), mType, metadata);
 }
 
+void FileData::update_metadata(const MetaDataMap& metadata, const std::vector<MetaDataSlot>& slots) const
+{
+	mValidMetaDataCache = false;
+	SystemManager::getInstance()->database().updateFileData(mFileID, getSystemID(), metadata, slots);
+}
+
 std::vector<FileData> FileData::getChildren(const FileSort* sort) const
 {
 	if(sort == NULL)
@@ -137,21 +143,35 @@ std::vector<FileData> FileData::getChildren(const FileSort* sort) const
 
 	if(mType == FILTER)
 	{
-		MetaDataMap metadata = get_metadata();
+		const MetaDataMap metadata = get_metadata();
 		//Sorry about abusing columns for other purposes.
-		std::string filter_matches = mMetaDataCache.get("genre");
-		int limit = mMetaDataCache.get<int>("players");
+		std::string filter_matches = metadata.get(MD_SLOT_GENRE);
+		int limit = metadata.get<int>(MD_SLOT_PLAYERS);
 		//TODO: Let a filter also specify ability to match filters/folders
-		std::string orderby = mMetaDataCache.get("developer");
+		std::string orderby = metadata.get(MD_SLOT_DEVELOPER);
 		FileSort filterSort("Filter given sort",orderby.c_str());
 		if(!orderby.empty())
 			sort = &filterSort;
+		else if(isSearchFilter(filter_matches))
+			sort = NULL; // by relevance
 		return SystemManager::getInstance()->database().getChildrenOfFilter(mFileID, mSystem, false, filter_matches, limit, foldersFirst, sort);
 	}
 
 	return SystemManager::getInstance()->database().getChildrenOf(mFileID, mSystem, true, true, foldersFirst, sort);
 }
 
+std::vector<sqlite3_int64> FileData::getChildRowIds(const FileSort* sort, const std::string& namePrefix) const
+{
+	assert(mType != FILTER);
+
+	if(sort == NULL)
+		sort = &getFileSorts().at(Settings::getInstance()->getInt("SortTypeIndex"));
+
+	bool foldersFirst = Settings::getInstance()->getBool("SortFoldersFirst");
+
+	return SystemManager::getInstance()->database().getChildRowIdsOf(mFileID, mSystem, true, foldersFirst, sort, namePrefix);
+}
+
 std::vector<FileData> FileData::getChildrenRecursive(bool includeFolders, const FileSort* sort) const
 {
 	if(sort == NULL)
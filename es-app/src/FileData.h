@@ -4,6 +4,7 @@
 #include <string>
 #include <boost/filesystem.hpp>
 #include "MetaData.h"
+#include <sqlite3/sqlite3.h>
 
 class SystemData;
 struct FileSort;
@@ -38,6 +39,7 @@ public:
 
 	MetaDataMap get_metadata() const;
 	void set_metadata(const MetaDataMap& metadata) const;
+	void update_metadata(const MetaDataMap& metadata, const std::vector<MetaDataSlot>& slots) const; // only writes those slots
 
 	const std::string& getName() const;
 	FileType getType() const;
@@ -49,6 +51,8 @@ public:
 	SystemData* getSystem() const { return mSystem; }
 
 	std::vector<FileData> getChildren(const FileSort* sortType = NULL) const;
+	// database row IDs of getChildren(), in the same order (not for filters, see GamelistDB::getChildRowIdsOf)
+	std::vector<sqlite3_int64> getChildRowIds(const FileSort* sortType = NULL, const std::string& namePrefix = "") const;
 	std::vector<FileData> getChildrenRecursive(bool includeFolders, const FileSort* sortType = NULL) const;
 
 	inline std::string getCleanName() const { return getCleanGameName(mFileID, mSystem); }
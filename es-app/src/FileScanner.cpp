@@ -0,0 +1,322 @@
+#include "FileScanner.h"
+#include "GamelistDB.h"
+#include "SystemData.h"
+#include "Log.h"
+#include <algorithm>
+
+namespace fs = boost::filesystem;
+
+// number of rows collected before a batch is handed to the writer
+#define BATCH_SIZE 256
+// max number of batches waiting for the writer before workers start blocking
+#define MAX_QUEUED_BATCHES 64
+
+// A directory that is being (or waiting to be) scanned.
+// pending counts our own listing plus every subdirectory that hasn't finished yet;
+// when it hits zero we know whether anything below us was a game.
+struct FileScanner::DirNode
+{
+	DirNode(DirNode* p, const SystemData* sys, const fs::path& dir, const std::string& id) 
+		: parent(p), system(sys), path(dir), fileID(id), pending(1), hasFile(false) {}
+
+	DirNode* parent;
+	const SystemData* system;
+	fs::path path;
+	std::string fileID;
+	std::atomic<int> pending;
+	std::atomic<bool> hasFile;
+};
+
+FileScanner::FileScanner(unsigned int threads)
+	: mPool(threads ? threads : std::max(2u, std::thread::hardware_concurrency())), mWalkDone(true), mCancelled(false),
+	mRootsRemaining(0), mDirectoryCount(0), mFileCount(0), mSkippedCount(0), mSkippedEntries(0), mStartWallTime(0), mWalkTime(0)
+{
+}
+
+FileScanner::~FileScanner()
+{
+	cancel();
+	mPool.wait();
+}
+
+void FileScanner::start(const std::vector<const SystemData*>& systems, const std::map<const SystemData*, SnapshotMap>& snapshots)
+{
+	mStartTime = std::chrono::steady_clock::now();
+	mStartWallTime = time(NULL);
+	mSnapshots = snapshots;
+
+	std::vector<DirNode*> roots;
+	for(auto it = systems.begin(); it != systems.end(); it++)
+	{
+		// filter systems have no directory to walk
+		if(!(*it)->getStartPath().empty())
+			roots.push_back(new DirNode(NULL, *it, (*it)->getStartPath(), "."));
+	}
+
+	mWalkDone = roots.empty();
+	mRootsRemaining = (int)roots.size();
+
+	for(auto it = roots.begin(); it != roots.end(); it++)
+	{
+		DirNode* node = *it;
+		mPool.queueWorkItem([this, node] { scanDirectory(node); });
+	}
+}
+
+void FileScanner::cancel()
+{
+	mCancelled = true;
+
+	std::lock_guard<std::mutex> lock(mQueueMutex);
+	mQueue.clear();
+	mQueueNotFull.notify_all();
+	mQueueNotEmpty.notify_all();
+}
+
+bool FileScanner::nextBatch(Batch& out)
+{
+	std::unique_lock<std::mutex> lock(mQueueMutex);
+	mQueueNotEmpty.wait(lock, [this] { return !mQueue.empty() || mWalkDone || mCancelled; });
+
+	if(mQueue.empty())
+		return false;
+
+	out.swap(mQueue.front());
+	mQueue.pop_front();
+	mQueueNotFull.notify_one();
+	return true;
+}
+
+bool FileScanner::pushBatch(Batch& batch)
+{
+	if(batch.empty())
+		return !mCancelled;
+
+	std::unique_lock<std::mutex> lock(mQueueMutex);
+	mQueueNotFull.wait(lock, [this] { return mQueue.size() < MAX_QUEUED_BATCHES || mCancelled; });
+	if(mCancelled)
+		return false;
+
+	mQueue.push_back(Batch());
+	mQueue.back().swap(batch);
+	mQueueNotEmpty.notify_one();
+	return true;
+}
+
+void FileScanner::finishWalk()
+{
+	mWalkTime = (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mStartTime).count();
+
+	std::lock_guard<std::mutex> lock(mQueueMutex);
+	mWalkDone = true;
+	mQueueNotEmpty.notify_all();
+}
+
+// checks the directory (checkDirectory), then once we and all of our subfolders are done,
+// finishDirectory reports this folder if it had a game.
+void FileScanner::scanDirectory(DirNode* node)
+{
+	Batch batch;
+
+	// finishDirectory has to run no matter what, or the walk never ends
+	try
+	{
+		if(!mCancelled)
+			checkDirectory(node, batch);
+	}catch(std::exception& e)
+	{
+		LOG(LogWarning) << "Error scanning \"" << node->path.generic_string() << "\": " << e.what();
+	}
+
+	pushBatch(batch);
+
+	if(finishDirectory(node))
+		finishWalk();
+}
+
+// - if the directory still matches its snapshot, skip listing it and just queue the subdirectories we remember.
+// - otherwise list it (listDirectory).
+void FileScanner::checkDirectory(DirNode* node, Batch& batch)
+{
+	const fs::path& dir = node->path;
+
+	// make sure that this isn't a symlink to a thing we already have
+	// (a dangling link or one we can't follow is skipped like an empty directory)
+	boost::system::error_code ec;
+	bool recursiveLink = false;
+	if(fs::is_symlink(dir, ec))
+	{
+		// if this symlink resolves to somewhere that's at the beginning of our path, it's gonna recurse
+		const fs::path target = fs::canonical(dir, ec);
+		if(ec || dir.generic_string().find(target.generic_string()) == 0)
+		{
+			LOG(LogWarning) << "Skipping " << (ec ? "broken" : "infinitely recursive") << " symlink \"" << dir << "\"";
+			recursiveLink = true;
+		}
+	}
+
+	std::time_t mtime = fs::last_write_time(dir, ec);
+	if(ec)
+		mtime = -1;
+
+	if(recursiveLink)
+	{
+		// nothing to do
+	}else if(mtime == -1 && !fs::is_directory(dir, ec))
+	{
+		// a directory from an old snapshot that has since disappeared, forget about it
+		ScannedDirectory gone = { node->system, node->fileID, node->parent ? node->parent->fileID : "", dir.filename().string(), -1, 0, false };
+		batch.directories.push_back(gone);
+	}else{
+		const DirSnapshot* snapshot = NULL;
+		auto sysIt = mSnapshots.find(node->system);
+		if(sysIt != mSnapshots.end())
+		{
+			auto snapIt = sysIt->second.find(node->fileID);
+			if(snapIt != sysIt->second.end())
+				snapshot = &snapIt->second;
+		}
+
+		if(snapshot && mtime != -1 && snapshot->mtime == mtime)
+		{
+			// nothing was added or removed here since the last scan
+			mSkippedCount++;
+			mSkippedEntries += snapshot->entries;
+			for(auto it = snapshot->subdirs.begin(); it != snapshot->subdirs.end(); it++)
+				queueSubdirectory(node, dir / *it);
+		}else{
+			listDirectory(node, mtime, snapshot, batch);
+		}
+	}
+}
+
+// - if it's a file, check if its extension matches our list, reporting it as a game if it does.
+//   also mark this folder as having a file.
+// - if it's a folder, queue it to be scanned on its own (finishDirectory will mark us if it had a game).
+// - record what we saw so the next scan can skip this directory if it doesn't change,
+//   and forget subdirectories from the old snapshot that are gone now.
+void FileScanner::listDirectory(DirNode* node, std::time_t mtime, const DirSnapshot* snapshot, Batch& batch)
+{
+	const fs::path& dir = node->path;
+	const SystemData* system = node->system;
+	const std::string& relativeTo = system->getStartPath();
+	const std::vector<std::string>& extensions = system->getExtensions();
+
+	mDirectoryCount++;
+
+	unsigned int entries = 0;
+	std::vector<std::string> subdirs;
+	boost::system::error_code ec; // entries we can't stat just aren't directories
+	try
+	{
+		for(fs::directory_iterator end, it(dir); it != end; ++it)
+		{
+			// fyi, folders *can* also match the extension and be added as games - this is mostly just to support higan
+			// see issue #75: https://github.com/Aloshi/EmulationStation/issues/75
+			const fs::path& path = *it;
+			entries++;
+
+			// if the extension is on our list
+			if(std::find(extensions.begin(), extensions.end(), path.extension().string()) != extensions.end())
+			{
+				// yep, it's a game: add it
+				ScannedFile file;
+				file.system = system;
+				// symlinks resolve somewhere else, everything else is just "[our ID]/[name]"
+				if(it->symlink_status().type() == fs::symlink_file)
+					file.fileID = pathToFileID(path, relativeTo);
+				else
+					file.fileID = node->fileID + "/" + path.filename().string();
+				file.type = FileType::GAME;
+				file.name = getCleanGameName(file.fileID, system);
+				batch.files.push_back(file);
+				node->hasFile = true;
+				mFileCount++;
+
+				if(batch.files.size() >= BATCH_SIZE && !pushBatch(batch))
+					break;
+			}else if(fs::is_directory(path, ec))
+			{
+				// it's not a game, but it's a directory - check if it contains any games
+				queueSubdirectory(node, path);
+				subdirs.push_back(path.filename().string());
+			}
+		}
+	}catch(fs::filesystem_error& e)
+	{
+		LOG(LogWarning) << "Error scanning \"" << dir.generic_string() << "\": " << e.what();
+		mtime = -1; // try again next time
+	}
+
+	if(mtime != -1 && mtime >= mStartWallTime - RACY_MTIME_WINDOW)
+		mtime = -1;
+
+	ScannedDirectory scanned = { system, node->fileID, node->parent ? node->parent->fileID : "", dir.filename().string(), mtime, entries, true };
+	batch.directories.push_back(scanned);
+
+	if(snapshot)
+	{
+		for(auto it = snapshot->subdirs.begin(); it != snapshot->subdirs.end(); it++)
+		{
+			if(std::find(subdirs.begin(), subdirs.end(), *it) == subdirs.end())
+			{
+				ScannedDirectory gone = { system, node->fileID + "/" + *it, node->fileID, *it, -1, 0, false };
+				batch.directories.push_back(gone);
+			}
+		}
+	}
+}
+
+void FileScanner::queueSubdirectory(DirNode* parent, const fs::path& path)
+{
+	std::string fileID;
+	boost::system::error_code ec;
+	if(fs::is_symlink(path, ec))
+		fileID = pathToFileID(path, parent->system->getStartPath());
+	else
+		fileID = parent->fileID + "/" + path.filename().string();
+
+	DirNode* child = new DirNode(parent, parent->system, path, fileID);
+	parent->pending++;
+	mPool.queueWorkItem([this, child] { scanDirectory(child); });
+}
+
+// Reports folders that became known once all of their subdirectories are done.
+// Every batch is pushed before the parent's pending count drops, so by the time the
+// last root finishes nothing can still be on its way to the queue.
+// Returns true if this finished the last root directory.
+bool FileScanner::finishDirectory(DirNode* node)
+{
+	while(node)
+	{
+		if(--node->pending != 0)
+			return false; // still waiting on subdirectories
+
+		DirNode* parent = node->parent;
+
+		if(node->hasFile && !mCancelled)
+		{
+			// this folder had a game, report it (and let our parent know)
+			Batch batch;
+			ScannedFile folder;
+			folder.system = node->system;
+			folder.fileID = node->fileID;
+			folder.type = FileType::FOLDER;
+			folder.name = getCleanGameName(folder.fileID, node->system);
+			batch.files.push_back(folder);
+			pushBatch(batch);
+
+			if(parent)
+				parent->hasFile = true;
+		}
+
+		delete node;
+
+		if(!parent)
+			return --mRootsRemaining == 0;
+
+		node = parent;
+	}
+
+	return false;
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include "FileData.h"
+#include "ThreadPool.h"
+
+class SystemData;
+
+// directories modified this close (in seconds) to a scan could still change within the same
+// timestamp, so their snapshot is stored as untrusted (same idea as git's "racy clean" entries)
+#define RACY_MTIME_WINDOW 2
+
+// a single row discovered by the FileScanner, ready to be inserted into the "files" table
+struct ScannedFile
+{
+	const SystemData* system;
+	std::string fileID;
+	FileType type;
+	std::string name;
+};
+
+// a directory the FileScanner listed (or found missing), used to update the snapshot table
+struct ScannedDirectory
+{
+	const SystemData* system;
+	std::string fileID;
+	std::string parentID; // empty for the system root
+	std::string name; // name of the entry in the parent directory
+	std::time_t mtime; // -1 if the snapshot should not be trusted next time
+	unsigned int entries;
+	bool exists;
+};
+
+// what a directory looked like the last time it was listed
+struct DirSnapshot
+{
+	DirSnapshot() : mtime(-1), entries(0) {}
+
+	std::time_t mtime;
+	unsigned int entries;
+	std::vector<std::string> subdirs; // names of the directories we walked into
+};
+
+// keyed by directory file ID
+typedef std::map<std::string, DirSnapshot> SnapshotMap;
+
+// Walks the start path of one or more systems on a pool of worker threads.
+// Subdirectories are queued as separate work items, so big folders (and different systems)
+// are spread across all workers.  Discovered files are handed out in batches through a
+// bounded queue, so a single consumer (the database writer) can drain them while the walk is
+// still running.  Like the old recursive scan, folders are only reported if they contain at least
+// one game somewhere below them.
+// If a snapshot is given for a system, directories whose modification time still matches it are
+// not listed again; the walk just continues into the subdirectories the snapshot remembers.
+class FileScanner
+{
+public:
+	struct Batch
+	{
+		std::vector<ScannedFile> files;
+		std::vector<ScannedDirectory> directories;
+
+		inline bool empty() const { return files.empty() && directories.empty(); }
+		inline void swap(Batch& other) { files.swap(other.files); directories.swap(other.directories); }
+	};
+
+	// threads = 0 picks a default (the walk is mostly I/O bound, so always at least 2)
+	FileScanner(unsigned int threads = 0);
+	virtual ~FileScanner(); // cancels the walk if it is still running
+
+	void start(const std::vector<const SystemData*>& systems, const std::map<const SystemData*, SnapshotMap>& snapshots = std::map<const SystemData*, SnapshotMap>());
+
+	// Blocks until a batch of files is ready.
+	// Returns false once the walk has finished and every batch has been handed out.
+	bool nextBatch(Batch& out);
+
+	// stops the walk early; nextBatch() will return false from now on
+	void cancel();
+
+	inline unsigned int getThreadCount() const { return mPool.getThreadCount(); }
+	inline unsigned int getDirectoryCount() const { return mDirectoryCount; }
+	inline unsigned int getFileCount() const { return mFileCount; }
+	// directories that matched their snapshot and were not listed
+	inline unsigned int getSkippedDirectoryCount() const { return mSkippedCount; }
+	inline unsigned int getSkippedEntryCount() const { return mSkippedEntries; }
+	// wall time from start() until the last directory was listed, in milliseconds
+	inline int getWalkTime() const { return mWalkTime; }
+
+private:
+	struct DirNode;
+
+	void scanDirectory(DirNode* node);
+	void checkDirectory(DirNode* node, Batch& batch);
+	void listDirectory(DirNode* node, std::time_t mtime, const DirSnapshot* snapshot, Batch& batch);
+	void queueSubdirectory(DirNode* parent, const boost::filesystem::path& path);
+	bool finishDirectory(DirNode* node);
+	bool pushBatch(Batch& batch);
+	void finishWalk();
+
+	ThreadPool mPool;
+	std::map<const SystemData*, SnapshotMap> mSnapshots;
+
+	// bounded queue of batches waiting for the writer
+	std::mutex mQueueMutex;
+	std::condition_variable mQueueNotEmpty;
+	std::condition_variable mQueueNotFull;
+	std::deque<Batch> mQueue;
+	bool mWalkDone;
+	std::atomic<bool> mCancelled;
+
+	std::atomic<int> mRootsRemaining;
+	std::atomic<unsigned int> mDirectoryCount;
+	std::atomic<unsigned int> mFileCount;
+	std::atomic<unsigned int> mSkippedCount;
+	std::atomic<unsigned int> mSkippedEntries;
+	std::chrono::steady_clock::time_point mStartTime;
+	std::time_t mStartWallTime;
+	int mWalkTime;
+};
@@ -3,17 +3,64 @@
 #include "Log.h"
 #include "SystemData.h"
 #include <sstream>
+#include <algorithm>
 #include <map>
+#include <set>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <queue>
 #include <boost/assign.hpp>
+#include <chrono>
 #include "SystemManager.h"
+#include "FileScanner.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace fs = boost::filesystem;
 
-#define RESERVED_COLUMNS 4
+#define RESERVED_COLUMNS 6
 #define COL_FILEID 0
 #define COL_SYSTEMID 1
 #define COL_FILETYPE 2
 #define COL_FILEEXISTS 3
+#define COL_PARENTID 4
+#define COL_DEPTH 5
+
+// files_search is an FTS5 index of these columns, kept in sync with files by triggers
+#define SEARCH_COLUMNS "name, \"desc\", developer, publisher, genre"
+#define SEARCH_NEW_VALUES "new.rowid, new.name, new.\"desc\", new.developer, new.publisher, new.genre"
+#define SEARCH_OLD_VALUES "old.rowid, old.name, old.\"desc\", old.developer, old.publisher, old.genre"
+// prefix index sizes, "1" is for the short words of longer searches (searchFiles() doesn't ask it for a lone letter)
+// and longer prefixes only cover a few different words each
+#define SEARCH_PREFIXES "1 2 3"
+
+// filters starting with this are an FTS5 query on files_search instead of SQL
+#define SEARCH_FILTER_PREFIX "search:"
+
+// what a row of files adds to its system's row in systemstats (see GamelistDB::createStats)
+#define STATS_GAMES(row) "(" row ".filetype = 1)"
+#define STATS_FOLDERS(row) "(" row ".filetype = 2)"
+#define STATS_IMAGES(row) "(IFNULL(" row ".image, '') <> '')"
+
+// how long the writer thread waits for more writes to put in the same transaction
+#define WRITE_BEHIND_MS 500
+// times a batch of queued writes is tried before it's given up on (each try waits up to BUSY_TIMEOUT_MS for locks)
+#define WRITE_ATTEMPTS 3
+// how long a connection waits for the other one to finish writing before giving up
+#define BUSY_TIMEOUT_MS 5000
+
+// every connection's page cache and how much of the database file it maps into memory
+#define CACHE_SIZE_KB 8192
+#define MMAP_SIZE (64 * 1024 * 1024)
+
+// how many rows have to change before the query planner's statistics are updated
+#define ANALYZE_AFTER_CHANGES 1000
 
 std::string pathToFileID(const fs::path& path, const fs::path& systemStartPath)
 {
@@ -30,6 +77,28 @@ fs::path fileIDToPath(const std::string& fileID, const SystemData* system)
 	return resolvePath(fileID, system->getStartPath(), true);
 }
 
+// the directory part of a file ID ("./a/b.rom" -> "./a"), empty if there isn't one
+std::string parent_dir_id(const char* fileID)
+{
+	const char* slash = strrchr(fileID, '/');
+	if(slash == NULL)
+		return "";
+
+	return std::string(fileID, slash - fileID);
+}
+
+// binds the parentid and depth columns derived from fileID to ?col and ?(col + 1)
+void bind_parent(sqlite3_stmt* stmt, int col, const std::string& fileID)
+{
+	const std::string parent = parent_dir_id(fileID.c_str());
+	if(parent.empty())
+		sqlite3_bind_null(stmt, col);
+	else
+		sqlite3_bind_text(stmt, col, parent.c_str(), parent.size(), SQLITE_TRANSIENT);
+
+	sqlite3_bind_int(stmt, col + 1, (int)std::count(fileID.begin(), fileID.end(), '/'));
+}
+
 
 
 std::vector<FileSort> sFileSorts = boost::assign::list_of
@@ -52,18 +121,228 @@ const std::vector<FileSort>& getFileSorts()
 	return sFileSorts;
 }
 
+// max number of dynamically built queries (getChildrenOf etc.) kept prepared
+#define MAX_CACHED_QUERIES 32
+
+// statements that are used often enough to always keep them prepared
+enum CachedStatement
+{
+	STMT_GET_FILE_DATA,
+	STMT_UPDATE_FILE_DATA,
+	STMT_INSERT_FILE_DATA,
+	STMT_GET_FILE_TAGS,
+	STMT_ADD_FILE_TAG,
+	STMT_REMOVE_FILE_TAG,
+	STMT_UPDATE_EXISTS,
+	STMT_REMOVE_ENTRY,
+	STMT_GET_FILE_BY_ROWID,
+	STMT_GET_ROWID,
+	STMT_GET_SYSTEM_ID,
+	STMT_ADD_SYSTEM,
+	STMT_GET_SYSTEM_STATS,
+
+	CACHED_STATEMENT_COUNT
+};
+
+std::string cached_statement_sql(CachedStatement id)
+{
+	switch(id)
+	{
+	case STMT_GET_FILE_DATA:
+		return "SELECT * FROM files WHERE fileid = ?1 AND systemid = ?2";
+	case STMT_UPDATE_FILE_DATA:
+		{
+			// same parameters as STMT_INSERT_FILE_DATA
+			std::stringstream ss;
+			ss << "UPDATE files SET filetype = ?3, fileexists = ?4, parentid = ?5, depth = ?6";
+
+			const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
+			for(unsigned int i = 0; i < mdd.size(); i++)
+				ss << ", " << mdd.at(i).key << " = ?" << i + RESERVED_COLUMNS + 1;
+
+			ss << " WHERE fileid = ?1 AND systemid = ?2";
+			return ss.str();
+		}
+	case STMT_INSERT_FILE_DATA:
+		{
+			std::stringstream ss;
+			ss << "INSERT INTO files VALUES (?1, ?2, ?3, ?4, ?5, ?6, ";
+
+			const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
+			for(unsigned int i = 0; i < mdd.size(); i++)
+			{
+				ss << "?" << i + RESERVED_COLUMNS + 1;
+
+				if(i + 1 < mdd.size())
+					ss << ", ";
+			}
+			ss << ")";
+			return ss.str();
+		}
+	case STMT_GET_FILE_TAGS:
+		return "SELECT tag FROM filetags WHERE filerowid = (SELECT rowid FROM files WHERE fileid = ?1 AND systemid = ?2)";
+	case STMT_ADD_FILE_TAG:
+		return "INSERT OR IGNORE INTO filetags (filerowid, tag) SELECT rowid, ?3 FROM files WHERE fileid = ?1 AND systemid = ?2";
+	case STMT_REMOVE_FILE_TAG:
+		return "DELETE FROM filetags WHERE filerowid = (SELECT rowid FROM files WHERE fileid = ?1 AND systemid = ?2) AND tag = ?3";
+	case STMT_UPDATE_EXISTS:
+		return "UPDATE files SET fileexists = ?1 WHERE fileid = ?2 AND systemid = ?3";
+	case STMT_REMOVE_ENTRY:
+		return "DELETE FROM files WHERE fileid = ?1 AND systemid = ?2";
+	case STMT_GET_FILE_BY_ROWID:
+		return "SELECT fileid, systemid, name, filetype FROM files WHERE rowid = ?1";
+	case STMT_GET_ROWID:
+		return "SELECT rowid FROM files WHERE fileid = ?1 AND systemid = ?2";
+	case STMT_GET_SYSTEM_ID:
+		return "SELECT id FROM systems WHERE name = ?1";
+	case STMT_ADD_SYSTEM:
+		return "INSERT OR IGNORE INTO systems (name) VALUES (?1)";
+	case STMT_GET_SYSTEM_STATS:
+		// ?1 = NULL adds up all systems
+		return "SELECT SUM(games), SUM(images) FROM systemstats WHERE ?1 IS NULL OR systemid = ?1";
+	default:
+		throw DBException() << "Unknown cached statement " << id;
+	}
+}
+
+sqlite3_stmt* prepare_stmt(sqlite3* db, const char* stmt)
+{
+	sqlite3_stmt* out = NULL;
+	if(sqlite3_prepare_v2(db, stmt, strlen(stmt), &out, NULL))
+		throw DBException() << "Error creating prepared stmt \"" << stmt << "\".\n\t" << sqlite3_errmsg(db);
+
+	return out;
+}
+
+// the same settings for every connection: the page cache and memory mapping are per connection, and with WAL
+// (see openDB) a commit only has to wait for the disk at checkpoints
+// (GAMELISTDB_DEFAULT_PRAGMAS keeps SQLite's defaults and the rollback journal instead, for benchmarks/)
+void tune_connection(sqlite3* db)
+{
+#ifndef GAMELISTDB_DEFAULT_PRAGMAS
+	std::stringstream ss;
+	ss << "PRAGMA synchronous = NORMAL; PRAGMA temp_store = MEMORY; PRAGMA cache_size = -" << CACHE_SIZE_KB << "; PRAGMA mmap_size = " << MMAP_SIZE;
+	if(sqlite3_exec(db, ss.str().c_str(), NULL, NULL, NULL))
+		throw DBException() << "Could not configure database connection.\n\t" << sqlite3_errmsg(db);
+#endif
+
+	sqlite3_busy_timeout(db, BUSY_TIMEOUT_MS);
+}
+
+// the file a connection's database lives in, empty for in-memory and temporary databases
+std::string db_file_path(sqlite3* db)
+{
+	const char* path = sqlite3_db_filename(db, "main");
+	return path ? path : "";
+}
+
+// Keeps prepared statements around so their SQL only has to be parsed once.
+// The hot statements above live in a fixed table; dynamically built queries are kept
+// in a small LRU list keyed by their SQL text.
+// A statement can only be handed out once at a time (acquire returns NULL while it's in use).
+class SQLStatementCache
+{
+public:
+	struct Entry
+	{
+		Entry() : stmt(NULL), inUse(false) {}
+
+		sqlite3_stmt* stmt;
+		bool inUse;
+	};
+
+	SQLStatementCache(sqlite3* db) : mDB(db) {}
+
+	~SQLStatementCache() {
+		for(unsigned int i = 0; i < CACHED_STATEMENT_COUNT; i++)
+			sqlite3_finalize(mHot[i].stmt);
+		for(auto it = mQueries.begin(); it != mQueries.end(); it++)
+			sqlite3_finalize(it->second.stmt);
+	}
+
+	inline sqlite3* getDB() const { return mDB; }
+
+	Entry* acquire(CachedStatement id) {
+		Entry& entry = mHot[id];
+		if(!entry.stmt)
+			entry.stmt = prepare_stmt(mDB, cached_statement_sql(id).c_str());
+
+		return take(entry);
+	}
+
+	Entry* acquire(const std::string& sql) {
+		auto found = mQueryMap.find(sql);
+		if(found != mQueryMap.end())
+		{
+			// most recently used goes to the front
+			mQueries.splice(mQueries.begin(), mQueries, found->second);
+			return take(found->second->second);
+		}
+
+		Entry entry;
+		entry.stmt = prepare_stmt(mDB, sql.c_str());
+		mQueries.push_front(std::make_pair(sql, entry));
+		mQueryMap[sql] = mQueries.begin();
+
+		// evict the least recently used queries that aren't currently being stepped through
+		auto it = mQueries.end();
+		while(mQueries.size() > MAX_CACHED_QUERIES && it != mQueries.begin())
+		{
+			--it;
+			if(it->second.inUse)
+				continue;
+
+			sqlite3_finalize(it->second.stmt);
+			mQueryMap.erase(it->first);
+			it = mQueries.erase(it);
+		}
+
+		return take(mQueries.front().second);
+	}
+
+	// resets the statement so it can be handed out again
+	static void release(Entry* entry) {
+		sqlite3_reset(entry->stmt);
+		sqlite3_clear_bindings(entry->stmt);
+		entry->inUse = false;
+	}
+
+private:
+	static Entry* take(Entry& entry) {
+		if(entry.inUse)
+			return NULL;
+
+		entry.inUse = true;
+		return &entry;
+	}
+
+	typedef std::list< std::pair<std::string, Entry> > QueryList;
+
+	sqlite3* mDB;
+	Entry mHot[CACHED_STATEMENT_COUNT];
+	QueryList mQueries;
+	std::map<std::string, QueryList::iterator> mQueryMap;
+};
+
 // super simple RAII wrapper for sqlite3
 // prepared statement, can be used just like an sqlite3_stmt* thanks to overloaded operator
+// statements borrowed from an SQLStatementCache are reset and given back instead of finalized
+// (if the cached one is already busy, e.g. in a nested call, a temporary one is prepared)
 class SQLPreparedStmt
 {
 public:
-	SQLPreparedStmt(sqlite3* db, const char* stmt) : mDB(db), mStmt(NULL) {
-		if(sqlite3_prepare_v2(db, stmt, strlen(stmt), &mStmt, NULL))
-			throw DBException() << "Error creating prepared stmt \"" << stmt << "\".\n\t" << sqlite3_errmsg(db);
-	}
+	SQLPreparedStmt(sqlite3* db, const char* stmt) : mDB(db), mStmt(prepare_stmt(db, stmt)), mCacheEntry(NULL) {}
 
 	SQLPreparedStmt(sqlite3* db, const std::string& stmt) : SQLPreparedStmt(db, stmt.c_str()) {};
 
+	SQLPreparedStmt(SQLStatementCache& cache, CachedStatement id) : mDB(cache.getDB()), mStmt(NULL), mCacheEntry(cache.acquire(id)) {
+		mStmt = mCacheEntry ? mCacheEntry->stmt : prepare_stmt(mDB, cached_statement_sql(id).c_str());
+	}
+
+	SQLPreparedStmt(SQLStatementCache& cache, const std::string& stmt) : mDB(cache.getDB()), mStmt(NULL), mCacheEntry(cache.acquire(stmt)) {
+		mStmt = mCacheEntry ? mCacheEntry->stmt : prepare_stmt(mDB, stmt.c_str());
+	}
+
 	int step() { return sqlite3_step(mStmt); }
 
 	void step_expected(int expected) {
@@ -78,7 +357,9 @@ public:
 	}
 
 	~SQLPreparedStmt() {
-		if(mStmt)
+		if(mCacheEntry)
+			SQLStatementCache::release(mCacheEntry);
+		else if(mStmt)
 			sqlite3_finalize(mStmt);
 	}
 
@@ -87,6 +368,7 @@ public:
 private:
 	sqlite3* mDB; // used for error messages
 	sqlite3_stmt* mStmt;
+	SQLStatementCache::Entry* mCacheEntry;
 };
 
 // encapsulates a transaction that cannot outlive the lifetime of this object
@@ -118,7 +400,60 @@ private:
 };
 
 
-GamelistDB::GamelistDB(const std::string& path) : mDB(NULL)
+// Read-only connections that background threads can borrow (see GamelistDB::withReadConnection).
+// Connections are opened as needed and kept open for the next borrower once they're given back.
+class SQLReadPool
+{
+public:
+	SQLReadPool(const std::string& path) : mPath(path) {}
+
+	~SQLReadPool() {
+		for(auto it = mIdle.begin(); it != mIdle.end(); it++)
+			sqlite3_close(*it);
+	}
+
+	sqlite3* acquire() {
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			if(!mIdle.empty())
+			{
+				sqlite3* db = mIdle.back();
+				mIdle.pop_back();
+				return db;
+			}
+		}
+
+		sqlite3* db = NULL;
+		if(sqlite3_open_v2(mPath.c_str(), &db, SQLITE_OPEN_READONLY, NULL))
+		{
+			const std::string error = db ? sqlite3_errmsg(db) : "out of memory";
+			sqlite3_close(db);
+			throw DBException() << "Could not open database \"" << mPath << "\" for reading.\n\t" << error;
+		}
+
+		try
+		{
+			tune_connection(db);
+		}catch(...)
+		{
+			sqlite3_close(db);
+			throw;
+		}
+		return db;
+	}
+
+	void release(sqlite3* db) {
+		std::unique_lock<std::mutex> lock(mMutex);
+		mIdle.push_back(db);
+	}
+
+private:
+	std::string mPath;
+	std::mutex mMutex;
+	std::vector<sqlite3*> mIdle;
+};
+
+GamelistDB::GamelistDB(const std::string& path) : mDB(NULL), mWriteDB(NULL), mFlushRequested(false), mStopWriter(false), mAnalyzedChanges(0)
 {
 	openDB(path.c_str());
 }
@@ -214,22 +549,221 @@ void GamelistDB::openDB(const char* path)
 			"\t" << sqlite3_errmsg(mDB);
 	}
 
+	mStatementCache = std::unique_ptr<SQLStatementCache>(new SQLStatementCache(mDB));
+
+	// with WAL, readers see the last commit instead of waiting for the writer thread (and the other way around)
+#ifndef GAMELISTDB_DEFAULT_PRAGMAS
+	if(!db_file_path(mDB).empty())
+	{
+		SQLPreparedStmt walStmt(mDB, "PRAGMA journal_mode = WAL");
+		if(walStmt.step() != SQLITE_ROW || strcmp((const char*)sqlite3_column_text(walStmt, 0), "wal") != 0)
+			LOG(LogWarning) << "Could not switch database \"" << path << "\" to WAL, readers will wait for writes.";
+	}
+#endif
+	tune_connection(mDB);
+
 	// register custom functions to handle directory comparisons
+	// (no longer used internally since files has a parentid column, but filter queries may still use them)
 	if(sqlite3_create_function_v2(mDB, "inimmediatedir", 2, SQLITE_UTF8 | SQLITE_DETERMINISTIC, NULL, &sqlite_inimmediatedir, NULL, NULL, NULL))
 		throw DBException() << "Could not register indir function.\n\t" << sqlite3_errmsg(mDB);
 	if(sqlite3_create_function_v2(mDB, "indir", 2, SQLITE_UTF8 | SQLITE_DETERMINISTIC, NULL, &sqlite_indir, NULL, NULL, NULL))
 		throw DBException() << "Could not register indir function.\n\t" << sqlite3_errmsg(mDB);
 
+	// INSERT OR REPLACE only fires the delete triggers that keep files_search in sync with this on
+	if(sqlite3_exec(mDB, "PRAGMA recursive_triggers = ON", NULL, NULL, NULL))
+		throw DBException() << "Could not enable recursive triggers.\n\t" << sqlite3_errmsg(mDB);
+
 	createMissingTables();
 
 	if(!hasValidSchema())
 		recreateTables();
+
+	createIndexes();
+	createSearchIndex();
+	createStats();
+	migrateTags();
+
+	mAnalyzedChanges = totalChanges();
+
+	openWriter();
+
+	// an in-memory or temporary database has no file to open more connections to
+	if(!db_file_path(mDB).empty())
+		mReadPool = std::unique_ptr<SQLReadPool>(new SQLReadPool(db_file_path(mDB)));
+}
+
+void GamelistDB::openWriter()
+{
+	// an in-memory or temporary database has no file to open a second connection to
+	const std::string path = db_file_path(mDB);
+	if(path.empty())
+		return;
+
+	if(sqlite3_open_v2(path.c_str(), &mWriteDB, SQLITE_OPEN_READWRITE, NULL))
+	{
+		LOG(LogWarning) << "Could not open a second connection to \"" << path << "\", writes won't be queued.\n\t" << sqlite3_errmsg(mWriteDB);
+		sqlite3_close(mWriteDB);
+		mWriteDB = NULL;
+		return;
+	}
+
+	tune_connection(mWriteDB);
+	mWriteCache = std::unique_ptr<SQLStatementCache>(new SQLStatementCache(mWriteDB));
+	mWriter = std::thread(&GamelistDB::runWriter, this);
+}
+
+void GamelistDB::closeWriter()
+{
+	if(!mWriteDB)
+		return;
+
+	{
+		std::unique_lock<std::mutex> lock(mWriteMutex);
+		mStopWriter = true;
+	}
+	mWriteQueued.notify_all();
+	mWriter.join(); // commits what's left first
+
+	mWriteCache.reset();
+	sqlite3_close(mWriteDB);
+	mWriteDB = NULL;
+}
+
+void GamelistDB::runWriter()
+{
+	int failedAttempts = 0; // in a row, for the batch at the front of the queue
+	std::unique_lock<std::mutex> lock(mWriteMutex);
+	while(!mStopWriter || !mWriteQueue.empty())
+	{
+		if(mWriteQueue.empty())
+		{
+			mWriteQueued.wait(lock);
+			continue;
+		}
+
+		// writes that come in shortly after go into the same transaction
+		mWriteQueued.wait_for(lock, std::chrono::milliseconds(WRITE_BEHIND_MS), [this] { return mFlushRequested || mStopWriter; });
+		mWritesInFlight.swap(mWriteQueue);
+		lock.unlock();
+
+		const bool committed = commitWrites();
+
+		lock.lock();
+		if(!committed && ++failedAttempts < WRITE_ATTEMPTS)
+		{
+			// back in front of whatever was queued since, so they still go in in order
+			mWriteQueue.insert(mWriteQueue.begin(), mWritesInFlight.begin(), mWritesInFlight.end());
+			mWritesInFlight.clear();
+			continue;
+		}
+
+		if(!committed)
+			LOG(LogError) << "Giving up on " << mWritesInFlight.size() << " queued database writes after " << WRITE_ATTEMPTS << " attempts!";
+
+		failedAttempts = 0;
+		mWritesInFlight.clear();
+		mWritesDone.notify_all();
+	}
+}
+
+bool GamelistDB::commitWrites()
+{
+	// IMMEDIATE takes the write lock right away, so a busy database fails here rather than halfway through
+	if(sqlite3_exec(mWriteDB, "BEGIN IMMEDIATE TRANSACTION", NULL, NULL, NULL))
+	{
+		LOG(LogWarning) << "Could not start writing " << mWritesInFlight.size() << " queued database writes:\n\t" << sqlite3_errmsg(mWriteDB);
+		return false;
+	}
+
+	for(auto it = mWritesInFlight.begin(); it != mWritesInFlight.end(); it++)
+	{
+		try
+		{
+			applyWrite(*mWriteCache, *it);
+		}catch(std::exception& e)
+		{
+			const int error = sqlite3_errcode(mWriteDB);
+			if(error == SQLITE_BUSY || error == SQLITE_LOCKED || error == SQLITE_FULL || error == SQLITE_IOERR)
+			{
+				// not this write's fault, the whole batch gets tried again
+				LOG(LogWarning) << "Could not write " << mWritesInFlight.size() << " queued database writes:\n\t" << e.what();
+				sqlite3_exec(mWriteDB, "ROLLBACK TRANSACTION", NULL, NULL, NULL);
+				return false;
+			}
+
+			// the others still go in
+			LOG(LogError) << "Could not write \"" << it->fileID << "\" to the database:\n\t" << e.what();
+		}
+	}
+
+	if(sqlite3_exec(mWriteDB, "COMMIT TRANSACTION", NULL, NULL, NULL))
+	{
+		LOG(LogWarning) << "Could not commit " << mWritesInFlight.size() << " queued database writes:\n\t" << sqlite3_errmsg(mWriteDB);
+		sqlite3_exec(mWriteDB, "ROLLBACK TRANSACTION", NULL, NULL, NULL);
+		return false;
+	}
+
+	return true;
+}
+
+void GamelistDB::queueWrite(const PendingWrite& write)
+{
+	if(!mWriteDB)
+	{
+		applyWrite(*mStatementCache, write);
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mWriteMutex);
+		mWriteQueue.push_back(write);
+	}
+	mWriteQueued.notify_all();
+}
+
+void GamelistDB::flushWrites()
+{
+	std::unique_lock<std::mutex> lock(mWriteMutex);
+	if(mWriteQueue.empty() && mWritesInFlight.empty())
+		return;
+
+	mFlushRequested = true;
+	mWriteQueued.notify_all();
+	mWritesDone.wait(lock, [this] { return mWriteQueue.empty() && mWritesInFlight.empty(); });
+	mFlushRequested = false;
+}
+
+void GamelistDB::forEachPendingWrite(const std::string& fileID, int systemId, const std::function<void(const PendingWrite&)>& f) const
+{
+	for(auto it = mWritesInFlight.begin(); it != mWritesInFlight.end(); it++)
+	{
+		if(it->systemId == systemId && it->fileID == fileID)
+			f(*it);
+	}
+	for(auto it = mWriteQueue.begin(); it != mWriteQueue.end(); it++)
+	{
+		if(it->systemId == systemId && it->fileID == fileID)
+			f(*it);
+	}
 }
 
 void GamelistDB::closeDB()
 {
+	// while the writer's changes still count
+	if(mDB)
+	{
+		flushWrites();
+		updateStatistics();
+	}
+
+	closeWriter();
+	mReadPool.reset();
+
 	if(mDB)
 	{
+
+		// statements have to be finalized before the connection can be closed
+		mStatementCache.reset();
 		sqlite3_close(mDB);
 		mDB = NULL;
 	}
@@ -239,12 +773,18 @@ void GamelistDB::createMissingTables()
 {
 	const std::vector<MetaDataDecl>& decl = getMDDMap().at(GAME_METADATA);
 
+	// system names are only stored once, everything else refers to them by id
+	if(sqlite3_exec(mDB, "CREATE TABLE IF NOT EXISTS systems (id INTEGER PRIMARY KEY, name VARCHAR(255) NOT NULL UNIQUE)", NULL, NULL, NULL))
+		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
+
 	std::stringstream ss;
 	ss << "CREATE TABLE IF NOT EXISTS files (" <<
 		"fileid VARCHAR(255) NOT NULL, " <<
-		"systemid VARCHAR(255) NOT NULL, " <<
+		"systemid INT NOT NULL, " <<
 		"filetype INT NOT NULL, " <<
-		"fileexists BOOLEAN, ";
+		"fileexists BOOLEAN, " <<
+		"parentid VARCHAR(255), " <<
+		"depth INT, ";
 	for(auto it = decl.begin(); it != decl.end(); it++)
 	{
 		// format here is "[key] [type] DEFAULT [default_value],"
@@ -290,10 +830,27 @@ void GamelistDB::createMissingTables()
 	if(sqlite3_exec(mDB, ss.str().c_str(), NULL, NULL, NULL))
 		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
 
-	if(sqlite3_exec(mDB, "CREATE TABLE IF NOT EXISTS tagtable (fileid VARCHAR(255) NOT NULL, systemid VARCHAR(255) NOT NULL, tag VARCHAR(255) NOT NULL, PRIMARY KEY (fileid, systemid, tag), FOREIGN KEY(fileid,systemid) REFERENCES files(fileid,systemid))", NULL, NULL, NULL))
+	if(sqlite3_exec(mDB, "CREATE TABLE IF NOT EXISTS filetags (filerowid INTEGER NOT NULL, tag VARCHAR(255) NOT NULL, PRIMARY KEY (filerowid, tag))", NULL, NULL, NULL))
+		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
+	if(sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_tags_delete AFTER DELETE ON files BEGIN "
+			"DELETE FROM filetags WHERE filerowid = old.rowid; END", NULL, NULL, NULL))
+		throw DBException() << "Error creating trigger!\n\t" << sqlite3_errmsg(mDB);
+
+	// what each directory looked like the last time it was scanned (see FileScanner)
+	// mtime/entries are written by addMissingFiles, checkedmtime by updateExists
+	if(sqlite3_exec(mDB, "CREATE TABLE IF NOT EXISTS dirsnapshots (systemid INT NOT NULL, path VARCHAR(255) NOT NULL, parent VARCHAR(255), name VARCHAR(255), mtime INT, entries INT, checkedmtime INT, PRIMARY KEY (systemid, path))", NULL, NULL, NULL))
+		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
+	// snapshots are only valid for the start path and extensions they were taken with
+	if(sqlite3_exec(mDB, "CREATE TABLE IF NOT EXISTS snapshotconfigs (systemid INT NOT NULL PRIMARY KEY, config VARCHAR(255))", NULL, NULL, NULL))
 		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
+	// a removed row would never come back if its directory kept matching the snapshot, so the directory it was in
+	// (and the folder itself, if it was one) gets listed again on the next scan
+	if(sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_snapshots_delete AFTER DELETE ON files BEGIN "
+			"DELETE FROM dirsnapshots WHERE systemid = old.systemid AND (path = old.parentid OR path = old.fileid); END", NULL, NULL, NULL))
+		throw DBException() << "Error creating trigger!\n\t" << sqlite3_errmsg(mDB);
+
 	sqlite3_exec(mDB, "DROP VIEW tags", NULL, NULL, NULL);
-	if(sqlite3_exec(mDB, "CREATE VIEW IF NOT EXISTS tags (tag) as select tag from tagtable where tagtable.fileid = files.fileid and tagtable.systemid = files.systemid", NULL, NULL, NULL))
+	if(sqlite3_exec(mDB, "CREATE VIEW IF NOT EXISTS tags (tag) as select tag from filetags where filetags.filerowid = files.rowid", NULL, NULL, NULL))
 		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
 }
 
@@ -313,6 +870,20 @@ std::vector<std::string> get_columns(sqlite3* db, const std::string& table_name)
 	return columns;
 }
 
+// returns the declared type of a column, empty if there's no such column
+std::string get_column_type(sqlite3* db, const std::string& table_name, const std::string& column)
+{
+	std::string query = "PRAGMA table_info(" + table_name + ")";
+	SQLPreparedStmt stmt(db, query);
+	while(stmt.step() == SQLITE_ROW)
+	{
+		if(column == (const char*)sqlite3_column_text(stmt, 1))
+			return (const char*)sqlite3_column_text(stmt, 2);
+	}
+
+	return "";
+}
+
 // returns a vector of all columns common to all supplied tables
 // order is not preserved!
 std::vector<std::string> get_common_columns(sqlite3* db, const std::vector<std::string>& table_names)
@@ -348,6 +919,13 @@ bool GamelistDB::hasValidSchema() const
 	if(columns.size() != RESERVED_COLUMNS + decl.size())
 		return false;
 
+	if(columns[COL_PARENTID] != "parentid" || columns[COL_DEPTH] != "depth")
+		return false;
+
+	// system IDs used to be names
+	if(get_column_type(mDB, "files", "systemid") != "INT")
+		return false;
+
 	for(unsigned int i = 0; i < decl.size(); i++)
 	{
 		if(columns[RESERVED_COLUMNS + i] != decl.at(i).key)
@@ -360,147 +938,430 @@ bool GamelistDB::hasValidSchema() const
 	return true;
 }
 
-void GamelistDB::recreateTables()
+void GamelistDB::createIndexes()
 {
-	LOG(LogInfo) << "Re-creating files table...";
-
-	if(sqlite3_exec(mDB, "ALTER TABLE files RENAME TO files_old", NULL, NULL, NULL))
-		throw DBException() << "Existing table could not be renamed!";
-
-	createMissingTables();
+	// covers getChildrenOf() for a single directory
+	if(sqlite3_exec(mDB, "CREATE INDEX IF NOT EXISTS files_children ON files (systemid, parentid, filetype, name, fileid)", NULL, NULL, NULL))
+		throw DBException() << "Error creating index!\n\t" << sqlite3_errmsg(mDB);
+	// recursive lookups are a range of file IDs within a system
+	if(sqlite3_exec(mDB, "CREATE INDEX IF NOT EXISTS files_paths ON files (systemid, fileid)", NULL, NULL, NULL))
+		throw DBException() << "Error creating index!\n\t" << sqlite3_errmsg(mDB);
+	// name prefix lookups within a directory (jump to letter, search), also the default sort order
+	if(sqlite3_exec(mDB, "CREATE INDEX IF NOT EXISTS files_names ON files (systemid, parentid, LOWER(name))", NULL, NULL, NULL))
+		throw DBException() << "Error creating index!\n\t" << sqlite3_errmsg(mDB);
+}
 
-	std::vector<std::string> common_cols = get_common_columns(mDB, { "files", "files_old" });
-	std::stringstream ss;
-	for(unsigned int i = 0; i < common_cols.size(); i++)
+void GamelistDB::createSearchIndex()
+{
+	std::string sql;
 	{
-		ss << common_cols.at(i) << (i + 1 < common_cols.size() ? ", " : "");
+		SQLPreparedStmt stmt(mDB, "SELECT sql FROM sqlite_master WHERE type = 'table' AND name = 'files_search'");
+		if(stmt.step() == SQLITE_ROW)
+			sql = (const char*)sqlite3_column_text(stmt, 0);
 	}
 
-	std::string copy = "INSERT INTO files (" + ss.str() + ") SELECT " + ss.str() + " FROM files_old";
-	if(sqlite3_exec(mDB, copy.c_str(), NULL, NULL, NULL))
-		throw DBException() << "Error copying into new table!";
-
-	if(sqlite3_exec(mDB, "DROP TABLE files_old", NULL, NULL, NULL))
-		throw DBException() << "Error dropping old table!";
-
-	LOG(LogInfo) << "Recreated files table successfully!";
+	// the prefix indexes can't be changed, an index from an older version is built again
+	if(!sql.empty() && sql.find("prefix='" SEARCH_PREFIXES "'") == std::string::npos)
+	{
+		LOG(LogInfo) << "Search index has old prefix settings, dropping it...";
+		dropSearchIndex();
+		sql.clear();
+	}
+	const bool exists = !sql.empty();
+
+	// external content table, so the text isn't stored twice
+	// prefix indexes make the "word*" queries fts_query() builds fast for short words
+	if(sqlite3_exec(mDB, "CREATE VIRTUAL TABLE IF NOT EXISTS files_search USING fts5(" SEARCH_COLUMNS ", content='files', content_rowid='rowid', prefix='" SEARCH_PREFIXES "')", NULL, NULL, NULL))
+		throw DBException() << "Error creating search index!\n\t" << sqlite3_errmsg(mDB);
+
+	if(sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_search_insert AFTER INSERT ON files BEGIN "
+			"INSERT INTO files_search (rowid, " SEARCH_COLUMNS ") VALUES (" SEARCH_NEW_VALUES "); END", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_search_delete AFTER DELETE ON files BEGIN "
+			"INSERT INTO files_search (files_search, rowid, " SEARCH_COLUMNS ") VALUES ('delete', " SEARCH_OLD_VALUES "); END", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_search_update AFTER UPDATE OF " SEARCH_COLUMNS " ON files BEGIN "
+			"INSERT INTO files_search (files_search, rowid, " SEARCH_COLUMNS ") VALUES ('delete', " SEARCH_OLD_VALUES "); "
+			"INSERT INTO files_search (rowid, " SEARCH_COLUMNS ") VALUES (" SEARCH_NEW_VALUES "); END", NULL, NULL, NULL))
+		throw DBException() << "Error creating search triggers!\n\t" << sqlite3_errmsg(mDB);
+
+	if(!exists)
+	{
+		LOG(LogInfo) << "Building search index...";
+		if(sqlite3_exec(mDB, "INSERT INTO files_search (files_search) VALUES ('rebuild')", NULL, NULL, NULL))
+			throw DBException() << "Error building search index!\n\t" << sqlite3_errmsg(mDB);
+	}
 }
 
-// used by populate_recursive to insert a single file into the database
-// assumes insert_stmt already has system ID set, and that
-// ?1 = fileid and ?2 = filetype
-void add_file(const char* fileid, FileType filetype, const SystemData* system, sqlite3* db, sqlite3_stmt* insert_stmt)
+void GamelistDB::createStats()
 {
-	if(sqlite3_bind_text(insert_stmt, 1, fileid, strlen(fileid), SQLITE_STATIC))
-		throw DBException() << "Error binding fileid in populate().\n\t" << sqlite3_errmsg(db);
-
-	if(sqlite3_bind_int(insert_stmt, 2, filetype))
-		throw DBException() << "Error binding filetype in populate().\n\t" << sqlite3_errmsg(db);
-
-	std::string clean_name = getCleanGameName(fileid, system);
-	if(sqlite3_bind_text(insert_stmt, 3, clean_name.c_str(), clean_name.size(), SQLITE_STATIC))
-		throw DBException() << "Error binding name in populate().\n\t" << sqlite3_errmsg(db);
+	bool exists;
+	{
+		SQLPreparedStmt stmt(mDB, "SELECT EXISTS(SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'systemstats')");
+		stmt.step_expected(SQLITE_ROW);
+		exists = (sqlite3_column_int(stmt, 0) != 0);
+	}
 
-	if(sqlite3_step(insert_stmt) != SQLITE_DONE)
-		throw DBException() << "Error adding file \"" << fileid << "\" in populate().\n\t" << sqlite3_errmsg(db);
+	if(sqlite3_exec(mDB, "CREATE TABLE IF NOT EXISTS systemstats (systemid INTEGER PRIMARY KEY, games INT NOT NULL DEFAULT 0, "
+			"folders INT NOT NULL DEFAULT 0, images INT NOT NULL DEFAULT 0, changes INT NOT NULL DEFAULT 0)", NULL, NULL, NULL))
+		throw DBException() << "Error creating table!\n\t" << sqlite3_errmsg(mDB);
 
-	if(sqlite3_reset(insert_stmt))
-		throw DBException() << "Error resetting statement for \"" << fileid << "\" in populate().\n\t" << sqlite3_errmsg(db);
+	// a row's systemid never changes, updates only have to move it between the counts of one system
+	if(sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_stats_insert AFTER INSERT ON files BEGIN "
+			"INSERT OR IGNORE INTO systemstats (systemid) VALUES (new.systemid); "
+			"UPDATE systemstats SET games = games + " STATS_GAMES("new") ", folders = folders + " STATS_FOLDERS("new") ", "
+			"images = images + " STATS_IMAGES("new") ", changes = changes + 1 WHERE systemid = new.systemid; END", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_stats_delete AFTER DELETE ON files BEGIN "
+			"UPDATE systemstats SET games = games - " STATS_GAMES("old") ", folders = folders - " STATS_FOLDERS("old") ", "
+			"images = images - " STATS_IMAGES("old") ", changes = changes + 1 WHERE systemid = old.systemid; END", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "CREATE TRIGGER IF NOT EXISTS files_stats_update AFTER UPDATE ON files BEGIN "
+			"UPDATE systemstats SET games = games + " STATS_GAMES("new") " - " STATS_GAMES("old") ", "
+			"folders = folders + " STATS_FOLDERS("new") " - " STATS_FOLDERS("old") ", "
+			"images = images + " STATS_IMAGES("new") " - " STATS_IMAGES("old") ", changes = changes + 1 WHERE systemid = new.systemid; END", NULL, NULL, NULL))
+		throw DBException() << "Error creating stats triggers!\n\t" << sqlite3_errmsg(mDB);
+
+	if(!exists)
+	{
+		LOG(LogInfo) << "Counting files...";
+		if(sqlite3_exec(mDB, "INSERT INTO systemstats (systemid, games, folders, images) SELECT systemid, "
+				"SUM" STATS_GAMES("files") ", SUM" STATS_FOLDERS("files") ", SUM" STATS_IMAGES("files") " FROM files GROUP BY systemid", NULL, NULL, NULL))
+			throw DBException() << "Error counting files!\n\t" << sqlite3_errmsg(mDB);
+	}
 }
 
-// what this does:
-// - if we add at least one valid file in this folder, return true.
-// - given a folder (start_dir), go through all the files and folders in it.
-// - if it's a file, check if its extension matches our list (extensions),
-//   adding it to the "files" table if it does (filetype = game).
-//   also mark this folder as having a file.
-// - if it's a folder, recurse into it. if that recursion returns true, also mark this folder as having a file.
-// - if this folder is marked as having a file at return time, add it to the database.
-
-bool populate_recursive(const fs::path& relativeTo, const std::vector<std::string>& extensions, 
-	const fs::path& start_dir, const SystemData* system, sqlite3* db, sqlite3_stmt* insert_stmt)
+void GamelistDB::migrateTags()
 {
-	// make sure that this isn't a symlink to a thing we already have
-	if(fs::is_symlink(start_dir))
 	{
-		// if this symlink resolves to somewhere that's at the beginning of our path, it's gonna recurse
-		if(start_dir.generic_string().find(fs::canonical(start_dir).generic_string()) == 0)
-		{
-			LOG(LogWarning) << "Skipping infinitely recursive symlink \"" << start_dir << "\"";
-			return false;
-		}
+		SQLPreparedStmt stmt(mDB, "SELECT EXISTS(SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'tagtable')");
+		stmt.step_expected(SQLITE_ROW);
+		if(sqlite3_column_int(stmt, 0) == 0)
+			return;
 	}
 
-	bool has_a_file = false;
-	for(fs::directory_iterator end, dir(start_dir); dir != end; ++dir)
-	{
-		// fyi, folders *can* also match the extension and be added as games - this is mostly just to support higan
-		// see issue #75: https://github.com/Aloshi/EmulationStation/issues/75
+	LOG(LogInfo) << "Moving tags to filetags...";
 
-		fs::path path = *dir;
+	// tags of files that aren't in the database anymore are dropped
+	SQLTransaction transaction(mDB);
+	if(sqlite3_exec(mDB, "INSERT OR IGNORE INTO filetags (filerowid, tag) SELECT files.rowid, tagtable.tag FROM tagtable "
+			"JOIN systems ON systems.name = tagtable.systemid JOIN files ON files.systemid = systems.id AND files.fileid = tagtable.fileid", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "DROP TABLE tagtable", NULL, NULL, NULL))
+		throw DBException() << "Error moving tags!\n\t" << sqlite3_errmsg(mDB);
+	transaction.commit();
+}
 
-		// if the extension is on our list
-		if(std::find(extensions.begin(), extensions.end(), path.extension().string()) != extensions.end())
-		{
-			// yep, it's a game: add it
-			const std::string fileid = pathToFileID(path, relativeTo);
-			add_file(fileid.c_str(), FileType::GAME, system, db, insert_stmt);
-			has_a_file = true;
-		}else{
-			// it's not a game, if it's a directory check if it contains any games
-			if(fs::is_directory(*dir))
-			{
-				// if it did have some games, add this directory to the DB later
-				if(populate_recursive(relativeTo, extensions, *dir, system, db, insert_stmt))
-					has_a_file = true;
-			}
-		}
-	}
+// Keeps the query planner's statistics (sqlite_stat1) in line with how many files each system and directory has.
+// This is what PRAGMA optimize does on newer SQLite versions than the one we ship.
+void GamelistDB::updateStatistics()
+{
+	const int changes = totalChanges();
+	if(changes - mAnalyzedChanges < ANALYZE_AFTER_CHANGES)
+		return;
 
-	if(has_a_file)
-	{
-		// this folder had a game, add it to the DB
-		std::string fileid = pathToFileID(start_dir, relativeTo);
-		add_file(fileid.c_str(), FileType::FOLDER, system, db, insert_stmt);
-	}
+	if(sqlite3_exec(mDB, "ANALYZE files", NULL, NULL, NULL))
+		LOG(LogWarning) << "Could not update database statistics.\n\t" << sqlite3_errmsg(mDB);
 
-	return has_a_file;
+	mAnalyzedChanges = changes;
 }
 
-void GamelistDB::addMissingFiles(const SystemData* system)
+void GamelistDB::dropSearchIndex()
 {
-	const std::string& relativeTo = system->getStartPath(); 
-	const std::vector<std::string>& extensions = system->getExtensions();
+	if(sqlite3_exec(mDB, "DROP TRIGGER IF EXISTS files_search_insert; DROP TRIGGER IF EXISTS files_search_delete; "
+			"DROP TRIGGER IF EXISTS files_search_update; DROP TABLE IF EXISTS files_search", NULL, NULL, NULL))
+		throw DBException() << "Existing search index could not be dropped!\n\t" << sqlite3_errmsg(mDB);
+}
+
+void GamelistDB::recreateTables()
+{
+	LOG(LogInfo) << "Re-creating files table...";
+
+	// the triggers would move to files_old with the rename, openDB() rebuilds the index afterwards
+	dropSearchIndex();
+
+	// indexes and triggers would move to files_old with the rename, and the tags view doesn't survive the rename check
+	if(sqlite3_exec(mDB, "DROP INDEX IF EXISTS files_children", NULL, NULL, NULL) || sqlite3_exec(mDB, "DROP INDEX IF EXISTS files_paths", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "DROP INDEX IF EXISTS files_names", NULL, NULL, NULL) || sqlite3_exec(mDB, "DROP TRIGGER IF EXISTS files_tags_delete", NULL, NULL, NULL) ||
+		sqlite3_exec(mDB, "DROP TRIGGER IF EXISTS files_snapshots_delete", NULL, NULL, NULL) || sqlite3_exec(mDB, "DROP VIEW IF EXISTS tags", NULL, NULL, NULL))
+		throw DBException() << "Existing index could not be dropped!";
+
+	// the counts are rebuilt from the new table by createStats()
+	if(sqlite3_exec(mDB, "DROP TRIGGER IF EXISTS files_stats_insert; DROP TRIGGER IF EXISTS files_stats_delete; "
+			"DROP TRIGGER IF EXISTS files_stats_update; DROP TABLE IF EXISTS systemstats", NULL, NULL, NULL))
+		throw DBException() << "Existing stats could not be dropped!\n\t" << sqlite3_errmsg(mDB);
+
+	if(sqlite3_exec(mDB, "ALTER TABLE files RENAME TO files_old", NULL, NULL, NULL))
+		throw DBException() << "Existing table could not be renamed!";
+
+	// system IDs used to be names, snapshots from back then are just thrown away (the next scan is a full one)
+	const bool namedSystems = (get_column_type(mDB, "files_old", "systemid") != "INT");
+	if(namedSystems)
+	{
+		if(sqlite3_exec(mDB, "DROP TABLE IF EXISTS dirsnapshots", NULL, NULL, NULL) || sqlite3_exec(mDB, "DROP TABLE IF EXISTS snapshotconfigs", NULL, NULL, NULL))
+			throw DBException() << "Error dropping old snapshots!\n\t" << sqlite3_errmsg(mDB);
+	}
+
+	createMissingTables();
+
+	if(namedSystems)
+	{
+		if(sqlite3_exec(mDB, "INSERT OR IGNORE INTO systems (name) SELECT DISTINCT systemid FROM files_old", NULL, NULL, NULL))
+			throw DBException() << "Error adding systems!\n\t" << sqlite3_errmsg(mDB);
+	}
+
+	std::vector<std::string> common_cols = get_common_columns(mDB, { "files", "files_old" });
+	std::stringstream ss;
+	std::stringstream values;
+	for(unsigned int i = 0; i < common_cols.size(); i++)
+	{
+		ss << common_cols.at(i) << (i + 1 < common_cols.size() ? ", " : "");
+		if(namedSystems && common_cols.at(i) == "systemid")
+			values << "(SELECT id FROM systems WHERE name = files_old.systemid)";
+		else
+			values << common_cols.at(i);
+		values << (i + 1 < common_cols.size() ? ", " : "");
+	}
+
+	// rowids are kept, tags refer to them
+	std::string copy = "INSERT INTO files (rowid, " + ss.str() + ") SELECT rowid, " + values.str() + " FROM files_old";
+	if(sqlite3_exec(mDB, copy.c_str(), NULL, NULL, NULL))
+		throw DBException() << "Error copying into new table!";
+
+	if(sqlite3_exec(mDB, "DROP TABLE files_old", NULL, NULL, NULL))
+		throw DBException() << "Error dropping old table!";
+
+	// fill in parentid/depth for databases from before those columns existed
+	if(std::find(common_cols.begin(), common_cols.end(), "parentid") == common_cols.end())
+	{
+		SQLPreparedStmt readStmt(mDB, "SELECT rowid, fileid FROM files");
+		SQLPreparedStmt updateStmt(mDB, "UPDATE files SET parentid = ?1, depth = ?2 WHERE rowid = ?3");
+
+		SQLTransaction transaction(mDB);
+		while(readStmt.step() != SQLITE_DONE)
+		{
+			bind_parent(updateStmt, 1, (const char*)sqlite3_column_text(readStmt, 1));
+			sqlite3_bind_int64(updateStmt, 3, sqlite3_column_int64(readStmt, 0));
+			updateStmt.step_expected(SQLITE_DONE);
+			updateStmt.reset();
+		}
+		transaction.commit();
+	}
 
-	// ?1 = fileid, ?2 = filetype, ?3 = systemid
-	SQLPreparedStmt stmt(mDB, "INSERT OR IGNORE INTO files (fileid, systemid, filetype, fileexists, name) VALUES (?1, ?4, ?2, 1, ?3)");
-	sqlite3_bind_text(stmt, 4, system->getName().c_str(), system->getName().size(), SQLITE_STATIC);
+	LOG(LogInfo) << "Recreated files table successfully!";
+}
+
+// used by addMissingFiles to insert a single file into the database
+// assumes ?1 = fileid, ?2 = filetype, ?3 = name, ?4 = systemid, ?5 = parentid, ?6 = depth
+void add_file(const ScannedFile& file, int systemId, sqlite3* db, sqlite3_stmt* insert_stmt)
+{
+	if(sqlite3_bind_text(insert_stmt, 1, file.fileID.c_str(), file.fileID.size(), SQLITE_STATIC))
+		throw DBException() << "Error binding fileid in populate().\n\t" << sqlite3_errmsg(db);
+
+	if(sqlite3_bind_int(insert_stmt, 2, file.type))
+		throw DBException() << "Error binding filetype in populate().\n\t" << sqlite3_errmsg(db);
+
+	if(sqlite3_bind_text(insert_stmt, 3, file.name.c_str(), file.name.size(), SQLITE_STATIC))
+		throw DBException() << "Error binding name in populate().\n\t" << sqlite3_errmsg(db);
+
+	if(sqlite3_bind_int(insert_stmt, 4, systemId))
+		throw DBException() << "Error binding systemid in populate().\n\t" << sqlite3_errmsg(db);
+
+	bind_parent(insert_stmt, 5, file.fileID);
+
+	if(sqlite3_step(insert_stmt) != SQLITE_DONE)
+		throw DBException() << "Error adding file \"" << file.fileID << "\" in populate().\n\t" << sqlite3_errmsg(db);
+
+	if(sqlite3_reset(insert_stmt))
+		throw DBException() << "Error resetting statement for \"" << file.fileID << "\" in populate().\n\t" << sqlite3_errmsg(db);
+}
+
+int elapsed_ms(const std::chrono::steady_clock::time_point& since)
+{
+	return (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+std::string scan_config(const SystemData* system)
+{
+	std::stringstream ss;
+	ss << system->getStartPath();
+	const std::vector<std::string>& extensions = system->getExtensions();
+	for(auto it = extensions.begin(); it != extensions.end(); it++)
+		ss << " " << *it;
+
+	return ss.str();
+}
+
+// loads the directory snapshots of a system, returns false if they were taken with a different configuration
+bool load_snapshots(sqlite3* db, const SystemData* system, int systemId, SnapshotMap& snapshots)
+{
+	const std::string config = scan_config(system);
+
+	SQLPreparedStmt configStmt(db, "SELECT config FROM snapshotconfigs WHERE systemid = ?1");
+	sqlite3_bind_int(configStmt, 1, systemId);
+	if(configStmt.step() != SQLITE_ROW)
+		return false;
+
+	const char* oldConfig = (const char*)sqlite3_column_text(configStmt, 0);
+	if(!oldConfig || config != oldConfig)
+		return false;
+
+	SQLPreparedStmt stmt(db, "SELECT path, parent, name, mtime, entries FROM dirsnapshots WHERE systemid = ?1");
+	sqlite3_bind_int(stmt, 1, systemId);
+	while(stmt.step() != SQLITE_DONE)
+	{
+		const char* path = (const char*)sqlite3_column_text(stmt, 0);
+		const char* parent = (const char*)sqlite3_column_text(stmt, 1);
+		const char* name = (const char*)sqlite3_column_text(stmt, 2);
+
+		DirSnapshot& snapshot = snapshots[path];
+		snapshot.mtime = sqlite3_column_type(stmt, 3) == SQLITE_NULL ? -1 : (std::time_t)sqlite3_column_int64(stmt, 3);
+		snapshot.entries = sqlite3_column_int(stmt, 4);
+
+		if(parent && name)
+			snapshots[parent].subdirs.push_back(name);
+	}
+
+	return true;
+}
+
+void GamelistDB::addMissingFiles(const SystemData* system)
+{
+	addMissingFiles(std::vector<SystemData*>(1, const_cast<SystemData*>(system)));
+}
+
+// The directory walk happens on a FileScanner worker pool; this thread is the only one
+// that touches the database, draining the scanner's batches into a single transaction.
+void GamelistDB::addMissingFiles(const std::vector<SystemData*>& systems, bool incremental)
+{
+	flushWrites();
+	const auto startTime = std::chrono::steady_clock::now();
+
+	// ?1 = fileid, ?2 = filetype, ?3 = name, ?4 = systemid, ?5 = parentid, ?6 = depth
+	SQLPreparedStmt stmt(mDB, "INSERT OR IGNORE INTO files (fileid, systemid, filetype, fileexists, name, parentid, depth) VALUES (?1, ?4, ?2, 1, ?3, ?5, ?6)");
+	SQLPreparedStmt snapshotStmt(mDB, "INSERT OR REPLACE INTO dirsnapshots (systemid, path, parent, name, mtime, entries) VALUES (?1, ?2, ?3, ?4, ?5, ?6)");
+	// forgets a directory and everything below it
+	SQLPreparedStmt forgetStmt(mDB, "DELETE FROM dirsnapshots WHERE systemid = ?1 AND (path = ?2 OR (path >= ?2 || '/' AND path < ?2 || '0'))");
+	SQLPreparedStmt clearStmt(mDB, "DELETE FROM dirsnapshots WHERE systemid = ?1");
+	SQLPreparedStmt configStmt(mDB, "INSERT OR REPLACE INTO snapshotconfigs (systemid, config) VALUES (?1, ?2)");
 
 	SQLTransaction transaction(mDB);
 
+	// go ahead and add the roots always.
+	std::map<const SystemData*, SnapshotMap> snapshots;
+	std::map<const SystemData*, int> systemIds;
+	for(auto it = systems.begin(); it != systems.end(); it++)
+	{
+		const int systemId = getSystemId(*it);
+		systemIds[*it] = systemId;
+
+		sqlite3_bind_text(stmt, 1, ".", 1, SQLITE_STATIC);
+		sqlite3_bind_int(stmt, 2, FileType::FOLDER);
+		sqlite3_bind_null(stmt, 3);
+		sqlite3_bind_int(stmt, 4, systemId);
+		bind_parent(stmt, 5, ".");
+		stmt.step_expected(SQLITE_DONE);
+		stmt.reset();
+
+		if(!incremental || !load_snapshots(mDB, *it, systemId, snapshots[*it]))
+		{
+			// start over from scratch
+			snapshots.erase(*it);
+			sqlite3_bind_int(clearStmt, 1, systemId);
+			clearStmt.step_expected(SQLITE_DONE);
+			clearStmt.reset();
+		}
+	}
+
 	// actually start adding things.
-	// go ahead and add the root always.
-	sqlite3_bind_text(stmt,1,".",1,SQLITE_STATIC);
-	sqlite3_bind_int(stmt,2,FileType::FOLDER);
-	sqlite3_bind_null(stmt,3);
-	stmt.step_expected(SQLITE_DONE);
-	sqlite3_reset(stmt);
-	if(!relativeTo.empty())
+	FileScanner scanner;
+	scanner.start(std::vector<const SystemData*>(systems.begin(), systems.end()), snapshots);
+
+	std::chrono::steady_clock::duration insertTime(0);
+	unsigned int rows = 0;
+	FileScanner::Batch batch;
+	while(scanner.nextBatch(batch))
 	{
-		populate_recursive(relativeTo, extensions, relativeTo, system, mDB, stmt);
+		const auto batchStart = std::chrono::steady_clock::now();
+		for(auto it = batch.files.begin(); it != batch.files.end(); it++)
+			add_file(*it, systemIds.at(it->system), mDB, stmt);
+
+		for(auto it = batch.directories.begin(); it != batch.directories.end(); it++)
+		{
+			const int systemId = systemIds.at(it->system);
+			if(it->exists)
+			{
+				sqlite3_bind_int(snapshotStmt, 1, systemId);
+				sqlite3_bind_text(snapshotStmt, 2, it->fileID.c_str(), it->fileID.size(), SQLITE_STATIC);
+				if(it->parentID.empty())
+					sqlite3_bind_null(snapshotStmt, 3);
+				else
+					sqlite3_bind_text(snapshotStmt, 3, it->parentID.c_str(), it->parentID.size(), SQLITE_STATIC);
+				sqlite3_bind_text(snapshotStmt, 4, it->name.c_str(), it->name.size(), SQLITE_STATIC);
+				if(it->mtime == -1)
+					sqlite3_bind_null(snapshotStmt, 5);
+				else
+					sqlite3_bind_int64(snapshotStmt, 5, it->mtime);
+				sqlite3_bind_int(snapshotStmt, 6, it->entries);
+				snapshotStmt.step_expected(SQLITE_DONE);
+				snapshotStmt.reset();
+			}else{
+				sqlite3_bind_int(forgetStmt, 1, systemId);
+				sqlite3_bind_text(forgetStmt, 2, it->fileID.c_str(), it->fileID.size(), SQLITE_STATIC);
+				forgetStmt.step_expected(SQLITE_DONE);
+				forgetStmt.reset();
+			}
+		}
+
+		insertTime += std::chrono::steady_clock::now() - batchStart;
+		rows += (unsigned int)batch.files.size();
+		batch.files.clear();
+		batch.directories.clear();
+	}
+
+	for(auto it = systems.begin(); it != systems.end(); it++)
+	{
+		const std::string config = scan_config(*it);
+		sqlite3_bind_int(configStmt, 1, systemIds.at(*it));
+		sqlite3_bind_text(configStmt, 2, config.c_str(), config.size(), SQLITE_TRANSIENT);
+		configStmt.step_expected(SQLITE_DONE);
+		configStmt.reset();
 	}
+
+	const auto commitStart = std::chrono::steady_clock::now();
 	transaction.commit();
+	const int commitTime = elapsed_ms(commitStart);
+
+	updateStatistics();
+
+	LOG(LogInfo) << "Scanned " << systems.size() << " system(s) on " << scanner.getThreadCount() << " threads: " <<
+		scanner.getDirectoryCount() << " directories listed, " << scanner.getSkippedDirectoryCount() << " unchanged (" << 
+		scanner.getSkippedEntryCount() << " entries skipped), " << scanner.getFileCount() << " games, " << rows << " rows offered to the database.";
+	LOG(LogInfo) << "  walk: " << scanner.getWalkTime() << "ms, insert: " << std::chrono::duration_cast<std::chrono::milliseconds>(insertTime).count() << "ms, commit: " << commitTime <<
+		"ms, total: " << elapsed_ms(startTime) << "ms";
 }
 
 void GamelistDB::updateExists(const SystemData* system)
 {
+	flushWrites();
 	const std::string& relativeTo = system->getStartPath();
+	const int systemId = getSystemId(system);
+
+	// directories whose files were all checked back when they had their current mtime can be skipped
+	std::map<std::string, std::time_t> checked;
+	SQLPreparedStmt checkedStmt(mDB, "SELECT path, checkedmtime FROM dirsnapshots WHERE systemid = ?1 AND checkedmtime IS NOT NULL");
+	sqlite3_bind_int(checkedStmt, 1, systemId);
+	while(checkedStmt.step() != SQLITE_DONE)
+		checked[(const char*)sqlite3_column_text(checkedStmt, 0)] = (std::time_t)sqlite3_column_int64(checkedStmt, 1);
 
 	SQLPreparedStmt readStmt(mDB, "SELECT fileid,fileexists,filetype FROM files WHERE systemid = ?1");
-	sqlite3_bind_text(readStmt, 1, system->getName().c_str(), system->getName().size(), SQLITE_STATIC);
+	sqlite3_bind_int(readStmt, 1, systemId);
 	
 	SQLPreparedStmt updateStmt(mDB, "UPDATE files SET fileexists = ?1 WHERE fileid = ?2 AND systemid = ?3");
-	sqlite3_bind_text(updateStmt, 3, system->getName().c_str(), system->getName().size(), SQLITE_STATIC);
+	sqlite3_bind_int(updateStmt, 3, systemId);
+
+	SQLPreparedStmt markStmt(mDB, "UPDATE dirsnapshots SET checkedmtime = ?3 WHERE systemid = ?1 AND path = ?2");
+	sqlite3_bind_int(markStmt, 1, systemId);
+
+	// current mtime of every directory we've seen (-1 if it couldn't be read)
+	std::map<std::string, std::time_t> mtimes;
+	const std::time_t now = time(NULL);
+	unsigned int skipped = 0;
 
 	SQLTransaction transaction(mDB);
 
@@ -510,6 +1371,26 @@ void GamelistDB::updateExists(const SystemData* system)
 		const char* path = (const char*)sqlite3_column_text(readStmt, 0);
 		bool existsOld = sqlite3_column_int(readStmt, 1) > 0;
 
+		// nothing in this directory was added or removed since we last checked it
+		const std::string dir = parent_dir_id(path);
+		if(!dir.empty())
+		{
+			auto mtime = mtimes.find(dir);
+			if(mtime == mtimes.end())
+			{
+				boost::system::error_code ec;
+				std::time_t time = fs::last_write_time(fileIDToPath(dir, system), ec);
+				mtime = mtimes.insert(std::make_pair(dir, ec ? (std::time_t)-1 : time)).first;
+			}
+
+			auto checkedTime = checked.find(dir);
+			if(mtime->second != -1 && checkedTime != checked.end() && checkedTime->second == mtime->second)
+			{
+				skipped++;
+				continue;
+			}
+		}
+
 		bool existsNew = false;
 		if(path && path[0] == '.') // it's relative
 			existsNew = fs::exists(relativeTo + "/" + path);
@@ -522,26 +1403,45 @@ void GamelistDB::updateExists(const SystemData* system)
 		updateStmt.reset();
 	}
 
+	// remember which directories are now completely up to date
+	for(auto it = mtimes.begin(); it != mtimes.end(); it++)
+	{
+		if(it->second == -1 || it->second >= now - RACY_MTIME_WINDOW)
+			continue;
+
+		auto checkedTime = checked.find(it->first);
+		if(checkedTime != checked.end() && checkedTime->second == it->second)
+			continue;
+
+		sqlite3_bind_text(markStmt, 2, it->first.c_str(), it->first.size(), SQLITE_STATIC);
+		sqlite3_bind_int64(markStmt, 3, it->second);
+		markStmt.step_expected(SQLITE_DONE);
+		markStmt.reset();
+	}
+
 	transaction.commit();
+
+	LOG(LogInfo) << "Checked files of system \"" << system->getName() << "\", skipped " << skipped << " in unchanged directories.";
 }
 
 void GamelistDB::updateExists(const FileData& file)
 {
-	SQLPreparedStmt stmt(mDB, "UPDATE files SET fileexists = ?1 WHERE fileid = ?2 AND systemid = ?3");
+	flushWrites();
+	SQLPreparedStmt stmt(*mStatementCache, STMT_UPDATE_EXISTS);
 	bool exists = fs::exists(fileIDToPath(file.getFileID(), file.getSystem()));
 	if(file.getType() == FILTER) exists = true;
 	sqlite3_bind_int(stmt, 1, exists);
 	sqlite3_bind_text(stmt, 2, file.getFileID().c_str(), file.getFileID().size(), SQLITE_STATIC);
-	sqlite3_bind_text(stmt, 3, file.getSystem()->getName().c_str(), file.getSystem()->getName().size(), SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 3, getSystemId(file.getSystem()));
 	stmt.step_expected(SQLITE_DONE);
 }
 
 void GamelistDB::removeEntry(const FileData& file)
 {
-	SQLPreparedStmt stmt(mDB, "DELETE FROM files WHERE fileid = ?1 AND systemid = ?2");
-	bool exists = fs::exists(fileIDToPath(file.getFileID(), file.getSystem()));
+	flushWrites();
+	SQLPreparedStmt stmt(*mStatementCache, STMT_REMOVE_ENTRY);
 	sqlite3_bind_text(stmt, 1, file.getFileID().c_str(), file.getFileID().size(), SQLITE_STATIC);
-	sqlite3_bind_text(stmt, 2, file.getSystem()->getName().c_str(), file.getSystem()->getName().size(), SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 2, getSystemId(file.getSystem()));
 	stmt.step_expected(SQLITE_DONE);
 }
 
@@ -549,19 +1449,42 @@ void GamelistDB::removeEntry(const FileData& file)
 //No check to verify the truth of that flag is performed.
 void GamelistDB::removeNonexisting(const SystemData* system)
 {
+	flushWrites();
 	SQLPreparedStmt deleteStmt(mDB, "DELETE FROM files WHERE systemid = ?1 AND fileexists = '0'");
-	sqlite3_bind_text(deleteStmt, 1, system->getName().c_str(), system->getName().size(), SQLITE_STATIC);
+	sqlite3_bind_int(deleteStmt, 1, getSystemId(system));
 
 	SQLTransaction transaction(mDB);
 	deleteStmt.step_expected(SQLITE_DONE);
 	transaction.commit();
+
+	updateStatistics();
 }
 
 MetaDataMap GamelistDB::getFileData(const std::string& fileID, const std::string& systemID) const
 {
-	SQLPreparedStmt readStmt(mDB, "SELECT * FROM files WHERE fileid = ?1 AND systemid = ?2");
+	const int systemId = getSystemId(systemID);
+	SQLPreparedStmt readStmt(*mStatementCache, STMT_GET_FILE_DATA);
 	sqlite3_bind_text(readStmt, 1, fileID.c_str(), fileID.size(), SQLITE_STATIC);
-	sqlite3_bind_text(readStmt, 2, systemID.c_str(), systemID.size(), SQLITE_STATIC);
+	sqlite3_bind_int(readStmt, 2, systemId);
+
+	// held until the queued writes are applied, so the writer can't drop in-flight writes (or take the queue) while the overlay is built
+	std::unique_lock<std::mutex> lock(mWriteMutex);
+
+	std::unique_ptr<MetaDataMap> pending;
+	forEachPendingWrite(fileID, systemId, [&pending] (const PendingWrite& write) {
+		if(write.kind == PendingWrite::SET_DATA)
+		{
+			pending = std::unique_ptr<MetaDataMap>(new MetaDataMap(write.metadata));
+		}else if(write.kind == PendingWrite::UPDATE_DATA && pending)
+		{
+			for(auto it = write.slots.begin(); it != write.slots.end(); it++)
+				pending->set(*it, write.metadata.get(*it));
+		}
+	});
+
+	// everything after the last queued setFileData() replaces what's in the database anyway
+	if(pending)
+		return *pending;
 
 	readStmt.step_expected(SQLITE_ROW);
 
@@ -570,179 +1493,616 @@ MetaDataMap GamelistDB::getFileData(const std::string& fileID, const std::string
 
 	for(int i = RESERVED_COLUMNS; i < sqlite3_column_count(readStmt); i++)
 	{
-		const char* col = (const char*)sqlite3_column_name(readStmt, i);
-		const char* value = (const char*)sqlite3_column_text(readStmt, i);
+		const int slot = MetaDataMap::getSlot(sqlite3_column_name(readStmt, i));
+		if(slot == -1)
+			continue;
 
-		if(value == NULL)
-			value = "";
-
-		mdl.set(col, value);
+		// numbers don't need to go through text
+		switch(sqlite3_column_type(readStmt, i))
+		{
+		case SQLITE_INTEGER:
+			mdl.set((MetaDataSlot)slot, sqlite3_column_int(readStmt, i));
+			break;
+		case SQLITE_FLOAT:
+			mdl.set((MetaDataSlot)slot, (float)sqlite3_column_double(readStmt, i));
+			break;
+		case SQLITE_NULL:
+			mdl.set((MetaDataSlot)slot, "");
+			break;
+		default:
+			mdl.set((MetaDataSlot)slot, (const char*)sqlite3_column_text(readStmt, i));
+			break;
+		}
 	}
 
+	forEachPendingWrite(fileID, systemId, [&mdl] (const PendingWrite& write) {
+		for(auto it = write.slots.begin(); it != write.slots.end(); it++)
+			mdl.set(*it, write.metadata.get(*it));
+	});
+
 	return mdl;
 }
 
-void GamelistDB::setFileData(const std::string& fileID, const std::string& systemID, FileType type, const MetaDataMap& metadata)
+// dates and times that aren't set are stored as NULL
+void bind_metadata_value(sqlite3_stmt* stmt, int col, const MetaDataMap& metadata, MetaDataSlot slot)
 {
-	std::stringstream ss;
-	ss << "INSERT OR REPLACE INTO files VALUES (?1, ?2, ?3, ?4, ";
-
-	const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
-	for(unsigned int i = 0; i < mdd.size(); i++)
+	const MetaDataType type = getMDDMap().at(GAME_METADATA).at(slot).type;
+	const std::string val = metadata.get(slot);
+	if((type == MD_TIME || type == MD_DATE) && (val == "not-a-date-time" || val.empty()))
 	{
-		ss << "?" << i + RESERVED_COLUMNS + 1;
-
-		if(i + 1 < mdd.size())
-			ss << ", ";
+		sqlite3_bind_null(stmt, col);
+	}else{
+		sqlite3_bind_text(stmt, col, val.c_str(), val.size(), SQLITE_TRANSIENT);
 	}
-	ss << ")";
+}
+
+// binds everything STMT_UPDATE_FILE_DATA and STMT_INSERT_FILE_DATA need
+void bind_file_data(sqlite3_stmt* stmt, const std::string& fileID, int systemId, FileType type, const MetaDataMap& metadata)
+{
+	const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
 
-	std::string insertstr = ss.str();
-	SQLPreparedStmt stmt(mDB, insertstr.c_str());
 	sqlite3_bind_text(stmt, 1, fileID.c_str(), fileID.size(), SQLITE_STATIC); // fileid
-	sqlite3_bind_text(stmt, 2, systemID.c_str(), systemID.size(), SQLITE_STATIC); // systemid
+	sqlite3_bind_int(stmt, 2, systemId); // systemid
 	sqlite3_bind_int(stmt, 3, type); // filetype
 	sqlite3_bind_int(stmt, 4, 1); // fileexists
+	bind_parent(stmt, 5, fileID); // parentid, depth
 
 	for(unsigned int i = 0; i < mdd.size(); i++)
+		bind_metadata_value(stmt, i + RESERVED_COLUMNS + 1, metadata, (MetaDataSlot)i);
+}
+
+// updates the file's row in place if it's already there, so it keeps its rowid (and tags)
+void write_file_data(SQLStatementCache& cache, const std::string& fileID, int systemId, FileType type, const MetaDataMap& metadata)
+{
 	{
-		const std::string& val = metadata.get(mdd.at(i).key);
-		if((mdd.at(i).type == MD_TIME || mdd.at(i).type == MD_DATE) && (val == "not-a-date-time" || val.empty()))
-		{
-			sqlite3_bind_null(stmt, i + RESERVED_COLUMNS + 1);
-		}else{
-			sqlite3_bind_text(stmt, i + RESERVED_COLUMNS + 1, val.c_str(), val.size(), SQLITE_STATIC);
-		}
+		SQLPreparedStmt stmt(cache, STMT_UPDATE_FILE_DATA);
+		bind_file_data(stmt, fileID, systemId, type, metadata);
+		stmt.step_expected(SQLITE_DONE);
 	}
 
+	if(sqlite3_changes(cache.getDB()) > 0)
+		return;
+
+	SQLPreparedStmt stmt(cache, STMT_INSERT_FILE_DATA);
+	bind_file_data(stmt, fileID, systemId, type, metadata);
 	stmt.step_expected(SQLITE_DONE);
 }
 
+void GamelistDB::setFileData(const std::string& fileID, const std::string& systemID, FileType type, const MetaDataMap& metadata)
+{
+	PendingWrite write(PendingWrite::SET_DATA, fileID, getSystemId(systemID));
+	write.type = type;
+	write.metadata = metadata;
+	queueWrite(write);
+}
+
+void GamelistDB::updateFileData(const std::string& fileID, const std::string& systemID, const MetaDataMap& metadata, const std::vector<MetaDataSlot>& slots)
+{
+	if(slots.empty())
+		return;
+
+	PendingWrite write(PendingWrite::UPDATE_DATA, fileID, getSystemId(systemID));
+	write.metadata = metadata;
+	write.slots = slots;
+	queueWrite(write);
+}
 
 std::vector<std::string> GamelistDB::getFileTags(const std::string& fileID, const std::string& systemID) const
 {
-	SQLPreparedStmt stmt(mDB, "SELECT tag FROM tagtable WHERE fileid = ?1 AND systemid = ?2");
+	const int systemId = getSystemId(systemID);
+	SQLPreparedStmt stmt(*mStatementCache, STMT_GET_FILE_TAGS);
 	sqlite3_bind_text(stmt, 1, fileID.c_str(), fileID.size(), SQLITE_STATIC);
-	sqlite3_bind_text(stmt, 2, systemID.c_str(), systemID.size(), SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 2, systemId);
 
 	std::vector<std::string> tags;
 
+	// (see getFileData)
+	std::unique_lock<std::mutex> lock(mWriteMutex);
+
+	while(stmt.step() != SQLITE_DONE)
+	{
+		tags.push_back((const char*)sqlite3_column_text(stmt,0));
+	}
+
+	forEachPendingWrite(fileID, systemId, [&tags] (const PendingWrite& write) {
+		if(write.kind != PendingWrite::SET_TAG)
+			return;
+
+		auto it = std::find(tags.begin(), tags.end(), write.tag);
+		if(write.value && it == tags.end())
+			tags.push_back(write.tag);
+		else if(!write.value && it != tags.end())
+			tags.erase(it);
+	});
+
+	return tags;
+}
+
+
+void GamelistDB::setFileTag(const std::string& fileID, const std::string& systemID, const std::string& tagID, bool value)
+{
+	PendingWrite write(PendingWrite::SET_TAG, fileID, getSystemId(systemID));
+	write.tag = tagID;
+	write.value = value;
+	queueWrite(write);
+}
+
+void GamelistDB::applyWrite(SQLStatementCache& cache, const PendingWrite& write)
+{
+	switch(write.kind)
+	{
+	case PendingWrite::SET_DATA:
+		write_file_data(cache, write.fileID, write.systemId, write.type, write.metadata);
+		break;
+	case PendingWrite::UPDATE_DATA:
+		{
+			const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
+			std::stringstream ss;
+			ss << "UPDATE files SET ";
+			for(unsigned int i = 0; i < write.slots.size(); i++)
+				ss << (i > 0 ? ", " : "") << mdd.at(write.slots.at(i)).key << " = ?" << i + 3;
+			ss << " WHERE fileid = ?1 AND systemid = ?2";
+
+			SQLPreparedStmt stmt(cache, ss.str());
+			sqlite3_bind_text(stmt, 1, write.fileID.c_str(), write.fileID.size(), SQLITE_STATIC);
+			sqlite3_bind_int(stmt, 2, write.systemId);
+			for(unsigned int i = 0; i < write.slots.size(); i++)
+				bind_metadata_value(stmt, i + 3, write.metadata, write.slots.at(i));
+			stmt.step_expected(SQLITE_DONE);
+		}
+		break;
+	case PendingWrite::SET_TAG:
+		{
+			SQLPreparedStmt stmt(cache, write.value ? STMT_ADD_FILE_TAG : STMT_REMOVE_FILE_TAG);
+			sqlite3_bind_text(stmt, 1, write.fileID.c_str(), write.fileID.size(), SQLITE_STATIC);
+			sqlite3_bind_int(stmt, 2, write.systemId);
+			sqlite3_bind_text(stmt, 3, write.tag.c_str(), write.tag.size(), SQLITE_STATIC);
+			stmt.step_expected(SQLITE_DONE);
+		}
+		break;
+	}
+}
+
+bool isSearchFilter(const std::string& filter)
+{
+	return filter.compare(0, strlen(SEARCH_FILTER_PREFIX), SEARCH_FILTER_PREFIX) == 0;
+}
+
+std::string sql_quote(const std::string& str)
+{
+	std::string quoted = "'";
+	for(auto it = str.begin(); it != str.end(); it++)
+	{
+		if(*it == '\'')
+			quoted += '\'';
+		quoted += *it;
+	}
+	return quoted + "'";
+}
+
+// SQLite's LOWER() only folds ASCII, so prefixes have to be lowered the same way to match
+std::string sql_lower(const std::string& str)
+{
+	std::string lower = str;
+	for(auto it = lower.begin(); it != lower.end(); it++)
+	{
+		if(*it >= 'A' && *it <= 'Z')
+			*it += 'a' - 'A';
+	}
+	return lower;
+}
+
+// files.systemid used to be the system's name, so older filters compare it to strings ("systemid = 'nes'",
+// "systemid IN ('nes', 'snes')"), which never match the id it is now.  Those names are looked up in systems instead.
+std::string systemid_names_to_ids(const std::string& filter)
+{
+	auto isWordChar = [] (char c) { return isalnum((unsigned char)c) || c == '_' || c == '.'; };
+	auto skipSpace = [&filter] (size_t i) { while(i < filter.size() && isspace((unsigned char)filter[i])) i++; return i; };
+	auto wordEnd = [&filter, &isWordChar] (size_t i) { while(i < filter.size() && isWordChar(filter[i])) i++; return i; };
+	// end of the quoted string or identifier starting at i, npos if it isn't closed
+	auto quoteEnd = [&filter] (size_t i) {
+		const char quote = filter[i];
+		for(i++; i < filter.size(); i++)
+		{
+			if(filter[i] != quote)
+				continue;
+			if(i + 1 < filter.size() && filter[i + 1] == quote)
+				i++; // escaped
+			else
+				return i + 1;
+		}
+		return std::string::npos;
+	};
+
+	std::string out;
+	bool rewritten = false;
+	size_t i = 0;
+	while(i < filter.size())
+	{
+		if(filter[i] == '\'' || filter[i] == '"')
+		{
+			const size_t end = std::min(quoteEnd(i), filter.size());
+			out.append(filter, i, end - i);
+			i = end;
+			continue;
+		}
+
+		if(!isWordChar(filter[i]))
+		{
+			out += filter[i++];
+			continue;
+		}
+
+		const size_t end = wordEnd(i);
+		const std::string word = sql_lower(filter.substr(i, end - i));
+		out.append(filter, i, end - i);
+		i = end;
+		if(word != "systemid" && word != "files.systemid")
+			continue;
+
+		// systemid = 'name' (or ==, !=, <>)
+		const size_t op = skipSpace(i);
+		size_t opEnd = op;
+		while(opEnd < filter.size() && (filter[opEnd] == '=' || filter[opEnd] == '!' || filter[opEnd] == '<' || filter[opEnd] == '>'))
+			opEnd++;
+		const std::string opStr = filter.substr(op, opEnd - op);
+		if(opStr == "=" || opStr == "==" || opStr == "!=" || opStr == "<>")
+		{
+			const size_t literal = skipSpace(opEnd);
+			if(literal < filter.size() && filter[literal] == '\'' && quoteEnd(literal) != std::string::npos)
+			{
+				const size_t literalEnd = quoteEnd(literal);
+				out.append(filter, i, literal - i);
+				out += "(SELECT id FROM systems WHERE name = " + filter.substr(literal, literalEnd - literal) + ")";
+				i = literalEnd;
+				rewritten = true;
+			}
+			continue;
+		}
+
+		// systemid [NOT] IN ('name', ...)
+		size_t keyword = op;
+		if(sql_lower(filter.substr(keyword, wordEnd(keyword) - keyword)) == "not")
+			keyword = skipSpace(wordEnd(keyword));
+		if(sql_lower(filter.substr(keyword, wordEnd(keyword) - keyword)) != "in")
+			continue;
+
+		const size_t open = skipSpace(wordEnd(keyword));
+		if(open >= filter.size() || filter[open] != '(')
+			continue;
+
+		size_t close = std::string::npos;
+		for(size_t pos = skipSpace(open + 1); pos < filter.size() && filter[pos] == '\'' && quoteEnd(pos) != std::string::npos; )
+		{
+			pos = skipSpace(quoteEnd(pos));
+			if(pos < filter.size() && filter[pos] == ')')
+				close = pos;
+			if(pos >= filter.size() || filter[pos] != ',')
+				break;
+			pos = skipSpace(pos + 1);
+		}
+		if(close == std::string::npos)
+			continue;
+
+		out.append(filter, i, open + 1 - i);
+		out += "SELECT id FROM systems WHERE name IN (" + filter.substr(open + 1, close - open - 1) + "))";
+		i = close + 1;
+		rewritten = true;
+	}
+
+	if(rewritten)
+	{
+		static std::mutex warnedMutex;
+		static std::set<std::string> warned;
+
+		std::lock_guard<std::mutex> lock(warnedMutex);
+		if(warned.insert(filter).second)
+			LOG(LogWarning) << "Filter \"" << filter << "\" compares systemid to a system name, but it's a number now! Looking the names up instead.";
+	}
+
+	return out;
+}
+
+// turns a "search:" filter into SQL that can go in a WHERE on files, other filters only get older
+// systemid comparisons fixed (see systemid_names_to_ids)
+std::string filter_sql(const std::string& filter)
+{
+	if(!isSearchFilter(filter))
+		return systemid_names_to_ids(filter);
+
+	return "rowid IN (SELECT rowid FROM files_search WHERE files_search MATCH " + 
+		sql_quote(filter.substr(strlen(SEARCH_FILTER_PREFIX))) + ")";
+}
+
+// turns what the user typed into an FTS5 query: every word has to match the start of a word somewhere
+// (quoted, so nothing they type is taken as FTS syntax)
+std::string fts_query(const std::string& text)
+{
+	std::string query;
+	std::string word;
+	for(size_t i = 0; i <= text.size(); i++)
+	{
+		if(i == text.size() || text[i] == ' ' || text[i] == '\t')
+		{
+			if(!word.empty())
+				query += (query.empty() ? "\"" : " \"") + word + "\"*";
+			word.clear();
+		}else{
+			if(text[i] == '"')
+				word += '"';
+			word += text[i];
+		}
+	}
+	return query;
+}
+
+// the text without the spaces around it if that's a single character (a few bytes in UTF-8), "" otherwise
+std::string single_char(const std::string& text)
+{
+	const size_t start = text.find_first_not_of(" \t");
+	if(start == std::string::npos)
+		return "";
+
+	size_t end = start + 1;
+	while(end < text.size() && (text[end] & 0xC0) == 0x80)
+		end++;
+
+	if(text.find_first_not_of(" \t", end) != std::string::npos)
+		return "";
+
+	return text.substr(start, end - start);
+}
+
+
+// builds the query behind getChildrenOf() and getChildRowIdsOf(), ?1 = system ID, ?2 = file ID
+// with namePrefix, ?3 and ?4 are the bounds of LOWER(name) (see bind_name_prefix)
+std::string children_query(const char* columns, const SystemData* system, bool immediateChildrenOnly, bool includeFolders, bool foldersFirst, const FileSort* sortType, bool namePrefix = false)
+{
+	const std::string systemFilter = filter_sql(system->getFilterQuery());
+
+	std::stringstream ss;
+	ss << "SELECT " << columns << " FROM files WHERE 1 ";
+	if(!systemFilter.empty()) 
+	{
+		ss << "AND (" << systemFilter << ") ";
+	}
+	if(!system->isMetaSystem())
+	{
+		ss << "AND ( systemid = ?1 ) ";
+	}
+	if(immediateChildrenOnly)
+		ss << "AND parentid = ?2 ";
+	else
+		ss << "AND fileid > ?2 || '/' AND fileid < ?2 || '0' "; // everything starting with "[fileID]/" ('0' comes after '/')
+
+	if(namePrefix)
+		ss << "AND LOWER(name) >= ?3 AND LOWER(name) < ?4 "; // a range so files_names can be used, LIKE can't
+
+	if(!includeFolders)
+		ss << " AND NOT filetype in ( " << FileType::FOLDER << "," << FileType::FILTER << ") ";
+
+	ss << " ORDER BY ";
+	if(includeFolders && foldersFirst) ss << " CASE WHEN filetype = 1 THEN 1 ELSE 0 END, ";
+	if(sortType)
+		ss << sortType->sql;
+	else
+		ss << "LOWER(name)";
+
+	return ss.str();
+}
+
+// reads a (fileid, systemid, name, filetype) row, system is the one with the ID systemId
+FileData read_file(sqlite3_stmt* stmt, SystemData* system, int systemId)
+{
+	const char* fileid = (const char*)sqlite3_column_text(stmt, 0);
+	const int fileSystemId = sqlite3_column_int(stmt, 1);
+	SystemData* fileSystem = (fileSystemId == systemId) ? system : SystemManager::getInstance()->getSystemById(fileSystemId);
+	const char* name = (const char*)sqlite3_column_text(stmt, 2);
+	FileType filetype = (FileType)sqlite3_column_int(stmt, 3);
+
+	if(!fileSystem)
+		return FileData();
+
+	return FileData(fileid, fileSystem, filetype, name ? name : "");
+}
+
+std::vector<FileData> GamelistDB::getChildrenOf(const std::string& fileID, SystemData* system, 
+	bool immediateChildrenOnly, bool includeFolders, bool foldersFirst, const FileSort* sortType)
+{
+	const int systemId = getSystemId(system);
+	std::vector<FileData> children;
+
+	std::string query = children_query("fileid,systemid,name,filetype", system, immediateChildrenOnly, includeFolders, foldersFirst, sortType);
+	SQLPreparedStmt stmt(*mStatementCache, query);
+	sqlite3_bind_int(stmt, 1, systemId); // systemid
+	sqlite3_bind_text(stmt, 2, fileID.c_str(), fileID.size(), SQLITE_STATIC);
+
+	while(stmt.step() != SQLITE_DONE)
+	{
+		FileData file = read_file(stmt, system, systemId);
+		if(file.getSystem())
+			children.push_back(file);
+	}
+
+	return children;
+}
+
+std::vector<sqlite3_int64> GamelistDB::getChildRowIdsOf(const std::string& fileID, SystemData* system, bool includeFolders, bool foldersFirst, 
+	const FileSort* sortType, const std::string& namePrefix)
+{
+	const int systemId = getSystemId(system);
+	std::vector<sqlite3_int64> rowIds;
+
+	std::string query = children_query("rowid", system, true, includeFolders, foldersFirst, sortType, !namePrefix.empty());
+	SQLPreparedStmt stmt(*mStatementCache, query);
+	sqlite3_bind_int(stmt, 1, systemId); // systemid
+	sqlite3_bind_text(stmt, 2, fileID.c_str(), fileID.size(), SQLITE_STATIC);
+
+	if(!namePrefix.empty())
+	{
+		// UTF-8 never contains 0xFF, so [prefix, prefix + 0xFF) is everything starting with prefix
+		std::string lower = sql_lower(namePrefix);
+		std::string upper = lower + '\xFF';
+		sqlite3_bind_text(stmt, 3, lower.c_str(), lower.size(), SQLITE_TRANSIENT);
+		sqlite3_bind_text(stmt, 4, upper.c_str(), upper.size(), SQLITE_TRANSIENT);
+	}
+
 	while(stmt.step() != SQLITE_DONE)
+		rowIds.push_back(sqlite3_column_int64(stmt, 0));
+
+	return rowIds;
+}
+
+std::vector<FileData> GamelistDB::getFilesByRowId(const sqlite3_int64* rowIds, size_t count, SystemData* system)
+{
+	const int systemId = getSystemId(system);
+	std::vector<FileData> files;
+	files.reserve(count);
+
+	SQLPreparedStmt stmt(*mStatementCache, STMT_GET_FILE_BY_ROWID);
+	for(size_t i = 0; i < count; i++)
+	{
+		sqlite3_bind_int64(stmt, 1, rowIds[i]);
+
+		if(stmt.step() == SQLITE_ROW)
+			files.push_back(read_file(stmt, system, systemId));
+		else
+			files.push_back(FileData()); // removed since the IDs were read
+
+		stmt.reset();
+	}
+
+	// names from queued writes, so a renamed file is listed with its new name before the writer gets to it
+	std::unique_lock<std::mutex> lock(mWriteMutex);
+	if(mWriteQueue.empty() && mWritesInFlight.empty())
+		return files;
+
+	std::unordered_multimap<std::string, size_t> byFileID;
+	for(size_t i = 0; i < files.size(); i++)
 	{
-		tags.push_back((const char*)sqlite3_column_text(stmt,0));
+		if(files[i].getSystem())
+			byFileID.insert(std::make_pair(files[i].getFileID(), i));
 	}
 
-	return tags;
-}
+	auto applyName = [this, &files, &byFileID] (const PendingWrite& write) {
+		if(write.kind == PendingWrite::SET_TAG || (write.kind == PendingWrite::UPDATE_DATA && 
+			std::find(write.slots.begin(), write.slots.end(), MD_SLOT_NAME) == write.slots.end()))
+			return;
+
+		auto range = byFileID.equal_range(write.fileID);
+		for(auto it = range.first; it != range.second; it++)
+		{
+			FileData& file = files[it->second];
+			if(getSystemId(file.getSystem()) == write.systemId)
+				file = FileData(file.getFileID(), file.getSystem(), file.getType(), write.metadata.get(MD_SLOT_NAME));
+		}
+	};
+	std::for_each(mWritesInFlight.begin(), mWritesInFlight.end(), applyName);
+	std::for_each(mWriteQueue.begin(), mWriteQueue.end(), applyName);
 
+	return files;
+}
 
-void GamelistDB::setFileTag(const std::string& fileID, const std::string& systemID, const std::string& tagID, bool value)
+sqlite3_int64 GamelistDB::getFileRowId(const FileData& file)
 {
-	if(value)
-	{
-		SQLPreparedStmt stmt(mDB, "INSERT OR IGNORE INTO tagtable VALUES ( ?1, ?2, ?3 )");
-		sqlite3_bind_text(stmt, 1, fileID.c_str(), fileID.size(), SQLITE_STATIC);
-		sqlite3_bind_text(stmt, 2, systemID.c_str(), systemID.size(), SQLITE_STATIC);
-		sqlite3_bind_text(stmt, 3, tagID.c_str(), tagID.size(), SQLITE_STATIC);
+	const int systemId = getSystemId(file.getSystem());
 
-		SQLTransaction transaction(mDB);
-		stmt.step_expected(SQLITE_DONE);
-		transaction.commit();
-	}else{
-		SQLPreparedStmt stmt(mDB, "DELETE FROM tagtable where fileid = ?1 AND systemid = ?2 AND tag = ?3");
-		sqlite3_bind_text(stmt, 1, fileID.c_str(), fileID.size(), SQLITE_STATIC);
-		sqlite3_bind_text(stmt, 2, systemID.c_str(), systemID.size(), SQLITE_STATIC);
-		sqlite3_bind_text(stmt, 3, tagID.c_str(), tagID.size(), SQLITE_STATIC);
+	SQLPreparedStmt stmt(*mStatementCache, STMT_GET_ROWID);
+	sqlite3_bind_text(stmt, 1, file.getFileID().c_str(), file.getFileID().size(), SQLITE_STATIC);
+	sqlite3_bind_int(stmt, 2, systemId);
 
-		SQLTransaction transaction(mDB);
-		stmt.step_expected(SQLITE_DONE);
-		transaction.commit();
-	}
+	if(stmt.step() != SQLITE_ROW)
+		return 0;
+
+	return sqlite3_column_int64(stmt, 0);
 }
 
-std::vector<FileData> GamelistDB::getChildrenOf(const std::string& fileID, SystemData* system, 
-	bool immediateChildrenOnly, bool includeFolders, bool foldersFirst, const FileSort* sortType)
+std::vector<std::string> GamelistDB::getImagePaths(const std::vector<sqlite3_int64>& rowIds)
 {
-	const std::string& systemID = system->getName();
-	const std::string& systemFilter = system->getFilterQuery();
-	const std::string& systemPath = system->getStartPath();
-	std::vector<FileData> children;
+	std::vector<std::string> images(rowIds.size());
+	if(rowIds.empty())
+		return images;
 
+	// row IDs are numbers, so they can go straight into the query
 	std::stringstream ss;
-	ss << "SELECT fileid,systemid,name,filetype FROM files WHERE 1 ";
-	if(!systemFilter.empty()) 
-	{
-		ss << "AND (" << systemFilter << ") ";
-	}
-	if(!system->isMetaSystem())
-	{
-		ss << "AND ( systemid = ?1 ) ";
-	}
-	if(immediateChildrenOnly)
-		ss << "AND inimmediatedir(fileid, ?2) ";
-	else
-		ss << "AND indir(fileid, ?2) ";
-
-	if(!includeFolders)
-		ss << " AND NOT filetype in ( " << FileType::FOLDER << "," << FileType::FILTER << ") ";
-
-	ss << " ORDER BY ";
-	if(includeFolders && foldersFirst) ss << " CASE WHEN filetype = 1 THEN 1 ELSE 0 END, ";
-	if(sortType)
-		ss << sortType->sql;
-	else
-		ss << "LOWER(name)";
+	ss << "SELECT rowid, image FROM files WHERE rowid IN (";
+	for(auto it = rowIds.begin(); it != rowIds.end(); it++)
+		ss << (it == rowIds.begin() ? "" : ", ") << *it;
+	ss << ")";
 
-	std::string query = ss.str();
-	SQLPreparedStmt stmt(mDB, query);
-	sqlite3_bind_text(stmt, 1, systemID.c_str(), systemID.size(), SQLITE_STATIC); // systemid
-	sqlite3_bind_text(stmt, 2, fileID.c_str(), fileID.size(), SQLITE_STATIC);
+	withReadConnection([&ss, &rowIds, &images] (sqlite3* db) {
+		SQLPreparedStmt stmt(db, ss.str());
+		while(stmt.step() == SQLITE_ROW)
+		{
+			const sqlite3_int64 rowId = sqlite3_column_int64(stmt, 0);
+			const char* image = (const char*)sqlite3_column_text(stmt, 1);
+			if(image == NULL)
+				continue;
 
-	while(stmt.step() != SQLITE_DONE)
-	{
-		const char* fileid = (const char*)sqlite3_column_text(stmt, 0);
-		std::string systemname((const char*)sqlite3_column_text(stmt,1));
-		SystemData* childSystem = (systemname == systemID) ? system : SystemManager::getInstance()->getSystemByName(systemname);
-		const char* name = (const char*)sqlite3_column_text(stmt, 2);
-		FileType filetype = (FileType)sqlite3_column_int(stmt, 3);
-		if(childSystem)
-			children.push_back(FileData(fileid, childSystem, filetype, name ? name : ""));
-	}
+			for(unsigned int i = 0; i < rowIds.size(); i++)
+			{
+				if(rowIds[i] == rowId)
+					images[i] = image;
+			}
+		}
+	});
 
-	return children;
+	return images;
 }
 
 std::vector<FileData> GamelistDB::getChildrenOfFilter(const std::string& fileID, SystemData* system, 
 	 bool matchFolders, const std::string& filter_matches, int limit, bool foldersFirst, const FileSort* sortType)
 {
-	const std::string& systemID = system->getName();
-	const std::string& systemFilter = system->getFilterQuery();
+	const int systemId = getSystemId(system);
+	const std::string systemFilter = filter_sql(system->getFilterQuery());
 	const std::string& systemPath = system->getStartPath();
 	std::vector<FileData> children;
 
+	const bool search = isSearchFilter(filter_matches);
+	const bool byRank = search && !sortType; // search results are ordered by relevance unless the filter says otherwise
+	const std::string searchQuery = search ? filter_matches.substr(strlen(SEARCH_FILTER_PREFIX)) : "";
+
 	std::stringstream ss;
 	//Use the indir logic to support filters having subfilters
 	//A subfilter may return more entries than the parent!
 	//The user can handle making sure subfilters make subsets.
-	ss << "SELECT fileid, systemid, name, filetype, CAST(strftime(\"%Y\",releasedate) as INTEGER) as year FROM files WHERE ";
-
+	ss << "SELECT fileid, systemid, name, filetype, CAST(strftime(\"%Y\",releasedate) as INTEGER) as year, rowid FROM files WHERE ";
 
-	ss << "( (inimmediatedir(fileid, ?2) AND systemid = ?1) OR ( ";
-
-	if(!systemFilter.empty()) 
-		ss << " (" << systemFilter << ") AND ";
-	if(!system->isMetaSystem())
-		ss << " ( systemid = ?1 ) AND ";
-	if(!filter_matches.empty())
-        {
-		ss << " (" << filter_matches << ") ";
+	if(byRank)
+	{
+		// just the filter's own children (subfilters), the best matches are added after them below
+		ss << "parentid = ?2 AND systemid = ?1 ";
+	}else if(search)
+	{
+		// the matches come from the search index, written as a union so neither half has to scan files
+		// (CROSS JOIN keeps files_search as the outer loop)
+		ss << "rowid IN (SELECT rowid FROM files WHERE parentid = ?2 AND systemid = ?1 UNION ";
+		ss << "SELECT files.rowid FROM (SELECT rowid AS matchid FROM files_search WHERE files_search MATCH ?4) CROSS JOIN files ON files.rowid = matchid WHERE 1 ";
+		if(!systemFilter.empty()) 
+			ss << " AND (" << systemFilter << ") ";
+		if(!system->isMetaSystem())
+			ss << " AND ( systemid = ?1 ) ";
+		if(!matchFolders)
+			ss << " AND filetype is " << FileType::GAME;
+		ss << ") ";
 	}else{
-		//Just match everything, put something to make the OR syntax work.
-		ss << " 1 ";
+		ss << "( (parentid = ?2 AND systemid = ?1) OR ( ";
+
+		if(!systemFilter.empty()) 
+			ss << " (" << systemFilter << ") AND ";
+		if(!system->isMetaSystem())
+			ss << " ( systemid = ?1 ) AND ";
+		if(!filter_matches.empty())
+	        {
+			ss << " (" << filter_sql(filter_matches) << ") ";
+		}else{
+			//Just match everything, put something to make the OR syntax work.
+			ss << " 1 ";
+		}
+		if(!matchFolders)
+			ss << " AND filetype is " << FileType::GAME;
+		ss << " )) ";
 	}
-	if(!matchFolders)
-		ss << " AND filetype is " << FileType::GAME;
-	ss << " )) ";
 
 	ss << " ORDER BY ";
 	if(foldersFirst) ss << " CASE WHEN filetype = 1 THEN 1 ELSE 0 END, ";
@@ -754,26 +2114,53 @@ std::vector<FileData> GamelistDB::getChildrenOfFilter(const std::string& fileID,
 		ss << " LIMIT ?3";
 
 	std::string query = ss.str();
-        LOG(LogDebug) << "(" << fileID << ","<<systemID<<") " << query << std::endl;
+        LOG(LogDebug) << "(" << fileID << ","<<system->getName()<<") " << query << std::endl;
 	try
 	{
-		SQLPreparedStmt stmt(mDB, query);
+		std::vector<sqlite3_int64> rowIds;
+
+		SQLPreparedStmt stmt(*mStatementCache, query);
 
-		sqlite3_bind_text(stmt, 1, systemID.c_str(), systemID.size(), SQLITE_STATIC); // systemid
+		sqlite3_bind_int(stmt, 1, systemId); // systemid
 		sqlite3_bind_text(stmt, 2, fileID.c_str(), fileID.size(), SQLITE_STATIC);
 		if(limit > 0)
 			sqlite3_bind_int(stmt, 3, limit);
+		if(search && !byRank)
+			sqlite3_bind_text(stmt, 4, searchQuery.c_str(), searchQuery.size(), SQLITE_STATIC);
 
-		while(stmt.step() != SQLITE_DONE)
+		// (a broken search query only fails when stepping)
+		while(stmt.step() == SQLITE_ROW)
 		{
 			const char* fileid = (const char*)sqlite3_column_text(stmt, 0);
-			std::string systemname((const char*)sqlite3_column_text(stmt,1));
-			SystemData* childSystem = (systemname == systemID) ? system : SystemManager::getInstance()->getSystemByName(systemname);
+			const int childSystemId = sqlite3_column_int(stmt, 1);
+			SystemData* childSystem = (childSystemId == systemId) ? system : SystemManager::getInstance()->getSystemById(childSystemId);
 			const char* name = (const char*)sqlite3_column_text(stmt, 2);
 			FileType filetype = (FileType)sqlite3_column_int(stmt, 3);
 			if (childSystem != NULL)
+			{
 				children.push_back(FileData(fileid, childSystem, filetype, name ? name : ""));
+				rowIds.push_back(sqlite3_column_int64(stmt, 5));
+			}
+		}
+
+		if(byRank)
+		{
+			// (a file can be both a subfilter and a match, it's only listed once)
+			std::unordered_set<sqlite3_int64> listed(rowIds.begin(), rowIds.end());
+			const std::vector<sqlite3_int64> matches = rankMatches(system, searchQuery, !matchFolders, limit > 0 ? limit + children.size() : 0);
+			const std::vector<FileData> files = getFilesByRowId(matches.data(), matches.size(), system);
+			for(size_t i = 0; i < files.size(); i++)
+			{
+				if(files[i].getSystem() && listed.find(matches[i]) == listed.end())
+					children.push_back(files[i]);
+			}
+
+			// subfilters go first, like folders
+			if(foldersFirst)
+				std::stable_partition(children.begin(), children.end(), [] (const FileData& file) { return file.getType() != GAME; });
 		}
+		if(limit > 0 && (int)children.size() > limit)
+			children.resize(limit);
 	}catch(...){
 		//statement failed, likely to do to syntax in the filter.
 		//we'll just return the empty children vector.
@@ -781,11 +2168,141 @@ std::vector<FileData> GamelistDB::getChildrenOfFilter(const std::string& fileID,
 
 	return children;
 }
+
+std::vector<sqlite3_int64> GamelistDB::rankMatches(SystemData* system, const std::string& ftsQuery, bool gamesOnly, int limit)
+{
+	const int systemId = getSystemId(system);
+	const std::string systemFilter = filter_sql(system->getFilterQuery());
+	std::vector<sqlite3_int64> rowIds;
+
+	// files_search is the outer loop, rank is only worked out for the matches that get past the filters
+	std::stringstream ss;
+	ss << "SELECT files.rowid, files_search.rank FROM files_search CROSS JOIN files ON files.rowid = files_search.rowid WHERE files_search MATCH ?2 ";
+	if(gamesOnly)
+		ss << "AND filetype = " << FileType::GAME << " ";
+	if(!systemFilter.empty()) 
+		ss << "AND (" << systemFilter << ") ";
+	if(!system->isMetaSystem())
+		ss << "AND ( systemid = ?1 ) ";
+
+	SQLPreparedStmt stmt(*mStatementCache, ss.str());
+	sqlite3_bind_int(stmt, 1, systemId);
+
+	// the name matches first, then the rest (skipping the name matches here is cheaper than a NOT {name} in the query)
+	const std::string nameQuery = "{name} : (" + ftsQuery + ")";
+	const std::string* passes[] = { &nameQuery, &ftsQuery };
+	std::unordered_set<sqlite3_int64> nameMatches;
+	for(int pass = 0; pass < 2; pass++)
+	{
+		if(limit > 0 && (int)rowIds.size() >= limit)
+			break;
+
+		// only the best ones are kept instead of sorting every match, (rank, rowid) with the worst on top
+		const size_t keep = (limit > 0) ? limit - rowIds.size() : 0;
+		std::priority_queue< std::pair<double, sqlite3_int64> > best;
+
+		sqlite3_bind_text(stmt, 2, passes[pass]->c_str(), passes[pass]->size(), SQLITE_STATIC);
+		while(stmt.step() == SQLITE_ROW)
+		{
+			const sqlite3_int64 rowId = sqlite3_column_int64(stmt, 0);
+			if(pass == 0)
+				nameMatches.insert(rowId);
+			else if(nameMatches.find(rowId) != nameMatches.end())
+				continue;
+
+			best.push(std::make_pair(sqlite3_column_double(stmt, 1), rowId));
+			if(keep > 0 && best.size() > keep)
+				best.pop();
+		}
+		stmt.reset(); // (throws if the query was broken)
+
+		// a lower rank is a better match, so they come out last to first
+		const size_t start = rowIds.size();
+		rowIds.resize(start + best.size());
+		for(size_t i = rowIds.size(); i > start; i--, best.pop())
+			rowIds[i - 1] = best.top().second;
+	}
+
+	return rowIds;
+}
+
+std::vector<sqlite3_int64> GamelistDB::searchFiles(SystemData* system, const std::string& text, int limit)
+{
+	const std::string query = fts_query(text);
+	if(query.empty())
+		return std::vector<sqlite3_int64>();
+
+	const std::string letter = single_char(text);
+	if(letter.empty())
+		return rankMatches(system, query, true, limit);
+
+	const int systemId = getSystemId(system);
+	const std::string systemFilter = filter_sql(system->getFilterQuery());
+	std::vector<sqlite3_int64> rowIds;
+
+	// a range on LOWER(name), so files_names can be used and the LIMIT stops it early
+	std::stringstream ss;
+	ss << "SELECT rowid FROM files WHERE filetype = " << FileType::GAME << " AND LOWER(name) >= ?2 AND LOWER(name) < ?3 ";
+	if(!systemFilter.empty()) 
+		ss << "AND (" << systemFilter << ") ";
+	if(!system->isMetaSystem())
+		ss << "AND ( systemid = ?1 ) ";
+	ss << "ORDER BY LOWER(name)";
+	if(limit > 0)
+		ss << " LIMIT ?4";
+
+	// UTF-8 never contains 0xFF, so [letter, letter + 0xFF) is everything starting with it
+	const std::string lower = sql_lower(letter);
+	const std::string upper = lower + '\xFF';
+
+	SQLPreparedStmt stmt(*mStatementCache, ss.str());
+	sqlite3_bind_int(stmt, 1, systemId);
+	sqlite3_bind_text(stmt, 2, lower.c_str(), lower.size(), SQLITE_STATIC);
+	sqlite3_bind_text(stmt, 3, upper.c_str(), upper.size(), SQLITE_STATIC);
+	if(limit > 0)
+		sqlite3_bind_int(stmt, 4, limit);
+
+	while(stmt.step() == SQLITE_ROW)
+		rowIds.push_back(sqlite3_column_int64(stmt, 0));
+
+	return rowIds;
+}
+
+// counts of systems with a filter can only be found with a query over files, they're kept until anything changes
+GamelistDB::FilterCounts& GamelistDB::getFilterCounts(const SystemData* system)
+{
+	std::stringstream key;
+	key << (system->isMetaSystem() ? 0 : getSystemId(system)) << ":" << system->getFilterQuery();
+
+	const int changes = totalChanges(); // counts refresh once the writer commits
+	FilterCounts& counts = mFilterCounts[key.str()];
+	if(counts.changes != changes)
+		counts = FilterCounts(changes);
+
+	return counts;
+}
+
+// the row of systemstats for system (all of them added up for meta systems), 0 = games, 1 = images
+int GamelistDB::getSystemStat(const SystemData* system, int column)
+{
+	SQLPreparedStmt readStmt(*mStatementCache, STMT_GET_SYSTEM_STATS);
+	if(!system->isMetaSystem()) sqlite3_bind_int(readStmt, 1, getSystemId(system));
+
+	readStmt.step_expected(SQLITE_ROW);
+	return sqlite3_column_int(readStmt, column);
+}
+
 bool GamelistDB::systemHasFileWithImage(const SystemData* system)
 {
-	const std::string& systemID = system->getName();
-	const std::string& systemFilter = system->getFilterQuery();
-	const std::string& systemPath = system->getStartPath();
+	if(system->getFilterQuery().empty())
+		return getSystemStat(system, 1) > 0;
+
+	FilterCounts& counts = getFilterCounts(system);
+	if(counts.hasImage != -1)
+		return counts.hasImage != 0;
+
+	const int systemId = getSystemId(system);
+	const std::string systemFilter = filter_sql(system->getFilterQuery());
 	std::stringstream ss;
 	ss << "SELECT EXISTS(SELECT 1 FROM files WHERE image IS NOT NULL AND image <> '' ";
 	if(!systemFilter.empty()) 
@@ -793,32 +2310,79 @@ bool GamelistDB::systemHasFileWithImage(const SystemData* system)
 	if(!system->isMetaSystem())
 		ss << "AND ( systemid = ?1 ) ";
 	ss << ")";
-	SQLPreparedStmt readStmt(mDB, ss.str());
-	if(!system->isMetaSystem()) sqlite3_bind_text(readStmt, 1, systemID.c_str(), systemID.size(), SQLITE_STATIC);
+	SQLPreparedStmt readStmt(*mStatementCache, ss.str());
+	if(!system->isMetaSystem()) sqlite3_bind_int(readStmt, 1, systemId);
 
 	readStmt.step_expected(SQLITE_ROW);
-	return sqlite3_column_int(readStmt,0);
+	counts.hasImage = sqlite3_column_int(readStmt,0);
+	return counts.hasImage != 0;
 }
+
 int GamelistDB::getSystemFileCount(const SystemData* system)
 {
-	const std::string& systemID = system->getName();
-	const std::string& systemFilter = system->getFilterQuery();
-	const std::string& systemPath = system->getStartPath();
+	if(system->getFilterQuery().empty())
+		return getSystemStat(system, 0);
+
+	FilterCounts& counts = getFilterCounts(system);
+	if(counts.games != -1)
+		return counts.games;
+
+	const int systemId = getSystemId(system);
+	const std::string systemFilter = filter_sql(system->getFilterQuery());
 	std::stringstream ss;
 	ss << "SELECT COUNT(1) FROM files WHERE filetype = 1 ";
 	if(!systemFilter.empty()) 
 		ss << "AND (" << systemFilter << ") ";
 	if(!system->isMetaSystem())
 		ss << "AND ( systemid = ?1 ) ";
-	SQLPreparedStmt readStmt(mDB, ss.str());
-	if(!system->isMetaSystem()) sqlite3_bind_text(readStmt, 1, systemID.c_str(), systemID.size(), SQLITE_STATIC);
+	SQLPreparedStmt readStmt(*mStatementCache, ss.str());
+	if(!system->isMetaSystem()) sqlite3_bind_int(readStmt, 1, systemId);
 
 	readStmt.step_expected(SQLITE_ROW);
-	return sqlite3_column_int(readStmt,0);
+	counts.games = sqlite3_column_int(readStmt,0);
+	return counts.games;
 }
-void GamelistDB::importXML(const SystemData* system, const std::string& xml_path)
+// a file read from a gamelist.xml, ready for write_file_data()
+struct ImportedFile
+{
+	ImportedFile(const std::string& id, FileType t, const MetaDataMap& md) : fileID(id), type(t), metadata(md) {}
+
+	std::string fileID;
+	FileType type;
+	MetaDataMap metadata;
+};
+
+// everything a worker read from one gamelist.xml for importXML()
+struct ImportedGamelist
+{
+	const SystemData* system;
+	std::string path;
+	std::string error; // not empty if the file couldn't be read at all
+	unsigned int skipped;
+	std::vector<ImportedFile> files;
+};
+
+// gamelist.xml dates are almost always exactly "YYYYMMDDTHHMMSS", which doesn't need a trip through ptime
+std::string legacy_to_sqlite_time(const std::string& value)
+{
+	if(value.size() != 15 || value[8] != 'T')
+		return ptime_to_string(string_to_ptime(value, LEGACY_TIME_STRING_FORMAT), SQLITE_TIME_STRING_FORMAT);
+
+	for(unsigned int i = 0; i < value.size(); i++)
+	{
+		if(i != 8 && (value[i] < '0' || value[i] > '9'))
+			return ptime_to_string(string_to_ptime(value, LEGACY_TIME_STRING_FORMAT), SQLITE_TIME_STRING_FORMAT);
+	}
+
+	return value.substr(0, 4) + "-" + value.substr(4, 2) + "-" + value.substr(6, 2) + " " + 
+		value.substr(9, 2) + ":" + value.substr(11, 2) + ":" + value.substr(13, 2);
+}
+
+// runs on a worker thread, doesn't touch the database
+void read_gamelist(ImportedGamelist& gamelist)
 {
-	LOG(LogInfo) << "Appending gamelist.xml file \"" << xml_path << "\" to database (system: " << system->getName() << ")...";
+	const SystemData* system = gamelist.system;
+	const std::string& xml_path = gamelist.path;
 
 	if(!fs::exists(xml_path))
 		throw ESException() << "XML file not found (path: " << xml_path << ")";
@@ -834,7 +2398,6 @@ void GamelistDB::importXML(const SystemData* system, const std::string& xml_path
 
 	const fs::path relativeTo = system->getStartPath();
 	
-	unsigned int skipCount = 0;
 	const char* tagList[2] = { "game", "folder" };
 	MetaDataListType metadataTypeList[2] = { GAME_METADATA, FOLDER_METADATA };
 	FileType fileTypeList[2] = { GAME, FOLDER };
@@ -852,7 +2415,7 @@ void GamelistDB::importXML(const SystemData* system, const std::string& xml_path
 			if(!boost::filesystem::exists(path))
 			{
 				LOG(LogWarning) << "File \"" << path << "\" does not exist! Ignoring.";
-				skipCount++;
+				gamelist.skipped++;
 				continue;
 			}
 
@@ -871,7 +2434,7 @@ void GamelistDB::importXML(const SystemData* system, const std::string& xml_path
 					
 					// if it's a time/date, convert it into the SQLite format
 					if(iter->type == MD_TIME || iter->type == MD_DATE)
-						value = ptime_to_string(string_to_ptime(value, LEGACY_TIME_STRING_FORMAT), SQLITE_TIME_STRING_FORMAT);
+						value = legacy_to_sqlite_time(value);
 
 					mdl.set(iter->key, value);
 				}
@@ -883,63 +2446,329 @@ void GamelistDB::importXML(const SystemData* system, const std::string& xml_path
 			if(mdl.get<std::string>("name").empty())
 				mdl.set<std::string>("name", getCleanGameName(fileID, system));
 
-			this->setFileData(fileID, system->getName(), fileType, mdl);
+			gamelist.files.push_back(ImportedFile(fileID, fileType, mdl));
 		}
 	}
 }
 
-void GamelistDB::exportXML(const SystemData* system, const std::string& xml_path)
+void GamelistDB::importXML(const SystemData* system, const std::string& xml_path)
 {
-	pugi::xml_document doc;
-	pugi::xml_node root = doc.append_child("gameList");
+	std::vector< std::pair<const SystemData*, std::string> > gamelists;
+	gamelists.push_back(std::make_pair(system, xml_path));
+	importXML(gamelists);
+}
 
-	SQLPreparedStmt readStmt(mDB, "SELECT * FROM files WHERE systemid = ?1");
-	sqlite3_bind_text(readStmt, 1, system->getName().c_str(), system->getName().size(), SQLITE_STATIC);
-	
-	std::string relativeTo = system->getStartPath();
-	while(readStmt.step() != SQLITE_DONE)
+void GamelistDB::importXML(const std::vector< std::pair<const SystemData*, std::string> >& gamelists, 
+	const std::function<void(const SystemData*, int, int)>& progress)
+{
+	if(gamelists.empty())
+		return;
+
+	flushWrites();
+
+	const auto startTime = std::chrono::steady_clock::now();
+
+	// gamelists the workers are done with, in the order they finished
+	std::mutex readMutex;
+	std::condition_variable readDone;
+	std::deque< std::unique_ptr<ImportedGamelist> > read;
+
+	// declared last so it's destroyed (waiting for the workers) before what they use
+	const unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+	ThreadPool pool(std::min(threads, (unsigned int)gamelists.size()));
+	for(auto it = gamelists.begin(); it != gamelists.end(); it++)
+	{
+		const SystemData* system = it->first;
+		const std::string path = it->second;
+		pool.queueWorkItem([system, path, &readMutex, &readDone, &read] {
+			std::unique_ptr<ImportedGamelist> gamelist(new ImportedGamelist());
+			gamelist->system = system;
+			gamelist->path = path;
+			gamelist->skipped = 0;
+
+			try
+			{
+				read_gamelist(*gamelist);
+			}catch(std::exception& e)
+			{
+				gamelist->files.clear();
+				gamelist->error = e.what();
+			}
+
+			std::lock_guard<std::mutex> lock(readMutex);
+			read.push_back(std::move(gamelist));
+			readDone.notify_one();
+		});
+	}
+
+	// this thread is the only writer
+	for(int written = 0; written < (int)gamelists.size(); written++)
 	{
-		MetaDataListType type = fileTypeToMetaDataType((FileType)sqlite3_column_int(readStmt, COL_FILETYPE));
-		pugi::xml_node node = root.append_child(type == GAME_METADATA ? "game" : "folder");
+		std::unique_ptr<ImportedGamelist> gamelist;
+		{
+			std::unique_lock<std::mutex> lock(readMutex);
+			readDone.wait(lock, [&read] { return !read.empty(); });
+			gamelist = std::move(read.front());
+			read.pop_front();
+		}
 
-		// write path
-		std::string path = (const char*)sqlite3_column_text(readStmt, COL_FILEID);
-		if(path[0] == '.')
-			path = relativeTo + path.substr(1, std::string::npos);
+		const std::string& systemID = gamelist->system->getName();
+		if(!gamelist->error.empty())
+		{
+			LOG(LogError) << "Could not import gamelist.xml file \"" << gamelist->path << "\" (system: " << systemID << "):\n\t" << gamelist->error;
+		}else{
+			const int systemId = getSystemId(gamelist->system);
+			SQLTransaction transaction(mDB);
+			for(auto it = gamelist->files.begin(); it != gamelist->files.end(); it++)
+				write_file_data(*mStatementCache, it->fileID, systemId, it->type, it->metadata);
+			transaction.commit();
+
+			LOG(LogInfo) << "Imported " << gamelist->files.size() << " files from gamelist.xml file \"" << gamelist->path << "\" (system: " << systemID << ", " << 
+				gamelist->skipped << " skipped)";
+		}
 
-		node.append_child("path").text().set(path.c_str());
+		if(progress)
+			progress(gamelist->system, written + 1, (int)gamelists.size());
+	}
+
+	updateStatistics();
 
-		const auto& mdd = getMDDMap().at(type);
+	LOG(LogInfo) << "Imported " << gamelists.size() << " gamelist.xml files in " << 
+		std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count() << "ms";
+}
 
-		// skip column 0 (fileid), 1 (systemid), 2 (filetype), 3 (fileexists)
-		std::string temp;
-		for(int i = RESERVED_COLUMNS; i < sqlite3_column_count(readStmt); i++)
+// writes str as XML text, escaping what needs to be escaped
+void write_xml_text(std::ostream& out, const char* str)
+{
+	const char* run = str;
+	for(; *str != '\0'; str++)
+	{
+		const char* entity;
+		switch(*str)
 		{
-			const char* col = (const char*)sqlite3_column_name(readStmt, i);
-			const char* value = (const char*)sqlite3_column_text(readStmt, i);
-			
+		case '&': entity = "&amp;"; break;
+		case '<': entity = "&lt;"; break;
+		case '>': entity = "&gt;"; break;
+		case '"': entity = "&quot;"; break;
+		default: continue;
+		}
+
+		out.write(run, str - run);
+		out << entity;
+		run = str + 1;
+	}
+	out.write(run, str - run);
+}
+
+// the reverse of legacy_to_sqlite_time(), same fast path for "YYYY-MM-DD HH:MM:SS"
+std::string sqlite_to_legacy_time(const char* value)
+{
+	static const char* pattern = "0000-00-00 00:00:00";
+
+	int i = 0;
+	for(; value[i] != '\0' && pattern[i] != '\0'; i++)
+	{
+		if(pattern[i] == '0' ? (value[i] < '0' || value[i] > '9') : value[i] != pattern[i])
+			break;
+	}
+
+	if(value[i] != '\0' || pattern[i] != '\0')
+		return ptime_to_string(string_to_ptime(value, SQLITE_TIME_STRING_FORMAT), LEGACY_TIME_STRING_FORMAT);
+
+	const std::string str(value);
+	return str.substr(0, 4) + str.substr(5, 2) + str.substr(8, 2) + "T" + str.substr(11, 2) + str.substr(14, 2) + str.substr(17, 2);
+}
+
+// streams every file in system straight from the files table to xml_path in gamelist.xml format.
+// db can be any connection to the database, so this can run on a worker thread with its own.
+// the file is written next to xml_path first and only replaces it once it's complete.
+void write_gamelist(sqlite3* db, const SystemData* system, int systemId, const std::string& xml_path)
+{
+	SQLPreparedStmt readStmt(db, "SELECT * FROM files WHERE systemid = ?1");
+	sqlite3_bind_int(readStmt, 1, systemId);
+
+	// look up the name of each column and whether it's a date once, instead of for every row
+	// (columns that are dates in game metadata don't have to be in folder metadata)
+	const int columns = sqlite3_column_count(readStmt);
+	std::vector<std::string> names(columns);
+	std::vector<bool> isTime[2] = { std::vector<bool>(columns, false), std::vector<bool>(columns, false) };
+	const MetaDataListType types[2] = { GAME_METADATA, FOLDER_METADATA };
+	for(int i = RESERVED_COLUMNS; i < columns; i++)
+	{
+		names[i] = sqlite3_column_name(readStmt, i);
+		for(int t = 0; t < 2; t++)
+		{
+			const auto& mdd = getMDDMap().at(types[t]);
 			for(auto it = mdd.begin(); it != mdd.end(); it++)
 			{
-				if(it->key == col)
+				if(it->key == names[i])
 				{
-					// convert from SQLite time format to legacy gamelist.xml time format
-					if(it->type == MD_TIME || it->type == MD_DATE)
-					{
-						temp = ptime_to_string(string_to_ptime(value, SQLITE_TIME_STRING_FORMAT), LEGACY_TIME_STRING_FORMAT);
-						value = temp.c_str();
-					}
+					isTime[t][i] = (it->type == MD_TIME || it->type == MD_DATE);
 					break;
 				}
 			}
+		}
+	}
+
+	const std::string tempPath = xml_path + ".tmp";
+	std::ofstream out(tempPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if(!out)
+		throw ESException() << "Could not open \"" << tempPath << "\" for writing!";
+
+	out << "<?xml version=\"1.0\"?>\n<gameList>\n";
+
+	const std::string relativeTo = system->getStartPath();
+	int result;
+	while((result = readStmt.step()) == SQLITE_ROW)
+	{
+		const int type = (fileTypeToMetaDataType((FileType)sqlite3_column_int(readStmt, COL_FILETYPE)) == GAME_METADATA ? 0 : 1);
+		const char* tag = (type == 0 ? "game" : "folder");
+		out << "\t<" << tag << ">\n";
+
+		// write path
+		const char* path = (const char*)sqlite3_column_text(readStmt, COL_FILEID);
+		out << "\t\t<path>";
+		if(path[0] == '.')
+		{
+			write_xml_text(out, relativeTo.c_str());
+			path++;
+		}
+		write_xml_text(out, path);
+		out << "</path>\n";
+
+		// skip the reserved columns (fileid, systemid, filetype, fileexists, parentid, depth)
+		for(int i = RESERVED_COLUMNS; i < columns; i++)
+		{
+			const char* value = (const char*)sqlite3_column_text(readStmt, i);
+			if(value == NULL)
+				continue;
+
+			out << "\t\t<" << names[i] << ">";
+			if(isTime[type][i])
+				write_xml_text(out, sqlite_to_legacy_time(value).c_str());
+			else
+				write_xml_text(out, value);
+			out << "</" << names[i] << ">\n";
+		}
+
+		out << "\t</" << tag << ">\n";
+	}
+
+	if(result != SQLITE_DONE)
+		throw DBException() << "Error reading files for system \"" << system->getName() << "\".\n\t" << sqlite3_errmsg(db);
+
+	out << "</gameList>\n";
+	out.close();
+	if(!out)
+		throw ESException() << "Error writing \"" << tempPath << "\"!";
+
+	fs::rename(tempPath, xml_path);
+}
+
+void GamelistDB::exportXML(const SystemData* system, const std::string& xml_path)
+{
+	flushWrites();
+	write_gamelist(mDB, system, getSystemId(system), xml_path);
+}
 
-			node.append_child(col).text().set(value);
+void GamelistDB::exportXML(const std::vector< std::pair<const SystemData*, std::string> >& gamelists)
+{
+	flushWrites();
+	const auto startTime = std::chrono::steady_clock::now();
+
+	// every worker reads through a connection from the read pool; an in-memory or temporary database
+	// has no file to open a second connection to, so that gets exported one system at a time here
+	std::atomic<int> failed(0);
+	auto exportGamelist = [this, &failed] (const SystemData* system, const std::string& xml_path) {
+		try
+		{
+			const int systemId = getSystemId(system);
+			withReadConnection([system, systemId, &xml_path] (sqlite3* db) {
+				write_gamelist(db, system, systemId, xml_path);
+			});
+		}catch(std::exception& e)
+		{
+			LOG(LogError) << "Could not export gamelist.xml file \"" << xml_path << "\" (system: " << system->getName() << "):\n\t" << e.what();
+			failed++;
+		}
+	};
+
+	if(mReadPool)
+	{
+		const unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+		ThreadPool pool(std::min(threads, (unsigned int)std::max((size_t)1, gamelists.size())));
+		for(auto it = gamelists.begin(); it != gamelists.end(); it++)
+		{
+			const SystemData* system = it->first;
+			const std::string xml_path = it->second;
+			pool.queueWorkItem([system, xml_path, &exportGamelist] {
+				exportGamelist(system, xml_path);
+			});
 		}
+		pool.wait();
+	}else{
+		for(auto it = gamelists.begin(); it != gamelists.end(); it++)
+			exportGamelist(it->first, it->second);
 	}
 
-	doc.save_file(xml_path.c_str());
+	LOG(LogInfo) << "Exported " << (gamelists.size() - failed) << " of " << gamelists.size() << " gamelist.xml files in " << 
+		std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count() << "ms";
+}
+
+void GamelistDB::withReadConnection(const std::function<void(sqlite3* db)>& f)
+{
+	if(!mReadPool)
+	{
+		f(mDB);
+		return;
+	}
+
+	sqlite3* db = mReadPool->acquire();
+	try
+	{
+		f(db);
+	}catch(...)
+	{
+		mReadPool->release(db);
+		throw;
+	}
+	mReadPool->release(db);
 }
 
 int GamelistDB::totalChanges()
 {
-	return sqlite3_total_changes(mDB);
+	return sqlite3_total_changes(mDB) + (mWriteDB ? sqlite3_total_changes(mWriteDB) : 0);
+}
+
+int GamelistDB::addSystem(const std::string& name)
+{
+	{
+		SQLPreparedStmt addStmt(*mStatementCache, STMT_ADD_SYSTEM);
+		sqlite3_bind_text(addStmt, 1, name.c_str(), name.size(), SQLITE_STATIC);
+		addStmt.step_expected(SQLITE_DONE);
+	}
+
+	SQLPreparedStmt stmt(*mStatementCache, STMT_GET_SYSTEM_ID);
+	sqlite3_bind_text(stmt, 1, name.c_str(), name.size(), SQLITE_STATIC);
+	stmt.step_expected(SQLITE_ROW);
+
+	const int id = sqlite3_column_int(stmt, 0);
+	std::lock_guard<std::mutex> lock(mSystemIdsMutex);
+	mSystemIds[name] = id;
+	return id;
+}
+
+int GamelistDB::getSystemId(const std::string& name) const
+{
+	std::lock_guard<std::mutex> lock(mSystemIdsMutex);
+	auto it = mSystemIds.find(name);
+	if(it == mSystemIds.end())
+		throw DBException() << "Unknown system \"" << name << "\" (it was never added)!";
+
+	return it->second;
+}
+
+int GamelistDB::getSystemId(const SystemData* system) const
+{
+	return getSystemId(system->getName());
 }
\ No newline at end of file
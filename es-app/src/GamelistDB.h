@@ -3,26 +3,43 @@
 #include "ESException.h"
 #include "MetaData.h"
 #include "FileData.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <sqlite3/sqlite3.h>
 
 class SystemData;
+class SQLStatementCache;
+class SQLReadPool;
 
 class DBException : public ESException {};
 
 boost::filesystem::path fileIDToPath(const std::string& fileID, const SystemData* system);
+std::string pathToFileID(const boost::filesystem::path& path, const boost::filesystem::path& systemStartPath);
 
 /*
  Gamelist DB format:
 
- A single table named "files" is created, with columns like so:
+ Files are kept in a table named "files", with columns like so:
 
- [file ID] [system ID] [file type] [file exists] [metadata 0] [metadata 1] [metadata 2] ... etc.
+ [file ID] [system ID] [file type] [file exists] [parent ID] [depth] [metadata 0] [metadata 1] [metadata 2] ... etc.
  The primary key for this table is the pair (file ID, system ID).
 
- File ID and system ID are strings. File type is an int. File exists is a boolean. 
+ File ID is a string. System ID is an int, the id of the system's row in the "systems" table (id, name).
+ File type is an int. File exists is a boolean. 
  Metadata types correspond to the MetaDataDecl vector.
 
+ Rows are updated in place, so a file keeps its rowid for as long as it's in the database.
+ Tags are kept in "filetags" as (file rowid, tag) and are removed along with the file.
+
+ "systemstats" has how many games, folders and files with an image each system has, plus a counter of changes
+ to its files.  Triggers on files keep it up to date.
+
  File ID is in the following format:
  ./path/to/game.rom  - for paths relative to system root
  ~/path/to/game.rom  - for paths relative to home
@@ -35,6 +52,10 @@ boost::filesystem::path fileIDToPath(const std::string& fileID, const SystemData
 
  File exists is a boolean indicating whether or not the file is present on the file system.
  This value is set at startup by the "updateExists" method.
+
+ Parent ID is the file ID of the directory containing the file ("./a/b.rom" -> "./a", NULL for the root ".").
+ Depth is the number of slashes in the file ID.  Both are derived from the file ID when a row is inserted,
+ so listing a directory can use an index instead of comparing every file ID.
 */
 
 
@@ -45,6 +66,10 @@ public:
 	virtual ~GamelistDB();
 
 	void addMissingFiles(const SystemData* system);
+	// Scans all of the given systems at once (directories are walked in parallel, inserts happen in a single transaction).
+	// If incremental is true, directories that haven't changed since the last scan are not listed again.
+	void addMissingFiles(const std::vector<SystemData*>& systems, bool incremental = true);
+	// directories that haven't changed since the last check are skipped
 	void updateExists(const SystemData* system);
 	void updateExists(const FileData& file); // update the fileexists flag for a particular file
 	void removeEntry(const FileData& file);
@@ -55,40 +80,168 @@ public:
 	// tags are a separate notion from meta data
 	std::vector<std::string> getFileTags(const std::string& fileID, const std::string& systemID) const;
 
+	// Metadata and tag writes are queued and committed in batches by a writer thread, so they don't wait for the disk.
+	// getFileData(), getFileTags() and the names from getFilesByRowId() include queued writes.  Listing, searching
+	// and counting see what's committed, which is at most half a second behind.  Writes that don't go through
+	// the queue, imports and exports call flushWrites() first.
+
 	// Sets all metadata for a given fileID (overwrites existing data).
 	void setFileData(const std::string& fileID, const std::string& systemID, FileType type, const MetaDataMap& metadata);
+	// Sets only the metadata values in slots, taken from metadata (e.g. playcount and lastplayed after a launch).
+	// Does nothing if the file isn't in the database.
+	void updateFileData(const std::string& fileID, const std::string& systemID, const MetaDataMap& metadata, const std::vector<MetaDataSlot>& slots);
 	// If value is true, add the tag. If the value is false, remove it.
 	void setFileTag(const std::string& fileID, const std::string& systemID, const std::string& tagID, bool value);
 
+	// Blocks until every queued write is committed. Call it before anything that might not come back (launching
+	// a game, shutting down), or before listing files that have to include a write that was just made (like after
+	// an edit); the destructor does it too.
+	void flushWrites();
+
 	// returns either all immediate children (immediateChildrenOnly) OR 
 	// all children, children of children, etc. of file ID (immedateChildrenOnly = false)
 	std::vector<FileData> getChildrenOf(const std::string& fileID, SystemData* system, 
 		bool immediateChildrenOnly, bool includeFolders, bool foldersFirst, const FileSort* sortType = NULL);
 
+	// Like getChildrenOf() for immediate children, but only returns the row IDs (in the same order),
+	// so huge folders can be listed without loading every file.  Use getFilesByRowId() to load the ones you need.
+	// If namePrefix isn't empty, only files whose name starts with it (ignoring ASCII case) are returned;
+	// that's an index lookup, so it's cheap enough to run on every keypress.
+	std::vector<sqlite3_int64> getChildRowIdsOf(const std::string& fileID, SystemData* system, 
+		bool includeFolders, bool foldersFirst, const FileSort* sortType = NULL, const std::string& namePrefix = "");
+	// returns the files in the same order, rows that don't exist anymore come back as FileData()
+	std::vector<FileData> getFilesByRowId(const sqlite3_int64* rowIds, size_t count, SystemData* system);
+	// 0 if the file isn't in the database
+	sqlite3_int64 getFileRowId(const FileData& file);
+	// The image paths of the given rows, in the same order ("" for rows without an image or that don't exist anymore).
+	// One query on a pooled read connection (see withReadConnection()), so it's meant for background threads.
+	std::vector<std::string> getImagePaths(const std::vector<sqlite3_int64>& rowIds);
+
 	// reads and runs a filter from the database.
 	// filters support a filesystem like hierarchy reusing a lot of the code
 	// from getChildrenOf().
 	// A filters are opaque to getting children.
 	//(You'll need to call this again to get "grandchildren")
+	// filter_matches can also be "search:<FTS5 query>", the results are then ordered by relevance if sortType is NULL.
 	std::vector<FileData> getChildrenOfFilter(const std::string& fileID, SystemData* system, 
 	 bool matchFolders, const std::string& filter_matches, int limit, bool foldersFirst, const FileSort* sortType);
 
+	// Full text search over name, description, developer, publisher and genre of the games in system, best match first
+	// (games whose name matches before the rest, see rankMatches()).
+	// Every word in text has to match the start of a word in one of those (case and accents are ignored).
+	// A single letter would match nearly everything, it lists the games whose name starts with it instead (by name).
+	// Filters can do the same with "search:<FTS5 query>" instead of SQL, see getChildrenOfFilter().
+	std::vector<sqlite3_int64> searchFiles(SystemData* system, const std::string& text, int limit = 0);
+
+	// Both are a lookup in systemstats; systems with a filter query files and keep the result until totalChanges() moves.
 	bool systemHasFileWithImage(const SystemData* system);
 	int getSystemFileCount(const SystemData* system);
 	void importXML(const SystemData* system, const std::string& xml_path);
+	// Imports several gamelist.xml files: they're read on a pool of worker threads while this thread writes the
+	// ones that are done, each system in a single transaction.  Files that can't be read are logged and skipped.
+	// progress is called on this thread after each system is written, with how many are done out of how many.
+	void importXML(const std::vector< std::pair<const SystemData*, std::string> >& gamelists, 
+		const std::function<void(const SystemData* system, int done, int total)>& progress = nullptr);
 	void exportXML(const SystemData* system, const std::string& xml_path);
+	// Exports every system in gamelists at once, each on a worker thread with its own read-only connection.
+	// Failures are logged and don't stop the other systems.
+	void exportXML(const std::vector< std::pair<const SystemData*, std::string> >& gamelists);
 
 	//Return the total_changes value from sqlite. Allows basic UI awareness.
 	int totalChanges();
 
+	// Runs f with a read-only connection from a pool, for background threads that only read (exports, prefetching).
+	// It sees what was committed when it starts reading (not queued writes, see flushWrites()) and doesn't block the
+	// other connections, nor do they block it.  In-memory databases only have the main connection, f gets that one.
+	void withReadConnection(const std::function<void(sqlite3* db)>& f);
+
+	// Adds a system's name to the systems table if it isn't there yet and returns its id.
+	// Ids never change once given out, see SystemManager::getSystemById().
+	// Every system has to be added (by SystemManager::loadConfig()) before anything else uses it.
+	int addSystem(const std::string& name);
+	// The id addSystem() gave a system, throws if it was never added.
+	int getSystemId(const std::string& name) const;
+	int getSystemId(const SystemData* system) const;
+
 private:
 	void openDB(const char* path);
 	void createMissingTables(); // will do nothing if a "files" table already exists
+	void createIndexes(); // needs a valid schema
+	void createSearchIndex(); // files_search and the triggers that keep it up to date, built from files if it's new
+	void dropSearchIndex();
+	void createStats(); // systemstats and the triggers that keep it up to date, counted from files if it's new
+	// The rows of system that match the FTS5 query ftsQuery, best match first, at most limit of them (0 = all).
+	// Files whose name matches come before the ones that only match somewhere else, so as long as enough names
+	// match, the rest never has to be ranked.
+	std::vector<sqlite3_int64> rankMatches(SystemData* system, const std::string& ftsQuery, bool gamesOnly, int limit);
 	bool hasValidSchema() const; // returns true if the current "files" table's schema matches our metadata declarations
 	void recreateTables(); // recreates the "files" table with the current metadata schema, copying any values with the same column names
 	void closeDB();
 
+	void migrateTags(); // moves tags from the old (fileid, systemid, tag) tagtable to filetags
+	void updateStatistics(); // runs ANALYZE once enough rows changed since the last time
+
+	struct PendingWrite
+	{
+		enum Kind { SET_DATA, UPDATE_DATA, SET_TAG };
+
+		PendingWrite(Kind k, const std::string& file, int system) : kind(k), fileID(file), systemId(system), type(GAME), 
+			metadata(GAME_METADATA, false), value(false) {}
+
+		Kind kind;
+		std::string fileID;
+		int systemId;
+		FileType type; // SET_DATA
+		MetaDataMap metadata; // SET_DATA, UPDATE_DATA
+		std::vector<MetaDataSlot> slots; // UPDATE_DATA
+		std::string tag; // SET_TAG
+		bool value; // SET_TAG
+	};
+
+	void openWriter(); // starts the writer thread on its own connection, if the database is a file
+	void closeWriter(); // commits whatever is still queued
+	void queueWrite(const PendingWrite& write);
+	void runWriter();
+	// applies mWritesInFlight in one transaction on mWriteDB, returns false if the batch should be tried again
+	bool commitWrites();
+	static void applyWrite(SQLStatementCache& cache, const PendingWrite& write);
+	// calls f for the queued writes to a file, oldest first (mWriteMutex has to be locked)
+	void forEachPendingWrite(const std::string& fileID, int systemId, const std::function<void(const PendingWrite&)>& f) const;
+
 	sqlite3* mDB;
+	// prepared statements reused between calls, owned by the connection
+	mutable std::unique_ptr<SQLStatementCache> mStatementCache;
+	std::unordered_map<std::string, int> mSystemIds; // the systems that were added, read from any thread
+	mutable std::mutex mSystemIdsMutex;
+
+	// the writer thread and its connection (NULL for in-memory databases, then writes happen right away)
+	sqlite3* mWriteDB;
+	std::unique_ptr<SQLStatementCache> mWriteCache;
+	std::thread mWriter;
+	mutable std::mutex mWriteMutex;
+	std::condition_variable mWriteQueued;
+	std::condition_variable mWritesDone;
+	std::deque<PendingWrite> mWriteQueue;
+	std::deque<PendingWrite> mWritesInFlight; // taken by the writer, not committed yet
+	bool mFlushRequested;
+	bool mStopWriter;
+
+	std::unique_ptr<SQLReadPool> mReadPool; // NULL for in-memory databases
+	int mAnalyzedChanges; // totalChanges() at the last ANALYZE
+
+	struct FilterCounts
+	{
+		FilterCounts(int c = -1) : changes(c), games(-1), hasImage(-1) {}
+
+		int changes; // totalChanges() when these were counted
+		int games; // -1 until counted
+		int hasImage; // -1 until counted
+	};
+
+	FilterCounts& getFilterCounts(const SystemData* system);
+	int getSystemStat(const SystemData* system, int column);
+
+	std::unordered_map<std::string, FilterCounts> mFilterCounts; // by system id and filter query
 };
 
 struct FileSort
@@ -100,3 +253,6 @@ struct FileSort
 };
 
 const std::vector<FileSort>& getFileSorts();
+
+// true for filters that are a full text search ("search:<FTS5 query>") rather than SQL
+bool isSearchFilter(const std::string& filter);
@@ -1,6 +1,10 @@
 #define NULL 0
 
+// Pairs of MAME short name -> full name (includes additional rom names from mame4all 0.37b5).
+// Entries are sorted by short name (strcmp order) so PlatformIds::getCleanMameName can binary search them,
+// keep it that way when adding new ones.
 const char* mameNameToRealName[] = {
+
 	"005", "005", 
 	"10yard", "10-Yard Fight (World, set 1)", 
 	"10yard85", "10-Yard Fight '85 (US, Taito license)", 
@@ -50,10 +54,15 @@ const char* mameNameToRealName[] = {
 	"20pacgalr2", "Ms. Pac-Man/Galaga - 20th Anniversary Class of 1981 Reunion (V1.02)", 
 	"20pacgalr3", "Ms. Pac-Man/Galaga - 20th Anniversary Class of 1981 Reunion (V1.03)", 
 	"20pacgalr4", "Ms. Pac-Man/Galaga - 20th Anniversary Class of 1981 Reunion (V1.04)", 
+	"22vp931", "Phillips 22VP931", 
+	"22vp932", "Phillips 22VP932", 
 	"24cdjuke", "Midcoin Juke Box 24CD", 
 	"25pacman", "Pac-Man - 25th Anniversary Edition (Rev 3.00)", 
 	"25pacmano", "Pac-Man - 25th Anniversary Edition (Rev 2.00)", 
+	"2804", "Parallel EEPROM 2804 (512x8)", 
 	"280zzzap", "280-ZZZAP", 
+	"2816", "Parallel EEPROM 2816 (2048x8)", 
+	"2864", "Parallel EEPROM 2864 (8192x8)", 
 	"2mindril", "Two Minute Drill", 
 	"30test", "30 Test (Remake)", 
 	"39in1", "39 in 1 MAME bootleg", 
@@ -84,6 +93,7 @@ const char* mameNameToRealName[] = {
 	"48in1b", "48 in 1 MAME bootleg (set 2, ver 3.09, alt flash)", 
 	"4dwarrio", "4-D Warriors (315-5162)", 
 	"4enlinea", "Cuatro en Linea", 
+	"4enlinea_cga", "ISA8_CGA_4ENLINEA", 
 	"4enraya", "4 En Raya (set 1)", 
 	"4enrayaa", "4 En Raya (set 2)", 
 	"4in1", "4 Fun in 1", 
@@ -96,20 +106,29 @@ const char* mameNameToRealName[] = {
 	"500gp", "500 GP (5GP3 Ver. C)", 
 	"50lions", "50 Lions (10120511, NSW/ACT)", 
 	"50lionsa", "50 Lions (10156111, Malaysia)", 
+	"56xx", "Namco 56xx", 
+	"58xx", "Namco 58xx", 
+	"59xx", "Namco 59xx", 
+	"5a22", "5A22", 
 	"5acespkr", "5-Aces Poker", 
 	"5clown", "Five Clown (English, set 1)", 
 	"5clowna", "Five Clown (English, set 2)", 
 	"5clownsp", "Five Clown (Spanish hack)", 
 	"600", "600", 
 	"60in1", "60 in 1 MAME bootleg (ver 3.00)", 
+	"64streej", "64th. Street - A Detective Story (Japan)",
 	"64street", "64th. Street - A Detective Story (World)", 
 	"64streetj", "64th. Street - A Detective Story (Japan)", 
 	"720", "720 Degrees (rev 4)", 
+	"720b", "720 Degrees (set 2)",
 	"720g", "720 Degrees (German, rev 2)", 
 	"720gr1", "720 Degrees (German, rev 1)", 
 	"720r1", "720 Degrees (rev 1)", 
 	"720r2", "720 Degrees (rev 2)", 
 	"720r3", "720 Degrees (rev 3)", 
+	"74148", "TTL 74148", 
+	"74153", "TTL 74153", 
+	"7474", "7474 TTL", 
 	"7jigen", "7jigen no Youseitachi - Mahjong 7 Dimensions (Japan)", 
 	"7mezzo", "7 e Mezzo", 
 	"7ordi", "7 Ordi (Korea)", 
@@ -123,11 +142,19 @@ const char* mameNameToRealName[] = {
 	"8ballact", "Eight Ball Action (DK conversion)", 
 	"8ballact2", "Eight Ball Action (DKJr conversion)", 
 	"8bpm", "Eight Ball Action (Pac-Man conversion)", 
+	"93c46_16", "Serial EEPROM 93C46 (64x16)", 
+	"93c46_8", "Serial EEPROM 93C46 (128x8)", 
+	"93c56_16", "Serial EEPROM 93C56 (128x16)", 
+	"93c56_8", "Serial EEPROM 93C56 (256x8)", 
+	"93c66_16", "Serial EEPROM 93C66 (256x16)", 
+	"93c66_8", "Serial EEPROM 93C66 (512x8)", 
+	"93c76_8", "Serial EEPROM 93C76 (1024x8)", 
 	"98best44", "Neo Print - '98 NeoPri Best 44 (Japan)", 
 	"99bottles", "99 Bottles of Beer", 
 	"99lstwar", "'99: The Last War (set 1)", 
 	"99lstwara", "'99: The Last War (set 2)", 
 	"99lstwark", "'99: The Last War (Kyugo)", 
+	"99lstwra", "'99 The Last War (alternate)",
 	"9ballsht", "9-Ball Shootout (set 1)", 
 	"9ballsht2", "9-Ball Shootout (set 2)", 
 	"9ballsht3", "9-Ball Shootout (set 3)", 
@@ -140,6 +167,7 @@ const char* mameNameToRealName[] = {
 	"aafbb", "All American Football (rev B)", 
 	"aafbc", "All American Football (rev C)", 
 	"aafbd2p", "All American Football (rev D, 2 Players)", 
+	"aakart", "AAKART", 
 	"aar_101", "Aaron Spelling (1.01)", 
 	"aavenger", "Airborne Avenger", 
 	"abacus", "Abacus (Ver 1.0)", 
@@ -214,6 +242,7 @@ const char* mameNameToRealName[] = {
 	"acefruit", "Silhouette", 
 	"acheart", "Arcana Heart", 
 	"acheartf", "Arcana Heart Full", 
+	"acia6850", "6850 ACIA", 
 	"acitya", "Atlantic City Action", 
 	"aclown", "Clown (Russia) (Atronic)", 
 	"acombat", "Astro Combat (newer, CB)", 
@@ -232,6 +261,8 @@ const char* mameNameToRealName[] = {
 	"act2000o3", "Action 2000 (Version 1.2)", 
 	"act2000v1", "Action 2000 (Version 3.5R Dual)", 
 	"act2000vx", "Action 2000 (Version 3.30XT Dual)", 
+	"actfanc1", "Act-Fancer Cybernetick Hyper Weapon (World revision 1)",
+	"actfancj", "Act-Fancer Cybernetick Hyper Weapon (Japan revision 1)",
 	"actfancr", "Act-Fancer Cybernetick Hyper Weapon (World revision 2)", 
 	"actfancr1", "Act-Fancer Cybernetick Hyper Weapon (World revision 1)", 
 	"actfancrj", "Act-Fancer Cybernetick Hyper Weapon (Japan revision 1)", 
@@ -489,8 +520,20 @@ const char* mameNameToRealName[] = {
 	"ad5vpaa", "Video Poker Ace (Bellfruit) (Adder 5) (set 2)", 
 	"ad5vpab", "Video Poker Ace (Bellfruit) (Adder 5) (set 3)", 
 	"ad5vpac", "Video Poker Ace (Bellfruit) (Adder 5) (set 4)", 
+	"adc0834", "ADC0834", 
+	"adc0838", "ADC0838", 
+	"adc1038", "ADC1038", 
+	"adc12138", "ADC12138", 
+	"address_map_bank", "Address Map Bank", 
 	"adillor", "Armadillo Racing (Rev. AM1 Ver.A)", 
 	"adonis", "Adonis (0200751V, NSW/ACT)", 
+	"adsp2100", "ADSP-2100", 
+	"adsp2101", "ADSP-2101", 
+	"adsp2104", "ADSP-2104", 
+	"adsp2105", "ADSP-2105", 
+	"adsp21062", "ADSP21062", 
+	"adsp2115", "ADSP-2115", 
+	"adsp2181", "ADSP-2181", 
 	"adults", "Adults Only (Russia) (Extrema)", 
 	"aerfboo2", "Aero Fighters (bootleg set 2)", 
 	"aerfboot", "Aero Fighters (bootleg set 1)", 
@@ -523,6 +566,8 @@ const char* mameNameToRealName[] = {
 	"agress", "Agress - Missile Daisenryaku (Japan)", 
 	"agressb", "Agress - Missile Daisenryaku (English bootleg)", 
 	"agsoccer", "A.G. Soccer Ball", 
+	"aica", "AICA", 
+	"aicartc", "AICA RTC", 
 	"ainferno", "Air Inferno (US)", 
 	"ainfernoj", "Air Inferno (Japan)", 
 	"airass", "Air Assault (World)", 
@@ -544,6 +589,7 @@ const char* mameNameToRealName[] = {
 	"ajax", "Ajax", 
 	"ajaxj", "Ajax (Japan)", 
 	"akamaru", "Panel &amp; Variety Akamaru Q Jousyou Dont-R", 
+	"akiko", "CBM AKIKO", 
 	"aking", "Angler King (AG1 Ver. A)", 
 	"akiss", "Mahjong Angel Kiss", 
 	"akkanvdr", "Akkanbeder (Ver 2.5J 1995/06/14)", 
@@ -555,6 +601,7 @@ const char* mameNameToRealName[] = {
 	"alcat_l7", "Alley Cats (Shuffle) (L-7)", 
 	"alcon", "Alcon (US)", 
 	"aleck64", "Aleck64 PIF BIOS", 
+	"alexkida", "Alex Kidd (set 2)",
 	"alexkidd", "Alex Kidd: The Lost Stars (set 2, unprotected)", 
 	"alexkidd1", "Alex Kidd: The Lost Stars (set 1, FD1089A 317-0021)", 
 	"alg_bios", "American Laser Games BIOS", 
@@ -583,6 +630,9 @@ const char* mameNameToRealName[] = {
 	"aliensj2", "Aliens (Japan set 2)", 
 	"alienstr", "Alien Star", 
 	"aliensu", "Aliens (US)", 
+	"aliensya", "Alien Syndrome (set 2)",
+	"aliensyb", "Alien Syndrome (set 3)",
+	"aliensyj", "Alien Syndrome (Japan)",
 	"aliensyn", "Alien Syndrome (set 4, System 16B, unprotected)", 
 	"aliensyn2", "Alien Syndrome (set 2, System 16A, FD1089A 317-0033)", 
 	"aliensyn3", "Alien Syndrome (set 3, System 16B, FD1089A 317-0033)", 
@@ -595,6 +645,8 @@ const char* mameNameToRealName[] = {
 	"alleymas", "Alley Master", 
 	"allied", "Allied System", 
 	"alpha1v", "Alpha One (Vision Electronics)", 
+	"alpha8201", "ALPHA-8201", 
+	"alpha8301", "ALPHA-8301", 
 	"alphaho", "Alpha Fighter / Head On", 
 	"alpham2", "Alpha Mission II / ASO II - Last Guardian (NGM-007)(NGH-007)", 
 	"alpham2p", "Alpha Mission II / ASO II - Last Guardian (prototype)", 
@@ -615,6 +667,7 @@ const char* mameNameToRealName[] = {
 	"alpok_l2", "Alien Poker (L-2)", 
 	"alpok_l6", "Alien Poker (L-6)", 
 	"altair", "Altair", 
+	"altbeas2", "Altered Beast (Version 2)",
 	"altbeast", "Altered Beast (set 8, 8751 317-0078)", 
 	"altbeast2", "Altered Beast (set 2, MC-8123B 317-0066)", 
 	"altbeast4", "Altered Beast (set 4, MC-8123B 317-0066)", 
@@ -624,6 +677,9 @@ const char* mameNameToRealName[] = {
 	"altbeastj", "Juuouki (set 7, Japan, 8751 317-0077)", 
 	"altbeastj1", "Juuouki (set 1, Japan, FD1094 317-0065)", 
 	"altbeastj3", "Juuouki (set 3, Japan, FD1094 317-0068)", 
+	"am29000", "AMD Am29000", 
+	"am53cf96", "53CF96 SCSI", 
+	"am9517a", "AM9517A", 
 	"am_mg24", "Multi Game I (V.Ger 2.4)", 
 	"am_mg3", "Multi Game III (V.Ger 3.5)", 
 	"am_mg31i", "Multi Game III (S.Ita 3.1)", 
@@ -639,6 +695,7 @@ const char* mameNameToRealName[] = {
 	"ambushj", "Ambush (Japan)", 
 	"ambushv", "Ambush (Volt Electronics)", 
 	"amclink", "Amcoe Link Control Box (Version 2.2)", 
+	"amd_29lv200t", "AMD 29LV200T Flash", 
 	"amerdart", "AmeriDarts (set 1)", 
 	"amerdart2", "AmeriDarts (set 2)", 
 	"amerdart3", "AmeriDarts (set 3)", 
@@ -649,6 +706,8 @@ const char* mameNameToRealName[] = {
 	"amidaro", "Amidar (Olympia)", 
 	"amidars", "Amidar (Scramble hardware)", 
 	"amidaru", "Amidar (Stern Electronics)", 
+	"amiga_fdc", "Amiga FDC", 
+	"amiga_paula", "Amiga Paula", 
 	"amigo", "Amigo", 
 	"ampkr228", "American Poker II (iamp2 v28)", 
 	"ampkr2b1", "American Poker II (bootleg, set 1)", 
@@ -772,6 +831,7 @@ const char* mameNameToRealName[] = {
 	"arbalest", "Arbalester", 
 	"arcadecl", "Arcade Classics (prototype)", 
 	"arcadian", "Arcadia (NMK)", 
+	"archriv2", "Arch Rivals (rev 2.0)",
 	"archrivl", "Arch Rivals (rev 4.0 6/29/89)", 
 	"archrivla", "Arch Rivals (rev 2.0 5/03/89)", 
 	"archrivlb", "Arch Rivals (rev 2.0 5/03/89, 8-way Joystick bootleg)", 
@@ -793,8 +853,11 @@ const char* mameNameToRealName[] = {
 	"aristmk5", "MKV Set/Clear Chips (USA)", 
 	"aristmk6", "Aristocrat MK6 Base (15011025, Malaysia)", 
 	"ark1ball", "Arkanoid (bootleg with MCU, harder)", 
+	"ark2jp", "Arkanoid - Revenge of DOH (Japan)",
+	"ark2us", "Arkanoid - Revenge of DOH (US)",
 	"arkangc", "Arkanoid (Game Corporation bootleg, set 1)", 
 	"arkangc2", "Arkanoid (Game Corporation bootleg, set 2)", 
+	"arkanoi2", "Arkanoid - Revenge of DOH (World)",
 	"arkanoid", "Arkanoid (World)", 
 	"arkanoidj", "Arkanoid (Japan)", 
 	"arkanoidjb", "Arkanoid (bootleg with MCU, set 1)", 
@@ -805,6 +868,7 @@ const char* mameNameToRealName[] = {
 	"arkarea", "Ark Area", 
 	"arkatayt", "Arkanoid (Tayto bootleg)", 
 	"arkatour", "Tournament Arkanoid (US)", 
+	"arkbl2", "Arkanoid (Japanese bootleg Set 2)",
 	"arkbloc2", "Block (Game Corporation bootleg, set 2)", 
 	"arkbloc3", "Block (Game Corporation bootleg, set 3)", 
 	"arkblock", "Block (Game Corporation bootleg, set 1)", 
@@ -814,10 +878,17 @@ const char* mameNameToRealName[] = {
 	"arknoid2b", "Arkanoid - Revenge of DOH (Japan bootleg)", 
 	"arknoid2j", "Arkanoid - Revenge of DOH (Japan)", 
 	"arknoid2u", "Arkanoid - Revenge of DOH (US)", 
+	"arknoidj", "Arkanoid (Japan)",
+	"arknoidu", "Arkanoid (US)",
 	"arkretrn", "Arkanoid Returns (Ver 2.02O 1997/02/10)", 
 	"arkretrnj", "Arkanoid Returns (Ver 2.02J 1997/02/10)", 
 	"arktayt2", "Arkanoid (Tayto bootleg, harder)", 
 	"arlingtn", "Arlington Horse Racing (v1.21-D)", 
+	"arm", "ARM", 
+	"arm7", "ARM7", 
+	"arm7_be", "ARM7 (big endian)", 
+	"arm9", "ARM9", 
+	"arm920t", "ARM920T", 
 	"armchmp2", "Arm Champs II v2.6", 
 	"armchmp2o", "Arm Champs II v1.7", 
 	"armedf", "Armed Formation", 
@@ -825,6 +896,7 @@ const char* mameNameToRealName[] = {
 	"armora", "Armor Attack", 
 	"armorap", "Armor Attack (prototype)", 
 	"armorar", "Armor Attack (Rock-Ola)", 
+	"armorca2", "Armored Car (set 2)",
 	"armorcar", "Armored Car (set 1)", 
 	"armorcar2", "Armored Car (set 2)", 
 	"armwar", "Armored Warriors (Euro 941024)", 
@@ -1007,10 +1079,12 @@ const char* mameNameToRealName[] = {
 	"as_wwc", "Wicked Willy (Astra, V104)", 
 	"as_wwd", "Wicked Willy (Astra, V103)", 
 	"as_wwe", "Wicked Willy (Astra, V102)", 
+	"asap", "ASAP", 
 	"ashnojoe", "Ashita no Joe (Japan)", 
 	"ashura", "Ashura Blaster (World)", 
 	"ashuraj", "Ashura Blaster (Japan)", 
 	"ashurau", "Ashura Blaster (US)", 
+	"asic65", "ASIC65", 
 	"asideral", "Ataque Sideral (Spanish bootleg of UniWar S)", 
 	"asndynmt", "Asian Dynamite", 
 	"aso", "ASO - Armored Scrum Object", 
@@ -1019,6 +1093,7 @@ const char* mameNameToRealName[] = {
 	"assaultj", "Assault (Japan)", 
 	"assaultp", "Assault Plus (Japan)", 
 	"astannie", "Asteroid Annie and the Aliens", 
+	"astdelu1", "Asteroids Deluxe (rev 1)",
 	"astdelux", "Asteroids Deluxe (rev 3)", 
 	"astdelux1", "Asteroids Deluxe (rev 1)", 
 	"astdelux2", "Asteroids Deluxe (rev 2)", 
@@ -1029,6 +1104,8 @@ const char* mameNameToRealName[] = {
 	"asterixj", "Asterix (ver JAD)", 
 	"asterock", "Asterock (Sidam bootleg of Asteroids)", 
 	"asterockv", "Asterock (Videotron bootleg of Asteroids)", 
+	"asteroi1", "Asteroids (rev 1)",
+	"asteroib", "Asteroids (bootleg on Lunar Lander hardware)",
 	"asteroid", "Asteroids (rev 4)", 
 	"asteroid1", "Asteroids (rev 1)", 
 	"asteroid2", "Asteroids (rev 2)", 
@@ -1036,6 +1113,7 @@ const char* mameNameToRealName[] = {
 	"astinvad", "Astro Invader", 
 	"astoneag", "Stone Age (Astro, Ver. ENG.03.A)", 
 	"astorm", "Alien Storm (World, 2 Players, FD1094 317-0154)", 
+	"astorm2p", "Alien Storm (2 Player)",
 	"astorm3", "Alien Storm (World, 3 Players, FD1094 317-0148)", 
 	"astormb2", "Alien Storm (bootleg, set 2)", 
 	"astormbl", "Alien Storm (bootleg, set 1)", 
@@ -1048,6 +1126,7 @@ const char* mameNameToRealName[] = {
 	"astrob2", "Astro Blaster (version 2)", 
 	"astrob2a", "Astro Blaster (version 2a)", 
 	"astrobg", "Astro Blaster (German)", 
+	"astrocade", "Astrocade", 
 	"astrof", "Astro Fighter (set 1)", 
 	"astrof2", "Astro Fighter (set 2)", 
 	"astrof3", "Astro Fighter (set 3)", 
@@ -1062,17 +1141,33 @@ const char* mameNameToRealName[] = {
 	"asurabld", "Asura Blade - Sword of Dynasty (Japan)", 
 	"asurabus", "Asura Buster - Eternal Warriors (Japan)", 
 	"asylum", "Asylum (prototype)", 
+	"at28c16", "AT28C16", 
+	"at89c4051", "AT89C4051", 
+	"at_keyb", "AT Keyboard", 
+	"ata_interface", "ATA Interface", 
+	"ata_slot", "ATA Connector", 
+	"ataflash", "ATA Flash PCCARD", 
 	"atamanot", "Computer Quiz Atama no Taisou (Japan)", 
+	"atari2804", "Atari EEPROM Interface (2804)", 
+	"atari2816", "Atari EEPROM Interface (2816)", 
+	"atari_rle", "Atari RLE Motion Objects", 
+	"atari_vg_earom", "ATARI VG EAROM", 
 	"atarians", "The Atarians", 
 	"atarifb", "Atari Football (revision 2)", 
 	"atarifb1", "Atari Football (revision 1)", 
 	"atarifb4", "Atari Football (4 players)", 
+	"atarimo", "Atari Motion Objects", 
 	"atarisy1", "Atari System 1 BIOS", 
+	"atarivad", "Atari VAD", 
+	"atarscom", "Atari Sound Communications", 
 	"ataxx", "Ataxx (set 1)", 
+	"ataxx_80186_sound", "Ataxx 80186 DAC", 
 	"ataxxa", "Ataxx (set 2)", 
 	"ataxxe", "Ataxx (Europe)", 
 	"ataxxj", "Ataxx (Japan)", 
 	"atehate", "Athena no Hatena ?", 
+	"atetckt2", "Tetris (Cocktail set 2)",
+	"atetcktl", "Tetris (Cocktail set 1)",
 	"atetris", "Tetris (set 1)", 
 	"atetrisa", "Tetris (set 2)", 
 	"atetrisb", "Tetris (bootleg set 1)", 
@@ -1080,6 +1175,10 @@ const char* mameNameToRealName[] = {
 	"atetrisc", "Tetris (cocktail set 1)", 
 	"atetrisc2", "Tetris (cocktail set 2)", 
 	"athena", "Athena", 
+	"atjsa1", "Atari JSA I Sound Board", 
+	"atjsa2", "Atari JSA II Sound Board", 
+	"atjsa3", "Atari JSA III Sound Board", 
+	"atjsa3s", "Atari JSA IIIs Sound Board", 
 	"atla_ltd", "Atlantis (LTD)", 
 	"atlantca", "Atlantica (Russia) (Atronic) (set 1)", 
 	"atlantcaa", "Atlantica (Russia) (Atronic) (set 2)", 
@@ -1088,6 +1187,7 @@ const char* mameNameToRealName[] = {
 	"atlantis2", "Battle of Atlantis (set 2)", 
 	"atlantisb", "Battle of Atlantis (bootleg)", 
 	"atlantol", "Atlant Olimpic", 
+	"atlants2", "Battle of Atlantis (set 2)",
 	"atleta", "Atleta", 
 	"atluspsx", "Atlus PSX", 
 	"atombjt", "Atom (bootleg of Bombjack Twin)", 
@@ -1110,6 +1210,7 @@ const char* mameNameToRealName[] = {
 	"atworlde1", "Around The World (Version 1.3E CGA)", 
 	"aurail", "Aurail (set 3, US, unprotected)", 
 	"aurail1", "Aurail (set 2, World, FD1089B 317-0168)", 
+	"auraila", "Aurail (set 2)",
 	"aurailj", "Aurail (set 1, Japan, FD1089A 317-0167)", 
 	"ausfache", "Akatsuki Blitzkampf Ausf Achse", 
 	"aust201", "Austin Powers (2.01)", 
@@ -1130,10 +1231,18 @@ const char* mameNameToRealName[] = {
 	"avalons", "The Key Of Avalon - The Wizard Master (server) (Rev C) (GDT-0005C)", 
 	"avefenix", "Ave Fenix (Spanish bootleg of Phoenix)", 
 	"avenger", "Avenger [TTL]", 
+	"avenger2", "Avengers (set 2)",
 	"avengers", "Avengers (US set 1)", 
 	"avengers2", "Avengers (US set 2)", 
 	"avengrgs", "Avengers In Galactic Storm (US)", 
 	"avengrgsj", "Avengers In Galactic Storm (Japan)", 
+	"avg", "AVG", 
+	"avg_bzone", "AVG_BZONE", 
+	"avg_mhavoc", "AVG_MHAVOC", 
+	"avg_quantum", "AVG_QUANTUM", 
+	"avg_starwars", "AVG_STARWARS", 
+	"avg_tempest", "AVG_TEMPEST", 
+	"avg_tomcat", "AVG_TOMCAT", 
 	"avsp", "Alien vs. Predator (Euro 940520)", 
 	"avspa", "Alien vs. Predator (Asia 940520)", 
 	"avspd", "Alien vs. Predator (Euro 940520 Phoenix Edition) (bootleg)", 
@@ -1145,7 +1254,11 @@ const char* mameNameToRealName[] = {
 	"avtnfl", "NFL (ver 109)", 
 	"avtsym14", "Symbols (ver 1.4)", 
 	"avtsym25", "Symbols (ver 2.5)", 
+	"aw_rom_board", "AW-ROM-BOARD", 
 	"awbios", "Atomiswave Bios", 
+	"ay8910", "AY-3-8910A", 
+	"ay8912", "AY-3-8912A", 
+	"ay8913", "AY-3-8913A", 
 	"aztarac", "Aztarac", 
 	"azumanga", "Azumanga Daioh Puzzle Bobble (GDL-0018)", 
 	"azurian", "Azurian Attack", 
@@ -1274,6 +1387,8 @@ const char* mameNameToRealName[] = {
 	"batsugun", "Batsugun", 
 	"batsuguna", "Batsugun (older set)", 
 	"batsugunsp", "Batsugun - Special Version", 
+	"battlan2", "Battle Lane Vol. 5 (set 2)",
+	"battlan3", "Battle Lane Vol. 5 (set 3)",
 	"battlane", "Battle Lane! Vol. 5 (set 1)", 
 	"battlane2", "Battle Lane! Vol. 5 (set 2)", 
 	"battlane3", "Battle Lane! Vol. 5 (set 3)", 
@@ -1281,15 +1396,20 @@ const char* mameNameToRealName[] = {
 	"battlera", "Battle Rangers (World)", 
 	"battles", "Battles", 
 	"battlex", "Battle Cross", 
+	"battlntj", "Battlantis (Japan)",
 	"battlnts", "Battlantis (program code G)", 
 	"battlntsa", "Battlantis (program code F)", 
 	"battlntsj", "Battlantis (Japan, program code E)", 
 	"battroad", "The Battle-Road", 
+	"batugnsp", "Batsugun Special Ver.",
+	"bayrouta", "Bay Route (set 2)",
 	"bayroute", "Bay Route (set 3, World, FD1094 317-0116)", 
 	"bayroute1", "Bay Route (set 1, US, unprotected)", 
 	"bayrouteb1", "Bay Route (encrypted, protected bootleg)", 
 	"bayrouteb2", "Bay Route (Datsu bootleg)", 
 	"bayroutej", "Bay Route (set 2, Japan, FD1094 317-0115)", 
+	"bayrtbl1", "Bay Route (bootleg set 1)",
+	"bayrtbl2", "Bay Route (bootleg set 2)",
 	"baywatch", "Baywatch", 
 	"bbakraid", "Battle Bakraid - Unlimited Version (USA) (Tue Jun 8 1999)", 
 	"bbakraidj", "Battle Bakraid - Unlimited Version (Japan) (Tue Jun 8 1999)", 
@@ -1340,6 +1460,7 @@ const char* mameNameToRealName[] = {
 	"beebopd", "Bee Bop (set 5)", 
 	"beebope", "Bee Bop (set 6)", 
 	"beeline", "Beeline (39-360-075)", 
+	"beep", "Beep", 
 	"beetlem", "Beetlemania (set 1)", 
 	"beetlema", "Beetlemania (set 2)", 
 	"beetlemb", "Beetlemania (set 3)", 
@@ -1348,6 +1469,7 @@ const char* mameNameToRealName[] = {
 	"beetleup", "Beetles Unplugged (Russia) (Atronic)", 
 	"beezer", "Beezer (set 1)", 
 	"beezer1", "Beezer (set 2)", 
+	"beezer_sound", "beezer SFX", 
 	"begas", "Bega's Battle (Revision 3)", 
 	"begas1", "Bega's Battle (Revision 1)", 
 	"bel", "Behind Enemy Lines", 
@@ -1358,6 +1480,9 @@ const char* mameNameToRealName[] = {
 	"berenstn", "The Berenstain Bears in Big Paw's Cave", 
 	"berlwall", "The Berlin Wall", 
 	"berlwallt", "The Berlin Wall (bootleg ?)", 
+	"berlwalt", "Berlin Wall, The (set 2)",
+	"bermudaa", "Bermuda Triangle (US early version)",
+	"bermudaj", "Bermuda Triangle (Japan)",
 	"bermudat", "Bermuda Triangle (World?)", 
 	"bermudata", "Bermuda Triangle (World Wars) (US)", 
 	"bermudatj", "Bermuda Triangle (Japan)", 
@@ -1368,6 +1493,10 @@ const char* mameNameToRealName[] = {
 	"bestleag", "Best League (bootleg of Big Striker, Italian Serie A)", 
 	"bestleaw", "Best League (bootleg of Big Striker, World Cup)", 
 	"bestri", "Bestri (Korea)", 
+	"bfm_adder2", "BFM ADDER2", 
+	"bfm_bd1", "BFM BD1 VFD controller", 
+	"bfm_bda", "BFM BDA VFD controller", 
+	"bfm_dm01", "Bellfruit Dotmatrix 01", 
 	"bg_barmy", "Barmy Army (BGT)", 
 	"bg_ddb", "Ding Dong Bells (BGT)", 
 	"bg_max", "Max A Million (BGT) (set 1)", 
@@ -1460,6 +1589,7 @@ const char* mameNameToRealName[] = {
 	"bking2", "Birdie King 2", 
 	"bking3", "Birdie King 3", 
 	"bkrtmaq", "Bakuretsu Quiz Ma-Q Dai Bouken (Japan)", 
+	"bktigerb", "Black Tiger (bootleg)",
 	"black", "Czernyj Korabl (Arcade bootleg of ZX Spectrum 'Blackbeard')", 
 	"black100", "Blackwater 100", 
 	"black100s", "Blackwater 100 (Single Ball Play)", 
@@ -1472,6 +1602,7 @@ const char* mameNameToRealName[] = {
 	"bladestl", "Blades of Steel (version T)", 
 	"bladestle", "Blades of Steel (version E)", 
 	"bladestll", "Blades of Steel (version L)", 
+	"bladstle", "Blades of Steel (version E)",
 	"blakpyra", "Black Pyramid", 
 	"blandia", "Blandia", 
 	"blandiap", "Blandia (prototype)", 
@@ -1486,10 +1617,12 @@ const char* mameNameToRealName[] = {
 	"blazlaz", "Blazing Lazers", 
 	"blazstar", "Blazing Star", 
 	"blbeauty", "Black Beauty (Shuffle)", 
+	"blckgalb", "Block Gal (bootleg)",
 	"blckhole", "Black Hole (Rev. 4)", 
 	"blckhole2", "Black Hole (Rev. 2)", 
 	"blckhols", "Black Hole (Sound Only)", 
 	"blckjack", "Black Jack", 
+	"blckout2", "Block Out (set 2)",
 	"bldwolf", "Bloody Wolf (US)", 
 	"bldwolfj", "Narazumono Sentoubutai Bloody Wolf (Japan)", 
 	"bldyr3b", "Bloody Roar 3 (bootleg)", 
@@ -1503,6 +1636,7 @@ const char* mameNameToRealName[] = {
 	"blitz2k", "NFL Blitz 2000 Gold Edition", 
 	"blitz99", "NFL Blitz '99", 
 	"blkbustr", "BlockBuster", 
+	"blkdrgnb", "Black Dragon (bootleg)",
 	"blkdrgon", "Black Dragon (Japan)", 
 	"blkdrgonb", "Black Dragon (bootleg)", 
 	"blkfever", "Black Fever", 
@@ -1551,6 +1685,8 @@ const char* mameNameToRealName[] = {
 	"bloxeedc", "Bloxeed (World, C System)", 
 	"bloxeedu", "Bloxeed (US, C System)", 
 	"blpearl", "Black Pearl (Russia) (Extrema)", 
+	"blsthead", "Blasteroids (with heads)",
+	"blstroi2", "Blasteroids (version 2)",
 	"blstroid", "Blasteroids (rev 4)", 
 	"blstroid2", "Blasteroids (rev 2)", 
 	"blstroid3", "Blasteroids (rev 3)", 
@@ -1559,6 +1695,7 @@ const char* mameNameToRealName[] = {
 	"blswhstl", "Bells &amp; Whistles (Version L)", 
 	"bluehawk", "Blue Hawk", 
 	"bluehawkn", "Blue Hawk (NTC)", 
+	"blueprnj", "Blue Print (Jaleco)",
 	"blueprnt", "Blue Print (Midway)", 
 	"blueprntj", "Blue Print (Jaleco)", 
 	"blueshrk", "Blue Shark", 
@@ -1633,6 +1770,7 @@ const char* mameNameToRealName[] = {
 	"boggy84b", "Boggy '84 (bootleg)", 
 	"bombbee", "Bomb Bee", 
 	"bomber", "Bomber (bootleg of Scramble)", 
+	"bombjac2", "Bomb Jack (set 2)",
 	"bombjack", "Bomb Jack (set 1)", 
 	"bombjack2", "Bomb Jack (set 2)", 
 	"bombjackt", "Bomb Jack (Tecfri, Spain)", 
@@ -1661,6 +1799,7 @@ const char* mameNameToRealName[] = {
 	"boonggab", "Boong-Ga Boong-Ga (Spank'em!)", 
 	"bootcamp", "Boot Camp", 
 	"boothill", "Boot Hill", 
+	"bootleg_sys16a_sprite", "Bootleg System 16A Sprites", 
 	"bop_l2", "The Machine: Bride of Pinbot (L-2)", 
 	"bop_l3", "The Machine: Bride of Pinbot (L-3)", 
 	"bop_l4", "The Machine: Bride of Pinbot (L-4)", 
@@ -1748,6 +1887,7 @@ const char* mameNameToRealName[] = {
 	"bsharkjjs", "Battle Shark (Japan, Joystick)", 
 	"bsharku", "Battle Shark (US)", 
 	"bsktball", "Basketball", 
+	"bsmt2000", "BSMT2000", 
 	"bsplash", "Banana Splash (set 1)", 
 	"bssoccer", "Back Street Soccer (KRB-0031 PCB)", 
 	"bssoccera", "Back Street Soccer (KRB-0032A PCB)", 
@@ -1807,6 +1947,7 @@ const char* mameNameToRealName[] = {
 	"bubblesp", "Bubbles (prototype version)", 
 	"bubblesr", "Bubbles (Solid Red label)", 
 	"bubbletr", "Bubble Trouble (Japan, Rev C)", 
+	"bubbobr1", "Bubble Bobble (US)",
 	"bubl2000", "Bubble 2000", 
 	"bublbob2", "Bubble Bobble II (Ver 2.5O 1994/10/05)", 
 	"bublbob2p", "Bubble Bobble II (Ver 0.0J 1993/12/13, prototype)", 
@@ -1814,6 +1955,7 @@ const char* mameNameToRealName[] = {
 	"bublbobl1", "Bubble Bobble (Japan, Ver 0.0)", 
 	"bublboblr", "Bubble Bobble (US, Ver 5.1)", 
 	"bublboblr1", "Bubble Bobble (US, Ver 1.0)", 
+	"bublbobr", "Bubble Bobble (US with mode select)",
 	"bublpong", "Bubble Pong Pong", 
 	"bubsymphb", "Bubble Symphony (bootleg with OKI6295)", 
 	"bubsymphe", "Bubble Symphony (Ver 2.5O 1994/10/05)", 
@@ -1831,18 +1973,22 @@ const char* mameNameToRealName[] = {
 	"buckyaab", "Bucky O'Hare (ver AAB)", 
 	"buckyea", "Bucky O'Hare (ver EA)", 
 	"buckyuab", "Bucky O'Hare (ver UAB)", 
+	"buffered_spriteram", "Buffered Sprite RAM", 
 	"bugfever", "Bugs Fever (Version 1.7R CGA)", 
 	"bugfeverd", "Bugs Fever (Version 1.7E CGA)", 
 	"bugfevero", "Bugs Fever (Version 1.6R CGA)", 
 	"bugfeverv", "Bugs Fever (Version 1.7R Dual)", 
 	"bugfeverv2", "Bugs Fever (Version 1.7E Dual)", 
 	"buggyboy", "Buggy Boy/Speed Buggy (cockpit)", 
+	"buggyboy_sound", "Buggy Boy Custom", 
 	"buggyboyjr", "Buggy Boy Junior/Speed Buggy (upright)", 
 	"buggychl", "Buggy Challenge", 
+	"buggychl_mcu", "BuggyChl MCU", 
 	"buggychlt", "Buggy Challenge (Tecfri)", 
 	"bujutsu", "Fighting Bujutsu", 
 	"bullet", "Bullet (FD1094 317-0041)", 
 	"bullfgt", "Bullfight (315-5065)", 
+	"bullfgtj", "Tougyuu, The (Japan)",
 	"bullfgtr", "Bull Fighter", 
 	"bullfgtrs", "Bull Fighter (Sega)", 
 	"bullsdrt", "Bulls Eye Darts", 
@@ -1858,6 +2004,8 @@ const char* mameNameToRealName[] = {
 	"burningf", "Burning Fight (NGM-018)(NGH-018)", 
 	"burningfh", "Burning Fight (NGH-018)(US)", 
 	"burningfp", "Burning Fight (prototype)", 
+	"burningh", "Burning Fight (set 2)",
+	"bus_master_ide_controller", "Bus Master IDE Controller", 
 	"bushido", "Bushido (set 1)", 
 	"bushidoa", "Bushido (set 2)", 
 	"buster", "Buster", 
@@ -1873,13 +2021,19 @@ const char* mameNameToRealName[] = {
 	"bwingso", "B-Wings (Japan old Ver.)", 
 	"bygone", "Bygone", 
 	"bzone", "Battle Zone (rev 2)", 
+	"bzone2", "Battle Zone (set 2)",
 	"bzonea", "Battle Zone (rev 1)", 
 	"bzonec", "Battle Zone (cocktail)", 
+	"c140", "C140", 
+	"c352", "C352", 
 	"c3_ppays", "The Phrase That Pays (Bellfruit) (Cobra 3?)", 
 	"c3_rtime", "Radio Times (Bellfruit) (Cobra 3)", 
 	"c3_telly", "Telly Addicts (Bellfruit) (Cobra 3)", 
 	"c3_totp", "Top of the Pops (Bellfruit) (Cobra 3?)", 
+	"c6280", "HuC6280", 
+	"c6545_1", "C6545-1 CRTC", 
 	"cabal", "Cabal (World, Joystick version)", 
+	"cabal2", "Cabal (US set 2)",
 	"cabala", "Cabal (Alpha Trading)", 
 	"cabalbl", "Cabal (bootleg of Joystick version, set 1, alternate sound hardware)", 
 	"cabalbl2", "Cabal (bootleg of Joystick version, set 2)", 
@@ -1908,12 +2062,14 @@ const char* mameNameToRealName[] = {
 	"calorieb", "Calorie Kun vs Moguranian (bootleg)", 
 	"calspeed", "California Speed (Version 2.1a, 4/17/98)", 
 	"calspeeda", "California Speed (Version 1.0r7a 3/4/98)", 
+	"cameltru", "Camel Try (US)",
 	"cameltry", "Cameltry (US, YM2610)", 
 	"cameltrya", "Cameltry (World, YM2203 + M6295)", 
 	"cameltryau", "Cameltry (US, YM2203 + M6295)", 
 	"cameltryj", "Cameltry (Japan, YM2610)", 
 	"camlight", "Camel Lights", 
 	"canasta", "Canasta '86'", 
+	"canbprot", "Canyon Bomber (prototype)",
 	"candance", "Cannon Dancer (Japan)", 
 	"candy", "Candy Candy", 
 	"cannball", "Cannon Ball (Yun Sung, horizontal)", 
@@ -1941,12 +2097,14 @@ const char* mameNameToRealName[] = {
 	"captavenu", "Captain America and The Avengers (US Rev 1.9)", 
 	"captavenua", "Captain America and The Avengers (US Rev 1.4)", 
 	"captavenuu", "Captain America and The Avengers (US Rev 1.6)", 
+	"captcomj", "Captain Commando (Japan)",
 	"captcomm", "Captain Commando (World 911202)", 
 	"captcommb", "Captain Commando (bootleg)", 
 	"captcommj", "Captain Commando (Japan 911202)", 
 	"captcommjr1", "Captain Commando (Japan 910928)", 
 	"captcommr1", "Captain Commando (World 911014)", 
 	"captcommu", "Captain Commando (USA 910928)", 
+	"captcomu", "Captain Commando (US)",
 	"capunc", "Capitan Uncino (Ver 1.2)", 
 	"car2", "Car 2 (bootleg of Head On 2)", 
 	"caractn", "Car Action (set 1)", 
@@ -1964,9 +2122,11 @@ const char* mameNameToRealName[] = {
 	"carnivalh", "Carnival (Head On hardware, set 1)", 
 	"carnivalha", "Carnival (Head On hardware, set 2)", 
 	"carnking", "Carnival King (v1.00.11)", 
+	"carnvckt", "Carnival (cocktail)",
 	"carpolo", "Car Polo", 
 	"carrera", "Carrera (Version 6.7)", 
 	"cartfury", "Cart Fury", 
+	"cartslot_image", "Cartslot", 
 	"casanova", "Casanova", 
 	"casbjack", "Casino Black Jack (color, Standard 00-05)", 
 	"cascade", "Cascade", 
@@ -2028,6 +2188,7 @@ const char* mameNameToRealName[] = {
 	"cc_12", "Cactus Canyon (1.2)", 
 	"cc_13", "Cactus Canyon (1.3)", 
 	"ccasino", "Chinese Casino [BET] (Japan)", 
+	"ccastle2", "Crystal Castles (set 2)",
 	"ccastles", "Crystal Castles (version 4)", 
 	"ccastles1", "Crystal Castles (version 1)", 
 	"ccastles2", "Crystal Castles (version 2)", 
@@ -2044,18 +2205,33 @@ const char* mameNameToRealName[] = {
 	"cchasm", "Cosmic Chasm (set 1)", 
 	"cchasm1", "Cosmic Chasm (set 2)", 
 	"cclimber", "Crazy Climber (US)", 
+	"cclimber_audio", "cclimber Sound Board", 
 	"cclimberj", "Crazy Climber (Japan)", 
 	"cclimbr2", "Crazy Climber 2 (Japan)", 
 	"cclimbr2a", "Crazy Climber 2 (Japan, Harder)", 
+	"cclimbrj", "Crazy Climber (Japan)",
 	"cclimbroper", "Crazy Climber (Spanish, Operamatic bootleg)", 
 	"cclownz", "Crazzy Clownz (Version 1.0)", 
+	"ccpu", "Cinematronics CPU", 
 	"ccruise", "Caribbean Cruise", 
 	"cd32bios", "CD32 Bios", 
+	"cdda", "CD/DA", 
+	"cdi68070", "CDI68070", 
 	"cdibios", "CD-i Bios", 
+	"cdicdic", "CDICDIC", 
 	"cdiscon1", "Disco No.1 (DECO Cassette)", 
+	"cdislave", "CDISLAVE", 
+	"cdp1802", "CDP1802", 
+	"cdp1852", "CDP1852", 
+	"cdp1869", "RCA CDP1869", 
+	"cdrom", "ATAPI CDROM", 
+	"cdrom_image", "CD-ROM Image", 
 	"cdsteljn", "DS Telejan (DECO Cassette, Japan)", 
 	"cecmatch", "ChuckECheese's Match Game", 
+	"cem3394", "CEM3394", 
 	"centaur", "Centaur", 
+	"centipb2", "Centipede (bootleg set 2)",
+	"centipd2", "Centipede (revision 2)",
 	"centipdb", "Centipede (bootleg)", 
 	"centipdd", "Centipede Dux (hack)", 
 	"centiped", "Centipede (revision 3)", 
@@ -2110,6 +2286,7 @@ const char* mameNameToRealName[] = {
 	"champbb2", "Champion Base Ball Part-2: Pair Play (set 1)", 
 	"champbb2a", "Champion Baseball II (set 2)", 
 	"champbb2j", "Champion Baseball II (Japan)", 
+	"champbbj", "Champion Baseball (Japan)",
 	"champbwl", "Championship Bowling", 
 	"champwr", "Champion Wrestler (World)", 
 	"champwrj", "Champion Wrestler (Japan)", 
@@ -2131,6 +2308,7 @@ const char* mameNameToRealName[] = {
 	"chasehqju", "Chase H.Q. (Japan, upright?)", 
 	"chasehqu", "Chase H.Q. (US)", 
 	"chboxing", "Champion Boxing", 
+	"checkmaj", "Checkman (Japan)",
 	"checkman", "Check Man", 
 	"checkmanj", "Check Man (Japan)", 
 	"checkmat", "Checkmate", 
@@ -2174,6 +2352,9 @@ const char* mameNameToRealName[] = {
 	"choppera", "Chopper I (US set 2)", 
 	"chopperb", "Chopper I (US set 3)", 
 	"choysun", "Choy Sun Doa (20131511, Malaysia)", 
+	"chplft", "Choplifter",
+	"chplftb", "Choplifter (alternate)",
+	"chplftbl", "Choplifter (bootleg)",
 	"chqflag", "Chequered Flag", 
 	"chqflagj", "Chequered Flag (Japan)", 
 	"chry10", "Cherry 10 (bootleg with PIC16F84)", 
@@ -2196,6 +2377,7 @@ const char* mameNameToRealName[] = {
 	"circuscc", "Circus Charlie (Centuri)", 
 	"circusce", "Circus Charlie (Centuri, earlier)", 
 	"circusp", "Circus", 
+	"cirrus_vga", "Cirrus Logic VGA", 
 	"cischeat", "Cisco Heat", 
 	"citalcup", "Champion Italian Cup (bootleg V220IT)", 
 	"citybomb", "City Bomber (World)", 
@@ -2212,11 +2394,13 @@ const char* mameNameToRealName[] = {
 	"cjdh2c", "Chao Ji Da Heng 2 (V215CN)", 
 	"cjffruit", "Funny Fruit (Ver. 1.13)", 
 	"ckong", "Crazy Kong", 
+	"ckonga", "Crazy Kong (set 2)",
 	"ckongalc", "Crazy Kong (Alca bootleg)", 
 	"ckongcv", "Crazy Kong (bootleg on Galaxian hardware, encrypted, set 2)", 
 	"ckongg", "Crazy Kong (bootleg on Galaxian hardware)", 
 	"ckonggx", "Crazy Kong (bootleg on Galaxian hardware, encrypted, set 1)", 
 	"ckongis", "Crazy Kong (bootleg on Galaxian hardware, encrypted, set 3)", 
+	"ckongjeu", "Crazy Kong (Jeutel bootleg)",
 	"ckongmc", "Crazy Kong (bootleg on Moon Cresta hardware)", 
 	"ckongo", "Crazy Kong (Orca bootleg)", 
 	"ckongpt2", "Crazy Kong Part II (set 1)", 
@@ -2253,6 +2437,7 @@ const char* mameNameToRealName[] = {
 	"cloakfr", "Cloak &amp; Dagger (French)", 
 	"cloakgr", "Cloak &amp; Dagger (German)", 
 	"cloaksp", "Cloak &amp; Dagger (Spanish)", 
+	"clock", "Clock", 
 	"clocknch", "Lock'n'Chase (DECO Cassette)", 
 	"closeenc", "Close Encounters of the Third Kind", 
 	"cloud9", "Cloud 9 (prototype)", 
@@ -2306,6 +2491,7 @@ const char* mameNameToRealName[] = {
 	"cnightst", "Night Star (DECO Cassette, set 1)", 
 	"cnightst2", "Night Star (DECO Cassette, set 2)", 
 	"cninja", "Caveman Ninja (World ver 4)", 
+	"cninja0", "Caveman Ninja (World revision 0)",
 	"cninja1", "Caveman Ninja (World ver 1)", 
 	"cninjabl", "Caveman Ninja (bootleg)", 
 	"cninjabl2", "Caveman Ninja (bootleg, alt)", 
@@ -2318,7 +2504,10 @@ const char* mameNameToRealName[] = {
 	"cntrygrla", "Country Girl (Japan set 2)", 
 	"cntsteer", "Counter Steer (Japan)", 
 	"cobra", "Cobra Command (Data East LD, set 1)", 
+	"cobra_jvs", "COBRA_JVS", 
+	"cobra_jvs_host", "COBRA_JVS_HOST", 
 	"cobraa", "Cobra Command (Data East LD, set 2)", 
+	"cobracmj", "Cobra-Command (Japan)",
 	"cobracom", "Cobra-Command (World revision 5)", 
 	"cobracomj", "Cobra-Command (Japan)", 
 	"cobram3", "Cobra Command (M.A.C.H. 3 hardware)", 
@@ -2326,6 +2515,7 @@ const char* mameNameToRealName[] = {
 	"cobraseg", "Cobra Command (Sega LaserDisc Hardware)", 
 	"code1d", "Code One Dispatch (ver D)", 
 	"code1db", "Code One Dispatch (ver B)", 
+	"cojag_hdd", "cojag HDD", 
 	"colmns97", "Columns '97 (JET 961209 V1.000)", 
 	"colony7", "Colony 7 (set 1)", 
 	"colony7a", "Colony 7 (set 2)", 
@@ -2344,6 +2534,10 @@ const char* mameNameToRealName[] = {
 	"columns2", "Columns II: The Voyage Through Time (World)", 
 	"columnsj", "Columns (Japan)", 
 	"columnsu", "Columns (US, cocktail)", 
+	"combasc", "Combat School (joystick)",
+	"combascb", "Combat School (bootleg)",
+	"combascj", "Combat School (Japan trackball)",
+	"combasct", "Combat School (trackball)",
 	"combat", "Combat (version 3.0)", 
 	"combatsc", "Combat School (joystick)", 
 	"combatscb", "Combat School (bootleg)", 
@@ -2390,12 +2584,14 @@ const char* mameNameToRealName[] = {
 	"comg5108", "Cal Omega - Game 51.08 (CEI Video Poker, Jacks or Better)", 
 	"comg903d", "Cal Omega - System 903 Diag.PROM", 
 	"comg905d", "Cal Omega - System 905 Diag.PROM", 
+	"commandj", "Senjo no Ookami",
 	"commando", "Commando (World)", 
 	"commandob", "Commando (bootleg set 1)", 
 	"commandob2", "Commando (bootleg set 2)", 
 	"commandoj", "Senjou no Ookami", 
 	"commandou", "Commando (US set 1)", 
 	"commandou2", "Commando (US set 2)", 
+	"commandu", "Commando (US)",
 	"commandw", "Command War - Super Special Battle &amp; War Game (Ver 0.0J) (Prototype)", 
 	"commsega", "Commando (Sega)", 
 	"comotion", "Comotion", 
@@ -2422,6 +2618,7 @@ const char* mameNameToRealName[] = {
 	"contrabj1", "Contra (Japan bootleg, set 2)", 
 	"contraj", "Contra (Japan, set 1)", 
 	"contraj1", "Contra (Japan, set 2)", 
+	"contrajb", "Contra (Japan bootleg)",
 	"cookbib", "Cookie &amp; Bibi (set 1)", 
 	"cookbib2", "Cookie &amp; Bibi 2", 
 	"cookbib3", "Cookie &amp; Bibi 3", 
@@ -2433,6 +2630,9 @@ const char* mameNameToRealName[] = {
 	"coozumou", "Oozumou - The Grand Sumo (DECO Cassette, Japan)", 
 	"cop01", "Cop 01 (set 1)", 
 	"cop01a", "Cop 01 (set 2)", 
+	"cop402", "COP402", 
+	"cop420", "COP420", 
+	"cop421", "COP421", 
 	"cops", "Cops", 
 	"copsnrob", "Cops'n Robbers", 
 	"coralr2", "Coral Riches II (1VXFC5472, New Zealand)", 
@@ -2455,6 +2655,7 @@ const char* mameNameToRealName[] = {
 	"cosmo", "Cosmo", 
 	"cosmogng", "Cosmo Gang the Video (US)", 
 	"cosmogngj", "Cosmo Gang the Video (Japan)", 
+	"cosmognj", "Cosmo Gang the Video (Japan)",
 	"cosmos", "Cosmos", 
 	"cotton", "Cotton (set 4, World, FD1094 317-0181a)", 
 	"cotton2", "Cotton 2 (JUET 970902 V1.000)", 
@@ -2486,6 +2687,7 @@ const char* mameNameToRealName[] = {
 	"cprogolf", "Tournament Pro Golf (DECO Cassette)", 
 	"cprogolf18", "18 Challenge Pro Golf (DECO Cassette, Japan)", 
 	"cprogolfj", "Tournament Pro Golf (DECO Cassette, Japan)", 
+	"cps3_custom", "CPS3 Custom", 
 	"cps3boot", "CPS3 Multi-game bootleg for HD6417095 type SH2 (New Generation, 3rd Strike, JoJo's Venture, JoJo's Bizarre Adventure, Red Earth)", 
 	"cps3boota", "CPS3 Multi-game bootleg for dead security cart (New Generation, 2nd Impact, 3rd Strike)", 
 	"cps3bs32", "Street Fighter III 2nd Impact: Giant Attack (USA 970930, bootleg for HD6417095 type SH2, V3)", 
@@ -2496,6 +2698,10 @@ const char* mameNameToRealName[] = {
 	"cpthook", "Captain Hook", 
 	"cpzn1", "ZN1", 
 	"cpzn2", "ZN2", 
+	"cquestlin", "Cube Quest Line CPU", 
+	"cquestrot", "Cube Quest Rotate CPU", 
+	"cquestsnd", "Cube Quest Sound CPU", 
+	"cr589", "Matsushita CR589", 
 	"cr589fw", "CD-ROM Drive Updater 2.0 (700B04)", 
 	"cr589fwa", "CD-ROM Drive Updater (700A04)", 
 	"crackndj", "Crackin' DJ", 
@@ -2507,6 +2713,7 @@ const char* mameNameToRealName[] = {
 	"crazycop", "Crazy Cop (Japan)", 
 	"crazyfgt", "Crazy Fight", 
 	"crazywar", "Crazy War", 
+	"crbalon2", "Crazy Balloon (set 2)",
 	"crbaloon", "Crazy Balloon (set 1)", 
 	"crbaloon2", "Crazy Balloon (set 2)", 
 	"crgolf", "Crowns Golf (834-5419-04)", 
@@ -2524,6 +2731,8 @@ const char* mameNameToRealName[] = {
 	"crimfght", "Crime Fighters (US 4 players)", 
 	"crimfght2", "Crime Fighters (World 2 Players)", 
 	"crimfghtj", "Crime Fighters (Japan 2 Players)", 
+	"crimfgt2", "Crime Fighters (World 2 Players)",
+	"crimfgtj", "Crime Fighters (Japan 2 Players)",
 	"crisscrs", "Criss Cross (Sweden)", 
 	"critcrsh", "Critter Crusher (EA 951204 V1.000)", 
 	"crkdown", "Crack Down (World, Floppy Based, FD1094 317-0058-04c)", 
@@ -2673,7 +2882,19 @@ const char* mameNameToRealName[] = {
 	"cvsgd", "Capcom Vs. SNK Millennium Fight 2000 Pro (GDL-0004)", 
 	"cworld", "Capcom World (Japan)", 
 	"cworld2j", "Adventure Quiz Capcom World 2 (Japan 920611)", 
+	"cxd8514q", "CXD8514Q", 
+	"cxd8530aq", "CXD8530AQ", 
+	"cxd8530bq", "CXD8530BQ", 
+	"cxd8530cq", "CXD8530CQ", 
+	"cxd8538q", "CXD8538Q", 
+	"cxd8561cq", "CXD8561CQ", 
+	"cxd8561q", "CXD8561Q", 
+	"cxd8606bq", "CXD8606BQ", 
+	"cxd8654q", "CXD8654Q", 
+	"cxd8661r", "CXD8661R", 
 	"cybattlr", "Cybattler", 
+	"cyberb2p", "Cyberball 2072 (2 player)",
+	"cyberba2", "Cyberball (Version 2)",
 	"cyberbal", "Cyberball (rev 4)", 
 	"cyberbal2", "Cyberball (rev 2)", 
 	"cyberbal2p", "Cyberball 2072 (2 player, rev 4)", 
@@ -2683,6 +2904,7 @@ const char* mameNameToRealName[] = {
 	"cyberbalp", "Cyberball (prototype)", 
 	"cyberbalt", "Tournament Cyberball 2072 (rev 2)", 
 	"cyberbalt1", "Tournament Cyberball 2072 (rev 1)", 
+	"cyberbt", "Tournament Cyberball 2072",
 	"cyberlip", "Cyber-Lip (NGM-010)", 
 	"cybertnk", "Cyber Tank (v1.4)", 
 	"cybots", "Cyberbots: Fullmetal Madness (Euro 950424)", 
@@ -2724,6 +2946,7 @@ const char* mameNameToRealName[] = {
 	"czmon_9b", "Crazy Monkey (bootleg, 070315, VIDEO GAME-1 O01 set 2)", 
 	"czmon_9c", "Crazy Monkey (bootleg, 070315, payout percentage 70)", 
 	"d9final", "Dream 9 Final (v2.24)", 
+	"dac", "DAC", 
 	"dacholer", "Dacholer", 
 	"dadandrn", "Kyukyoku Sentai Dadandarn (ver JAA)", 
 	"dai2kaku", "Dai-Dai-Kakumei (Japan)", 
@@ -2777,6 +3000,8 @@ const char* mameNameToRealName[] = {
 	"darkhors", "Dark Horse (bootleg of Jockey Club II)", 
 	"darkmist", "The Lost Castle In Darkmist", 
 	"darkplnt", "Dark Planet", 
+	"darksea1", "Dark Seal (World revision 1)",
+	"darkseaj", "Dark Seal (Japan)",
 	"darkseal", "Dark Seal (World revision 3)", 
 	"darkseal1", "Dark Seal (World revision 1)", 
 	"darkseal2", "Dark Seal 2 (Japan v2.1)", 
@@ -2807,6 +3032,7 @@ const char* mameNameToRealName[] = {
 	"dblchalo", "Double Challenge (Version 1.1)", 
 	"dblchalv1", "Double Challenge (Version 1.5R Dual)", 
 	"dblcrown", "Double Crown (v1.0.3)", 
+	"dbldyn", "Double Dynamites, The",
 	"dbldynj", "The Double Dynamites (Japan)", 
 	"dbldynu", "The Double Dynamites (US)", 
 	"dblewing", "Double Wings", 
@@ -2822,6 +3048,7 @@ const char* mameNameToRealName[] = {
 	"dcclub", "Dynamic Country Club (World, ROM Based)", 
 	"dcclubfd", "Dynamic Country Club (US, Floppy Based, FD1094 317-0058-09d)", 
 	"dcclubj", "Dynamic Country Club (Japan, ROM Based)", 
+	"dcctrl", "DC_CONTROLLER", 
 	"dcheese", "Double Cheese", 
 	"dcon", "D-Con", 
 	"dcrown", "Dream Crown (Set 1)", 
@@ -2891,6 +3118,7 @@ const char* mameNameToRealName[] = {
 	"ddr4msj", "Dance Dance Revolution 4th Mix Solo (G*A33 VER. JBA)", 
 	"ddr5m", "Dance Dance Revolution 5th Mix (G*A27 VER. JAA)", 
 	"ddra", "Dance Dance Revolution (GN845 VER. AAA)", 
+	"ddrago3b", "Double Dragon 3 - The Rosetta Stone (bootleg)",
 	"ddragon", "Double Dragon (Japan)", 
 	"ddragon2", "Double Dragon II - The Revenge (World)", 
 	"ddragon2u", "Double Dragon II - The Revenge (US)", 
@@ -2956,6 +3184,7 @@ const char* mameNameToRealName[] = {
 	"dduxj", "Dynamite Dux (set 2, Japan, FD1094 317-0094)", 
 	"ddz", "Dou Di Zhu", 
 	"deadang", "Dead Angle", 
+	"deadconj", "Dead Connection (Japan)",
 	"deadconx", "Dead Connection (World)", 
 	"deadconxj", "Dead Connection (Japan)", 
 	"deadeye", "Dead Eye", 
@@ -2968,7 +3197,29 @@ const char* mameNameToRealName[] = {
 	"deathsml", "Deathsmiles (2007/10/09 MASTER VER)", 
 	"decathlt", "Decathlete (JUET 960709 V1.001)", 
 	"decathlto", "Decathlete (JUET 960424 V1.000)", 
+	"deco104", "DECO104PROT", 
+	"deco146", "DECO146PROT", 
+	"deco16", "DECO16", 
+	"deco16ic", "Data East IC 55 / 56 / 74 / 141", 
+	"deco222", "DECO 222", 
+	"deco_bac06", "decbac06_device", 
+	"deco_karnovsprites", "karnovsprites_device", 
+	"deco_mxc06", "decmxc06_device", 
+	"decobsmt", "Data East/Sega/Stern BSMT2000 Sound Board", 
+	"decoc10707", "DECO C10707", 
 	"decocass", "DECO Cassette System", 
+	"decocass_tape", "DECO Cassette Tape", 
+	"decocomn", "Data East Common Video Functions", 
+	"decocpu1", "Data East Pinball CPU Board Type 1", 
+	"decocpu2", "Data East Pinball CPU Board Type 2", 
+	"decocpu3", "Data East Pinball CPU Board Type 3", 
+	"decocpu3b", "Data East Pinball CPU Board Type 3B", 
+	"decocpu6", "DECO CPU-6", 
+	"decocpu7", "DECO CPU-7", 
+	"decodmd1", "Data East Pinball Dot Matrix Display Type 1", 
+	"decodmd2", "Data East Pinball Dot Matrix Display Type 2", 
+	"decodmd3", "Data East Pinball Dot Matrix Display Type 3", 
+	"decospr", "decospr_device", 
 	"deerhunt", "Deer Hunting USA V4.3", 
 	"deerhunta", "Deer Hunting USA V4.2", 
 	"deerhuntb", "Deer Hunting USA V4.0", 
@@ -2981,6 +3232,8 @@ const char* mameNameToRealName[] = {
 	"defenderb", "Defender (Blue label)", 
 	"defenderg", "Defender (Green label)", 
 	"defenderw", "Defender (White label)", 
+	"defendg", "Defender (Green label)",
+	"defendw", "Defender (White label)",
 	"defense", "Defense (System 16B, FD1089A 317-0028)", 
 	"defndjeu", "Defender (bootleg)", 
 	"deltrace", "Delta Race", 
@@ -3017,6 +3270,8 @@ const char* mameNameToRealName[] = {
 	"desertdn", "Desert Dan", 
 	"desertgu", "Desert Gun", 
 	"desertwr", "Desert War / Wangan Sensou", 
+	"destderb", "Demolition Derby",
+	"destderm", "Demolition Derby (2-Player Mono Board Version)",
 	"destdrby", "Destruction Derby [TTL]", 
 	"desterth", "Destination Earth (bootleg of Lunar Rescue)", 
 	"destiny", "Destiny - The Fortuneteller (USA)", 
@@ -3027,9 +3282,12 @@ const char* mameNameToRealName[] = {
 	"detatwin", "Detana!! Twin Bee (Japan ver. J)", 
 	"detest", "Data East Test Chip", 
 	"deucesw2", "Deuces Wild 2 - American Heritage (Ver. 2.02F)", 
+	"devcb2_line_dispatch", "Line dispatcher (2 slots)", 
 	"devilfsg", "Devil Fish (Galaxian hardware, bootleg?)", 
 	"devilfsh", "Devil Fish", 
 	"devilw", "Devil World", 
+	"devstor2", "Devastators (version X)",
+	"devstor3", "Devastators (version V)",
 	"devstors", "Devastators (ver. Z)", 
 	"devstors2", "Devastators (ver. X)", 
 	"devstors3", "Devastators (ver. V)", 
@@ -3052,12 +3310,15 @@ const char* mameNameToRealName[] = {
 	"digdug", "Dig Dug (rev 2)", 
 	"digdug1", "Dig Dug (rev 1)", 
 	"digdug2", "Dig Dug II (New Ver.)", 
+	"digdug2a", "Dig Dug II (set 2)",
 	"digdug2o", "Dig Dug II (Old Ver.)", 
 	"digdugat", "Dig Dug (Atari, rev 2)", 
 	"digdugat1", "Dig Dug (Atari, rev 1)", 
+	"digdugb", "Dig Dug (set 2)",
 	"digger", "Digger", 
 	"diggerc", "Digger (CVS)", 
 	"diggerma", "Digger Man (prototype)", 
+	"digitalker", "Digitalker", 
 	"digsid", "Dig Dug (manufactured by Sidam)", 
 	"dimahoo", "Dimahoo (Euro 000121)", 
 	"dimahoou", "Dimahoo (USA 000121)", 
@@ -3088,6 +3349,7 @@ const char* mameNameToRealName[] = {
 	"discoboy", "Disco Boy", 
 	"discoboyp", "Disco Boy (Promat license?)", 
 	"discof", "Disco No.1 (Rev.F)", 
+	"discrete", "DISCRETE", 
 	"ditrio", "Diamond Trio (set 1)", 
 	"diverboy", "Diver Boy", 
 	"djboy", "DJ Boy (set 1)", 
@@ -3097,6 +3359,9 @@ const char* mameNameToRealName[] = {
 	"dkgensanm72", "Daiku no Gensan (Japan, M72)", 
 	"dking", "Donkey King", 
 	"dkingjr", "Donkey King Jr. (bootleg of Donkey Kong Jr.)", 
+	"dkjrbl", "Donkey Kong Junior (bootleg?)",
+	"dkjrjp", "Donkey Kong Junior (Japan)",
+	"dkngjrjp", "Donkey Kong Jr. (Original Japanese)",
 	"dkong", "Donkey Kong (US set 1)", 
 	"dkong3", "Donkey Kong 3 (US)", 
 	"dkong3b", "Donkey Kong 3 (bootleg on Donkey Kong Jr. hardware)", 
@@ -3107,6 +3372,8 @@ const char* mameNameToRealName[] = {
 	"dkongjnrj", "Donkey Kong Junior (Japan?)", 
 	"dkongjo", "Donkey Kong (Japan set 2)", 
 	"dkongjo1", "Donkey Kong (Japan set 3)", 
+	"dkongjp", "Donkey Kong (Japan set 1)",
+	"dkongjpo", "Donkey Kong (Japan set 2)",
 	"dkongjr", "Donkey Kong Junior (US set F-2)", 
 	"dkongjrb", "Donkey Kong Jr. (bootleg)", 
 	"dkongjre", "Donkey Kong Junior (E kit)", 
@@ -3140,6 +3407,7 @@ const char* mameNameToRealName[] = {
 	"dleaguej", "Dynamite League (Japan)", 
 	"dleuro", "Dragon's Lair (European)", 
 	"dlital", "Dragon's Lair (Italian)", 
+	"dm9368", "DM9368", 
 	"dm_h5", "Demolition Man (H-5)", 
 	"dm_h6", "Demolition Man (H-6)", 
 	"dm_la1", "Demolition Man (LA-1)", 
@@ -3147,6 +3415,7 @@ const char* mameNameToRealName[] = {
 	"dm_lx4", "Demolition Man (LX-4)", 
 	"dm_pa2", "Demolition Man (PA-2)", 
 	"dm_px5", "Demolition Man (PX-5)", 
+	"dmadac", "DMA-driven DAC", 
 	"dmdtouch", "Diamond Touch (0400433V, Local)", 
 	"dmndrby", "Diamond Derby (Newer)", 
 	"dmndrbya", "Diamond Derby (Original)", 
@@ -3165,6 +3434,7 @@ const char* mameNameToRealName[] = {
 	"doa2m", "Dead or Alive 2 Millennium (JPN, USA, EXP, KOR, AUS)", 
 	"doaa", "Dead or Alive (Model 2A, Revision A)", 
 	"doapp", "Dead Or Alive ++ (Japan)", 
+	"docastl2", "Mr. Do's Castle (set 2)",
 	"docastle", "Mr. Do's Castle (set 1)", 
 	"docastle2", "Mr. Do's Castle (set 2)", 
 	"docastleo", "Mr. Do's Castle (older)", 
@@ -3214,10 +3484,13 @@ const char* mameNameToRealName[] = {
 	"doraemon", "Doraemon no Eawase Montage (prototype)", 
 	"dorodon", "Dorodon (set 1)", 
 	"dorodon2", "Dorodon (set 2)", 
+	"dorunru2", "Do! Run Run (set 2)",
+	"dorunruc", "Do! Run Run (Do's Castle hardware)",
 	"dorunrun", "Do! Run Run (set 1)", 
 	"dorunrun2", "Do! Run Run (set 2)", 
 	"dorunrunc", "Do! Run Run (Do's Castle hardware, set 1)", 
 	"dorunrunca", "Do! Run Run (Do's Castle hardware, set 2)", 
+	"dotriku2", "Dottori Kun (old version)",
 	"dotrikun", "Dottori Kun (new version)", 
 	"dotrikun2", "Dottori Kun (old version)", 
 	"dotron", "Discs of Tron (Upright)", 
@@ -3318,8 +3591,14 @@ const char* mameNameToRealName[] = {
 	"drtoppelu", "Dr. Toppel's Adventure (US)", 
 	"drw80pk2", "Draw 80 Poker - Minn", 
 	"drw80pkr", "Draw 80 Poker", 
+	"ds1204", "DS1204", 
+	"ds1302", "DS1302", 
+	"ds2401", "DS2401", 
+	"ds2404", "DS2404", 
+	"ds5002fp", "DS5002FP", 
 	"dsaber", "Dragon Saber", 
 	"dsaberj", "Dragon Saber (Japan, Rev B)", 
+	"dsbz80", "Sega Z80-based Digital Sound Board", 
 	"dsem", "Dancing Stage Euro Mix (G*936 VER. EAA)", 
 	"dsem2", "Dancing Stage Euro Mix 2 (G*C23 VER. EAA)", 
 	"dsfdct", "Dancing Stage featuring Dreams Come True (GC910 VER. JCA)", 
@@ -3331,9 +3610,13 @@ const char* mameNameToRealName[] = {
 	"dsmbl", "Deathsmiles MegaBlack Label (2008/10/06 MEGABLACK LABEL VER)", 
 	"dsoccr94", "Dream Soccer '94 (World, M107 hardware)", 
 	"dsoccr94j", "Dream Soccer '94 (Japan, M92 hardware)", 
+	"dsp16", "DSP16", 
+	"dsp32c", "DSP32C", 
+	"dsp56156", "DSP56156", 
 	"dspirit", "Dragon Spirit (new version (DS3))", 
 	"dspirit1", "Dragon Spirit (old version (DS1))", 
 	"dspirit2", "Dragon Spirit (DS2)", 
+	"dspirito", "Dragon Spirit (old version)",
 	"dstage", "Dancing Stage - Internet Ranking Ver (GC845 VER. EBA)", 
 	"dstagea", "Dancing Stage (GN845 VER. EAA)", 
 	"dstlk", "Darkstalkers: The Night Warriors (Euro 940705)", 
@@ -3356,6 +3639,7 @@ const char* mameNameToRealName[] = {
 	"dunkmnia", "Dunk Mania (Asia, DM2/VER.C)", 
 	"dunkmniajc", "Dunk Mania (Japan, DM1/VER.C)", 
 	"dunkshot", "Dunk Shot (FD1089A 317-0022)", 
+	"dvg", "DVG", 
 	"dvisland", "Devil Island (Version 1.4R CGA)", 
 	"dvislando", "Devil Island (Version 1.0R CGA)", 
 	"dvlrider", "Devil Riders", 
@@ -3371,6 +3655,7 @@ const char* mameNameToRealName[] = {
 	"dwarfd", "Draw Poker III / Dwarfs Den (Dwarf Gfx)", 
 	"dwarfda", "Draw Poker III / Dwarfs Den (Card Gfx)", 
 	"dwex", "Dragon World 3 EX (ver. 100)", 
+	"dwj", "Tenchi wo Kurau (Japan)",
 	"dwpc", "Dragon World Pretty Chance (V101, Japan)", 
 	"dybb99", "Dynamite Baseball '99 (JPN) / World Series '99 (USA, EXP, KOR, AUS) (Rev B)", 
 	"dybbnao", "Dynamite Baseball NAOMI (JPN)", 
@@ -3402,10 +3687,17 @@ const char* mameNameToRealName[] = {
 	"dynwarj", "Tenchi wo Kurau (Japan)", 
 	"dynwarjr", "Tenchi wo Kurau (Japan Resale Ver.)", 
 	"dzigzag", "Zig Zag (Dig Dug hardware)", 
+	"e116t", "E1-16T", 
+	"e116xt", "E1-16XT", 
+	"e132n", "E1-32N", 
+	"e132t", "E1-32T", 
+	"e132xn", "E1-32XN", 
+	"e132xt", "E1-32XT", 
 	"eagle", "Eagle (set 1)", 
 	"eagle2", "Eagle (set 2)", 
 	"eagle3", "Eagle (set 3)", 
 	"eaglshot", "Eagle Shot Golf", 
+	"earthinv", "Super Earth Invasion",
 	"earthjkr", "U.N. Defense Force: Earth Joker (Japan)", 
 	"earthjkrp", "U.N. Defense Force: Earth Joker (Japan, prototype?)", 
 	"eatpm_4g", "Elvira and the Party Monsters (LG-4)", 
@@ -3927,6 +4219,7 @@ const char* mameNameToRealName[] = {
 	"eightfrc", "Eight Forces", 
 	"eightman", "Eight Man (NGM-025)(NGH-025)", 
 	"einning", "Extra Inning / Ball Park II", 
+	"einnings", "Extra Innings",
 	"ejanhs", "E-Jan High School (Japan)", 
 	"ejihon", "Ejihon Tantei Jimusyo (J 950613 V1.000)", 
 	"ejollyx5", "Euro Jolly X5", 
@@ -3935,11 +4228,13 @@ const char* mameNameToRealName[] = {
 	"ejsakura12", "E-Jan Sakurasou (Japan, SYS386F V1.2)", 
 	"elandore", "Touryuu Densetsu Elan-Doree / Elan Doree - Legend of Dragoon (JUET 980922 V1.006)", 
 	"eldorado", "El Dorado City of Gold", 
+	"elecyoy2", "Electric Yo-Yo, The (set 2)",
 	"elecyoyo", "The Electric Yo-Yo (set 1)", 
 	"elecyoyo2", "The Electric Yo-Yo (set 2)", 
 	"elektra", "Elektra", 
 	"elephfam", "Elephant Family (Italian, new)", 
 	"elephfmb", "Elephant Family (Italian, old)", 
+	"elevatob", "Elevator Action (bootleg)",
 	"elevator", "Elevator Action", 
 	"elevatorb", "Elevator Action (bootleg)", 
 	"elgrande", "El Grande - 5 Card Draw (New)", 
@@ -4783,14 +5078,22 @@ const char* mameNameToRealName[] = {
 	"ep_xspotb", "X Marks The Spot (Maygay) (EPOCH) (1.4, set 3)", 
 	"ep_xtra", "X-tra X-tra (Maygay) (EPOCH) (1.5, set 1)", 
 	"ep_xtraa", "X-tra X-tra (Maygay) (EPOCH) (1.5, set 2)", 
+	"epic12", "epic12_device", 
 	"eprom", "Escape from the Planet of the Robot Monsters (set 1)", 
 	"eprom2", "Escape from the Planet of the Robot Monsters (set 2)", 
 	"equites", "Equites", 
 	"equitess", "Equites (Sega)", 
+	"er2055", "ER2055", 
+	"er5911_16", "Serial EEPROM ER5911 (64x16)", 
+	"er5911_8", "Serial EEPROM ER5911 (128x8)", 
 	"erosone", "Eros One", 
 	"ertictac", "Erotictac/Tactic", 
 	"ertictaca", "Erotictac/Tactic (ver 01)", 
 	"ertictacb", "Erotictac/Tactic (set 2)", 
+	"es5503", "Ensoniq ES5503", 
+	"es5505", "ES5505", 
+	"es5506", "ES5506", 
+	"es8712", "ES8712", 
 	"esb", "The Empire Strikes Back", 
 	"escape", "Escape", 
 	"esckids", "Escape Kids (Asia, 4 Players)", 
@@ -4811,10 +5114,12 @@ const char* mameNameToRealName[] = {
 	"espgal", "Espgaluda (2003/10/15 Master Ver)", 
 	"espgal2", "Espgaluda II (2005/11/14 MASTER VER)", 
 	"espial", "Espial (Europe)", 
+	"espiale", "Espial (Europe)",
 	"espialu", "Espial (US?)", 
 	"esprade", "ESP Ra.De. (International, Ver. 98/04/22)", 
 	"espradej", "ESP Ra.De. (Japan, Ver. 98/04/21)", 
 	"espradejo", "ESP Ra.De. (Japan, Ver. 98/04/14)", 
+	"esrip", "ESRIP", 
 	"eswat", "E-Swat - Cyber Police (set 4, World, FD1094 317-0130)", 
 	"eswatbl", "E-Swat - Cyber Police (bootleg)", 
 	"eswatj", "E-Swat - Cyber Police (set 2, Japan, FD1094 317-0128)", 
@@ -4844,6 +5149,8 @@ const char* mameNameToRealName[] = {
 	"excthour", "Exciting Hour", 
 	"exctleag", "Excite League (FD1094 317-0079)", 
 	"exctscc2", "Exciting Soccer II", 
+	"exctscca", "Exciting Soccer (alternate music)",
+	"exctsccb", "Exciting Soccer (bootleg)",
 	"exctsccr", "Exciting Soccer", 
 	"exctsccra", "Exciting Soccer (alternate music)", 
 	"exctsccrb", "Exciting Soccer (bootleg)", 
@@ -4856,6 +5163,9 @@ const char* mameNameToRealName[] = {
 	"exeriont", "Exerion (Taito)", 
 	"exerizer", "Exerizer (Japan)", 
 	"exerizerb", "Exerizer (Japan) (bootleg)", 
+	"exerizrb", "Exerizer (Japan) (bootleg)",
+	"exidy440_sound", "Exidy 440 CVSD", 
+	"exidy_sfx", "Exidy SFX", 
 	"exodus", "Exodus (bootleg?)", 
 	"expcard", "Express Card / Top Card (Ver. 1.5)", 
 	"explbrkr", "Explosive Breaker", 
@@ -4940,6 +5250,7 @@ const char* mameNameToRealName[] = {
 	"fantzone1", "Fantasy Zone (unprotected)", 
 	"fantzonep", "Fantasy Zone (317-5000)", 
 	"fantzonepr", "Fantasy Zone (prototype)", 
+	"fantzono", "Fantasy Zone (Old Ver.)",
 	"farfalla", "Farfalla", 
 	"farfallag", "Farfalla (German speech)", 
 	"farfallai", "Farfalla (Italian speech)", 
@@ -5064,6 +5375,9 @@ const char* mameNameToRealName[] = {
 	"fcockt_9", "Fruit Cocktail (070305 Russia)", 
 	"fcombat", "Field Combat", 
 	"fcrash", "Final Crash (bootleg of Final Fight)", 
+	"fd1089a", "FD1089A", 
+	"fd1089b", "FD1089B", 
+	"fd1094", "FD1094", 
 	"fearless", "Fearless Pinocchio (V101US)", 
 	"fenix", "Fenix (bootleg of Phoenix)", 
 	"feversoc", "Fever Soccer", 
@@ -5116,10 +5430,14 @@ const char* mameNameToRealName[] = {
 	"fhunter", "Fortune Hunter (2XF5196I01, USA)", 
 	"fhuntera", "Fortune Hunter (2XF5196I02, USA)", 
 	"fieldday", "Field Day", 
+	"fifo7200", "IDT7200 FIFO", 
 	"fightfev", "Fight Fever (set 1)", 
 	"fightfeva", "Fight Fever (set 2)", 
 	"fightrol", "Fighting Roller", 
 	"filetto", "Filetto (v1.05 901009)", 
+	"filetto_cga", "ISA8_CGA_FILETTO", 
+	"filter_rc", "RC Filter", 
+	"filter_volume", "Volume Filter", 
 	"filthyr", "Filthy Rich (Russia)", 
 	"finalap2", "Final Lap 2", 
 	"finalap2j", "Final Lap 2 (Japan)", 
@@ -5136,6 +5454,7 @@ const char* mameNameToRealName[] = {
 	"finalbny", "Mahjong Final Bunny [BET] (Japan)", 
 	"finalbu", "Final Blow (US)", 
 	"finalgdr", "Final Godori (Korea, version 2.20.5915)", 
+	"finalizb", "Finalizer - Super Transformation (bootleg)",
 	"finalizr", "Finalizer - Super Transformation", 
 	"finalizrb", "Finalizer - Super Transformation (bootleg)", 
 	"finallap", "Final Lap (Rev E)", 
@@ -5167,6 +5486,7 @@ const char* mameNameToRealName[] = {
 	"fireshrka", "Fire Shark (earlier)", 
 	"fireshrkd", "Fire Shark (Korea, set 1, easier)", 
 	"fireshrkdh", "Fire Shark (Korea, set 2, harder)", 
+	"firetpbl", "Fire Trap (Japan bootleg)",
 	"firetrap", "Fire Trap (US)", 
 	"firetrapbl", "Fire Trap (Japan bootleg)", 
 	"firetrapj", "Fire Trap (Japan)", 
@@ -5194,6 +5514,7 @@ const char* mameNameToRealName[] = {
 	"fixeighttwt", "FixEight (Taiwan, Taito license)", 
 	"fixeightu", "FixEight (USA)", 
 	"fixeightut", "FixEight (USA, Taito license)", 
+	"fixfreq", "FIXFREQ", 
 	"fjbuster", "Fujiyama Buster (Japan)", 
 	"fjholden", "FJ Holden", 
 	"flamegun", "Flame Gunner", 
@@ -5209,6 +5530,7 @@ const char* mameNameToRealName[] = {
 	"flashgdnv", "Flash Gordon (Vocalizer sound)", 
 	"flicker", "Flicker (prototype)", 
 	"flicky", "Flicky (128k Version, System 2, 315-5051)", 
+	"flicky2", "Flicky (set 2)",
 	"flickyo", "Flicky (64k Version, System 1, 315-5051, set 1)", 
 	"flickys1", "Flicky (64k Version, System 1, 315-5051, set 2)", 
 	"flickys2", "Flicky (128k Version, System 2, not encrypted)", 
@@ -5220,6 +5542,7 @@ const char* mameNameToRealName[] = {
 	"flkatck", "Flak Attack (Japan)", 
 	"flkatcka", "Flak Attack (Japan, PWB 450593 sub-board)", 
 	"flower", "Flower (US)", 
+	"flower_sound", "Flower Custom Sound", 
 	"flowerj", "Flower (Japan)", 
 	"flstory", "The FairyLand Story", 
 	"flstoryj", "The FairyLand Story (Japan)", 
@@ -5297,8 +5620,11 @@ const char* mameNameToRealName[] = {
 	"froggers", "Frog", 
 	"froggers1", "Frogger (Sega set 1)", 
 	"froggers2", "Frogger (Sega set 2)", 
+	"froggrmc", "Frogger (modified Moon Cresta hardware)",
 	"froggrs", "Frogger (Scramble hardware)", 
 	"frogs", "Frogs", 
+	"frogseg1", "Frogger (Sega set 1)",
+	"frogseg2", "Frogger (Sega set 2)",
 	"fromanc2", "Taisen Idol-Mahjong Final Romance 2 (Japan)", 
 	"fromanc4", "Taisen Mahjong Final Romance 4 (Japan)", 
 	"fromance", "Idol-Mahjong Final Romance (Japan)", 
@@ -5337,7 +5663,9 @@ const char* mameNameToRealName[] = {
 	"ftimpactj", "Fighters' Impact (Ver 2.02J)", 
 	"ftimpactu", "Fighters' Impact (Ver 2.02A)", 
 	"ftimpcta", "Fighters' Impact A (Ver 2.00J)", 
+	"ftsoccer", "Fighting Soccer",
 	"ftspeed", "Faster Than Speed", 
+	"fujitsu_29f016a", "Fujitsu 29F016A Flash", 
 	"fullthrl", "Full Throttle (Japan)", 
 	"fun4", "Fun Four (Set 1) [TTL]", 
 	"fun4a", "Fun Four (Set 2) [TTL]", 
@@ -5347,6 +5675,7 @@ const char* mameNameToRealName[] = {
 	"funcube3", "Funcube 3 (v1.1)", 
 	"funcube4", "Funcube 4 (v1.0)", 
 	"funcube5", "Funcube 5 (v1.0)", 
+	"funcube_touchscrene", "Funcube Touchscreen", 
 	"funkball", "Funky Ball", 
 	"funkybee", "Funky Bee", 
 	"funkybeeb", "Funky Bee (bootleg, harder)", 
@@ -5391,6 +5720,9 @@ const char* mameNameToRealName[] = {
 	"ga2", "Golden Axe: The Revenge of Death Adder (World)", 
 	"ga2j", "Golden Axe: The Revenge of Death Adder (Japan)", 
 	"ga2u", "Golden Axe: The Revenge of Death Adder (US)", 
+	"gaelco_cg1v", "Gaelco CG1V", 
+	"gaelco_gae1", "Gaelco GAE1", 
+	"gaelco_serial", "gaelco_serial", 
 	"gaia", "Gaia Crusaders", 
 	"gaiapols", "Gaiapolis (ver EAF)", 
 	"gaiapolsj", "Gaiapolis (ver JAF)", 
@@ -5402,14 +5734,19 @@ const char* mameNameToRealName[] = {
 	"gal10ren", "Mahjong Gal 10-renpatsu (Japan)", 
 	"gal3", "Galaxian 3 - Theater 6 : Project Dragoon", 
 	"galactic", "Galactica - Batalha Espacial", 
+	"galag88b", "Galaga '88 (set 2)",
+	"galag88j", "Galaga '88 (Japan)",
 	"galaga", "Galaga (Namco rev. B)", 
 	"galaga3", "Galaga 3 (GP3 rev. D)", 
 	"galaga3a", "Galaga 3 (GP3 rev. C)", 
 	"galaga3b", "Galaga 3 (GP3)", 
 	"galaga3c", "Galaga 3 (set 4)", 
 	"galaga3m", "Galaga 3 (set 5)", 
+	"galaga84", "Galaga '84",
 	"galaga88", "Galaga '88", 
 	"galaga88j", "Galaga '88 (Japan)", 
+	"galagab2", "Galaga (bootleg)",
+	"galagads", "Galaga (fast shoot)",
 	"galagamf", "Galaga (Midway set 1 with fast shoot hack)", 
 	"galagamk", "Galaga (Midway set 2)", 
 	"galagamw", "Galaga (Midway set 1)", 
@@ -5418,6 +5755,7 @@ const char* mameNameToRealName[] = {
 	"galap4", "Galaxian Part 4 (hack)", 
 	"galapx", "Galaxian Part X (moonaln hack)", 
 	"galastrm", "Galactic Storm (Japan)", 
+	"galaxb", "Galaxian (bootleg)",
 	"galaxbsf", "Galaxian (bootleg, set 1)", 
 	"galaxbsf2", "Galaxian (bootleg, set 3)", 
 	"galaxi", "Galaxi (v2.0)", 
@@ -5426,6 +5764,7 @@ const char* mameNameToRealName[] = {
 	"galaxiab", "Galaxia (set 3)", 
 	"galaxiac", "Galaxia (set 4)", 
 	"galaxian", "Galaxian (Namco set 1)", 
+	"galaxian_sound", "Galaxian Custom", 
 	"galaxiana", "Galaxian (Namco set 2)", 
 	"galaxianbl", "Galaxian (bootleg, set 2)", 
 	"galaxiani", "Galaxian (Irem)", 
@@ -5454,6 +5793,7 @@ const char* mameNameToRealName[] = {
 	"gallgall", "Gallagher's Gallery v2.2", 
 	"gallop", "Gallop - Armed Police Unit (Japan)", 
 	"galmedes", "Galmedes (Japan)", 
+	"galmidw", "Galaxian (Midway)",
 	"galpani2", "Gals Panic II (Asia)", 
 	"galpani2e", "Gals Panic II (English)", 
 	"galpani2e2", "Gals Panic II (English, 2 PCB ver.)", 
@@ -5628,9 +5968,11 @@ const char* mameNameToRealName[] = {
 	"gamt9", "Gaminator 9 (set 1)", 
 	"gamt9a", "Gaminator 9 (set 2)", 
 	"gamt9lotc", "Gaminator 9 (bootleg, C-Loto)", 
+	"gamtor_vga", "GAMTOR_VGA", 
 	"ganbare", "Ganbare! Marine Kun (Japan 2K0411)", 
 	"gangonta", "Ganbare! Gonta!! 2 / Party Time: Gonta the Diver II (Japan Release)", 
 	"gangrose", "Gangster's Roses (v4.70)", 
+	"gangwarb", "Gang Wars (bootleg)",
 	"gangwars", "Gang Wars", 
 	"gangwarsu", "Gang Wars (US)", 
 	"ganjaja", "Ganbare Jajamaru Saisho wa Goo / Ganbare Jajamaru Hop Step &amp; Jump", 
@@ -5660,6 +6002,7 @@ const char* mameNameToRealName[] = {
 	"garoup", "Garou - Mark of the Wolves (prototype)", 
 	"garuka", "Garuka (Japan ver. W)", 
 	"garyoret", "Garyo Retsuden (Japan)", 
+	"gatedom1", "Gate of Doom (US revision 1)",
 	"gatedoom", "Gate of Doom (US revision 4)", 
 	"gatedoom1", "Gate of Doom (US revision 1)", 
 	"gatsbee", "Gatsbee", 
@@ -5668,8 +6011,11 @@ const char* mameNameToRealName[] = {
 	"gaunt22p1", "Gauntlet II (2 Players, rev 1)", 
 	"gaunt22pg", "Gauntlet II (2 Players, German)", 
 	"gaunt2g", "Gauntlet II (German)", 
+	"gaunt2p", "Gauntlet (2 Players)",
 	"gauntdl", "Gauntlet Dark Legacy (version DL 2.52)", 
 	"gauntdl24", "Gauntlet Dark Legacy (version DL 2.4)", 
+	"gauntir1", "Gauntlet (Intermediate Release 1)",
+	"gauntir2", "Gauntlet (Intermediate Release 2)",
 	"gauntleg", "Gauntlet Legends (version 1.6)", 
 	"gauntleg12", "Gauntlet Legends (version 1.2)", 
 	"gauntlet", "Gauntlet (rev 14)", 
@@ -5707,6 +6053,7 @@ const char* mameNameToRealName[] = {
 	"gdfs", "Mobil Suit Gundam Final Shooting (Japan)", 
 	"gdvsgd", "Gundam vs. Gundam", 
 	"geebee", "Gee Bee (Japan)", 
+	"geebee_sound", "Gee Bee Custom", 
 	"geebeeb", "Gee Bee (Europe)", 
 	"geebeeg", "Gee Bee (US)", 
 	"gegege", "GeGeGe no Kitarou Youkai Slot", 
@@ -5734,6 +6081,8 @@ const char* mameNameToRealName[] = {
 	"gepoker2", "Poker (Version 50.02 ICB, set 3)", 
 	"getbass", "Get Bass", 
 	"getrich", "Get Rich (Version 1.0.1)", 
+	"getstar", "Guardian",
+	"getstarb", "Get Star (bootleg)",
 	"getstarb1", "Get Star (bootleg set 1)", 
 	"getstarb2", "Get Star (bootleg set 2)", 
 	"getstarj", "Get Star (Japan)", 
@@ -5741,6 +6090,7 @@ const char* mameNameToRealName[] = {
 	"gforce2", "Galaxy Force 2", 
 	"gforce2j", "Galaxy Force 2 (Japan)", 
 	"gforce2ja", "Galaxy Force 2 (Japan, Rev A)", 
+	"gfxdecode", "gfxdecode", 
 	"ggate", "Golden Gate (set 1) (Bingo)", 
 	"ggatea", "Golden Gate (set 2) (Bingo)", 
 	"ggconnie", "Go! Go! Connie chan Jaka Jaka Janken", 
@@ -5765,6 +6115,7 @@ const char* mameNameToRealName[] = {
 	"ghostmun", "Ghost Muncher", 
 	"ghostsqu", "Ghost Squad (Rev A) (GDX-0012A)", 
 	"ghouls", "Ghouls'n Ghosts (World)", 
+	"ghoulsj", "Dai Makai-Mura (Japan)",
 	"ghoulsu", "Ghouls'n Ghosts (USA)", 
 	"ghox", "Ghox (spinner)", 
 	"ghoxj", "Ghox (joystick)", 
@@ -5844,6 +6195,9 @@ const char* mameNameToRealName[] = {
 	"gmgalax", "Ghostmuncher Galaxian (bootleg)", 
 	"gmine_l2", "Gold Mine (Shuffle) (L-2)", 
 	"gmissile", "Guided Missile", 
+	"gms30c2116", "GMS30C2116", 
+	"gms30c2132", "GMS30C2132", 
+	"gms30c2232", "GMS30C2232", 
 	"gnbarich", "Gunbarich", 
 	"gng", "Ghosts'n Goblins (World? set 1)", 
 	"gnga", "Ghosts'n Goblins (World? set 2)", 
@@ -5907,6 +6261,10 @@ const char* mameNameToRealName[] = {
 	"goldmedl", "Gold Medalist (set 1)", 
 	"goldmedla", "Gold Medalist (set 2)", 
 	"goldmedlb", "Gold Medalist (bootleg)", 
+	"goldnabl", "Golden Axe (bootleg)",
+	"goldnaxa", "Golden Axe (Version 2)",
+	"goldnaxb", "Golden Axe (Version 2 317-0110)",
+	"goldnaxc", "Golden Axe (Version 2 317-0122)",
 	"goldnaxe", "Golden Axe (set 6, US, 8751 317-123A)", 
 	"goldnaxe1", "Golden Axe (set 1, World, FD1094 317-0110)", 
 	"goldnaxe2", "Golden Axe (set 2, US, 8751 317-0112)", 
@@ -5915,6 +6273,7 @@ const char* mameNameToRealName[] = {
 	"goldnaxeb2", "Golden Axe (bootleg)", 
 	"goldnaxej", "Golden Axe (set 4, Japan, FD1094 317-0121)", 
 	"goldnaxeu", "Golden Axe (set 5, US, FD1094 317-0122)", 
+	"goldnaxj", "Golden Axe (Version 1, Japan)",
 	"goldnpkb", "Golden Poker Double Up (Mini Boy)", 
 	"goldnpkr", "Golden Poker Double Up (Big Boy)", 
 	"goldprmd", "Golden Pyramids (MV4091, USA)", 
@@ -5924,6 +6283,7 @@ const char* mameNameToRealName[] = {
 	"golgo13", "Golgo 13 (Japan, GLG1/VER.A)", 
 	"gollygho", "Golly! Ghost!", 
 	"gomoku", "Gomoku Narabe Renju", 
+	"gomoku_sound", "Gomoku Custom", 
 	"gondo", "Gondomania (US)", 
 	"gonefsh2", "Gone Fishing 2", 
 	"good", "Good (Korea)", 
@@ -5937,10 +6297,13 @@ const char* mameNameToRealName[] = {
 	"gork", "Gork", 
 	"gorkans", "Gorkans", 
 	"gotcha", "Got-cha Mini Game Festival", 
+	"gotsndr1", "Gottlieb Sound rev. 1", 
+	"gotsndr2", "Gottlieb Sound rev. 2", 
 	"gotya", "Got-Ya (12/24/1981, prototype?)", 
 	"gowcaizr", "Voltage Fighter - Gowcaizer / Choujin Gakuen Gowcaizer", 
 	"gp2quiz", "Gals Panic II - Quiz Version", 
 	"gp2se", "Gals Panic II' - Special Edition (Japan)", 
+	"gp9001vdp", "GP9001_VDP", 
 	"gp98", "Grand Prix '98 (V100K)", 
 	"gp_110", "Model 110", 
 	"gpgolf", "Golden Par Golf (Joystick, V1.1)", 
@@ -6003,11 +6366,15 @@ const char* mameNameToRealName[] = {
 	"gratiaa", "Gratia - Second Earth (91022-10 version)", 
 	"gravitar", "Gravitar (version 3)", 
 	"gravitar2", "Gravitar (version 2)", 
+	"gravitr2", "Gravitar (version 2)",
 	"gravp", "Gravitar (prototype)", 
 	"grchamp", "Grand Champion", 
 	"grdforce", "Guardian Force (JUET 980318 V0.105)", 
 	"grdian", "Guardian (US)", 
 	"grdians", "Guardians / Denjin Makai II", 
+	"grdius2a", "Gradius II - Gofer no Yabou (Japan set 2)",
+	"grdius2b", "Gradius II - Gofer no Yabou (Japan set 3)",
+	"grdius3a", "Gradius III (Asia)",
 	"grdnstrm", "Guardian Storm (horizontal, not encrypted)", 
 	"grdnstrmg", "Guardian Storm (Germany)", 
 	"grdnstrmk", "Jeon Sin - Guardian Storm (Korea)", 
@@ -6020,6 +6387,7 @@ const char* mameNameToRealName[] = {
 	"grgar_t1", "Gorgar (T-1)", 
 	"gridiron", "Gridiron Fight", 
 	"gridlee", "Gridlee", 
+	"gridlee_sound", "Gridlee Custom", 
 	"griffon", "Griffon (bootleg of Phoenix)", 
 	"grindstm", "Grind Stormer", 
 	"grindstma", "Grind Stormer (older set)", 
@@ -6198,6 +6566,7 @@ const char* mameNameToRealName[] = {
 	"gunchamps", "Gun Champ (newer, Super Shot hardware)", 
 	"gundamex", "Mobile Suit Gundam EX Revue", 
 	"gundamos", "Gundam Battle Operating Simulator (GDX-0013)", 
+	"gundeala", "Gun Dealer (set 2)",
 	"gundealr", "Gun Dealer", 
 	"gundealra", "Gun Dealer (alt card set)", 
 	"gundealrt", "Gun Dealer (Japan)", 
@@ -6213,6 +6582,8 @@ const char* mameNameToRealName[] = {
 	"gunforce", "Gunforce - Battle Fire Engulfed Terror Island (World)", 
 	"gunforcej", "Gunforce - Battle Fire Engulfed Terror Island (Japan)", 
 	"gunforceu", "Gunforce - Battle Fire Engulfed Terror Island (US)", 
+	"gunforcu", "Gunforce - Battle Fire Engulfed Terror Island (US)",
+	"gunfronj", "Gun Frontier (Japan)",
 	"gunfront", "Gun &amp; Frontier (World)", 
 	"gunfrontj", "Gun Frontier (Japan)", 
 	"gunhard", "Gun Hard (Japan)", 
@@ -6224,10 +6595,13 @@ const char* mameNameToRealName[] = {
 	"gunnail", "GunNail (28th May. 1992)", 
 	"gunnrose", "Guns and Roses (C606191SMP, Australia)", 
 	"gunpey", "Gunpey (Japan)", 
+	"gunsmoka", "Gun.Smoke (US set 2)",
 	"gunsmoke", "Gun.Smoke (World)", 
 	"gunsmokej", "Gun.Smoke (Japan)", 
 	"gunsmokeu", "Gun.Smoke (US set 1)", 
 	"gunsmokeua", "Gun.Smoke (US set 2)", 
+	"gunsmokj", "Gun.Smoke (Japan)",
+	"gunsmrom", "Gun.Smoke (US set 1)",
 	"gunsur2", "Gun Survivor 2 Biohazard Code: Veronica (BHF1 Ver. E)", 
 	"gunsur2e", "Gun Survivor 2 Biohazard Code: Veronica (BHF2 Ver. E)", 
 	"gunwars", "Gunmen Wars (GM1 Ver. B)", 
@@ -6265,6 +6639,30 @@ const char* mameNameToRealName[] = {
 	"gyruss", "Gyruss", 
 	"gyrussb", "Gyruss (bootleg?)", 
 	"gyrussce", "Gyruss (Centuri)", 
+	"h46505", "H46505 CRTC", 
+	"h6280", "H6280", 
+	"h63484", "H63484", 
+	"h83002", "H8/3002", 
+	"h83007", "H8/3007", 
+	"h83008", "H8/3008", 
+	"h83044", "H8/3044", 
+	"h83048", "H8/3048", 
+	"h83334", "H8/3334", 
+	"h83337", "H8/3337", 
+	"h8_16bits_timer_channel", "H8 16-bits timer channel", 
+	"h8_8bits_timer_channel", "H8 8-bits timer channel", 
+	"h8_adc_2357", "H8 ADC 2357", 
+	"h8_adc_3006", "H8 ADC 3006", 
+	"h8_adc_3337", "H8 ADC 3337", 
+	"h8_digital_port", "H8 digital port", 
+	"h8_intc", "H8 INTC", 
+	"h8_sci", "H8 Serial Communications Interface", 
+	"h8_timer16", "H8 16-bits timer", 
+	"h8h_16bits_timer_channel", "H8H 16-bits timer channel", 
+	"h8h_intc", "H8H INTC", 
+	"h8s2394", "H8S/2394", 
+	"h8s_16bits_timer_channel", "H8S 16-bits timer channel", 
+	"h8s_intc", "H8S INTC", 
 	"hachamf", "Hacha Mecha Fighter (19th Sep. 1991)", 
 	"hacher", "Hacher (hack of Win Win Bingo)", 
 	"hachoo", "Hachoo!", 
@@ -6301,6 +6699,7 @@ const char* mameNameToRealName[] = {
 	"hapytour", "Happy Tour", 
 	"hardbody", "Hardbody", 
 	"hardbodyg", "Hardbody (German)", 
+	"harddisk_image", "Harddisk", 
 	"harddriv", "Hard Drivin' (cockpit, rev 7)", 
 	"harddriv1", "Hard Drivin' (cockpit, rev 1)", 
 	"harddriv2", "Hard Drivin' (cockpit, rev 2)", 
@@ -6322,6 +6721,7 @@ const char* mameNameToRealName[] = {
 	"hardhea2", "Hard Head 2 (v2.0)", 
 	"hardhead", "Hard Head", 
 	"hardheadb", "Hard Head (bootleg)", 
+	"hardhedb", "Hard Head (Bootleg)",
 	"hardyard", "Hard Yardage (v1.20)", 
 	"hardyard10", "Hard Yardage (v1.00)", 
 	"harem", "Harem", 
@@ -6457,13 +6857,24 @@ const char* mameNameToRealName[] = {
 	"hb_ydda", "Yabba-Dabba-Dough (Qps) (set 2)", 
 	"hbarrel", "Heavy Barrel (US)", 
 	"hbarrelw", "Heavy Barrel (World)", 
+	"hc55516", "HC-55516", 
 	"hcastle", "Haunted Castle (version M)", 
+	"hcastlea", "Haunted Castle (set 2)",
 	"hcastlee", "Haunted Castle (version E)", 
+	"hcastlej", "Akuma-Jou Dracula (Japan)",
 	"hcastlek", "Haunted Castle (version K)", 
 	"hcrash", "Hyper Crash (version D)", 
 	"hcrashc", "Hyper Crash (version C)", 
+	"hd61830", "HD61830 LCDC", 
+	"hd6303y", "HD6303Y", 
+	"hd6309", "HD6309", 
+	"hd63484", "HD63484 CRTC", 
+	"hd63701", "HD63701", 
+	"hd63705", "HD63705", 
+	"hd6845", "HD6845 CRTC", 
 	"hd_l1", "Harley Davidson (L-1)", 
 	"hd_l3", "Harley Davidson (L-3)", 
+	"hdd", "IDE Hard Disk", 
 	"hdrivair", "Hard Drivin's Airborne (prototype)", 
 	"hdrivairp", "Hard Drivin's Airborne (prototype, early rev)", 
 	"headon", "Head On (2 players)", 
@@ -6489,6 +6900,7 @@ const char* mameNameToRealName[] = {
 	"hedpanicf", "Head Panic (ver. 0315, 15/03/2000)", 
 	"hedpanico", "Head Panic (ver. 0615, 15/06/1999)", 
 	"heiankyo", "Heiankyo Alien", 
+	"helifira", "HeliFire (revision A)",
 	"helifire", "HeliFire (set 1)", 
 	"helifirea", "HeliFire (set 2)", 
 	"hellfire", "Hellfire (2P set)", 
@@ -6553,6 +6965,7 @@ const char* mameNameToRealName[] = {
 	"hiticej", "Hit the Ice (Japan)", 
 	"hitme", "Hit Me (set 1)", 
 	"hitme1", "Hit Me (set 2)", 
+	"hitnmis2", "Hit 'n Miss (version 2.0)",
 	"hitnmiss", "Hit 'n Miss (version 3.0)", 
 	"hitnmiss2", "Hit 'n Miss (version 2.0)", 
 	"hitpoker", "Hit Poker (Bulgaria)", 
@@ -6675,6 +7088,9 @@ const char* mameNameToRealName[] = {
 	"hthero95", "Hat Trick Hero '95 (Ver 2.5J 1994/11/03)", 
 	"hthero95u", "Hat Trick Hero '95 (Ver 2.5A 1994/11/03)", 
 	"httip_l1", "Hot Tip (L-1)", 
+	"huc6202", "HuC6202 VPC", 
+	"huc6260", "HuC6260 VCE", 
+	"huc6270", "HuC6270 VDC", 
 	"hulk", "Incredible Hulk,The", 
 	"hunchbak", "Hunchback (set 1)", 
 	"hunchbaka", "Hunchback (set 2)", 
@@ -6730,14 +7146,52 @@ const char* mameNameToRealName[] = {
 	"hyprduel2", "Hyper Duel (Japan set 2)", 
 	"hypreac2", "Mahjong Hyper Reaction 2 (Japan)", 
 	"hypreact", "Mahjong Hyper Reaction (Japan)", 
+	"hyprolyb", "Hyper Olympic (bootleg)",
+	"hyprolyb_adpcm", "Hyper Olympics Audio", 
 	"hyprolym", "Hyper Olympic", 
 	"hyprolymb", "Hyper Olympic (bootleg)", 
 	"hypsptsp", "Hyper Sports Special (Japan)", 
+	"i2cmem", "I2CMEM", 
+	"i386", "I386", 
+	"i4004", "Intel I4004", 
+	"i486", "I486", 
+	"i5000snd", "I5000", 
 	"i500_11b", "Indianapolis 500 (1.1 Belgium)", 
 	"i500_11r", "Indianapolis 500 (1.1R)", 
+	"i80186", "I80186", 
+	"i80188", "I80188", 
+	"i8031", "I8031", 
+	"i8032", "I8032", 
+	"i8035", "I8035", 
+	"i8039", "I8039", 
+	"i8041", "I8041", 
+	"i8049", "I8049", 
+	"i8051", "I8051", 
+	"i8052", "I8052", 
+	"i8080", "8080", 
+	"i8080a", "8080A", 
+	"i8085a", "8085A", 
+	"i8086", "I8086", 
+	"i8088", "I8088", 
+	"i80c31", "I80C31", 
+	"i80c32", "I80C32", 
+	"i80c51", "I80C51", 
+	"i8155", "8155 RIOT", 
+	"i8243", "I8243", 
+	"i8251", "I8251", 
+	"i8255", "8255 PPI", 
+	"i8257", "DMA8257", 
+	"i8279", "8279 KDC", 
+	"i860xr", "i860XR", 
+	"i8741", "I8741", 
+	"i8742", "I8742", 
+	"i8748", "I8748", 
+	"i8751", "I8751", 
+	"i960kb", "i960kb", 
 	"ibara", "Ibara (2005/03/22 MASTER VER..)", 
 	"ibarablk", "Ibara Kuro Black Label (2006/02/06. MASTER VER.)", 
 	"ibarablka", "Ibara Kuro Black Label (2006/02/06 MASTER VER.)", 
+	"ibm8514a", "IBM8514A", 
 	"iccash", "I C Cash (Russia) (Atronic)", 
 	"iceclimb", "Vs. Ice Climber (set IC4-4 B-1)", 
 	"iceclimba", "Vs. Ice Climber (set IC4-4 ?)", 
@@ -6749,7 +7203,10 @@ const char* mameNameToRealName[] = {
 	"ichirj", "Puzzle &amp; Action: Ichidant-R (Japan)", 
 	"ichirjbl", "Puzzle &amp; Action: Ichidant-R (Japan) (bootleg)", 
 	"ichirk", "Puzzle &amp; Action: Ichidant-R (Korea)", 
+	"ics2115", "ICS2115", 
 	"id4", "Independence Day", 
+	"ide_baseboard", "IDE Baseboard", 
+	"ide_controller", "IDE Controller (32 bit)", 
 	"idhimitu", "Idol no Himitsu [BET] (Japan 890304)", 
 	"idolmj", "Idol-Mahjong Housoukyoku (Japan)", 
 	"idsoccer", "Indoor Soccer (set 1)", 
@@ -6760,6 +7217,9 @@ const char* mameNameToRealName[] = {
 	"igmo", "IGMO", 
 	"igromula", "Igrosoft Multigame Bootleg (15 Games)", 
 	"igromult", "Igrosoft Multigame Bootleg (10 Games)", 
+	"igs022", "IGS022", 
+	"igs028", "IGS028", 
+	"igs_025_022", "IGS025", 
 	"igs_ncs", "New Champion Skill (v100n)", 
 	"igs_ncs2", "New Champion Skill (v100n 2000)", 
 	"igsm312", "unknown 'IGS 6POKER2' game (V312CN)", 
@@ -6794,6 +7254,8 @@ const char* mameNameToRealName[] = {
 	"inca", "Inca", 
 	"incanp", "Incan Pyramids (Konami Endeavour)", 
 	"ind250cc", "250 CC", 
+	"indersb", "Inder 4xDAC Sound Board", 
+	"indervd", "Inder / Dinamic TMS Video", 
 	"indianbt", "Indian Battle", 
 	"indianbtbr", "Indian Battle (Brazil)", 
 	"indiandr", "Indian Dreaming (0100845V, Local)", 
@@ -6804,6 +7266,9 @@ const char* mameNameToRealName[] = {
 	"indy500to", "INDY 500 Twin (Revision A)", 
 	"indy800", "Indy 800 [TTL]", 
 	"indyheat", "Danny Sullivan's Indy Heat", 
+	"indytem2", "Indiana Jones and the Temple of Doom (set 2)",
+	"indytem3", "Indiana Jones and the Temple of Doom (set 3)",
+	"indytem4", "Indiana Jones and the Temple of Doom (set 4)",
 	"indytemp", "Indiana Jones and the Temple of Doom (set 1)", 
 	"indytemp2", "Indiana Jones and the Temple of Doom (set 2)", 
 	"indytemp3", "Indiana Jones and the Temple of Doom (set 3)", 
@@ -6821,13 +7286,19 @@ const char* mameNameToRealName[] = {
 	"initdv3j", "Initial D Arcade Stage Ver. 3 (Japan) (Rev. C) (GDS-0032C)", 
 	"initdv3jb", "Initial D Arcade Stage Ver. 3 (Japan) (Rev. B) (GDS-0032B)", 
 	"inquiztr", "Inquizitor", 
+	"ins8050", "INS 8050 SC/MP", 
+	"ins8154", "INS8154", 
 	"insector", "Insector (prototype)", 
 	"insectx", "Insector X (World)", 
 	"insectxj", "Insector X (Japan)", 
 	"intcup94", "International Cup '94 (Ver 2.2O 1994/05/26)", 
+	"intel_e28f008sa", "Intel E28F008SA Flash", 
+	"intel_e28f400b", "Intel E28F400B Flash", 
+	"intel_te28f160", "Intel TE28F160 Flash", 
 	"inthunt", "In The Hunt (World)", 
 	"inthuntu", "In The Hunt (US)", 
 	"intlaser", "International Team Laser (prototype)", 
+	"intrepi2", "Intrepid (set 2)",
 	"intrepid", "Intrepid (set 1)", 
 	"intrepid2", "Intrepid (set 2)", 
 	"intrepidb", "Intrepid (Elsys bootleg, set 1)", 
@@ -6870,6 +7341,7 @@ const char* mameNameToRealName[] = {
 	"invmultis3a", "Space Invaders Multigame (S0.83A)", 
 	"invmultit3d", "Space Invaders Multigame (T8.03D)", 
 	"invqix", "Space Invaders / Qix Silver Anniversary Edition (Ver. 2.03)", 
+	"invrvnga", "Invader's Revenge (Dutchford)",
 	"invrvnge", "Invader's Revenge (set 1)", 
 	"invrvngea", "Invader's Revenge (set 2)", 
 	"invrvngeb", "Invader's Revenge (set 3)", 
@@ -6883,6 +7355,8 @@ const char* mameNameToRealName[] = {
 	"iqblocka", "Shu Zi Le Yuan (V127M)", 
 	"iqblockf", "Shu Zi Le Yuan (V113FR)", 
 	"iqpipe", "IQ Pipe", 
+	"irem_audio", "Irem Audio", 
+	"iremga20", "Irem GA20", 
 	"irobot", "I, Robot", 
 	"iron", "Iron (SNES bootleg)", 
 	"ironclad", "Choutetsu Brikin'ger - Iron clad (Prototype)", 
@@ -6892,6 +7366,8 @@ const char* mameNameToRealName[] = {
 	"ironhors", "Iron Horse", 
 	"ironmaid", "Iron Maiden", 
 	"irrmaze", "The Irritating Maze / Ultra Denryu Iraira Bou", 
+	"isa8", "ISA8", 
+	"isa8_slot", "ISA8_SLOT", 
 	"isgsm", "ISG Selection Master Type 2006 BIOS", 
 	"island", "Island (050713 World)", 
 	"island2", "Island 2 (060529 World)", 
@@ -8296,9 +8772,13 @@ const char* mameNameToRealName[] = {
 	"jackie", "Happy Jackie (v110U)", 
 	"jackler", "Jackler (Jungler bootleg)", 
 	"jackpool", "Jackpot Cards / Jackpot Pool (Italy)", 
+	"jackrab2", "Jack Rabbit (set 2)",
+	"jackrabs", "Jack Rabbit (special)",
 	"jackrabt", "Jack Rabbit (set 1)", 
 	"jackrabt2", "Jack Rabbit (set 2)", 
 	"jackrabts", "Jack Rabbit (special)", 
+	"jaguardsp", "Jaguar DSP", 
+	"jaguargpu", "Jaguar GPU", 
 	"jailbrek", "Jail Break", 
 	"jailbrekb", "Jail Break (bootleg)", 
 	"jajamaru", "Vs. Ninja Jajamaru Kun (Japan)", 
@@ -8316,6 +8796,7 @@ const char* mameNameToRealName[] = {
 	"janptrsp", "Janputer Special (Japan)", 
 	"janputer", "New Double Bet Mahjong (bootleg of Janputer)", 
 	"janshi", "Janshi", 
+	"janshi_vdp", "JANSHIVDP", 
 	"janshin", "Jyanshin Densetsu - Quest of Jongmaster", 
 	"janshinp", "Mahjong Janshin Plus (Japan)", 
 	"jansou", "Jansou (set 1)", 
@@ -8422,6 +8903,7 @@ const char* mameNameToRealName[] = {
 	"jongkyo", "Jongkyo", 
 	"jongtei", "Mahjong Jong-Tei (Japan, ver. NM532-01)", 
 	"josvolly", "Joshi Volleyball", 
+	"josvolly8741_4pack", "joshi Vollyball 8741 MCU 4 pack", 
 	"journey", "Journey", 
 	"joust", "Joust (White/Green label)", 
 	"joust2", "Joust 2 - Survival of the Fittest", 
@@ -8474,8 +8956,10 @@ const char* mameNameToRealName[] = {
 	"junglekj2", "Jungle King (Japan, earlier)", 
 	"jungler", "Jungler", 
 	"junglers", "Jungler (Stern Electronics)", 
+	"junglkj2", "Jungle King (Japan, earlier)",
 	"junofrst", "Juno First", 
 	"junofrstg", "Juno First (Gottlieb)", 
+	"junofstg", "Juno First (Gottlieb)",
 	"jupk_501", "Jurassic Park (5.01)", 
 	"jupk_513", "Jurassic Park (5.13)", 
 	"jupk_g51", "Jurassic Park (5.01 Germany)", 
@@ -8486,37 +8970,87 @@ const char* mameNameToRealName[] = {
 	"jy_11", "Junk Yard (1.1)", 
 	"jy_12", "Junk Yard (1.2)", 
 	"jyangoku", "Jyangokushi: Haoh no Saihai (Japan 990527)", 
+	"jyuohki", "Jyuohki (Japan)",
 	"jzth", "Jue Zhan Tian Huang", 
-	"kabukikl", "Far East of Eden - Kabuki Klash / Tengai Makyou - Shin Den", 
-	"kabukiz", "Kabuki-Z (World)", 
-	"kabukizj", "Kabuki-Z (Japan)", 
-	"kageki", "Kageki (US)", 
-	"kagekih", "Kageki (hack)", 
-	"kagekij", "Kageki (Japan)", 
-	"kaguya", "Mahjong Kaguyahime [BET] (Japan 880521)", 
-	"kaguya2", "Mahjong Kaguyahime Sono2 [BET] (Japan 890829)", 
-	"kaguya2f", "Mahjong Kaguyahime Sono2 Fukkokuban [BET] (Japan 010808)", 
-	"kaiserkn", "Kaiser Knuckle (Ver 2.1O 1994/07/29)", 
-	"kaiserknj", "Kaiser Knuckle (Ver 2.1J 1994/07/29)", 
-	"kaitei", "Kaitei Takara Sagashi", 
-	"kaiteids", "Kaitei Daisensou (Japan)", 
-	"kaitein", "Kaitei Takara Sagashi (Namco license)", 
-	"kaiunqz", "Kaiun Quiz (Japan, KW1/VER.A)", 
-	"kakumei", "Mahjong Kakumei (Japan)", 
-	"kakumei2", "Mahjong Kakumei 2 - Princess League (Japan)", 
-	"kamakazi3", "Kamakazi III (superg hack)", 
-	"kamenrid", "Masked Riders Club Battle Race", 
-	"kamikaze", "Kamikaze", 
-	"kamikcab", "Kamikaze Cabbie", 
-	"kanatuen", "Kanatsuen no Onna [BET] (Japan 880905)", 
-	"kangaroo", "Kangaroo", 
-	"kangarooa", "Kangaroo (Atari)", 
-	"kangaroob", "Kangaroo (bootleg)", 
-	"kaos", "Kaos", 
-	"karatblz", "Karate Blazers (World)", 
-	"karatblzj", "Karate Blazers (Japan)", 
-	"karatblzu", "Karate Blazers (US)", 
-	"karatedo", "Karate Dou (Japan)", 
+	"k001604", "Konami 001604", 
+	"k005289", "K005289", 
+	"k007121", "Konami 007121", 
+	"k007232", "K007232", 
+	"k007342", "Konami 007342", 
+	"k007420", "Konami 007420", 
+	"k033906", "Konami 033906", 
+	"k037122", "Konami 0371222", 
+	"k051316", "Konami 051316", 
+	"k051649", "K051649", 
+	"k051733", "Konami 051733", 
+	"k051960", "Konami 051960", 
+	"k052109", "Konami 052109", 
+	"k053247", "Konami 053246 &amp; 053247", 
+	"k05324x", "Konami 053244 &amp; 053245", 
+	"k053250", "K053250", 
+	"k053251", "Konami 053251", 
+	"k053252", "Konami 053252", 
+	"k053260", "K053260", 
+	"k053936", "Konami 053936", 
+	"k054000", "Konami 054000", 
+	"k054338", "Konami 054338", 
+	"k054539", "K054539", 
+	"k055555", "Konami 055555", 
+	"k055673", "Konami 055673", 
+	"k056230", "Konami 056230", 
+	"k056800", "Konami 056800 MIRAC", 
+	"k056832", "Konami 056832", 
+	"k573cassslot", "KONAMI 573 CASSETTE SLOT", 
+	"k573cassslotserial", "KONAMI 573 CASSETTE SLOT (SERIAL)", 
+	"k573cassx", "KONAMI 573 CASSETTE X", 
+	"k573cassxi", "KONAMI 573 CASSETTE XI", 
+	"k573cassy", "KONAMI 573 CASSETTE Y", 
+	"k573cassyi", "KONAMI 573 CASSETTE YI", 
+	"k573casszi", "KONAMI 573 CASSETTE ZI", 
+	"k573dio", "Konami 573 digital I/O board", 
+	"k573mcr", "Konami Memory Card Reader", 
+	"k573msu", "Konami Multi Session Unit", 
+	"k573npu", "Konami Network PCB Unit", 
+	"kabukikl", "Far East of Eden - Kabuki Klash / Tengai Makyou - Shin Den", 
+	"kabukiz", "Kabuki-Z (World)", 
+	"kabukizj", "Kabuki-Z (Japan)", 
+	"kageki", "Kageki (US)", 
+	"kagekih", "Kageki (hack)", 
+	"kagekij", "Kageki (Japan)", 
+	"kaguya", "Mahjong Kaguyahime [BET] (Japan 880521)", 
+	"kaguya2", "Mahjong Kaguyahime Sono2 [BET] (Japan 890829)", 
+	"kaguya2f", "Mahjong Kaguyahime Sono2 Fukkokuban [BET] (Japan 010808)", 
+	"kaiserkn", "Kaiser Knuckle (Ver 2.1O 1994/07/29)", 
+	"kaiserknj", "Kaiser Knuckle (Ver 2.1J 1994/07/29)", 
+	"kaitei", "Kaitei Takara Sagashi", 
+	"kaiteids", "Kaitei Daisensou (Japan)", 
+	"kaitein", "Kaitei Takara Sagashi (Namco license)", 
+	"kaiunqz", "Kaiun Quiz (Japan, KW1/VER.A)", 
+	"kakumei", "Mahjong Kakumei (Japan)", 
+	"kakumei2", "Mahjong Kakumei 2 - Princess League (Japan)", 
+	"kamakazi3", "Kamakazi III (superg hack)", 
+	"kamenrid", "Masked Riders Club Battle Race", 
+	"kamikaze", "Kamikaze", 
+	"kamikcab", "Kamikaze Cabbie", 
+	"kanatuen", "Kanatsuen no Onna [BET] (Japan 880905)", 
+	"kaneko16_sprite", "kaneko16_sprite_device", 
+	"kaneko_calc3", "kaneko_calc3_device", 
+	"kaneko_grap2", "kaneko_grap2_device", 
+	"kaneko_hit", "kaneko_hit_device", 
+	"kaneko_pandora", "Kaneko Pandora - PX79C480FP-3", 
+	"kaneko_toybox", "kaneko_toybox_device", 
+	"kaneko_view2_tilemap", "kaneko_view2_tilemap_device", 
+	"kangaroa", "Kangaroo (Atari)",
+	"kangarob", "Kangaroo (bootleg)",
+	"kangaroo", "Kangaroo", 
+	"kangarooa", "Kangaroo (Atari)", 
+	"kangaroob", "Kangaroo (bootleg)", 
+	"kaos", "Kaos", 
+	"karatblu", "Karate Blazers (US)",
+	"karatblz", "Karate Blazers (World)", 
+	"karatblzj", "Karate Blazers (Japan)", 
+	"karatblzu", "Karate Blazers (US)", 
+	"karatedo", "Karate Dou (Japan)", 
 	"karatevs", "Taisen Karate Dou (Japan VS version)", 
 	"karatour", "The Karate Tournament", 
 	"karianx", "Karian Cross (Rev. 1.0)", 
@@ -8530,6 +9064,7 @@ const char* mameNameToRealName[] = {
 	"kazan", "Ninja Kazan (World)", 
 	"kbash", "Knuckle Bash", 
 	"kbash2", "Knuckle Bash 2 (bootleg)", 
+	"kbdc8042", "Keyboard Controller 8042", 
 	"kbm", "Keyboardmania", 
 	"kbm2nd", "Keyboardmania 2nd Mix", 
 	"kbm3rd", "Keyboardmania 3rd Mix", 
@@ -8564,6 +9099,15 @@ const char* mameNameToRealName[] = {
 	"keta", "Ketsui: Kizuna Jigoku Tachi (2003/01/01 Master Ver.)", 
 	"ketb", "Ketsui: Kizuna Jigoku Tachi (2003/01/01 Master Ver)", 
 	"keyboard", "La Keyboard (GDS-0017)", 
+	"keycus_c406", "KEYCUS C406", 
+	"keycus_c409", "KEYCUS C409", 
+	"keycus_c410", "KEYCUS C410", 
+	"keycus_c411", "KEYCUS C411", 
+	"keycus_c430", "KEYCUS C430", 
+	"keycus_c431", "KEYCUS C431", 
+	"keycus_c432", "KEYCUS C432", 
+	"keycus_c442", "KEYCUS C442", 
+	"keycus_c443", "KEYCUS C443", 
 	"kf10thep", "The King of Fighters 10th Anniversary Extra Plus (The King of Fighters 2002 bootleg)", 
 	"kf2k2mp", "The King of Fighters 2002 Magic Plus (bootleg)", 
 	"kf2k2mp2", "The King of Fighters 2002 Magic Plus II (bootleg)", 
@@ -8580,6 +9124,7 @@ const char* mameNameToRealName[] = {
 	"kgbirda", "K.G. Bird (4VXFC5341, New Zealand, 10c)", 
 	"kick", "Kick (upright)", 
 	"kick4csh", "Kick '4' Cash", 
+	"kicka", "Kick (cocktail)",
 	"kickboy", "Kick Boy", 
 	"kickc", "Kick (cocktail)", 
 	"kicker", "Kicker", 
@@ -8602,6 +9147,7 @@ const char* mameNameToRealName[] = {
 	"killcom", "Killer Comet", 
 	"kimbldhl", "Kimble Double HI-LO", 
 	"kimblz80", "Kimble Double HI-LO (z80 version)", 
+	"kingbalj", "King & Balloon (Japan)",
 	"kingball", "King &amp; Balloon (US)", 
 	"kingballj", "King &amp; Balloon (Japan)", 
 	"kingdmgp", "Kingdom Grandprix", 
@@ -8666,6 +9212,7 @@ const char* mameNameToRealName[] = {
 	"kodja", "The King of Dragons (Japan 910805, B-Board 89625B-1)", 
 	"kodr1", "The King of Dragons (World 910711)", 
 	"kodu", "The King of Dragons (USA 910910)", 
+	"kodure", "Kodure Ookami (Japan)",
 	"kof10th", "The King of Fighters 10th Anniversary (The King of Fighters 2002 bootleg)", 
 	"kof2000", "The King of Fighters 2000 (NGM-2570) (NGH-2570)", 
 	"kof2000n", "The King of Fighters 2000 (not encrypted)", 
@@ -8717,6 +9264,7 @@ const char* mameNameToRealName[] = {
 	"konam80s", "Konami 80's AC Special (GC826 VER. EAA)", 
 	"konam80u", "Konami 80's AC Special (GC826 VER. UAA)", 
 	"konami88", "Konami '88", 
+	"konami_cpu", "KONAMI", 
 	"konamigt", "Konami GT", 
 	"konamigv", "Baby Phoenix/GV System", 
 	"konamigx", "System GX", 
@@ -8791,13 +9339,16 @@ const char* mameNameToRealName[] = {
 	"kuhga", "Kuhga - Operation Code 'Vapor Trail' (Japan revision 3)", 
 	"kungfub", "Kung-Fu Master (bootleg set 1)", 
 	"kungfub2", "Kung-Fu Master (bootleg set 2)", 
+	"kungfud", "Kung Fu Master (Data East)",
 	"kungfum", "Kung-Fu Master (World)", 
 	"kungfumd", "Kung-Fu Master (US)", 
 	"kungfur", "Kung-Fu Roushi", 
 	"kungfut", "Kung-Fu Taikun (set 1)", 
 	"kungfuta", "Kung-Fu Taikun (set 2)", 
+	"kuniokub", "Nekketsu Kouha Kunio-kun (Japan bootleg)",
 	"kuniokun", "Nekketsu Kouha Kunio-kun (Japan)", 
 	"kuniokunb", "Nekketsu Kouha Kunio-kun (Japan bootleg)", 
+	"kurikina", "Kuri Kinton (prototype?)",
 	"kurikint", "Kuri Kinton (World)", 
 	"kurikinta", "Kuri Kinton (World, prototype?)", 
 	"kurikintj", "Kuri Kinton (Japan)", 
@@ -8811,6 +9362,7 @@ const char* mameNameToRealName[] = {
 	"kyuhito", "Kyukyoku no Hito [BET] (Japan 880824)", 
 	"kyukaidk", "Kyuukai Douchuuki (Japan, new version (Rev B))", 
 	"kyukaidko", "Kyuukai Douchuuki (Japan, old version)", 
+	"kyukaido", "Kyuukai Douchuuki (Japan old version)",
 	"kyustrkr", "Last Striker / Kyuukyoku no Striker", 
 	"kz26", "KZ-26", 
 	"labyrunr", "Labyrinth Runner (Japan)", 
@@ -8881,10 +9433,13 @@ const char* mameNameToRealName[] = {
 	"lastmisn", "Last Mission (US revision 6)", 
 	"lastmisnj", "Last Mission (Japan)", 
 	"lastmisno", "Last Mission (US revision 5)", 
+	"lastmiss", "Last Mission (US revision 6)",
+	"lastmss2", "Last Mission (US revision 5)",
 	"lastsold", "The Last Soldier (Korean release of The Last Blade)", 
 	"laststar", "The Last Starfighter (prototype)", 
 	"lastsurv", "Last Survivor (Japan, FD1094 317-0083)", 
 	"lasvegas", "Las Vegas, Nevada", 
+	"latch8", "8 bit latch", 
 	"lazarian", "Lazarian", 
 	"lazercmd", "Lazer Command", 
 	"lazrlord", "Lazer Lord", 
@@ -8895,6 +9450,7 @@ const char* mameNameToRealName[] = {
 	"lc_11", "League Champ (1.1)", 
 	"lca", "Lights...Camera...Action!", 
 	"lca2", "Lights...Camera...Action! (rev.2)", 
+	"ldp1450", "Sony LDP-1450", 
 	"ldrink", "Lucky Drink (set 1)", 
 	"ldrinka", "Lucky Drink (set 2)", 
 	"ldrun", "Lode Runner (set 1)", 
@@ -8903,6 +9459,7 @@ const char* mameNameToRealName[] = {
 	"ldrun3j", "Lode Runner III - Majin No Fukkatsu", 
 	"ldrun4", "Lode Runner IV - Teikoku Karano Dasshutsu", 
 	"ldruna", "Lode Runner (set 2)", 
+	"ldv1000", "Pioneer LD-V1000", 
 	"le2", "Lethal Enforcers II: Gun Fighters (ver EAA)", 
 	"le2j", "Lethal Enforcers II: The Western (ver JAA)", 
 	"le2u", "Lethal Enforcers II: Gun Fighters (ver UAA)", 
@@ -8912,6 +9469,7 @@ const char* mameNameToRealName[] = {
 	"lectrono", "Lectronamo", 
 	"ledstorm", "Led Storm (US)", 
 	"ledstorm2", "Led Storm Rally 2011 (US)", 
+	"legacy_mos8520", "LEGACY_MOS8520", 
 	"legend", "Legend", 
 	"legendb", "Legion (bootleg of Legend)", 
 	"legendoh", "Legend of Heroes", 
@@ -8922,6 +9480,7 @@ const char* mameNameToRealName[] = {
 	"legiono", "Chouji Meikyuu Legion (Japan bootleg ver 1.05)", 
 	"legofair", "Koukuu Kihei Monogatari - The Legend of Air Cavalry (Japan)", 
 	"leking", "Le King", 
+	"leland_80186_sound", "Leland 80186 DAC", 
 	"lemans24", "Le Mans 24 (Revision B)", 
 	"lemmings", "Lemmings (US prototype)", 
 	"lemnangl", "Mahjong Lemon Angel (Japan)", 
@@ -8974,10 +9533,14 @@ const char* mameNameToRealName[] = {
 	"liblrabl", "Libble Rabble", 
 	"lifefrce", "Lifeforce (US)", 
 	"lifefrcej", "Lifeforce (Japan)", 
+	"lifefrcj", "Lifeforce (Japan)",
 	"lightbr", "Light Bringer (Ver 2.2O 1994/04/08)", 
 	"lightbrj", "Light Bringer (Ver 2.1J 1994/02/18)", 
 	"lightnin", "Lightning", 
 	"lindbios", "Sega Lindbergh Bios", 
+	"linearflash16mb", "Linear Flash PCCARD (16MB)", 
+	"linearflash32mb", "Linear Flash PCCARD (32MB)", 
+	"linearflash64mb", "Linear Flash PCCARD (64MB)", 
 	"linkypip", "Linky Pipe", 
 	"liquidk", "Liquid Kids (World)", 
 	"liquidku", "Liquid Kids (US)", 
@@ -9029,6 +9592,7 @@ const char* mameNameToRealName[] = {
 	"lordofk", "The Lord of King (Japan)", 
 	"lortium", "Lortium", 
 	"lostspc", "Lost in Space", 
+	"losttmbh", "Lost Tomb (hard)",
 	"losttomb", "Lost Tomb (easy)", 
 	"losttombh", "Lost Tomb (hard)", 
 	"lostwrld", "Lost Worlds (Japan)", 
@@ -9092,9 +9656,12 @@ const char* mameNameToRealName[] = {
 	"lrescuem2", "Lunar Rescue (Model Racing bootleg, set 2)", 
 	"lresort", "Last Resort", 
 	"lsasquad", "Land Sea Air Squad / Riku Kai Kuu Saizensen", 
+	"lsi53c810", "53C810 SCSI", 
 	"lsrcu_l2", "Laser Cue (L-2)", 
 	"lsrquiz", "Laser Quiz Italy", 
 	"lsrquiz2", "Laser Quiz 2 Italy (v1.0)", 
+	"lstduela", "Last Duel (US set 2)",
+	"lstduelb", "Last Duel (bootleg)",
 	"ltcasinn", "Little Casino (newer)", 
 	"ltcasino", "Little Casino (older)", 
 	"luckboom", "Lucky Boom", 
@@ -9143,6 +9710,7 @@ const char* mameNameToRealName[] = {
 	"lwings2", "Legendary Wings (US set 2)", 
 	"lwingsb", "Legendary Wings (bootleg)", 
 	"lwingsj", "Ares no Tsubasa (Japan)", 
+	"lwingsjp", "Ales no Tsubasa (Japan)",
 	"lzbal_l2", "Laser Ball (L-2)", 
 	"lzbal_t2", "Laser Ball (T-2)", 
 	"m1albsq", "Albert Square (Maygay) v4.1 (M1A/B)", 
@@ -10233,6 +10801,9 @@ const char* mameNameToRealName[] = {
 	"m21", "21 (Mirco)", 
 	"m2hilite", "Hi-Lights (Barcrest) (MPU2)", 
 	"m2svlite", "Silver Lights (Barcrest) (MPU2)", 
+	"m3745x", "Mitsubishi M37450", 
+	"m37702", "M37702", 
+	"m37710", "M37710", 
 	"m3acech", "Ace Chase (Bwb) (MPU3)", 
 	"m3autort", "Autoroute (Barcrest) (MPU3)", 
 	"m3bankr", "Banker (Bwb) (MPU3)", 
@@ -10318,6 +10889,11 @@ const char* mameNameToRealName[] = {
 	"m421", "Twenty One (Barcrest) (MPU4)", 
 	"m421club", "21 Club (Barcrest) [DTW, Dutch] (MPU4)", 
 	"m42punlm", "2p Unlimited (Mdm) (MPU4)", 
+	"m48t02", "M48T02", 
+	"m48t08", "MK48T08", 
+	"m48t35", "M48T35", 
+	"m48t37", "M48T37", 
+	"m48t58", "M48T58", 
 	"m4aao", "Against All Odds (Eurotek) (MPU4)", 
 	"m4abeaut", "American Beauty (Avantime?) (MPU4) (AB, set 1)", 
 	"m4abeaut_1", "American Beauty (Avantime?) (MPU4) (AB, set 2)", 
@@ -15907,7 +16483,11 @@ const char* mameNameToRealName[] = {
 	"m4xtrm__b", "X-treme (Bwb) (MPU4) (set 3)", 
 	"m4zill", "Zillionare's Challenge (Pure Leisure) (MPU4) (set 1)", 
 	"m4zilla", "Zillionare's Challenge (Pure Leisure) (MPU4) (set 2)", 
+	"m50458", "m50458", 
 	"m55050", "Fifty Fifty (Bwb) (MPU5)", 
+	"m58715", "M58715", 
+	"m58817", "M58817", 
+	"m58819", "M58819", 
 	"m5aceclb", "Ace Of Clubs (Empire) (MPU5, set 1)", 
 	"m5aceclba", "Ace Of Clubs (Empire) (MPU5, set 2)", 
 	"m5aceclbb", "Ace Of Clubs (Empire) (MPU5, set 3)", 
@@ -16537,9 +17117,29 @@ const char* mameNameToRealName[] = {
 	"m5xfact04", "X Factor (Empire) (MPU5) (set 3)", 
 	"m5xfact11", "X Factor (Empire) (MPU5) (set 4)", 
 	"m5zigzag", "Zig Zag (Barcrest - Red Gaming) (MPU5)", 
+	"m6502", "M6502", 
+	"m6504", "M6504", 
+	"m65sc02", "M65SC02", 
 	"m660", "Mission 660 (US)", 
 	"m660b", "Mission 660 (bootleg)", 
 	"m660j", "Mission 660 (Japan)", 
+	"m6800", "M6800", 
+	"m68000", "M68000", 
+	"m6801", "M6801", 
+	"m68010", "M68010", 
+	"m6802", "M6802", 
+	"m68020", "M68020", 
+	"m6803", "M6803", 
+	"m68040", "M68040", 
+	"m6808", "M6808", 
+	"m6809", "M6809", 
+	"m6809e", "M6809E", 
+	"m68301", "M68301", 
+	"m68705", "M68705", 
+	"m68ec020", "M68EC020", 
+	"m68ec030", "M68EC030", 
+	"m6m80011ap", "M6M80011AP EEPROM", 
+	"m72_audio", "M72 Custom", 
 	"m79amb", "M-79 Ambush", 
 	"m_mpac", "Mr. and Mrs. PacMan", 
 	"m_tppokr", "Top Poker (Dutch, Game Card 95-750-899)", 
@@ -16554,6 +17154,7 @@ const char* mameNameToRealName[] = {
 	"machomou", "Macho Mouse", 
 	"machridr", "Vs. Mach Rider (Endurance Course Version)", 
 	"machridra", "Vs. Mach Rider (Fighting Course Version, set MR4-1 A)", 
+	"macronix_29l001mc", "Macronix 29L001MC Flash", 
 	"macross", "Super Spacefortress Macross / Chou-Jikuu Yousai Macross", 
 	"macross2", "Super Spacefortress Macross II / Chou-Jikuu Yousai Macross II", 
 	"macrossp", "Macross Plus", 
@@ -16633,6 +17234,7 @@ const char* mameNameToRealName[] = {
 	"mahretsu", "Mahjong Kyo Retsuden (NGM-004)(NGH-004)", 
 	"maiko", "Maikobana (Japan 900802)", 
 	"mainevt", "The Main Event (4 Players ver. Y)", 
+	"mainevt2", "Main Event, The (version F)",
 	"mainevt2p", "The Main Event (2 Players ver. X)", 
 	"mainevto", "The Main Event (4 Players ver. F)", 
 	"mainline", "Mainline Double Joker Poker", 
@@ -16649,6 +17251,8 @@ const char* mameNameToRealName[] = {
 	"majxtal7", "Mahjong X-Tal 7 - Crystal Mahjong / Mahjong Diamond 7 (Japan)", 
 	"makaiden", "Makai Densetsu (Japan)", 
 	"makaijan", "Makaijan [BET] (Japan)", 
+	"makaimuc", "Makai-Mura (Revision C)",
+	"makaimug", "Makai-Mura (Revision G)",
 	"makaimur", "Makai-Mura (Japan)", 
 	"makaimurc", "Makai-Mura (Japan Revision C)", 
 	"makaimurg", "Makai-Mura (Japan Revision G)", 
@@ -16672,13 +17276,16 @@ const char* mameNameToRealName[] = {
 	"manxtt", "Manx TT Superbike - DX (Revision D)", 
 	"manxttc", "Manx TT Superbike - Twin (Revision C)", 
 	"manybloc", "Many Block", 
+	"maple_dc", "MAPLE_DC", 
 	"mappy", "Mappy (US)", 
 	"mappyj", "Mappy (Japan)", 
+	"mappyjp", "Mappy (Japan)",
 	"marble", "Marble Madness (set 1)", 
 	"marble2", "Marble Madness (set 2)", 
 	"marble3", "Marble Madness (set 3)", 
 	"marble4", "Marble Madness (set 4)", 
 	"marble5", "Marble Madness (set 5 - LSI Cartridge)", 
+	"marblea", "Marble Madness (set 3)",
 	"margmgc", "Margarita Magic (01J00101, NSW/ACT)", 
 	"marineb", "Marine Boy", 
 	"marinedt", "Marine Date", 
@@ -16686,6 +17293,7 @@ const char* mameNameToRealName[] = {
 	"mario", "Mario Bros. (US, Revision F)", 
 	"marioe", "Mario Bros. (US, Revision E)", 
 	"marioj", "Mario Bros. (Japan)", 
+	"mariojp", "Mario Bros. (Japan)",
 	"marioo", "Mario Bros. (US, Unknown Rev)", 
 	"markham", "Markham", 
 	"mars", "Mars", 
@@ -16700,6 +17308,8 @@ const char* mameNameToRealName[] = {
 	"marvins", "Marvin's Maze", 
 	"marvland", "Marvel Land (US)", 
 	"marvlandj", "Marvel Land (Japan)", 
+	"marvlanj", "Marvel Land (Japan)",
+	"mas3507d", "MAS3507D", 
 	"masao", "Masao", 
 	"maski", "Maski Show (Russia) (Extrema)", 
 	"mastboy", "Master Boy (Spanish, PCB Rev A)", 
@@ -16713,6 +17323,7 @@ const char* mameNameToRealName[] = {
 	"match98", "Match '98 (ver. 1.33)", 
 	"matchit", "Match It", 
 	"matchit2", "Match It II", 
+	"mathbox", "MATHBOX", 
 	"matmania", "Mat Mania", 
 	"matrim", "Matrimelee / Shin Gouketsuji Ichizoku Toukon (NGM-2660) (NGH-2660)", 
 	"matrimbl", "Matrimelee / Shin Gouketsuji Ichizoku Toukon (bootleg)", 
@@ -16748,9 +17359,21 @@ const char* mameNameToRealName[] = {
 	"mazerblaa", "Mazer Blazer (set 2)", 
 	"mazinger", "Mazinger Z (World)", 
 	"mazingerj", "Mazinger Z (Japan)", 
+	"mb14241", "MB14241", 
+	"mb3773", "MB3773", 
+	"mb86233", "MB86233", 
+	"mb87078", "Fujitsu MB87078", 
+	"mb8841", "MB8841", 
+	"mb8842", "MB8842", 
+	"mb8843", "MB8843", 
+	"mb8844", "MB8844", 
+	"mb8884", "MB8884", 
+	"mb89371", "MB89371", 
+	"mb90082", "mb90082", 
 	"mb_10", "Monster Bash (1.0)", 
 	"mb_106", "Monster Bash (1.06)", 
 	"mb_106b", "Monster Bash (1.06b)", 
+	"mb_vcu", "Mazer Blazer custom VCU", 
 	"mbaa", "Melty Blood Actress Again", 
 	"mbaaa", "Melty Blood Actress Again (Ver. A)", 
 	"mbomberj", "Muscle Bomber: The Body Explosion (Japan 930713)", 
@@ -16758,12 +17381,25 @@ const char* mameNameToRealName[] = {
 	"mbombrdj", "Muscle Bomber Duo: Heat Up Warriors (Japan 931206)", 
 	"mbossy", "Mike Bossy", 
 	"mbrush", "Magic Brush (bootleg of Crush Roller)", 
+	"mc146818", "MC146818", 
+	"mc3417", "MC3417", 
+	"mc65c02", "M65C02", 
+	"mc68307", "MC68307", 
+	"mc68340", "MC68340", 
+	"mc6845", "MC6845 CRTC", 
+	"mc68681", "MC68681", 
+	"mc68681_channel", "DUART 68681 channel", 
+	"mc68901", "Motorola MC68901", 
+	"mc68hc11", "MC68HC11", 
 	"mcastle", "Magic Castle", 
 	"mcastlef", "Magic Castle (French speech)", 
 	"mcastleg", "Magic Castle (German speech)", 
 	"mcastlei", "Magic Castle (Italian speech)", 
 	"mcatadv", "Magical Cat Adventure", 
 	"mcatadvj", "Magical Cat Adventure (Japan)", 
+	"mcd212", "MCD212", 
+	"mcf5206e", "MCF5206E", 
+	"mcf5206e_peripheral", "MCF5206E Peripheral", 
 	"mchampdx", "Multi Champ Deluxe (ver. 0106, 06/01/2000)", 
 	"mchampdxa", "Multi Champ Deluxe (ver. 1126, 26/11/1999)", 
 	"mchampdxb", "Multi Champ Deluxe (ver. 1114, 14/11/1999)", 
@@ -16784,6 +17420,7 @@ const char* mameNameToRealName[] = {
 	"mechattj", "Mechanized Attack (Japan)", 
 	"mechattu", "Mechanized Attack (US)", 
 	"mechattu1", "Mechanized Attack (US, Version 1, Single Player)", 
+	"mediagx", "MEDIAGX", 
 	"medlanes", "Meadows Lanes", 
 	"medusa", "Medusa", 
 	"megaaton", "Meg Aaton", 
@@ -16843,6 +17480,7 @@ const char* mameNameToRealName[] = {
 	"megat6", "Megatouch 6 (9255-80-01 ROA, Standard version)", 
 	"megatack", "Megatack", 
 	"megatech", "Mega-Tech", 
+	"megaznik", "Mega Zone (Kosuka)",
 	"megazone", "Mega Zone (Konami set 1)", 
 	"megazonea", "Mega Zone (Konami set 2)", 
 	"megazoneb", "Mega Zone (Kosuka set 1)", 
@@ -16943,13 +17581,24 @@ const char* mameNameToRealName[] = {
 	"michkitb", "Michigan Kit Bingo Stake 6/10 (Bingo)", 
 	"michnew", "Michigan Bingo New (Bingo)", 
 	"michstake", "Michigan Bingo Stake 6/10 (Bingo)", 
+	"micro3d_sound", "Microprose Custom", 
 	"micrombc", "Microman Battle Charge (J 990326 V1.000)", 
+	"microtouch", "Microtouch Touchscreen", 
+	"microtouch_serial", "Microtouch Serial Touchscreen", 
+	"midcsd", "Midway Chip Squeak Deluxe Sound Board", 
 	"midearth", "Middle Earth", 
+	"midi_kbd", "Generic MIDI Keyboard", 
 	"midnrun", "Midnight Run (Euro v1.11)", 
 	"midres", "Midnight Resistance (World)", 
 	"midresb", "Midnight Resistance (bootleg with 68705)", 
 	"midresj", "Midnight Resistance (Japan)", 
 	"midresu", "Midnight Resistance (US)", 
+	"midsg", "Midway Sounds Good Sound Board", 
+	"midsnt", "Midway Squawk 'n' Talk Sound Board", 
+	"midssio", "Midway SSIO Sound Board", 
+	"midtcs", "Midway Turbo Chip Squeak Sound Board", 
+	"mie", "MIE", 
+	"mie_jvs", "MIE-JVS", 
 	"miexchng", "Money Puzzle Exchanger / Money Idol Exchanger", 
 	"mightguy", "Mighty Guy", 
 	"mightybj", "Vs. Mighty Bomb Jack (Japan)", 
@@ -16976,6 +17625,7 @@ const char* mameNameToRealName[] = {
 	"miniboy7", "Mini Boy 7 (set 1)", 
 	"miniboy7a", "Mini Boy 7 (set 2)", 
 	"miniboy7b", "Mini Boy 7 (set 3)", 
+	"minigol2", "Mini Golf (set 2)",
 	"minigolf", "Mini Golf (11/25/85)", 
 	"minigolf2", "Mini Golf (10/8/85)", 
 	"minivadr", "Mini Vaders", 
@@ -17035,6 +17685,7 @@ const char* mameNameToRealName[] = {
 	"mjikaga", "Mahjong Ikaga Desu ka (Japan)", 
 	"mjkinjas", "Mahjong Kinjirareta Asobi (Japan)", 
 	"mjkjidai", "Mahjong Kyou Jidai (Japan)", 
+	"mjkjidai_adpcm", "Custom ADPCM", 
 	"mjkoiura", "Mahjong Koi Uranai (Japan set 1)", 
 	"mjkojink", "Mahjong Kojinkyouju (Private Teacher) (Japan)", 
 	"mjlaman", "Mahjong La Man (Japan)", 
@@ -17049,6 +17700,7 @@ const char* mameNameToRealName[] = {
 	"mjnanpas", "Mahjong Nanpa Story (Japan 890713)", 
 	"mjnanpau", "Mahjong Nanpa Story (Ura) (Japan 890805)", 
 	"mjnatsu", "Mahjong Natsu Monogatari (Japan)", 
+	"mjnquesb", "Mahjong Quest (No Nudity)",
 	"mjnquest", "Mahjong Quest (Japan)", 
 	"mjnquestb", "Mahjong Quest (No Nudity)", 
 	"mjprivat", "Mahjong Private (Japan)", 
@@ -17079,6 +17731,7 @@ const char* mameNameToRealName[] = {
 	"mk2r21", "Mortal Kombat II (rev L2.1)", 
 	"mk2r30", "Mortal Kombat II (rev L3.0)", 
 	"mk2r31e", "Mortal Kombat II (rev L3.1 (European))", 
+	"mk2r32", "Mortal Kombat II (rev L3.2 (European))",
 	"mk2r32e", "Mortal Kombat II (rev L3.2 (European))", 
 	"mk2r42", "Mortal Kombat II (rev L4.2, hack)", 
 	"mk2r91", "Mortal Kombat II (rev L9.1, hack)", 
@@ -17133,6 +17786,7 @@ const char* mameNameToRealName[] = {
 	"mmpanic", "Monkey Mole Panic (USA)", 
 	"mmpork", "Muchi Muchi Pork! (2007/ 4/17 MASTER VER.)", 
 	"mmsikaku", "Mahjong Shikaku [BET] (Japan 880929)", 
+	"mn1020012a", "MN1020012A", 
 	"mnchmobl", "Munch Mobile (US)", 
 	"mnfb_c27", "Monday Night Football (2.7, 50cts)", 
 	"mnight", "Mutant Night", 
@@ -17187,6 +17841,7 @@ const char* mameNameToRealName[] = {
 	"monsterz", "Monster Zero", 
 	"montana", "Montana Bingo Stake 6/10 (Bingo)", 
 	"montecar", "Monte Carlo", 
+	"monwar2a", "Moon War II (set 2)",
 	"monymony", "Money Money", 
 	"monzagp", "Monza GP", 
 	"monzagpb", "Monza GP (bootleg)", 
@@ -17208,6 +17863,7 @@ const char* mameNameToRealName[] = {
 	"mooncrs3", "Moon Cresta (bootleg set 3)", 
 	"mooncrs4", "Moon Crest (Moon Cresta bootleg)", 
 	"mooncrsb", "Moon Cresta (bootleg set 1)", 
+	"mooncrsg", "Moon Cresta (Gremlin)",
 	"mooncrsl", "Cresta Mundo (Laguna S.A. Spanish Moon Cresta bootleg)", 
 	"mooncrst", "Moon Cresta (Nichibutsu)", 
 	"mooncrstg", "Moon Cresta (Gremlin)", 
@@ -17217,11 +17873,16 @@ const char* mameNameToRealName[] = {
 	"mooncrstuku", "Moon Cresta (Nichibutsu UK, unencrypted)", 
 	"moonlght", "Moon Light (bootleg of Golden Star)", 
 	"moonqsr", "Moon Quasar", 
+	"moonwalk", "Moon Walker (Set 1)",
 	"moonwar", "Moonwar", 
+	"moonwar2", "Moon War II (set 1)",
 	"moonwara", "Moonwar (older)", 
 	"moonwarp", "Moon War (prototype on Frenzy hardware)", 
+	"moonwlka", "Moon Walker (Set 2)",
+	"moonwlkb", "Moon Walker (bootleg)",
 	"moremore", "More More", 
 	"moremorp", "More More Plus", 
+	"mos656x_attack_ufo", "MOS656X", 
 	"mosaic", "Mosaic", 
 	"mosaica", "Mosaic (Fuuki)", 
 	"mosaicf2", "Mosaic (F2 System)", 
@@ -17267,6 +17928,7 @@ const char* mameNameToRealName[] = {
 	"mpangu", "Mighty! Pang (USA 001010)", 
 	"mpatrol", "Moon Patrol", 
 	"mpatrolw", "Moon Patrol (Williams)", 
+	"mpc8240", "PowerPC MPC8240", 
 	"mplanets", "Mad Planets", 
 	"mplanetsuk", "Mad Planets (UK)", 
 	"mpoker", "Multi-Poker", 
@@ -17302,6 +17964,7 @@ const char* mameNameToRealName[] = {
 	"mrtnt", "Mr. TNT", 
 	"mrviking", "Mister Viking (315-5041)", 
 	"mrvikingj", "Mister Viking (315-5041, Japan)", 
+	"mrvikinj", "Mister Viking (Japan)",
 	"ms4plus", "Metal Slug 4 Plus (bootleg)", 
 	"ms5pcb", "Metal Slug 5 (JAMMA PCB)", 
 	"ms5plus", "Metal Slug 5 Plus (bootleg)", 
@@ -17351,6 +18014,11 @@ const char* mameNameToRealName[] = {
 	"mslug5h", "Metal Slug 5 (NGH-2680)", 
 	"mslug6", "Metal Slug 6", 
 	"mslugx", "Metal Slug X - Super Vehicle-001 (NGM-2500)(NGH-2500)", 
+	"msm5205", "MSM5205", 
+	"msm5232", "MSM5232", 
+	"msm6242", "msm6242", 
+	"msm6585", "MSM6585", 
+	"mspacatk", "Ms. Pac-Man Plus",
 	"mspacii", "Ms. Pac-Man II (Orca bootleg set 1)", 
 	"mspacii2", "Ms. Pac-Man II (Orca bootleg set 2)", 
 	"mspacmab", "Ms. Pac-Man (bootleg)", 
@@ -17442,6 +18110,7 @@ const char* mameNameToRealName[] = {
 	"multigm3", "Multi Game III", 
 	"multigmb", "Multi Game (set 2)", 
 	"multigmt", "Multi Game (Tung Sheng Electronics)", 
+	"multipcm", "Sega/Yamaha 315-5560", 
 	"multiped", "Multipede (Centipede/Millipede multigame kit)", 
 	"multiwin", "Multi Win (Ver.0167, encrypted)", 
 	"mundial", "Mundial 90", 
@@ -17511,6 +18180,7 @@ const char* mameNameToRealName[] = {
 	"myangel3", "Kosodate Quiz My Angel 3 (Japan, KQT1/VER.A)", 
 	"myfairld", "Virtual Mahjong 2 - My Fair Lady (J 980608 V1.000)", 
 	"myhero", "My Hero (US, not encrypted)", 
+	"myheroj", "Seishun Scandal (Japan)",
 	"myherok", "My Hero (Korea)", 
 	"myqbert", "Mello Yello Q*bert", 
 	"mystcast", "Mystery Castle", 
@@ -17527,15 +18197,34 @@ const char* mameNameToRealName[] = {
 	"mystwarra", "Mystic Warriors (ver AAA)", 
 	"mystwarrj", "Mystic Warriors (ver JAA)", 
 	"mystwarru", "Mystic Warriors (ver UAA)", 
+	"n2a03", "N2A03", 
+	"n64_periphs", "N64 Periphal Chips", 
+	"n7751", "N7751", 
 	"nagano98", "Nagano Winter Olympics '98 (GX720 EAA)", 
 	"naganoj", "Hyper Olympic in Nagano (GX720 JAA)", 
 	"nam1975", "NAM-1975 (NGM-001)(NGH-001)", 
+	"namco", "Namco", 
+	"namco06xx", "Namco 06xx", 
+	"namco50", "Namco 50xx", 
+	"namco51", "Namco 51xx", 
+	"namco52", "Namco 52xx", 
+	"namco53", "Namco 53xx", 
+	"namco54", "Namco 54xx", 
+	"namco62", "Namco 62xx", 
+	"namco_63701x", "Namco 63701X", 
+	"namco_c45_road", "Namco C45 Road", 
+	"namco_settings", "Namco settings device", 
 	"namcostr", "Namco Stars", 
 	"nametune", "Name That Tune (set 1)", 
 	"nametune2", "Name That Tune (3/23/86)", 
 	"naname", "Naname de Magic! (Japan)", 
 	"naomi", "Naomi Bios", 
 	"naomi2", "Naomi 2 Bios", 
+	"naomi_gdrom_board", "NAOMI-GDROM-BOARD", 
+	"naomi_m1_board", "NAOMI-M1-BOARD", 
+	"naomi_m2_board", "NAOMI-M2-BOARD", 
+	"naomi_m4_board", "NAOMI-M4-BOARD", 
+	"naomi_rom_board", "NAOMI-ROM-BOARD", 
 	"naomigd", "Naomi GD-ROM Bios", 
 	"narc", "Narc (rev 7.00)", 
 	"narc2", "Narc (rev 2.00)", 
@@ -17557,10 +18246,15 @@ const char* mameNameToRealName[] = {
 	"natodef", "NATO Defense", 
 	"natodefa", "NATO Defense (alternate mazes)", 
 	"natsuiro", "Natsuiro Mahjong (Japan)", 
+	"naughtya", "Naughty Boy (bootleg)",
 	"naughtyb", "Naughty Boy", 
+	"naughtyb_sound", "Naughty Boy Custom", 
 	"naughtyba", "Naughty Boy (bootleg)", 
 	"naughtybc", "Naughty Boy (Cinematronics)", 
+	"naughtyc", "Naughty Boy (Cinematronics)",
+	"navalone", "Navalone",
 	"navarone", "Navarone", 
+	"nb1413m3", "Nichibutsu NB1413M3", 
 	"nbaf_11", "NBA Fastbreak (1.1)", 
 	"nbaf_115", "NBA Fastbreak (1.15)", 
 	"nbaf_11a", "NBA Fastbreak (1.1 - S2.0)", 
@@ -17574,11 +18268,15 @@ const char* mameNameToRealName[] = {
 	"nbajam", "NBA Jam (rev 3.01 04/07/93)", 
 	"nbajamex", "NBA Jam Extreme", 
 	"nbajamr2", "NBA Jam (rev 2.00 02/10/93)", 
+	"nbajamt1", "NBA Jam TE (rev 1.0 01/17/94)",
+	"nbajamt2", "NBA Jam TE (rev 2.0 01/28/94)",
+	"nbajamt3", "NBA Jam TE (rev 3.0 03/04/94)",
 	"nbajamte", "NBA Jam TE (rev 4.0 03/23/94)", 
 	"nbajamte1", "NBA Jam TE (rev 1.0 01/17/94)", 
 	"nbajamte2", "NBA Jam TE (rev 2.0 01/28/94)", 
 	"nbajamte3", "NBA Jam TE (rev 3.0 03/04/94)", 
 	"nbajamten", "NBA Jam T.E. Nani Edition (rev 5.2 8/11/95, prototype)", 
+	"nbamaxht", "NBA Maximum Hangtime (rev 1.0)",
 	"nbamht", "NBA Maximum Hangtime (rev 1.03 06/09/97)", 
 	"nbamht1", "NBA Maximum Hangtime (rev 1.0 11/08/96)", 
 	"nbanfl", "NBA Showtime / NFL Blitz 2000", 
@@ -17597,6 +18295,7 @@ const char* mameNameToRealName[] = {
 	"ncombat", "Ninja Combat (NGM-009)", 
 	"ncombath", "Ninja Combat (NGH-009)", 
 	"ncommand", "Ninja Commando", 
+	"ncr537xx", "53C7xx SCSI", 
 	"ncv1", "Namco Classic Collection Vol.1", 
 	"ncv1j", "Namco Classic Collection Vol.1 (Japan, v1.00)", 
 	"ncv1j2", "Namco Classic Collection Vol.1 (Japan, v1.03)", 
@@ -17604,6 +18303,7 @@ const char* mameNameToRealName[] = {
 	"ncv2j", "Namco Classic Collection Vol.2 (Japan)", 
 	"ndcfboxa", "Naomi DIMM Firmware Update for CF-BOX (Rev A) (GDS-0042A)", 
 	"ndxron10", "Royal on Ten (Noraut Deluxe hack)", 
+	"nebulbee", "Nebulous Bee",
 	"nebulray", "Nebulas Ray (World, NR2)", 
 	"nebulrayj", "Nebulas Ray (Japan, NR1)", 
 	"neckneck", "Neck-n-Neck (v1.2)", 
@@ -17611,6 +18311,7 @@ const char* mameNameToRealName[] = {
 	"nemesis", "Nemesis (ROM version)", 
 	"nemesisp", "Nemesis", 
 	"nemesisuk", "Nemesis (World?, ROM version)", 
+	"nemesuk", "Nemesis (World?)",
 	"nemo", "Nemo (World 901130)", 
 	"nemoj", "Nemo (Japan 901120)", 
 	"neobattl", "SD Gundam Neo Battling (Japan)", 
@@ -17622,7 +18323,12 @@ const char* mameNameToRealName[] = {
 	"neptunp2", "Neptune's Pearls 2", 
 	"neruton", "Mahjong Neruton Haikujiradan (Japan, Rev. B?)", 
 	"nerutona", "Mahjong Neruton Haikujiradan (Japan, Rev. A?)", 
+	"nesapu", "N2A03 APU", 
 	"netchu02", "Netchuu Pro Yakyuu 2002 (NPY1 Ver. A)", 
+	"netlist_analog_input", "netlist analog input", 
+	"netlist_analog_output", "netlist analog output", 
+	"netlist_cpu", "Netlist cpu device", 
+	"netlist_sound", "Netlist sound device", 
 	"netmerc", "NetMerc?", 
 	"nettoqc", "Nettoh Quiz Champion (Japan)", 
 	"netwars", "Net Wars", 
@@ -17678,6 +18384,7 @@ const char* mameNameToRealName[] = {
 	"nibbler", "Nibbler (rev 9)", 
 	"nibbler6", "Nibbler (rev 6)", 
 	"nibbler8", "Nibbler (rev 8)", 
+	"nibblera", "Nibbler (set 2)",
 	"nibblero", "Nibbler (Olympia - rev 8)", 
 	"nibblerp", "Nibbler (Pioneer Balloon conversion)", 
 	"nightgal", "Night Gal (Japan 840920 AG 1-00)", 
@@ -17688,10 +18395,13 @@ const char* mameNameToRealName[] = {
 	"nightstr", "Night Striker (World)", 
 	"nightstrj", "Night Striker (Japan)", 
 	"nightstru", "Night Striker (US)", 
+	"nile", "NiLe", 
 	"ninclown", "Ninja Clowns (08/27/91)", 
 	"nineball", "Nine Ball", 
 	"ninja", "Ninja (315-5102)", 
 	"ninjak", "The Ninja Kids (World)", 
+	"ninjak2a", "Ninja Kid II (set 2)",
+	"ninjak2b", "Ninja Kid II (set 3)",
 	"ninjakd2", "Ninja-Kid II / NinjaKun Ashura no Shou (set 1)", 
 	"ninjakd2a", "Ninja-Kid II / NinjaKun Ashura no Shou (set 2, bootleg?)", 
 	"ninjakd2b", "Ninja-Kid II / NinjaKun Ashura no Shou (set 3, bootleg?)", 
@@ -17719,7 +18429,9 @@ const char* mameNameToRealName[] = {
 	"nmg5", "Multi 5 / New Multi Game 5 (set 1)", 
 	"nmg5a", "Multi 5 / New Multi Game 5 (set 2)", 
 	"nmg5e", "Multi 5 / New Multi Game 5 (set 3, earlier)", 
-	"nmouse", "Naughty Mouse (set 1)", 
+	"nmk004", "NMK004", 
+	"nmk112", "NMK 112", 
+	"nmouse", "Naughty Mouse (set 1)", 
 	"nmouseb", "Naughty Mouse (set 2)", 
 	"nmoves", "Night Moves", 
 	"nmsengen", "Nekketsu Mahjong Sengen! AFTER 5 (Japan)", 
@@ -17748,20 +18460,29 @@ const char* mameNameToRealName[] = {
 	"nostk", "Nostradamus (Korea)", 
 	"nouryoku", "Nouryoku Koujou Iinkai", 
 	"nouryokup", "Nouryoku Koujou Iinkai (prototype)", 
+	"nov2001u", "Nova 2001 (US)",
 	"nova2001", "Nova 2001 (Japan)", 
 	"nova2001u", "Nova 2001 (US)", 
 	"novoplay", "Novo Play Multi Card / Club Card", 
+	"npacmod", "PuckMan (harder?)",
 	"npcartv1", "Neo Print V1 (World)", 
 	"nprinces", "Ninja Princess (315-5051, 64k Ver. bootleg?)", 
 	"nprincesb", "Ninja Princess (315-5051?, 128k Ver. bootleg?)", 
 	"nprinceso", "Ninja Princess (315-5098, 128k Ver.)", 
 	"nprincesu", "Ninja Princess (64k Ver. not encrypted)", 
+	"nprincsb", "Ninja Princess (bootleg?)",
+	"nprincsu", "Ninja Princess (not encrypted)",
 	"nprsp", "NeopriSP Retro Collection (Japan)", 
 	"nrallyx", "New Rally X", 
 	"nrallyxb", "New Rally X (bootleg?)", 
 	"nratechu", "Neratte Chu", 
+	"ns16450", "National Semiconductor NS16450", 
+	"ns16550", "National Semiconductor NS16550", 
 	"ns8lines", "New Lucky 8 Lines / New Super 8 Lines (W-4)", 
 	"ns8linew", "New Lucky 8 Lines / New Super 8 Lines (F-5, Witch Bonus)", 
+	"nsc8105", "NSC8105", 
+	"nscsi_bus", "NSCSI Bus", 
+	"nscsi_connector", "NSCSI device connector abstraction", 
 	"nslasher", "Night Slashers (Korea Rev 1.3)", 
 	"nslasherj", "Night Slashers (Japan Rev 1.2)", 
 	"nslashers", "Night Slashers (Over Sea Rev 1.2)", 
@@ -17796,6 +18517,7 @@ const char* mameNameToRealName[] = {
 	"number10", "Number Dieci (Poker)", 
 	"numbr10l", "Number Dieci (Lattine)", 
 	"nunchaku", "Nunchackun", 
+	"nvram", "NVRAM", 
 	"nwarr", "Night Warriors: Darkstalkers' Revenge (Euro 950316)", 
 	"nwarra", "Night Warriors: Darkstalkers' Revenge (Asia 950302)", 
 	"nwarrb", "Night Warriors: Darkstalkers' Revenge (Brazil 950403)", 
@@ -17826,6 +18548,7 @@ const char* mameNameToRealName[] = {
 	"offroadt", "Ironman Ivan Stewart's Super Off-Road Track-Pak", 
 	"offroadt2p", "Ironman Ivan Stewart's Super Off-Road Track-Pak (2 Players)", 
 	"offrthnd", "Offroad Thunder", 
+	"offtwalc", "Off the Wall (2-player cocktail)",
 	"offtwall", "Off the Wall (2/3-player upright)", 
 	"offtwallc", "Off the Wall (2-player cocktail)", 
 	"ogonsiro", "Ougon no Shiro (Japan)", 
@@ -17841,6 +18564,9 @@ const char* mameNameToRealName[] = {
 	"ojankoy", "Ojanko Yakata (Japan)", 
 	"ojousan", "Ojousan (Japan 871204)", 
 	"ojousanm", "Ojousan [BET] (Japan 870108)", 
+	"okim6295", "OKI6295", 
+	"okim6376", "OKI6376", 
+	"okim9810", "OKI9810", 
 	"olds", "Oriental Legend Special / Xi You Shi E Zhuan Super (ver. 101, Korean Board)", 
 	"olds100", "Oriental Legend Special / Xi You Shi E Zhuan Super (ver. 100, set 1)", 
 	"olds100a", "Oriental Legend Special / Xi You Shi E Zhuan Super (ver. 100, set 2)", 
@@ -17902,6 +18628,8 @@ const char* mameNameToRealName[] = {
 	"orunnersj", "OutRunners (Japan)", 
 	"orunnersu", "OutRunners (US)", 
 	"oscar", "Psycho-Nics Oscar (World revision 0)", 
+	"oscarj", "Psycho-Nics Oscar (Japan revision 2)",
+	"oscarj0", "Psycho-Nics Oscar (Japan revision 0)",
 	"oscarj1", "Psycho-Nics Oscar (Japan revision 1)", 
 	"oscarj2", "Psycho-Nics Oscar (Japan revision 2)", 
 	"oscaru", "Psycho-Nics Oscar (US)", 
@@ -17928,6 +18656,7 @@ const char* mameNameToRealName[] = {
 	"outr2", "Out Run 2 (Rev A) (GDX-0004A)", 
 	"outr2st", "Out Run 2 Special Tours (Rev A) (GDX-0014A)", 
 	"outrun", "Out Run (sitdown/upright, Rev B)", 
+	"outruna", "Out Run (set 2)",
 	"outrunb", "Out Run (bootleg)", 
 	"outrundx", "Out Run (deluxe sitdown)", 
 	"outrundxa", "Out Run (deluxe sitdown earlier version)", 
@@ -17938,6 +18667,7 @@ const char* mameNameToRealName[] = {
 	"outzoneb", "Out Zone (older set)", 
 	"outzonec", "Out Zone (oldest set)", 
 	"outzoneh", "Out Zone (harder)", 
+	"outzonep", "Out Zone (bootleg)",
 	"overdriv", "Over Drive", 
 	"overrev", "Over Rev (Model 2C, Revision A)", 
 	"overrevb", "Over Rev (Model 2B, Revision B)", 
@@ -17963,6 +18693,8 @@ const char* mameNameToRealName[] = {
 	"pachifev", "Pachifever", 
 	"pachiten", "Medal Mahjong Pachi-Slot Tengoku [BET] (Japan)", 
 	"pacland", "Pac-Land (World)", 
+	"pacland2", "Pac-Land (set 2)",
+	"pacland3", "Pac-Land (set 3)",
 	"paclandj", "Pac-Land (Japan new)", 
 	"paclandjo", "Pac-Land (Japan old)", 
 	"paclandjo2", "Pac-Land (Japan older)", 
@@ -17974,6 +18706,9 @@ const char* mameNameToRealName[] = {
 	"pacmanf", "Pac-Man (Midway, speedup hack)", 
 	"pacmania", "Pac-Mania", 
 	"pacmaniaj", "Pac-Mania (Japan)", 
+	"pacmanij", "Pac-Mania (Japan)",
+	"pacmanjp", "PuckMan (Japan set 2)",
+	"pacmanm", "Pac-Man (Midway)",
 	"pacmansp", "Puck Man (Spanish, 'Made in Greece' bootleg)", 
 	"pacmod", "Pac-Man (Midway, harder)", 
 	"pacnchmp", "Pac-Man &amp; Chomp Chomp", 
@@ -17995,6 +18730,7 @@ const char* mameNameToRealName[] = {
 	"pairsten", "Pairs (System Ten) (Japan 890826)", 
 	"pajaroes", "Pajaro del Espacio (Spanish bootleg of UniWar S)", 
 	"palamed", "Palamedes (Japan)", 
+	"palette", "palette", 
 	"pandoras", "Pandora's Palace", 
 	"pang", "Pang (World)", 
 	"pang3", "Pang! 3 (Euro 950601)", 
@@ -18012,6 +18748,7 @@ const char* mameNameToRealName[] = {
 	"panic", "Space Panic (version E)", 
 	"panic2", "Space Panic (set 2)", 
 	"panic3", "Space Panic (set 3)", 
+	"panica", "Space Panic (set 2)",
 	"panicbom", "Panic Bomber", 
 	"panicger", "Space Panic (German)", 
 	"panich", "Space Panic (harder)", 
@@ -18059,6 +18796,7 @@ const char* mameNameToRealName[] = {
 	"pb_l2", "Pin-Bot (L-2)", 
 	"pb_l3", "Pin-Bot (L-3)", 
 	"pb_l5", "Pin-Bot (L-5)", 
+	"pbactio2", "Pinball Action (set 2)",
 	"pbaction", "Pinball Action (set 1)", 
 	"pbaction2", "Pinball Action (set 2)", 
 	"pbaction3", "Pinball Action (set 3, encrypted)", 
@@ -18090,6 +18828,9 @@ const char* mameNameToRealName[] = {
 	"pbss330", "Pit Boss Superstar III 30 (9233-00-01)", 
 	"pbst30", "Pit Boss Supertouch 30 (9234-10-01)", 
 	"pbst30b", "Pit Boss Supertouch 30 (9234-00-01)", 
+	"pc080sn", "Taito PC080SN", 
+	"pc090oj", "Taito PC090OJ", 
+	"pc16552d", "National Semiconductor PC16552D", 
 	"pc_1942", "1942 (PlayChoice-10)", 
 	"pc_bball", "Baseball (PlayChoice-10)", 
 	"pc_bfght", "Balloon Fight (PlayChoice-10)", 
@@ -18145,6 +18886,8 @@ const char* mameNameToRealName[] = {
 	"pc_wcup", "Nintendo World Cup (PlayChoice-10)", 
 	"pc_wgnmn", "Wild Gunman (PlayChoice-10)", 
 	"pc_ynoid", "Yo! Noid (PlayChoice-10)", 
+	"pccard", "PCCARD SLOT", 
+	"pci_bus_legacy", "PCI Bus Legacy", 
 	"pcktgal", "Pocket Gal (Japan)", 
 	"pcktgal2", "Pocket Gal 2 (English)", 
 	"pcktgal2j", "Pocket Gal 2 (Japanese)", 
@@ -18197,6 +18940,10 @@ const char* mameNameToRealName[] = {
 	"penta", "Penta", 
 	"pentacup", "Pentacup (rev. 1)", 
 	"pentacup2", "Pentacup (rev. 2)", 
+	"pentium", "PENTIUM", 
+	"pentium2", "Pentium II", 
+	"pentium3", "Pentium III", 
+	"pentium4", "Pentium 4", 
 	"pepp0002", "Player's Edge Plus (PP0002) Standard Draw Poker", 
 	"pepp0002a", "Player's Edge Plus (PP0002) Standard Draw Poker (International)", 
 	"pepp0008", "Player's Edge Plus (PP0008) Standard Draw Poker", 
@@ -18474,6 +19221,7 @@ const char* mameNameToRealName[] = {
 	"phnix_l1", "Phoenix (L-1)", 
 	"phoenix", "Phoenix (Amstar)", 
 	"phoenix3", "Phoenix (T.P.N.)", 
+	"phoenix_sound", "Phoenix Custom", 
 	"phoenixa", "Phoenix (Centuri, set 1)", 
 	"phoenixb", "Phoenix (Centuri, set 2)", 
 	"phoenixc", "Phoenix (Irecsa / G.G.I Corp, set 1)", 
@@ -18498,6 +19246,9 @@ const char* mameNameToRealName[] = {
 	"phrcrazec", "Phraze Craze (6221-40, U5-3 Expanded Questions)", 
 	"phrcrazev", "Phraze Craze (6221-45, U5-2 Vertical)", 
 	"phtetris", "Tetris (Photon System)", 
+	"pia6821", "6821 PIA", 
+	"pic16c55", "PIC16C55", 
+	"pic16c57", "PIC16C57", 
 	"piccolop", "Piccolo Poker 100", 
 	"pickin", "Pickin'", 
 	"pickwin", "Pick 'n Win (Version 2.9E Dual)", 
@@ -18540,6 +19291,7 @@ const char* mameNameToRealName[] = {
 	"pipedrmt", "Pipe Dream (Taiwan)", 
 	"pipedrmu", "Pipe Dream (US)", 
 	"pipeline", "Pipeline", 
+	"pipibibi", "Pipi & Bibis / Whoopee (Japan) [bootleg ?]",
 	"pipibibs", "Pipi &amp; Bibis / Whoopee!! (Z80 sound cpu, set 1)", 
 	"pipibibsa", "Pipi &amp; Bibis / Whoopee!! (Z80 sound cpu, set 2)", 
 	"pipibibsbl", "Pipi &amp; Bibis / Whoopee!! (bootleg)", 
@@ -18595,6 +19347,9 @@ const char* mameNameToRealName[] = {
 	"pisces", "Pisces", 
 	"piscesb", "Pisces (bootleg)", 
 	"pistoldm", "Pistol Daimyo no Bouken (Japan)", 
+	"pit8253", "8253 PIT", 
+	"pit8254", "8254 PIT", 
+	"pit8259", "8259 PIC", 
 	"pitboss", "The Pit Boss (2214-04)", 
 	"pitboss2", "Pit Boss II (9221-01C)", 
 	"pitbossa", "The Pit Boss (2214-03, U5-0C)", 
@@ -18609,6 +19364,8 @@ const char* mameNameToRealName[] = {
 	"pitfall2", "Pitfall II (315-5093)", 
 	"pitfall2a", "Pitfall II (315-5093, Flicky Conversion)", 
 	"pitfall2u", "Pitfall II (not encrypted)", 
+	"pitfallu", "Pitfall II (not encrypted)",
+	"pitfigh3", "Pit Fighter (version 3)",
 	"pitfight", "Pit Fighter (rev 9)", 
 	"pitfight3", "Pit Fighter (rev 3)", 
 	"pitfight4", "Pit Fighter (rev 4)", 
@@ -18673,6 +19430,7 @@ const char* mameNameToRealName[] = {
 	"pleiadbl", "Pleiads (bootleg set 1)", 
 	"pleiadce", "Pleiads (Centuri)", 
 	"pleiads", "Pleiads (Tehkan)", 
+	"pleiads_sound", "Pleiads Custom", 
 	"pleiadsb2", "Pleiads (bootleg set 2)", 
 	"plgirls", "Play Girls", 
 	"plgirls2", "Play Girls 2", 
@@ -18713,6 +19471,7 @@ const char* mameNameToRealName[] = {
 	"pokermon", "Mundial/Mondial (Italian/French)", 
 	"pokeroul", "Poker Roulette (Version 8.22)", 
 	"pokersis", "unknown Sisteme France Poker", 
+	"pokey", "POKEY", 
 	"pokio", "Pokio (Dutch, Game Card 95-750-278)", 
 	"pokonl97", "Poker Only '97 (ver. 3.3)", 
 	"pokrdice", "Poker Dice", 
@@ -18722,14 +19481,20 @@ const char* mameNameToRealName[] = {
 	"polarisbr", "Polaris (Brazil)", 
 	"polariso", "Polaris (Original version)", 
 	"polepos", "Pole Position (World)", 
+	"polepos1", "Pole Position (Atari version 1)",
 	"polepos2", "Pole Position II (Japan)", 
 	"polepos2a", "Pole Position II (Atari)", 
 	"polepos2b", "Pole Position II (bootleg)", 
 	"polepos2bi", "Gran Premio F1 (Italian bootleg of Pole Position II)", 
+	"polepos_sound", "Pole Position Custom", 
+	"poleposa", "Pole Position (Atari version 2)",
 	"poleposa1", "Pole Position (Atari version 1)", 
 	"poleposa2", "Pole Position (Atari version 2)", 
 	"poleposj", "Pole Position (Japan)", 
 	"poleposn", "Pole Position (Sonic)", 
+	"poleps2a", "Pole Position II (Atari)",
+	"poleps2b", "Pole Position II (Atari bootleg 1)",
+	"poleps2c", "Pole Position II (Atari bootleg 2)",
 	"polic_l2", "Police Force (LA-2)", 
 	"polic_l3", "Police Force (LA-3)", 
 	"polic_l4", "Police Force (LA-4)", 
@@ -18780,11 +19545,14 @@ const char* mameNameToRealName[] = {
 	"popbingo", "Pop Bingo", 
 	"popbounc", "Pop 'n Bounce / Gapporin", 
 	"popeye", "Popeye (revision D)", 
+	"popeye2", "Popeye (set 2)",
 	"popeyebl", "Popeye (bootleg)", 
 	"popeyef", "Popeye (revision F)", 
 	"popeyeman", "Popeye-Man", 
 	"popeyeu", "Popeye (revision D not protected)", 
+	"popflama", "Pop Flamer (set 2)",
 	"popflame", "Pop Flamer (protected)", 
+	"popflame_sound", "Pop Flamer Custom", 
 	"popflamea", "Pop Flamer (not protected)", 
 	"popflameb", "Pop Flamer (hack?)", 
 	"popflamen", "Pop Flamer (bootleg on Naughty Boy PCB)", 
@@ -18823,6 +19591,7 @@ const char* mameNameToRealName[] = {
 	"poundfor", "Pound for Pound (World)", 
 	"poundforj", "Pound for Pound (Japan)", 
 	"poundforu", "Pound for Pound (US)", 
+	"poundfou", "Pound for Pound (US)",
 	"pow", "P.O.W. - Prisoners of War (US version 1)", 
 	"powerbal", "Power Balls", 
 	"powerbals", "Power Balls (Super Slam conversion)", 
@@ -18832,11 +19601,19 @@ const char* mameNameToRealName[] = {
 	"powerinsa", "Power Instinct (USA, bootleg set 1)", 
 	"powerinsb", "Power Instinct (USA, bootleg set 2)", 
 	"powerinsj", "Gouketsuji Ichizoku (Japan)", 
+	"powervr2", "PowerVR 2", 
 	"powj", "Datsugoku - Prisoners of War (Japan)", 
 	"powrplay", "Power Play", 
 	"powyak96", "Jikkyou Powerful Pro Yakyuu '96 (GV017 Japan 1.03)", 
 	"powyakex", "Jikkyou Powerful Pro Yakyuu EX (GX802 VER. JAB)", 
 	"ppan", "Peter Pan (bootleg of Hook)", 
+	"ppc403ga", "PowerPC 403GA", 
+	"ppc403gcx", "PowerPC 403GCX", 
+	"ppc602", "PowerPC 602", 
+	"ppc603", "PowerPC 603", 
+	"ppc603e", "PowerPC 603e", 
+	"ppc603r", "PowerPC 603R", 
+	"ppc604", "PowerPC 604", 
 	"ppcar", "Pang Pang Car", 
 	"ppchamp", "Pasha Pasha Champ Mini Game Festival (Korea)", 
 	"ppd", "ParaParaDancing", 
@@ -18847,8 +19624,17 @@ const char* mameNameToRealName[] = {
 	"ppp1mp", "ParaParaParadise 1st Mix Plus", 
 	"ppp2nd", "ParaParaParadise 2nd Mix", 
 	"pprobe", "Planet Probe (prototype?)", 
+	"pps4", "PPS4", 
 	"ppsatan", "Poka Poka Satan (Japan)", 
 	"ppspeed", "Speed Up (Spanish bootleg of Pole Position)", 
+	"ppu2c03b", "2C03B PPU", 
+	"ppu2c04", "2C04 PPU", 
+	"ppu2c05_01", "2C05_01 PPU", 
+	"ppu2c05_02", "2C05_02 PPU", 
+	"ppu2c05_03", "2C05_03 PPU", 
+	"ppu2c05_04", "2C05_04 PPU", 
+	"pr7820", "Pioneer PR-7820", 
+	"pr8210", "Pioneer PR-8210", 
 	"pr_5xcsh", "5x Cash (Project) (PROCONN)", 
 	"pr_7hvn", "777 Heaven (Project) (PROCONN)", 
 	"pr_7hvna", "777 Heaven (Project) (10GBP Jackpot) (PROCONN)", 
@@ -18984,6 +19770,7 @@ const char* mameNameToRealName[] = {
 	"prehisle", "Prehistoric Isle in 1930 (World)", 
 	"prehislek", "Prehistoric Isle in 1930 (Korea)", 
 	"prehisleu", "Prehistoric Isle in 1930 (US)", 
+	"prehislu", "Prehistoric Isle in 1930 (US)",
 	"preisle2", "Prehistoric Isle 2", 
 	"prikura", "Princess Clara Daisakusen (J 960910 V1.000)", 
 	"primella", "Primella", 
@@ -19037,6 +19824,12 @@ const char* mameNameToRealName[] = {
 	"pstone", "Power Stone (JPN, USA, EUR, ASI, AUS)", 
 	"pstone2", "Power Stone 2 (JPN, USA, EUR, ASI, AUS)", 
 	"psurge", "Power Surge", 
+	"psxdma", "PSX DMA", 
+	"psxirq", "PSX IRQ", 
+	"psxmdec", "PSX MDEC", 
+	"psxrcnt", "PSX RCNT", 
+	"psxsio0", "PSX SIO-0", 
+	"psxsio1", "PSX SIO-1", 
 	"psychic5", "Psychic 5 (set 1)", 
 	"psychic5a", "Psychic 5 (set 2)", 
 	"psychos", "Psycho Soldier (US)", 
@@ -19051,6 +19844,7 @@ const char* mameNameToRealName[] = {
 	"ptblank2", "Point Blank 2 (GNB5/VER.A)", 
 	"ptblank2ua", "Point Blank 2 (US, GNB3/VER.A)", 
 	"ptblank3", "Point Blank 3 (Asia, GNN2 Ver.A)", 
+	"ptm6840", "6840 PTM", 
 	"ptrmj", "PT Reach Mahjong (Japan)", 
 	"pturn", "Parallel Turn", 
 	"puchicar", "Puchi Carat (Ver 2.02O 1997/10/29)", 
@@ -19066,6 +19860,7 @@ const char* mameNameToRealName[] = {
 	"puckpkmnb", "Puckman Pockimon (set 3)", 
 	"pulirula", "PuLiRuLa (World)", 
 	"pulirulaj", "PuLiRuLa (Japan)", 
+	"pulirulj", "PuLiRuLa (Japan)",
 	"pulltabs", "Pull Tabs", 
 	"pulsar", "Pulsar", 
 	"pulstar", "Pulstar", 
@@ -19081,10 +19876,13 @@ const char* mameNameToRealName[] = {
 	"punisherh", "The Punisher (Hispanic 930422)", 
 	"punisherj", "The Punisher (Japan 930422)", 
 	"punisheru", "The Punisher (USA 930422)", 
+	"punishrj", "Punisher, The (Japan)",
+	"punishru", "Punisher, The (US)",
 	"punk", "Punk!", 
 	"punkshot", "Punk Shot (US 4 Players)", 
 	"punkshot2", "Punk Shot (US 2 Players)", 
 	"punkshotj", "Punk Shot (Japan 2 Players)", 
+	"punksht2", "Punk Shot (2 Players)",
 	"pururun", "Pururun", 
 	"pushman", "Pushman (Korea, set 1)", 
 	"pushmana", "Pushman (Korea, set 2)", 
@@ -19100,6 +19898,7 @@ const char* mameNameToRealName[] = {
 	"puyoja", "Puyo Puyo (Japan, Rev A)", 
 	"puyopuy2", "Puyo Puyo 2 (Japan)", 
 	"puyosun", "Puyo Puyo Sun (J 961115 V0.001)", 
+	"puzbobb", "Puzzle Bobble (Japan, B-System)",
 	"puzlbang", "Puzzle Bang Bang (Korea, version 2.9 / 990108)", 
 	"puzlbanga", "Puzzle Bang Bang (Korea, version 2.8 / 990106)", 
 	"puzlclub", "Puzzle Club (Japan prototype)", 
@@ -19109,6 +19908,7 @@ const char* mameNameToRealName[] = {
 	"puzzledp", "Puzzle De Pon!", 
 	"puzzlekg", "Puzzle King (Dance &amp; Puzzle)", 
 	"puzzlet", "Puzzlet (Japan)", 
+	"puzzlet_io", "Puzzlet Coin/Start I/O", 
 	"puzzli", "Puzzli", 
 	"puzzli2", "Puzzli 2 (ver. 100)", 
 	"puzzli2s", "Puzzli 2 Super (ver. 200)", 
@@ -19128,6 +19928,7 @@ const char* mameNameToRealName[] = {
 	"pwrinst2j", "Gouketsuji Ichizoku 2 (Japan, Ver. 94/04/08)", 
 	"pwrkick", "Power Kick (Japan)", 
 	"pwrshovl", "Power Shovel ni Norou!! - Power Shovel Simulator", 
+	"pxa255", "PXA255", 
 	"py2k2", "Photo Y2K 2", 
 	"pyenaget", "Pye-nage Taikai", 
 	"pyramid", "Pyramid (Dutch, Game Card 95-750-898)", 
@@ -19145,11 +19946,13 @@ const char* mameNameToRealName[] = {
 	"pzloop2j", "Puzz Loop 2 (Japan 010226)", 
 	"pzloop2jr1", "Puzz Loop 2 (Japan 010205)", 
 	"qad", "Quiz &amp; Dragons: Capcom Quiz Game (USA 920701)", 
+	"qadj", "Quiz & Dragons (Japan)",
 	"qadjr", "Quiz &amp; Dragons: Capcom Quiz Game (Japan Resale Ver. 940921)", 
 	"qb3", "QB-3 (prototype)", 
 	"qbert", "Q*bert (US set 1)", 
 	"qberta", "Q*bert (US set 2)", 
 	"qbertj", "Q*bert (Japan)", 
+	"qbertjp", "Q*bert (Japan)",
 	"qbertqub", "Q*bert's Qubes", 
 	"qberttst", "Q*bert (early test version)", 
 	"qbquest", "Q*Bert's Quest", 
@@ -19177,10 +19980,13 @@ const char* mameNameToRealName[] = {
 	"qosb", "A Question of Sport (set 3, 39-960-089)", 
 	"qotn", "Queen of the Nile (0200439V, NSW/ACT)", 
 	"qrouka", "Quiz Rouka Ni Tattenasai (Japan, ROM Based)", 
+	"qs1000", "QS1000", 
 	"qsangoku", "Quiz Sangokushi (Japan)", 
+	"qsound", "Q-Sound", 
 	"qsww", "Quiz Syukudai wo Wasuremashita (Japan, Floppy Based, FD1094 317-0058-08b)", 
 	"qtheater", "Quiz Theater - 3tsu no Monogatari (Ver 2.3J 1994/11/10)", 
 	"qtono1", "Quiz Tonosama no Yabou (Japan)", 
+	"qtono2", "Quiz Tonosama no Yabou 2 Zenkoku-ban (Japan)",
 	"qtono2j", "Quiz Tonosama no Yabou 2: Zenkoku-ban (Japan 950123)", 
 	"qtorimon", "Quiz Torimonochou (Japan)", 
 	"quake", "Quake Arcade Tournament (Release Beta 2)", 
@@ -19197,7 +20003,9 @@ const char* mameNameToRealName[] = {
 	"quartet2", "Quartet 2 (8751 317-0010)", 
 	"quartet2a", "Quartet 2 (unprotected)", 
 	"quarteta", "Quartet (8751 315-5194)", 
+	"quartetj", "Quartet (Japan)",
 	"quarth", "Quarth (Japan)", 
+	"quartrba", "Quarterback (set 2)",
 	"quasar", "Quasar (set 1)", 
 	"quasara", "Quasar (set 2)", 
 	"queen", "Queen?", 
@@ -19250,6 +20058,7 @@ const char* mameNameToRealName[] = {
 	"quizvadr", "Quizvaders (39-360-078)", 
 	"quizvid", "Video Quiz", 
 	"qwak", "Qwak (prototype)", 
+	"qwakprot", "Qwak (prototype)",
 	"qzchikyu", "Quiz Chikyu Bouei Gun (Japan)", 
 	"qzkklgy2", "Quiz Kokology 2", 
 	"qzkklogy", "Quiz Kokology", 
@@ -19257,6 +20066,15 @@ const char* mameNameToRealName[] = {
 	"qzshowby", "Quiz Sekai wa SHOW by shobai (Japan)", 
 	"r2dtank", "R2D Tank", 
 	"r2dx_v33", "Raiden II / DX (newer V33 PCB)", 
+	"r3041", "R3041", 
+	"r3051", "R3051", 
+	"r4600le_drc", "R4600 (little) DRC", 
+	"r4650be_drc", "IDT R4650 (big) DRC", 
+	"r4700le_drc", "R4700 (little) DRC", 
+	"r5000be_drc", "R5000 (big) DRC", 
+	"r5000le_drc", "R5000 (little) DRC", 
+	"r6545_1", "R6545-1 CRTC", 
+	"r65c02", "R65C02", 
 	"raaspec", "Spectrum I+", 
 	"rab_103", "Adventures of Rocky and Bullwinkle and Friends (1.03 Spain)", 
 	"rab_130", "Adventures of Rocky and Bullwinkle and Friends (1.30)", 
@@ -19354,6 +20172,8 @@ const char* mameNameToRealName[] = {
 	"raimaisj", "Raimais (Japan)", 
 	"raimaisjo", "Raimais (Japan, first revision)", 
 	"raimfire", "Ready...Aim...Fire!", 
+	"rainbow", "Rainbow Islands",
+	"rainbowe", "Rainbow Islands (Extra)",
 	"raizpin", "Raizin Ping Pong", 
 	"rally", "Rally", 
 	"rallybik", "Rally Bike / Dash Yarou", 
@@ -19363,14 +20183,18 @@ const char* mameNameToRealName[] = {
 	"rallyxa", "Rally X", 
 	"rallyxm", "Rally X (Midway)", 
 	"rallyxmr", "Rally X (Model Racing bootleg)", 
+	"ram", "RAM", 
 	"rambo3", "Rambo III (Europe)", 
+	"rambo3a", "Rambo III (set 2, US)",
 	"rambo3p", "Rambo III (Europe, Proto?)", 
 	"rambo3u", "Rambo III (US)", 
+	"ramdac", "ramdac", 
 	"rampage", "Rampage (Rev 3, 8/27/86)", 
 	"rampage2", "Rampage (Rev 2, 8/4/86)", 
 	"rampart", "Rampart (Trackball)", 
 	"rampart2p", "Rampart (Joystick)", 
 	"rampartj", "Rampart (Japan, Joystick)", 
+	"ramprt2p", "Rampart (2-player Joystick)",
 	"ramtek3", "unknown Ramtek Game (Maybe Hockey?) [TTL]", 
 	"rangrmsn", "Ranger Mission", 
 	"raphero", "Rapid Hero", 
@@ -19386,6 +20210,7 @@ const char* mameNameToRealName[] = {
 	"rastan", "Rastan (World Rev 1)", 
 	"rastana", "Rastan (World)", 
 	"rastanu", "Rastan (US Rev 1)", 
+	"rastanu2", "Rastan (US set 2)",
 	"rastanua", "Rastan (US)", 
 	"rastanub", "Rastan (US, Earlier code base)", 
 	"rastsag2", "Rastan Saga 2 (Japan)", 
@@ -19500,6 +20325,7 @@ const char* mameNameToRealName[] = {
 	"recordbr", "Recordbreaker (World)", 
 	"redalert", "Red Alert", 
 	"redbaron", "Red Baron (Revised Hardware)", 
+	"redbaron_custom", "Red Baron Custom", 
 	"redbarona", "Red Baron", 
 	"redclash", "Red Clash (set 1)", 
 	"redclasha", "Red Clash (set 2)", 
@@ -19513,6 +20339,7 @@ const char* mameNameToRealName[] = {
 	"redhawke", "Red Hawk (Excellent Co., Ltd)", 
 	"redhawki", "Red Hawk (Italy)", 
 	"redlin2p", "Redline Racer (2 players)", 
+	"redline_80186_sound", "Redline Racer 80186 DAC", 
 	"redrobin", "Red Robin", 
 	"redufo", "Defend the Terra Attack on the Red UFO", 
 	"redufob", "Defend the Terra Attack on the Red UFO (bootleg)", 
@@ -19530,10 +20357,12 @@ const char* mameNameToRealName[] = {
 	"relief3", "Relief Pitcher (set 3, 10 Apr 1992 / 08 Apr 1992)", 
 	"renaiclb", "Mahjong Ren-ai Club (Japan)", 
 	"renegade", "Renegade (US)", 
+	"renegade_adpcm", "Renegade Custom ADPCM", 
 	"renju", "Renju Kizoku", 
 	"repulse", "Repulse", 
 	"rescraid", "Rescue Raider (5/11/87) (non-cartridge)", 
 	"rescraida", "Rescue Raider (stand-alone)", 
+	"rescrdsa", "Rescue Raider (Stand-Alone)",
 	"rescu911", "Rescue 911 (rev.1)", 
 	"rescue", "Rescue", 
 	"rescueb", "Rescue (bootleg)", 
@@ -19550,6 +20379,8 @@ const char* mameNameToRealName[] = {
 	"resdnt_6", "Resident (100311 World)", 
 	"resdnt_8", "Resident (100311 Entertainment)", 
 	"resdnt_9", "Resident (100316 Russia)", 
+	"retofin1", "Return of the Invaders (bootleg set 1)",
+	"retofin2", "Return of the Invaders (bootleg set 2)",
 	"retofinv", "Return of the Invaders", 
 	"retofinv1", "Return of the Invaders (bootleg set 1)", 
 	"retofinv2", "Return of the Invaders (bootleg set 2)", 
@@ -19558,6 +20389,8 @@ const char* mameNameToRealName[] = {
 	"rezon", "Rezon", 
 	"rezont", "Rezon (Taito)", 
 	"rf2", "Konami RF2 - Red Fighter", 
+	"rf5c400", "RF5C400", 
+	"rf5c68", "RF5C68", 
 	"rfjet", "Raiden Fighters Jet (Germany)", 
 	"rfjet2kc", "Raiden Fighters Jet 2000 (China, SYS386I)", 
 	"rfjeta", "Raiden Fighters Jet (Korea)", 
@@ -19594,6 +20427,8 @@ const char* mameNameToRealName[] = {
 	"ringdstd", "Ring of Destruction: Slammasters II (Euro 940902 Phoenix Edition) (bootleg)", 
 	"ringfgt", "Ring Fighter (set 1)", 
 	"ringfgt2", "Ring Fighter (set 2)", 
+	"ringkin2", "Ring King (set 2)",
+	"ringkin3", "Ring King (set 3)",
 	"ringking", "Ring King (US set 1)", 
 	"ringking2", "Ring King (US set 2)", 
 	"ringking3", "Ring King (US set 3)", 
@@ -19605,6 +20440,7 @@ const char* mameNameToRealName[] = {
 	"ringrageu", "Ring Rage (Ver 2.3A 1992/08/09)", 
 	"rio", "Rio", 
 	"riot", "Riot", 
+	"riot6532", "6532 RIOT", 
 	"riotcity", "Riot City (Japan)", 
 	"rip300", "Ripley's Believe It or Not! (3.00)", 
 	"rip301", "Ripley's Believe It or Not! (3.01)", 
@@ -19640,6 +20476,7 @@ const char* mameNameToRealName[] = {
 	"rivierab", "Riviera Hi-Score (2131-08, U5-2D)", 
 	"rjammer", "Roller Jammer", 
 	"rltennis", "Reality Tennis", 
+	"rm7000le_drc", "RM7000 (little) DRC", 
 	"rmancp2j", "Rockman: The Power Battle (CPS2, Japan 950922)", 
 	"rmgoldyh", "Real Mahjong Gold Yumehai / Super Real Mahjong GOLD part.2 [BET] (Japan)", 
 	"rmhaihai", "Real Mahjong Haihai (Japan)", 
@@ -19698,6 +20535,7 @@ const char* mameNameToRealName[] = {
 	"robocopu", "Robocop (US revision 1)", 
 	"robocopu0", "Robocop (US revision 0)", 
 	"robocopw", "Robocop (World revision 3)", 
+	"robocpu0", "Robocop (US revision 0)",
 	"robokid", "Atomic Robo-kid", 
 	"robokidj", "Atomic Robo-kid (Japan, set 1)", 
 	"robokidj2", "Atomic Robo-kid (Japan, set 2)", 
@@ -19708,9 +20546,11 @@ const char* mameNameToRealName[] = {
 	"roboti", "Robot (Zaccaria, Italian speech)", 
 	"robotron", "Robotron: 2084 (Solid Blue label)", 
 	"robotronyo", "Robotron: 2084 (Yellow/Orange label)", 
+	"robotryo", "Robotron (Yellow/Orange label)",
 	"robowars", "Robo-War", 
 	"robowres", "Robo Wres 2001", 
 	"robowresb", "Robo Wres 2001 (bootleg)", 
+	"roc10937", "Rockwell 10937 VFD controller and compatible", 
 	"rock", "Rock", 
 	"rock2500", "Rock 2500", 
 	"rock_enc", "Rock Encore", 
@@ -19727,11 +20567,13 @@ const char* mameNameToRealName[] = {
 	"rockrage", "Rock'n Rage (World)", 
 	"rockragea", "Rock'n Rage (prototype?)", 
 	"rockragej", "Koi no Hotrock (Japan)", 
+	"rockragj", "Koi no Hotrock (Japan)",
 	"rocktris", "Rock Tris", 
 	"rocktrv2", "MTV Rock-N-Roll Trivia (Part 2)", 
 	"rocky", "Rocky", 
 	"rocnrope", "Roc'n Rope", 
 	"rocnropek", "Roc'n Rope (Kosuka)", 
+	"rocnropk", "Roc'n Rope (Kosuka)",
 	"rodland", "Rod-Land (World)", 
 	"rodlandj", "Rod-Land (Japan)", 
 	"rodlandjb", "Rod-Land (Japan bootleg)", 
@@ -19803,6 +20645,7 @@ const char* mameNameToRealName[] = {
 	"roypok96", "Royal Poker '96 (set 1)", 
 	"roypok96a", "Royal Poker '96 (set 2)", 
 	"roypok96b", "Royal Poker '96 (set 3)", 
+	"rp5h01", "RP5H01", 
 	"rpatrol", "River Patrol (Orca)", 
 	"rpatrolb", "River Patrol (bootleg)", 
 	"rpunch", "Rabbit Punch (US)", 
@@ -19821,11 +20664,16 @@ const char* mameNameToRealName[] = {
 	"rs_lx5", "Red and Ted's Road Show (Lx-5)", 
 	"rsgun", "Radiant Silvergun (JUET 980523 V1.000)", 
 	"rshark", "R-Shark", 
+	"rsp_drc", "RSP DRC", 
+	"rtc4543", "Epson R4543", 
+	"rtc65271", "RTC65271", 
+	"rtc9701", "rtc9701", 
 	"rthun2", "Rolling Thunder 2", 
 	"rthun2j", "Rolling Thunder 2 (Japan)", 
 	"rthunder", "Rolling Thunder (rev 3)", 
 	"rthunder1", "Rolling Thunder (rev 1)", 
 	"rthunder2", "Rolling Thunder (rev 2)", 
+	"rthundro", "Rolling Thunder (old version)",
 	"rtriv", "Romar Triv", 
 	"rtype", "R-Type (World)", 
 	"rtype2", "R-Type II", 
@@ -19836,6 +20684,7 @@ const char* mameNameToRealName[] = {
 	"rtypejp", "R-Type (Japan prototype)", 
 	"rtypeleo", "R-Type Leo (World)", 
 	"rtypeleoj", "R-Type Leo (Japan)", 
+	"rtypepj", "R-Type (Japan prototype)",
 	"rtypeu", "R-Type (US)", 
 	"rugby", "Rugby? (four roses hardware)", 
 	"rugrats", "Rug Rats", 
@@ -19869,6 +20718,8 @@ const char* mameNameToRealName[] = {
 	"ryukobou", "Mahjong Ryukobou (Japan, V030J)", 
 	"ryukyu", "RyuKyu (Japan, FD1094 317-5023)", 
 	"ryuuha", "Ryuuha [BET] (Japan 871027)", 
+	"s11c_bg", "Williams System 11C background music", 
+	"s14001a", "S14001A", 
 	"s1945", "Strikers 1945 (World)", 
 	"s1945a", "Strikers 1945 (Japan / World)", 
 	"s1945bl", "Strikers 1945 (Hong Kong, bootleg)", 
@@ -19878,7 +20729,14 @@ const char* mameNameToRealName[] = {
 	"s1945jn", "Strikers 1945 (Japan, unprotected)", 
 	"s1945k", "Strikers 1945 (Korea)", 
 	"s1945p", "Strikers 1945 Plus", 
+	"s2636", "Signetics 2636", 
+	"s2650", "S2650", 
+	"s3520cf", "s3520cf", 
+	"s3_vga", "S3 Graphics VGA", 
+	"s3c2410", "Samsung S3C2410", 
 	"s80tst", "System 80 Test", 
+	"saa1099", "SAA1099", 
+	"saa5050", "SAA5050", 
 	"sabotenb", "Saboten Bombers (set 1)", 
 	"sabotenba", "Saboten Bombers (set 2)", 
 	"sadari", "Sadari", 
@@ -19921,6 +20779,7 @@ const char* mameNameToRealName[] = {
 	"samesame", "Same! Same! Same! (1P set)", 
 	"samesame2", "Same! Same! Same! (2P set)", 
 	"sammymdl", "Sammy Medal Game System Bios", 
+	"samples", "Samples", 
 	"sams64", "Samurai Shodown 64 / Samurai Spirits 64", 
 	"sams64_2", "Samurai Shodown: Warrior's Rage / Samurai Spirits 2: Asura Zanmaden", 
 	"samsh5sp", "Samurai Shodown V Special / Samurai Spirits Zero Special (NGM-2720)", 
@@ -19954,6 +20813,7 @@ const char* mameNameToRealName[] = {
 	"satansat", "Satan of Saturn (set 1)", 
 	"satansata", "Satan of Saturn (set 2)", 
 	"satansatind", "Satan of Saturn (Inder S.A., bootleg)", 
+	"saturn", "Saturn",
 	"saturn2", "Saturn 2", 
 	"saturnzi", "Saturn", 
 	"sauro", "Sauro", 
@@ -25438,6 +26298,7 @@ const char* mameNameToRealName[] = {
 	"sc_18s2", "Safe Cracker (1.8 alternate sound)", 
 	"scandal", "Scandal Mahjong (Japan 890213)", 
 	"scandalm", "Scandal Mahjong [BET] (Japan 890217)", 
+	"scc68070", "SCC68070", 
 	"scessjoe", "Success Joe (World)", 
 	"scfinals", "Super Cup Finals (Ver 2.2O 1994/01/13)", 
 	"scfinalso", "Super Cup Finals (Ver 2.1O 1993/11/19)", 
@@ -25448,6 +26309,7 @@ const char* mameNameToRealName[] = {
 	"schaserb", "Space Chaser (set 3)", 
 	"schaserc", "Space Chaser (set 4)", 
 	"schasercv", "Space Chaser (CV version - set 1)", 
+	"schasrcv", "Space Chaser (CV version)",
 	"scherrym", "Super Cherry Master", 
 	"schery97", "Skill Cherry '97 (ver. sc3.52)", 
 	"schery97a", "Skill Cherry '97 (ver. sc3.52c4)", 
@@ -25459,6 +26321,7 @@ const char* mameNameToRealName[] = {
 	"scion", "Scion", 
 	"scionc", "Scion (Cinematronics)", 
 	"sciu", "Special Criminal Investigation (US)", 
+	"scn2674_device", "scn2674_device", 
 	"scobra", "Super Cobra", 
 	"scobrab", "Super Cobra (bootleg)", 
 	"scobras", "Super Cobra (Stern Electronics)", 
@@ -25482,9 +26345,11 @@ const char* mameNameToRealName[] = {
 	"scrambler", "Scramble (Reben S.A. Spanish bootleg)", 
 	"scrambles", "Scramble (Stern Electronics set 1)", 
 	"scrambles2", "Scramble (Stern Electronics set 2)", 
+	"scrambls", "Scramble (Stern)",
 	"scrambp", "Impacto (Billport S.A., Spanish bootleg of Scramble)", 
 	"scrampt", "Scramble (Petaco S.A., Spanish bootleg)", 
 	"scramrf", "Scramble (Recreativos Franco, Spanish bootleg)", 
+	"screen", "Video Screen", 
 	"screenp1", "Screen Play (Maygay, MV1 Video, ver. 1.9, set 1)", 
 	"screenp1a", "Screen Play (Maygay, MV1 Video, ver. 1.9, set 2)", 
 	"screenp2", "Screen Play (Maygay, MV1 Video, ver. 1.9, Isle of Man, set 1)", 
@@ -25499,12 +26364,19 @@ const char* mameNameToRealName[] = {
 	"scrossu", "Stadium Cross (US)", 
 	"scrpn_l1", "Scorpion (L-1)", 
 	"scrpn_t1", "Scorpion (T-1)", 
+	"scsi_harddisk", "SCSI HARDDISK", 
+	"scsibus", "SCSI bus", 
+	"scsicd", "SCSICD", 
+	"scsihd", "SCSIHD", 
+	"scsp", "SCSP", 
+	"sctionza", "Section Z (set 2)",
 	"scud", "Scud Race Twin (Australia)", 
 	"scuda", "Scud Race Twin (Export)", 
 	"scudhamm", "Scud Hammer", 
 	"scudj", "Scud Race Deluxe (Japan)", 
 	"scudplus", "Scud Race Plus (Revision A)", 
 	"scudplusa", "Scud Race Plus", 
+	"scudsp", "SCUDSP", 
 	"sddz", "Super Dou Di Zhu", 
 	"sderby", "Super Derby (v.07.03)", 
 	"sderbya", "Super Derby (v.10.04)", 
@@ -25513,11 +26385,13 @@ const char* mameNameToRealName[] = {
 	"sdi", "SDI - Strategic Defense Initiative (Japan, old, System 16A, FD1089B 317-0027)", 
 	"sdib", "SDI - Strategic Defense Initiative (System 16B, FD1089A 317-0028)", 
 	"sdibl", "SDI - Strategic Defense Initiative (bootleg)", 
+	"sdioj", "SDI - Strategic Defense Initiative (Japan)",
 	"sdmg2", "Mahjong Super Da Man Guan II (China, V754C)", 
 	"sdodgeb", "Super Dodge Ball / Kunio no Nekketsu Toukyuu Densetsu", 
 	"sdtennis", "Super Doubles Tennis", 
 	"sdungeon", "Space Dungeon", 
 	"sdwx", "Sheng Dan Wu Xian", 
+	"se3208", "SE3208", 
 	"seabass", "Sea Bass Fishing (JUET 971110 V0.001)", 
 	"seabattl", "Sea Battle (set 1)", 
 	"seabattla", "Sea Battle (set 2)", 
@@ -25542,10 +26416,42 @@ const char* mameNameToRealName[] = {
 	"sectionz", "Section Z (set 1)", 
 	"sectionza", "Section Z (set 2)", 
 	"sectrzon", "Sector Zone", 
+	"sega005_sound", "005 Custom", 
+	"sega315_5124", "Sega 315-5124", 
+	"sega315_5246", "Sega 315-5246", 
+	"sega315_5313", "Sega 315-5313 (Genesis VDP)", 
+	"sega_16bit_sprite", "Sega System 16B Sprites", 
+	"sega_315_5195", "Sega 315-5195 Memory Mapper", 
+	"sega_315_5248", "Sega 315-5248 Multiplier", 
+	"sega_315_5249", "Sega 315-5249 Divider", 
+	"sega_315_5250", "Sega 315-5250 Compare/Timer", 
+	"sega_837_13551", "SEGA-837-13551", 
+	"sega_hangon_sprite", "Sega Hang On Sprites", 
+	"sega_outrun_sprite", "Sega Out Run Sprites", 
+	"sega_sharrier_sprite", "Sega Space Harrier Sprites", 
+	"sega_speech_sound", "Sega Speech Sound Board", 
+	"sega_sys16a_sprite", "Sega System 16A Sprites", 
+	"sega_xboard_sprite", "Sega X-Board Sprites", 
+	"sega_yboard_sprite", "Sega Y-Board Sprites", 
+	"segaic16_road", "Sega 16-bit Road Generator", 
+	"segaic16_video", "Sega 16-bit Video", 
 	"segajw", "Golden Poker Series &quot;Joker's Wild&quot; (Rev. B)", 
+	"segam1audio", "Sega Model 1 Sound Board", 
 	"seganinj", "Sega Ninja (315-5102)", 
 	"seganinju", "Sega Ninja (not encrypted)", 
+	"seganinu", "Sega Ninja (not encrypted)",
+	"segapcm", "Sega PCM", 
+	"segapsg", "SEGA VDP PSG", 
+	"segas24_mixer", "S24MIXER", 
+	"segas24_sprite", "S24SPRITE", 
+	"segas24_tile", "S24TILE", 
+	"segausb", "Sega Universal Sound Board", 
+	"segausbrom", "Sega Universal Sound Board with ROM", 
 	"segawski", "Sega Water Ski (Japan, Revision A)", 
+	"seibu_adpcm", "Seibu ADPCM", 
+	"seibu_cop_legacy", "Seibu COP Legacy", 
+	"seibu_crtc", "Seibu CRT Controller", 
+	"seibu_sound", "Seibu Sound System", 
 	"seicross", "Seicross", 
 	"seiha", "Seiha (Japan 870725)", 
 	"seiham", "Seiha [BET] (Japan 870723)", 
@@ -25554,6 +26460,7 @@ const char* mameNameToRealName[] = {
 	"semibase", "MuHanSeungBu (SemiCom Baseball) (Korea)", 
 	"sengekis", "Sengeki Striker (Asia)", 
 	"sengekisj", "Sengeki Striker (Japan)", 
+	"sengokh", "Sengoku / Sengoku Denshou (set 2)",
 	"sengokmj", "Sengoku Mahjong [BET] (Japan)", 
 	"sengoku", "Sengoku / Sengoku Denshou (NGM-017)(NGH-017)", 
 	"sengoku2", "Sengoku 2 / Sengoku Denshou 2", 
@@ -25567,6 +26474,9 @@ const char* mameNameToRealName[] = {
 	"senkyu", "Senkyu (Japan set 1)", 
 	"senkyua", "Senkyu (Japan set 2)", 
 	"sentetst", "Sente Diagnostic Cartridge", 
+	"sercharu", "SAR - Search And Rescue (US)",
+	"serflash", "SERFLASH", 
+	"seta001", "seta001_device", 
 	"setaroul", "Visco Roulette", 
 	"sexappl", "Sex Appeal (Version 6.02)", 
 	"sextriv", "Sex Triv", 
@@ -25577,19 +26487,27 @@ const char* mameNameToRealName[] = {
 	"sexyparo", "Sexy Parodius (ver JAA)", 
 	"sexyparoa", "Sexy Parodius (ver AAA)", 
 	"sf", "Street Fighter (World, Analog buttons)", 
+	"sf1", "Street Fighter (World)",
+	"sf1jp", "Street Fighter (Japan)",
+	"sf1us", "Street Fighter (US)",
 	"sf2", "Street Fighter II: The World Warrior (World 910522)", 
 	"sf2049", "San Francisco Rush 2049", 
 	"sf2049se", "San Francisco Rush 2049: Special Edition", 
 	"sf2049te", "San Francisco Rush 2049: Tournament Edition", 
+	"sf2a", "Street Fighter II - The World Warrior (US 910206)",
 	"sf2acc", "Street Fighter II': Champion Edition (Accelerator!, bootleg, set 1)", 
 	"sf2acca", "Street Fighter II': Champion Edition (Accelerator!, bootleg, set 2)", 
 	"sf2accp2", "Street Fighter II': Champion Edition (Accelerator Pt.II, bootleg)", 
 	"sf2amf", "Street Fighter II': Champion Edition (Alpha Magic-F, bootleg)", 
 	"sf2amf2", "Street Fighter II': Champion Edition (L735 Test Rom, bootleg)", 
+	"sf2b", "Street Fighter II - The World Warrior (US 910214)",
 	"sf2bhh", "Street Fighter II': Champion Edition (Hung Hsi, bootleg)", 
 	"sf2ce", "Street Fighter II': Champion Edition (World 920513)", 
+	"sf2cea", "Street Fighter II' - Champion Edition (US rev A)",
+	"sf2ceb", "Street Fighter II' - Champion Edition (US rev B)",
 	"sf2ceblp", "Street Fighter II': Champion Edition (protected bootleg on non-dash board)", 
 	"sf2ceea", "Street Fighter II': Champion Edition (World 920313)", 
+	"sf2cej", "Street Fighter II' - Champion Edition (Japan)",
 	"sf2ceja", "Street Fighter II': Champion Edition (Japan 920322)", 
 	"sf2cejb", "Street Fighter II': Champion Edition (Japan 920513)", 
 	"sf2cejc", "Street Fighter II': Champion Edition (Japan 920803)", 
@@ -25598,6 +26516,7 @@ const char* mameNameToRealName[] = {
 	"sf2ceuc", "Street Fighter II': Champion Edition (USA 920803)", 
 	"sf2dkot2", "Street Fighter II': Champion Edition (Double K.O. Turbo II, bootleg)", 
 	"sf2dongb", "Street Fighter II': Champion Edition (Dongfang Bubai protection, bootleg)", 
+	"sf2e", "Street Fighter II - The World Warrior (US 910228)",
 	"sf2eb", "Street Fighter II: The World Warrior (World 910214)", 
 	"sf2ebbl", "Street Fighter II: The World Warrior (TAB Austria, bootleg, set 1)", 
 	"sf2ed", "Street Fighter II: The World Warrior (World 910318)", 
@@ -25607,6 +26526,7 @@ const char* mameNameToRealName[] = {
 	"sf2hfu", "Street Fighter II': Hyper Fighting (USA 921209)", 
 	"sf2j", "Street Fighter II: The World Warrior (Japan 911210)", 
 	"sf2ja", "Street Fighter II: The World Warrior (Japan 910214)", 
+	"sf2jb", "Street Fighter II - The World Warrior (Japan 910214)",
 	"sf2jc", "Street Fighter II: The World Warrior (Japan 910306)", 
 	"sf2jf", "Street Fighter II: The World Warrior (Japan 910411)", 
 	"sf2jh", "Street Fighter II: The World Warrior (Japan 910522)", 
@@ -25630,7 +26550,9 @@ const char* mameNameToRealName[] = {
 	"sf2red", "Street Fighter II': Champion Edition (Red Wave, bootleg)", 
 	"sf2rk", "Street Fighter II: The World Warrior (RK, bootleg)", 
 	"sf2stt", "Street Fighter II: The World Warrior (TAB Austria, bootleg, set 2)", 
+	"sf2t", "Street Fighter II' - Hyper Fighting (US)",
 	"sf2thndr", "Street Fighter II: The World Warrior (Thunder Edition, bootleg)", 
+	"sf2tj", "Street Fighter II' Turbo - Hyper Fighting (Japan)",
 	"sf2ua", "Street Fighter II: The World Warrior (USA 910206)", 
 	"sf2ub", "Street Fighter II: The World Warrior (USA 910214)", 
 	"sf2uc", "Street Fighter II: The World Warrior (USA 910306)", 
@@ -25669,6 +26591,7 @@ const char* mameNameToRealName[] = {
 	"sfchampj", "Super Football Champ (Ver 2.4J)", 
 	"sfchampo", "Super Football Champ (Ver 2.4O)", 
 	"sfchampu", "Super Football Champ (Ver 2.4A)", 
+	"sfeverbw", "Space Fever (black and white)",
 	"sfex", "Street Fighter EX (Euro 961219)", 
 	"sfex2", "Street Fighter EX2 (USA 980526)", 
 	"sfex2a", "Street Fighter EX2 (Asia 980312)", 
@@ -25786,6 +26709,10 @@ const char* mameNameToRealName[] = {
 	"sgunner2j", "Steel Gunner 2 (Japan, Rev A)", 
 	"sgunnerj", "Steel Gunner (Japan)", 
 	"sgyxz", "Warriors of Fate ('sgyxz' bootleg)", 
+	"sh1_drc", "SH-1 DRC", 
+	"sh2_drc", "SH-2 DRC", 
+	"sh3be", "SH-3 (big)", 
+	"sh4", "SH-4 (little)", 
 	"shabdama", "LD Mahjong #4 Shabon-Dama", 
 	"shackled", "Shackled (US)", 
 	"shadfgtr", "Shadow Fighters", 
@@ -25810,6 +26737,7 @@ const char* mameNameToRealName[] = {
 	"shangon1", "Super Hang-On (mini ride-on?, FD1089B 317-0034)", 
 	"shangon2", "Super Hang-On (mini ride-on, Rev A, FD1089B 317-0034)", 
 	"shangon3", "Super Hang-On (sitdown/upright, FD1089B 317-0034)", 
+	"shangonb", "Super Hang-On (bootleg)",
 	"shangonle", "Limited Edition Hang-On", 
 	"shangonrb", "Super Hang-On (bootleg)", 
 	"shangonro", "Super Hang-On (ride-on, Japan, FD1094 317-0038)", 
@@ -25827,12 +26755,14 @@ const char* mameNameToRealName[] = {
 	"sharkpya", "Shark Party (Italy, v1.6)", 
 	"sharkpye", "Shark Party (English, Alpha license)", 
 	"sharkt", "Shark (Taito)", 
+	"sharp_lh28f400", "Sharp LH28F400 Flash", 
 	"sharrier", "Space Harrier (Rev A, 8751 315-5163A)", 
 	"sharrier1", "Space Harrier (8751 315-5163)", 
 	"shdancbl", "Shadow Dancer (bootleg)", 
 	"shdancer", "Shadow Dancer (World)", 
 	"shdancer1", "Shadow Dancer (US)", 
 	"shdancerj", "Shadow Dancer (Japan)", 
+	"shdancrj", "Shadow Dancer (Japan)",
 	"sheriff", "Sheriff", 
 	"shfin_l1", "Shuffle Inn (Shuffle) (L-1)", 
 	"shienryu", "Shienryu (JUET 961226 V1.000)", 
@@ -25850,6 +26780,9 @@ const char* mameNameToRealName[] = {
 	"shinobi3", "Shinobi (set 3, System 16B, MC-8123B 317-0054)", 
 	"shinobi4", "Shinobi (set 4, System 16B, MC-8123B 317-0054)", 
 	"shinobi5", "Shinobi (set 5, System 16B, unprotected)", 
+	"shinobia", "Shinobi (set 2)",
+	"shinobib", "Shinobi (set 3)",
+	"shinobl", "Shinobi (bootleg)",
 	"shinoblb", "Shinobi (Beta bootleg)", 
 	"shinobld", "Shinobi (Datsu bootleg)", 
 	"shinobls", "Shinobi (Star bootleg, System 16A)", 
@@ -25871,6 +26804,8 @@ const char* mameNameToRealName[] = {
 	"shootbul", "Shoot the Bull", 
 	"shootgal", "Shooting Gallery", 
 	"shootopl", "Shootout Pool", 
+	"shootoub", "Shoot Out (Korean Bootleg)",
+	"shootouj", "Shoot Out (Japan)",
 	"shootout", "Shoot Out (US)", 
 	"shootoutb", "Shoot Out (Korean Bootleg)", 
 	"shootoutj", "Shoot Out (Japan)", 
@@ -25911,8 +26846,11 @@ const char* mameNameToRealName[] = {
 	"sianniv", "Space Invaders Anniversary (V2.02J)", 
 	"sichuan2", "Sichuan II (hack, set 1)", 
 	"sichuan2a", "Sichuan II (hack, set 2)", 
+	"sichuana", "Sichuan II (hack ?) (set 2)",
 	"sicv", "Space Invaders (CV Version)", 
 	"sidampkr", "unknown Sidam Poker", 
+	"sidearjp", "Side Arms - Hyper Dyne (Japan)",
+	"sidearmr", "Side Arms - Hyper Dyne (US)",
 	"sidearms", "Side Arms - Hyper Dyne (World)", 
 	"sidearmsj", "Side Arms - Hyper Dyne (Japan)", 
 	"sidearmsr", "Side Arms - Hyper Dyne (US)", 
@@ -25923,6 +26861,8 @@ const char* mameNameToRealName[] = {
 	"sidepckt", "Side Pocket (World)", 
 	"sidepcktb", "Side Pocket (bootleg)", 
 	"sidepcktj", "Side Pocket (Japan)", 
+	"sidepctb", "Side Pocket (bootleg)",
+	"sidepctj", "Side Pocket (Japan)",
 	"sidetrac", "Side Trak", 
 	"sidewndr", "Sidewinder", 
 	"sigma2k", "Sigma Poker 2000", 
@@ -25934,6 +26874,7 @@ const char* mameNameToRealName[] = {
 	"silkroada", "The Legend of Silkroad (larger ROMs)", 
 	"silkworm", "Silk Worm (World)", 
 	"silkwormj", "Silk Worm (Japan)", 
+	"silkwrm2", "Silkworm (set 2)",
 	"silverga", "Silver Game", 
 	"silvland", "Silver Land", 
 	"silvmil", "Silver Millennium", 
@@ -25956,15 +26897,20 @@ const char* mameNameToRealName[] = {
 	"simpprty", "Simpsons Pinball Party, The (5.00)", 
 	"simpprty_204", "Simpsons Pinball Party, The (2.04)", 
 	"simpprty_400", "Simpsons Pinball Party, The (4.00)", 
+	"simps2pj", "Simpsons, The (2 Players Japan)",
+	"simpsn2p", "Simpsons, The (2 Players)",
 	"simpsons", "The Simpsons (4 Players World, set 1)", 
 	"simpsons2p", "The Simpsons (2 Players World, set 1)", 
 	"simpsons2p2", "The Simpsons (2 Players World, set 2)", 
 	"simpsons2pa", "The Simpsons (2 Players Asia)", 
 	"simpsons2pj", "The Simpsons (2 Players Japan)", 
 	"simpsons4pa", "The Simpsons (4 Players World, set 2)", 
+	"simutrek", "Simutrek Modified PR-8210", 
 	"sinbad", "Sinbad", 
 	"sinbadn", "Sinbad (Norway)", 
 	"sindbadm", "Sindbad Mystery", 
+	"sinista1", "Sinistar (prototype version)",
+	"sinista2", "Sinistar (revision 2)",
 	"sinistar", "Sinistar (revision 3)", 
 	"sinistar1", "Sinistar (prototype version)", 
 	"sinistar2", "Sinistar (revision 2)", 
@@ -25993,12 +26939,15 @@ const char* mameNameToRealName[] = {
 	"skill98", "Skill '98 (ver. s98-1.33)", 
 	"skilldrp", "Skill Drop Georgia (Ver. G1.0S)", 
 	"skimaxx", "Skimaxx", 
+	"skingam2", "Irem Skins Game, The (US set 2)",
 	"skingame", "The Irem Skins Game (US set 1)", 
 	"skingame2", "The Irem Skins Game (US set 2)", 
 	"skisuprg", "Sega Ski Super G", 
 	"skns", "Super Kaneko Nova System BIOS", 
+	"sknsspr", "sknsspr_device", 
 	"skullfng", "Skull Fang (World)", 
 	"skullfngj", "Skull Fang (Japan)", 
+	"skullxb2", "Skull & Crossbones (set 2)",
 	"skullxbo", "Skull &amp; Crossbones (rev 5)", 
 	"skullxbo1", "Skull &amp; Crossbones (rev 1)", 
 	"skullxbo2", "Skull &amp; Crossbones (rev 2)", 
@@ -26017,6 +26966,7 @@ const char* mameNameToRealName[] = {
 	"skyfox", "Sky Fox", 
 	"skykid", "Sky Kid (new version)", 
 	"skykidd", "Sky Kid (CUS60 version)", 
+	"skykiddo", "Sky Kid Deluxe (set 2)",
 	"skykiddx", "Sky Kid Deluxe (set 1)", 
 	"skykiddxo", "Sky Kid Deluxe (set 2)", 
 	"skykido", "Sky Kid (old version)", 
@@ -26042,6 +26992,8 @@ const char* mameNameToRealName[] = {
 	"slammast", "Saturday Night Slam Masters (World 930713)", 
 	"slammastu", "Saturday Night Slam Masters (USA 930713)", 
 	"slampic", "Saturday Night Slam Masters (bootleg with PIC16c57)", 
+	"slapbtjp", "Slap Fight (Japan bootleg)",
+	"slapbtuk", "Slap Fight (English bootleg)",
 	"slapfigh", "Slap Fight (Japan set 1)", 
 	"slapfigha", "Slap Fight (Japan set 2)", 
 	"slapfighb1", "Slap Fight (bootleg set 1)", 
@@ -26088,6 +27040,7 @@ const char* mameNameToRealName[] = {
 	"smbmush", "Super Mario Brothers Mushroom World", 
 	"smbomb", "Super Muscle Bomber: The International Blowout (Japan 940831)", 
 	"smbombr1", "Super Muscle Bomber: The International Blowout (Japan 940808)", 
+	"smc91c94", "SMC91C94", 
 	"smgolf", "Vs. Stroke &amp; Match Golf (Men Version, set GF4-2 F)", 
 	"smgolfb", "Vs. Stroke &amp; Match Golf (Men Version, set GF4-2 ?)", 
 	"smgolfj", "Vs. Stroke &amp; Match Golf (Men Version) (Japan, set GF3 B)", 
@@ -26106,13 +27059,21 @@ const char* mameNameToRealName[] = {
 	"smoto16", "Super Moto (Italy, v1.6)", 
 	"smoto20", "Super Rider (Italy, v2.0)", 
 	"smshilo", "HI-LO Double Up Joker Poker", 
+	"sn76477", "SN76477", 
+	"sn76489", "SN76489", 
+	"sn76489a", "SN76489A", 
+	"sn76494", "SN76494", 
+	"sn76496", "SN76496", 
 	"snake", "Snake Machine", 
 	"snakepit", "Snake Pit", 
 	"snakjack", "Snacks'n Jaxson", 
 	"snapjack", "Snap Jack", 
 	"snapper", "Snapper (Korea)", 
 	"sncwgltd", "Sonic Wings Limited (Japan)", 
+	"snes_sound", "SNES Custom DSP (SPC700)", 
 	"sngkace", "Sengoku Ace (Japan)", 
+	"snk6502_sound", "snk6502 Custom", 
+	"snkwave", "SNK Wave", 
 	"snlad", "Snake &amp; Ladders", 
 	"snookr10", "Snooker 10 (Ver 1.11)", 
 	"snowboar", "Snow Board Championship (Version 2.1)", 
@@ -26120,6 +27081,9 @@ const char* mameNameToRealName[] = {
 	"snowbro2", "Snow Bros. 2 - With New Elves / Otenki Paradise", 
 	"snowbro2b", "Snow Bros. 2 - With New Elves / Otenki Paradise (bootleg)", 
 	"snowbro3", "Snow Brothers 3 - Magical Adventure", 
+	"snowbroa", "Snow Bros. - Nick & Tom (set 2)",
+	"snowbrob", "Snow Bros. - Nick & Tom (set 3)",
+	"snowbroj", "Snow Bros. - Nick & Tom (Japan)",
 	"snowbros", "Snow Bros. - Nick &amp; Tom (set 1)", 
 	"snowbrosa", "Snow Bros. - Nick &amp; Tom (set 2)", 
 	"snowbrosb", "Snow Bros. - Nick &amp; Tom (set 3)", 
@@ -26140,6 +27104,7 @@ const char* mameNameToRealName[] = {
 	"socrking", "Soccer Kings", 
 	"socrkingg", "Soccer Kings (German speech)", 
 	"socrkingi", "Soccer Kings (Italian speech)", 
+	"software_list", "Software list", 
 	"sogeki", "Sogeki (ver JAA)", 
 	"sokonuke", "Sokonuke Taisen Game (Japan)", 
 	"sokyugrt", "Soukyugurentai / Terra Diver (JUET 960821 V1.000)", 
@@ -26217,6 +27182,8 @@ const char* mameNameToRealName[] = {
 	"souledgeuc", "Soul Edge Ver. II (US, SO3/VER.C)", 
 	"soulsurf", "Soul Surfer (Rev A)", 
 	"soutenry", "Soutenryu (V2.07J)", 
+	"sp0250", "SP0250", 
+	"sp0256", "SP0256", 
 	"sp_atw", "Around The World In Eighty Days (Crystal) (sp.ACE?)", 
 	"sp_beau", "Beau Peep (Ace) (sp.ACE) (set 1)", 
 	"sp_beau2", "Further Adventures Of Beau Peep (Ace) (sp.ACE) (set 1)", 
@@ -26773,6 +27740,7 @@ const char* mameNameToRealName[] = {
 	"spacewin", "Scacco Matto / Space Win", 
 	"spacewr3", "Space War Part 3", 
 	"spacezap", "Space Zap", 
+	"spacfura", "Space Fury (revision A)",
 	"spacfury", "Space Fury (revision C)", 
 	"spacfurya", "Space Fury (revision A)", 
 	"spacfuryb", "Space Fury (revision B)", 
@@ -26791,6 +27759,7 @@ const char* mameNameToRealName[] = {
 	"spbactn", "Super Pinball Action (US)", 
 	"spbactnj", "Super Pinball Action (Japan)", 
 	"spbactnp", "Super Pinball Action (prototype)", 
+	"spc700", "SPC700", 
 	"spcdrag", "Space Dragon (Moon Cresta bootleg, set 1)", 
 	"spcdraga", "Space Dragon (Moon Cresta bootleg, set 2)", 
 	"spceking", "Space King", 
@@ -26817,6 +27786,8 @@ const char* mameNameToRealName[] = {
 	"spdball", "Speed Ball - Contest at Neonworld (prototype)", 
 	"spdcoin", "Speed Coin (prototype)", 
 	"spdodgeb", "Super Dodge Ball (US)", 
+	"speaker", "Speaker", 
+	"speaker_sound", "Filtered 1-bit DAC", 
 	"speakesy", "Speakeasy", 
 	"speakesy4p", "Speakeasy 4 Player", 
 	"speakres", "Speak &amp; Rescue", 
@@ -26870,9 +27841,11 @@ const char* mameNameToRealName[] = {
 	"spikes91", "1991 Spikes (Italian bootleg, set 1)", 
 	"spikes91b", "1991 Spikes (Italian bootleg, set 2)", 
 	"spinkick", "Hec's Spinkick", 
+	"spinlbrj", "Spinal Breakers (Japan)",
 	"spinlbrk", "Spinal Breakers (World)", 
 	"spinlbrkj", "Spinal Breakers (Japan)", 
 	"spinlbrku", "Spinal Breakers (US)", 
+	"spinlbru", "Spinal Breakers (US)",
 	"spinmast", "Spin Master / Miracle Adventure", 
 	"spinner", "Spinner", 
 	"spirit", "Spirit", 
@@ -26890,6 +27863,7 @@ const char* mameNameToRealName[] = {
 	"splitsec", "Split Second", 
 	"splmastr", "Spell Master (Russia) (Atronic)", 
 	"splndrbt", "Splendor Blast", 
+	"spnchotj", "Super Punch-Out!! (Japan)",
 	"spnchout", "Super Punch-Out!!", 
 	"spnchoutj", "Super Punch-Out!! (Japan)", 
 	"spooky", "Spooky Night 2nd Edition (Version 2.0.4)", 
@@ -26928,9 +27902,12 @@ const char* mameNameToRealName[] = {
 	"sprtshot", "Sports Shooting USA", 
 	"spss4240", "S-Plus (SS4240) Coral Reef", 
 	"spstn_l5", "Space Station (L-5)", 
+	"sptrekct", "Space Trek (cocktail)",
+	"spu", "SPU", 
 	"spuzbobl", "Super Puzzle Bobble (V2.05O)", 
 	"spuzboblj", "Super Puzzle Bobble (V2.04J)", 
 	"spy", "S.P.Y. - Special Project Y (World ver. N)", 
+	"spyhnt2a", "Spy Hunter 2 (rev 1)",
 	"spyhunt", "Spy Hunter", 
 	"spyhunt2", "Spy Hunter II (rev 2)", 
 	"spyhunt2a", "Spy Hunter II (rev 1)", 
@@ -26942,6 +27919,7 @@ const char* mameNameToRealName[] = {
 	"sqix", "Super Qix (World, Rev 2)", 
 	"sqixb1", "Super Qix (bootleg set 1)", 
 	"sqixb2", "Super Qix (bootleg set 2)", 
+	"sqixbl", "Super Qix (bootleg)",
 	"sqixr1", "Super Qix (World, Rev 1)", 
 	"sqixu", "Super Qix (US)", 
 	"squaitsa", "Squash (Itisa)", 
@@ -26973,6 +27951,7 @@ const char* mameNameToRealName[] = {
 	"srumbler", "The Speed Rumbler (set 1)", 
 	"srumbler2", "The Speed Rumbler (set 2)", 
 	"srumbler3", "The Speed Rumbler (set 3)", 
+	"srumblr2", "Speed Rumbler, The (set 2)",
 	"sryudens", "Mahjong Seiryu Densetsu (Japan, NM502)", 
 	"ss2005", "Super Shanghai 2005 (GDL-0031)", 
 	"ss2005a", "Super Shanghai 2005 (Rev A) (GDL-0031A)", 
@@ -27043,6 +28022,8 @@ const char* mameNameToRealName[] = {
 	"ssozumo", "Syusse Oozumou (Japan)", 
 	"sspac2k1", "Super Space 2001", 
 	"sspacaho", "Space Attack / Head On", 
+	"sspacat2", "Space Attack (upright, older)",
+	"sspacatc", "Space Attack (cocktail)",
 	"sspaceat", "Space Attack (upright set 1)", 
 	"sspaceat2", "Space Attack (upright set 2)", 
 	"sspaceat3", "Space Attack (upright set 3)", 
@@ -27058,6 +28039,13 @@ const char* mameNameToRealName[] = {
 	"ssprintg", "Super Sprint (German, rev 2)", 
 	"ssprintg1", "Super Sprint (German, rev 1)", 
 	"ssprints", "Super Sprint (Spanish)", 
+	"ssrdrabd", "Sunset Riders (Asia 2 Players ver. ABD)",
+	"ssrdrebc", "Sunset Riders (World 2 Players ver. EBC)",
+	"ssrdrebd", "Sunset Riders (World 2 Players ver. EBD)",
+	"ssrdrjbd", "Sunset Riders (Japan 2 Players ver. JBD)",
+	"ssrdruac", "Sunset Riders (US 4 Players ver. UAC)",
+	"ssrdrubc", "Sunset Riders (US 2 Players ver. UBC)",
+	"ssrdruda", "Sunset Riders (US 4 Players ver. UDA)",
 	"ssriders", "Sunset Riders (4 Players ver EAC)", 
 	"ssriders2", "Sunset Riders 2 (bootleg 4 Players ver ADD)", 
 	"ssridersabd", "Sunset Riders (2 Players ver ABD)", 
@@ -27088,6 +28076,8 @@ const char* mameNameToRealName[] = {
 	"sstrkfgt", "Sega Strike Fighter (Rev A)", 
 	"ssvc_a26", "Secret Service (2.6)", 
 	"ssvc_b26", "Secret Service (2.6 alternate sound)", 
+	"st0016", "ST0016", 
+	"st0020", "st0020_device", 
 	"st_game", "unknown pinball game", 
 	"st_ohla", "Oh La La (Stella)", 
 	"st_vulkn", "Vulkan (Stella)", 
@@ -27116,6 +28106,7 @@ const char* mameNameToRealName[] = {
 	"starforca", "Star Force (encrypted, set 2)", 
 	"starforcb", "Star Force (encrypted, bootleg)", 
 	"starforce", "Star Force (encrypted, set 1)", 
+	"starfore", "Star Force (encrypted)",
 	"stargate", "Stargate", 
 	"stargatp", "Stargate (Pinball)", 
 	"stargatp1", "Stargate (rev.1)", 
@@ -27136,6 +28127,7 @@ const char* mameNameToRealName[] = {
 	"starhrsp", "Star Horse Progress (Rev A)", 
 	"starjack", "Star Jacker (Sega)", 
 	"starjacks", "Star Jacker (Stern Electronics)", 
+	"starjacs", "Star Jacker (Stern)",
 	"starlstr", "Vs. Star Luster", 
 	"starrace", "Star Race", 
 	"starrkr", "Star Raker", 
@@ -27155,6 +28147,7 @@ const char* mameNameToRealName[] = {
 	"startrp", "Starship Troopers", 
 	"starw", "Star Wars (bootleg of Galaxy Wars, set 1)", 
 	"starw1", "Star Wars (bootleg of Galaxy Wars, set 2)", 
+	"starwar1", "Star Wars (rev 1)",
 	"starwarr", "Star Warrior", 
 	"starwars", "Star Wars (rev 2)", 
 	"starwars1", "Star Wars (rev 1)", 
@@ -27215,6 +28208,7 @@ const char* mameNameToRealName[] = {
 	"stratof", "Raiga - Strato Fighter (US)", 
 	"stratvox", "Stratovox", 
 	"stratvoxb", "Stratovox (bootleg)", 
+	"stratvxb", "Stratovox (bootleg)",
 	"strax_p7", "Star Trax (domestic prototype)", 
 	"streakng", "Streaking (set 1)", 
 	"streaknga", "Streaking (set 2)", 
@@ -27222,6 +28216,8 @@ const char* mameNameToRealName[] = {
 	"streetg2", "Street Games II (Revision 7C)", 
 	"streetg2r5", "Street Games II (Revision 5)", 
 	"streetgr3", "Street Games (Revision 3)", 
+	"streets1", "Street Smart (US version 1)",
+	"streetsj", "Street Smart (Japan version 1)",
 	"streetsm", "Street Smart (US version 2)", 
 	"streetsm1", "Street Smart (US version 1)", 
 	"streetsmj", "Street Smart (Japan version 1)", 
@@ -27235,6 +28231,7 @@ const char* mameNameToRealName[] = {
 	"striderj", "Strider Hiryu (Japan)", 
 	"striderjr", "Strider Hiryu (Japan Resale Ver.)", 
 	"striderua", "Strider (USA, B-Board 89624B-3)", 
+	"stridrja", "Strider Hiryu (Japan set 2)",
 	"strik_l4", "Strike Master (L-4)", 
 	"strike", "Strike", 
 	"striker", "Striker", 
@@ -27302,6 +28299,7 @@ const char* mameNameToRealName[] = {
 	"supbtime", "Super Burger Time (World, set 1)", 
 	"supbtimea", "Super Burger Time (World, set 2)", 
 	"supbtimej", "Super Burger Time (Japan)", 
+	"supbtimj", "Super Burger Time (Japan)",
 	"supcrash", "Super Crash (bootleg of Head On)", 
 	"supdrapo", "Super Draw Poker (set 1)", 
 	"supdrapoa", "Super Draw Poker (set 2)", 
@@ -27336,6 +28334,8 @@ const char* mameNameToRealName[] = {
 	"supermap", "Superman (Pinball)", 
 	"superpac", "Super Pac-Man", 
 	"superpacm", "Super Pac-Man (Midway)", 
+	"superpcm", "Super Pac-Man (Midway)",
+	"superqix", "Super Qix",
 	"superspy", "The Super Spy (NGM-011)(NGH-011)", 
 	"superten", "Super Ten V8.3", 
 	"supertnk", "Super Tank", 
@@ -27358,6 +28358,7 @@ const char* mameNameToRealName[] = {
 	"suprlocoo", "Super Locomotive", 
 	"suprmatk", "Super Missile Attack (for rev 1)", 
 	"suprmatkd", "Super Missile Attack (not encrypted)", 
+	"suprmou2", "Funny Mouse (bootleg?)",
 	"suprmous", "Super Mouse", 
 	"suprmrio", "Vs. Super Mario Bros. (set SM4-4 E)", 
 	"suprmrioa", "Vs. Super Mario Bros. (set ?, harder)", 
@@ -27382,6 +28383,7 @@ const char* mameNameToRealName[] = {
 	"surfnsaf", "Surf'n Safari", 
 	"surfplnt", "Surf Planet (Version 4.1)", 
 	"surfplnt40", "Surf Planet (Version 4.0)", 
+	"surpratk", "Surprise Attack (Japan)",
 	"survarts", "Survival Arts (World)", 
 	"survartsj", "Survival Arts (Japan)", 
 	"survartsu", "Survival Arts (USA)", 
@@ -27465,6 +28467,7 @@ const char* mameNameToRealName[] = {
 	"szaxxon", "Super Zaxxon (315-5013)", 
 	"szone_l2", "Strike Zone (Shuffle) (L-2)", 
 	"szone_l5", "Strike Zone (Shuffle) (L-5)", 
+	"t11", "T11", 
 	"t2_l2", "Terminator 2: Judgment Day (L-2)", 
 	"t2_l3", "Terminator 2: Judgment Day (L-3)", 
 	"t2_l4", "Terminator 2: Judgment Day (L-4)", 
@@ -27496,6 +28499,9 @@ const char* mameNameToRealName[] = {
 	"tail2nos", "Tail to Nose - Great Championship", 
 	"tailg", "Tailgunner", 
 	"taitest", "Taito Test Fixture", 
+	"taito8741_4pack", "Taito 8741 MCU 4 pack", 
+	"taito_en", "Taito Ensoniq Sound System", 
+	"taito_zoom", "Taito Zoom Sound System", 
 	"taitofx1", "Taito FX1", 
 	"taitogn", "Taito GNET", 
 	"taitotz", "Type Zero BIOS", 
@@ -27519,6 +28525,7 @@ const char* mameNameToRealName[] = {
 	"tankfrce", "Tank Force (US, 2 Player)", 
 	"tankfrce4", "Tank Force (US, 4 Player)", 
 	"tankfrcej", "Tank Force (Japan)", 
+	"tankfrcj", "Tank Force (Japan)",
 	"tantr", "Puzzle &amp; Action: Tant-R (Japan)", 
 	"tantrbl", "Puzzle &amp; Action: Tant-R (Japan) (bootleg set 1)", 
 	"tantrbl2", "Puzzle &amp; Action: Tant-R (Japan) (bootleg set 2)", 
@@ -27535,6 +28542,7 @@ const char* mameNameToRealName[] = {
 	"targetha", "Target Hits (ver 1.0)", 
 	"tarzan", "Tarzan (V109C)", 
 	"tarzana", "Tarzan (V107)", 
+	"tatsujn2", "Truxton II / Tatsujin II / Tatsujin Oh (Japan)",
 	"tattack", "Time Attacker", 
 	"tattass", "Tattoo Assassins (US prototype)", 
 	"tattassa", "Tattoo Assassins (Asia prototype)", 
@@ -27551,6 +28559,20 @@ const char* mameNameToRealName[] = {
 	"tbowlj", "Tecmo Bowl (Japan)", 
 	"tbowlp", "Tecmo Bowl (World, prototype?)", 
 	"tbyahhoo", "Twin Bee Yahhoo! (ver JAA)", 
+	"tc0080vco", "Taito TC0080VCO", 
+	"tc0091lvc", "TC0091LVC", 
+	"tc0100scn", "Taito TC0100SCN", 
+	"tc0110pcr", "Taito TC0110PCR", 
+	"tc0140syt", "Taito TC0140SYT", 
+	"tc0150rod", "Taito TC0150ROD", 
+	"tc0180vcu", "Taito TC0180VCU", 
+	"tc0220ioc", "Taito TC0220IOC", 
+	"tc0280grd", "Taito TC0280GRD &amp; TC0430GRW", 
+	"tc0360pri", "Taito TC0360PRI", 
+	"tc0480scp", "Taito TC0480SCP", 
+	"tc0510nio", "Taito TC0510NIO", 
+	"tc0640fio", "Taito TC0640FIO", 
+	"tc8830f", "TC8830F", 
 	"tceptor", "Thunder Ceptor", 
 	"tceptor2", "Thunder Ceptor II", 
 	"tcl", "Taiwan Chess Legend", 
@@ -27656,6 +28678,8 @@ const char* mameNameToRealName[] = {
 	"term3i_205", "Terminator 3: Rise of the Machines (2.05 Italy)", 
 	"term3l", "Terminator 3: Rise of the Machines (4.00 Spain)", 
 	"term3l_205", "Terminator 3: Rise of the Machines (2.05 Spain)", 
+	"terracra", "Terra Cresta (YM2203)",
+	"terracrb", "Terra Cresta (YM3526 set 2)",
 	"terracre", "Terra Cresta (YM3526 set 1)", 
 	"terracrea", "Terra Cresta (YM3526 set 3)", 
 	"terracren", "Terra Cresta (YM2203)", 
@@ -27675,8 +28699,10 @@ const char* mameNameToRealName[] = {
 	"tetris1", "Tetris (set 1, Japan, System 16B, FD1094 317-0091)", 
 	"tetris2", "Tetris (set 2, Japan, System 16B, FD1094 317-0092)", 
 	"tetris3", "Tetris (set 3, Japan, System 16A, FD1094 317-0093a)", 
+	"tetrisa", "Tetris (Sega Set 2)",
 	"tetrisbl", "Tetris (bootleg)", 
 	"tetriskr", "Tetris (bootleg of Mirrorsoft PC-XT Tetris version)", 
+	"tetriskr_cga", "ISA8_CGA_TETRISKR", 
 	"tetrisp", "Tetris Plus", 
 	"tetrisp2", "Tetris Plus 2 (World)", 
 	"tetrisp2j", "Tetris Plus 2 (Japan, V2.2)", 
@@ -27728,6 +28754,7 @@ const char* mameNameToRealName[] = {
 	"thegrid", "The Grid (version 1.2)", 
 	"thegrida", "The Grid (version 1.1)", 
 	"thehand", "The Hand", 
+	"thehustj", "Hustler, The (Japan version J)",
 	"thehustl", "The Hustler (Japan, program code M)", 
 	"thehustlj", "The Hustler (Japan, program code J)", 
 	"themj", "The Mah-jong (Japan)", 
@@ -27742,6 +28769,7 @@ const char* mameNameToRealName[] = {
 	"thief", "Thief", 
 	"thndblst", "Thunder Blaster (Japan)", 
 	"thndbolt", "Thunderbolt", 
+	"thnderxj", "Thunder Cross (Japan)",
 	"thndrbld", "Thunder Blade (upright, FD1094 317-0056)", 
 	"thndrbld1", "Thunder Blade (deluxe/standing, unprotected)", 
 	"thndrx2", "Thunder Cross II (World)", 
@@ -27775,10 +28803,15 @@ const char* mameNameToRealName[] = {
 	"thundfoxu", "Thunder Fox (US)", 
 	"thunt", "Puzzle &amp; Action: Treasure Hunt (JUET 970901 V2.00E)", 
 	"thuntk", "Puzzle &amp; Action: BoMulEul Chajara (JUET 970125 V2.00K)", 
+	"tia_ntsc_video", "TIA Video (NTSC)", 
+	"tia_sound", "TIA", 
+	"tiamc1_sound", "TIA-MC1 Custom", 
 	"tickee", "Tickee Tickats", 
+	"ticket_dispenser", "Ticket Dispenser", 
 	"tictac", "Tic Tac Trivia (6221-23, U5-0C Horizontal)", 
 	"tictacv", "Tic Tac Trivia (6221-22, U5-0 Vertical)", 
 	"tigerh", "Tiger Heli (US)", 
+	"tigerh2", "Tiger Heli (set 2)",
 	"tigerhb1", "Tiger Heli (bootleg set 1)", 
 	"tigerhb2", "Tiger Heli (bootleg set 2)", 
 	"tigerhb3", "Tiger Heli (bootleg set 3)", 
@@ -27795,6 +28828,7 @@ const char* mameNameToRealName[] = {
 	"tighooko2", "Tiger Hook (Version 1.7)", 
 	"tighookv1", "Tiger Hook (Version 2.1R Dual)", 
 	"tighookv2", "Tiger Hook (Version 2.0LT Dual)", 
+	"tilemap", "Tilemap", 
 	"timber", "Timber", 
 	"time2000", "Time 2000", 
 	"timecris", "Time Crisis (Rev. TS2 Ver.B)", 
@@ -27811,14 +28845,18 @@ const char* mameNameToRealName[] = {
 	"timelimt", "Time Limit", 
 	"timeline", "Time Line", 
 	"timeplt", "Time Pilot", 
+	"timeplt_audio", "Time Pilot Audio", 
 	"timeplta", "Time Pilot (Atari)", 
 	"timepltc", "Time Pilot (Centuri)", 
+	"timer", "Timer", 
 	"timescan", "Time Scanner (set 2, System 16B)", 
 	"timescan1", "Time Scanner (set 1, System 16A, FD1089B 317-0024)", 
+	"timesol1", "Time Soldiers (US Rev 1)",
 	"timesold", "Time Soldiers (US Rev 3)", 
 	"timesold1", "Time Soldiers (US Rev 1)", 
 	"timetrv", "Time Traveler", 
 	"timetunl", "Time Tunnel", 
+	"timscanr", "Time Scanner",
 	"tinklpit", "Tinkle Pit (Japan)", 
 	"tinstar", "The Tin Star (set 1)", 
 	"tinstar2", "The Tin Star (set 2)", 
@@ -27840,6 +28878,7 @@ const char* mameNameToRealName[] = {
 	"tkmmpzdm", "Tokimeki Memorial Taisen Puzzle-dama (ver JAB)", 
 	"tknight", "Tecmo Knight", 
 	"tkoboxng", "Vs. T.K.O. Boxing", 
+	"tlc34076", "TLC34076", 
 	"tm", "Touchmaster (v3.00 Euro)", 
 	"tm2k", "Touchmaster 2000 Plus (v4.63 Standard)", 
 	"tm2ka", "Touchmaster 2000 (v4.02 Standard)", 
@@ -27884,6 +28923,7 @@ const char* mameNameToRealName[] = {
 	"tmmjprd", "Tokimeki Mahjong Paradise - Dear My Love", 
 	"tmnt", "Teenage Mutant Ninja Turtles (World 4 Players)", 
 	"tmnt2", "Teenage Mutant Ninja Turtles - Turtles in Time (4 Players ver UAA)", 
+	"tmnt22p", "Teenage Mutant Ninja Turtles - Turtles in Time (2 Players US)",
 	"tmnt22pu", "Teenage Mutant Ninja Turtles - Turtles in Time (2 Players ver UDA)", 
 	"tmnt2a", "Teenage Mutant Ninja Turtles - Turtles in Time (4 Players ver ADA)", 
 	"tmnt2pj", "Teenage Mutant Ninja Turtles (Japan 2 Players)", 
@@ -27897,29 +28937,66 @@ const char* mameNameToRealName[] = {
 	"tmoshs", "Tokimeki Memorial Oshiete Your Heart Seal Version (GE755 JAA)", 
 	"tmoshsp", "Tokimeki Memorial Oshiete Your Heart Seal Version Plus (GE756 JAB)", 
 	"tmoshspa", "Tokimeki Memorial Oshiete Your Heart Seal Version Plus (GE756 JAA)", 
+	"tmp68301", "TMP68301", 
+	"tmp90841", "TMP90841", 
+	"tmp91640", "TMP91640", 
+	"tmp95c063", "TMP95C063", 
 	"tmpdoki", "Tokimeki Mahjong Paradise - Doki Doki Hen", 
+	"tms32010", "TMS32010", 
+	"tms32015", "TMS32015", 
+	"tms32025", "TMS32025", 
+	"tms32026", "TMS32026", 
+	"tms32031", "TMS32031", 
+	"tms32032", "TMS32032", 
+	"tms32051", "TMS32051", 
+	"tms34010", "TMS34010", 
+	"tms34020", "TMS34020", 
+	"tms34061", "TMS34061 VSC", 
+	"tms3615", "TMS3615", 
+	"tms36xx", "TMS36XX", 
+	"tms5100", "TMS5100", 
+	"tms5110a", "TMS5110A", 
+	"tms5200", "TMS5200", 
+	"tms5220", "TMS5220", 
+	"tms5220c", "TMS5220C", 
+	"tms57002", "TMS57002", 
+	"tms9118", "TMS9118 VDP", 
+	"tms9128", "TMS9128 VDP", 
+	"tms9902", "TMS9902 ACC", 
+	"tms9927", "TMS9927 VTC", 
+	"tms9928a", "TMS9928A VDP", 
+	"tms9980a", "TMS9980A", 
+	"tms9995", "TMS9995", 
 	"tmspoker", "unknown TMS9980 Poker Game", 
+	"tmsprom", "TMSPROM", 
 	"tmwrp_l2", "Time Warp (L-2)", 
 	"tmwrp_t2", "Time Warp (T-2)", 
 	"tndrcade", "Thundercade / Twin Formation", 
 	"tndrcadej", "Tokusyu Butai U.A.G. (Japan)", 
+	"tndrcadj", "Tokusyu Butai UAG (Japan)",
 	"tnextspc", "The Next Space (set 1)", 
 	"tnextspc2", "The Next Space (set 2)", 
 	"tnextspcj", "The Next Space (Japan)", 
 	"tnk3", "T.N.K III (US)", 
 	"tnk3j", "T.A.N.K (Japan)", 
 	"tnzs", "The NewZealand Story (World, new version) (newer PCB)", 
+	"tnzs2", "NewZealand Story 2, The (World)",
+	"tnzsb", "NewZealand Story, The (World, bootleg)",
 	"tnzsj", "The NewZealand Story (Japan, new version) (newer PCB)", 
 	"tnzsjo", "The NewZealand Story (Japan, old version) (older PCB)", 
 	"tnzso", "The NewZealand Story (World, old version) (older PCB)", 
 	"tnzsop", "The NewZealand Story (World, prototype?) (older PCB)", 
+	"toaplan_scu", "toaplan_scu_device", 
 	"todruaga", "The Tower of Druaga (New Ver.)", 
 	"todruagao", "The Tower of Druaga (Old Ver.)", 
 	"todruagas", "The Tower of Druaga (Sidam)", 
+	"todruagb", "Tower of Druaga (set 2)",
 	"toffy", "Toffy", 
 	"togenkyo", "Tougenkyou (Japan 890418)", 
 	"toggle", "Toggle (prototype)", 
 	"toki", "Toki (World, set 1)", 
+	"toki2", "Toki (set 2)",
+	"toki3", "Toki (set 3)",
 	"tokia", "Toki (World, set 2)", 
 	"tokib", "Toki (Datsu bootleg)", 
 	"tokimbsj", "Tokimeki Bishoujo [BET] (Japan)", 
@@ -27939,6 +29016,7 @@ const char* mameNameToRealName[] = {
 	"tom_12", "Theatre Of Magic (1.2X)", 
 	"tom_13", "Theatre Of Magic (1.3X)", 
 	"tom_14h", "Theatre Of Magic (1.4H)", 
+	"tomahaw5", "Tomahawk 777 (Revision 5)",
 	"tomahawk", "Tomahawk 777 (rev 5)", 
 	"tomahawk1", "Tomahawk 777 (rev 1)", 
 	"tomcat", "TomCat (prototype)", 
@@ -27955,6 +29033,7 @@ const char* mameNameToRealName[] = {
 	"toobin2e", "Toobin' (Europe, rev 2)", 
 	"toobine", "Toobin' (Europe, rev 3)", 
 	"toobing", "Toobin' (German, rev 3)", 
+	"toobinp", "Toobin' (Prototype)",
 	"top21", "Top XXI (Version 1.2)", 
 	"topaz_l1", "Topaz (Shuffle) (L-1)", 
 	"topbladv", "Top Blade V", 
@@ -27996,6 +29075,7 @@ const char* mameNameToRealName[] = {
 	"tortufam", "Tortuga Family (Italian)", 
 	"torus", "Torus", 
 	"toryumon", "Toryumon", 
+	"toshiba_t5182", "T5182", 
 	"totan_04", "Tales Of The Arabian Nights (0.4)", 
 	"totan_12", "Tales Of The Arabian Nights (1.2)", 
 	"totan_13", "Tales Of The Arabian Nights (1.3)", 
@@ -28039,7 +29119,9 @@ const char* mameNameToRealName[] = {
 	"tpoker2", "Turbo Poker 2", 
 	"tps", "TPS", 
 	"tqst", "Treasure Quest", 
+	"trackflc", "Track & Field (Centuri)",
 	"trackfld", "Track &amp; Field", 
+	"trackfld_audio", "Track And Field Audio", 
 	"trackfldc", "Track &amp; Field (Centuri)", 
 	"trackfldnz", "Track &amp; Field (NZ bootleg?)", 
 	"trailblz", "Trail Blazer", 
@@ -28062,6 +29144,7 @@ const char* mameNameToRealName[] = {
 	"trgheart", "Trigger Heart Exelica (Rev A) (GDL-0036A)", 
 	"tricktrp", "Trick Trap (World?)", 
 	"trident", "Trident", 
+	"trident_vga", "Trident VGA", 
 	"triforce", "Triforce Bios", 
 	"trigon", "Trigon (Japan)", 
 	"triothep", "Trio The Punch - Never Forget Me... (World)", 
@@ -28096,6 +29179,7 @@ const char* mameNameToRealName[] = {
 	"trog", "Trog (rev LA5 03/29/91)", 
 	"trog3", "Trog (rev LA3 02/14/91)", 
 	"trog4", "Trog (rev LA4 03/11/91)", 
+	"trogp", "Trog (prototype, rev 4.00 07/27/90)",
 	"trogpa4", "Trog (prototype, rev 4.00 07/27/90)", 
 	"trogpa6", "Trog (prototype, rev PA6-PAC 09/09/90)", 
 	"trojan", "Trojan (US set 1)", 
@@ -28154,6 +29238,7 @@ const char* mameNameToRealName[] = {
 	"ts_lx4", "The Shadow (LX-4)", 
 	"ts_lx5", "The Shadow (LX-5)", 
 	"ts_pa1", "The Shadow (PA-1)", 
+	"tsamura2", "Samurai Nihon-ichi (set 2)",
 	"tsamurai", "Samurai Nihon-Ichi (set 1)", 
 	"tsamurai2", "Samurai Nihon-Ichi (set 2)", 
 	"tsamuraih", "Samurai Nihon-Ichi (bootleg, harder)", 
@@ -28176,9 +29261,12 @@ const char* mameNameToRealName[] = {
 	"ttchamp", "Table Tennis Champions (set 1)", 
 	"ttchampa", "Table Tennis Champions (set 2)", 
 	"ttfitter", "T.T. Fitter (Japan)", 
+	"ttl74123", "TTL 74123", 
+	"ttl74181", "TTL 74181", 
 	"ttmahjng", "T.T Mahjong", 
 	"tts_l1", "Tic-Tac-Strike (Shuffle) (L-1)", 
 	"tts_l2", "Tic-Tac-Strike (Shuffle) (L-2)", 
+	"ttsnd", "Turret Tower Sound", 
 	"ttt_10", "Ticket Tac Toe (1.0)", 
 	"tturf", "Tough Turf (set 2, Japan, 8751 317-0104)", 
 	"tturfbl", "Tough Turf (Datsu bootleg)", 
@@ -28190,6 +29278,8 @@ const char* mameNameToRealName[] = {
 	"tumbleb", "Tumble Pop (bootleg)", 
 	"tumbleb2", "Tumble Pop (bootleg with PIC)", 
 	"tumblep", "Tumble Pop (World)", 
+	"tumblep2", "Tumble Pop (bootleg set 2)",
+	"tumblepb", "Tumble Pop (bootleg set 1)",
 	"tumblepba", "Tumble Pop (Playmark bootleg)", 
 	"tumblepj", "Tumble Pop (Japan)", 
 	"tunhunt", "Tunnel Hunt", 
@@ -28207,12 +29297,14 @@ const char* mameNameToRealName[] = {
 	"turpin", "Turpin", 
 	"turpins", "Turpin (bootleg on Scramble hardware)", 
 	"turrett", "Turret Tower", 
+	"turrett_hdd", "Turrett Tower HDD", 
 	"turtles", "Turtles", 
 	"turtship", "Turtle Ship (North America)", 
 	"turtshipj", "Turtle Ship (Japan)", 
 	"turtshipk", "Turtle Ship (Korea)", 
 	"tutankhm", "Tutankham", 
 	"tutankhms", "Tutankham (Stern Electronics)", 
+	"tutankst", "Tutankham (Stern)",
 	"tutstomb", "Tut's Tomb", 
 	"tv21", "T.V. 21", 
 	"tv21_3", "T.V. 21 III", 
@@ -28244,6 +29336,7 @@ const char* mameNameToRealName[] = {
 	"twinbrata", "Twin Brats (set 2)", 
 	"twincobr", "Twin Cobra (World)", 
 	"twincobru", "Twin Cobra (US)", 
+	"twincobu", "Twin Cobra (US)",
 	"twineag2", "Twin Eagle II - The Rescue Mission", 
 	"twineagl", "Twin Eagle - Revenge Joe's Brother", 
 	"twinfalc", "Twin Falcons", 
@@ -28266,6 +29359,7 @@ const char* mameNameToRealName[] = {
 	"twst_404", "Twister (4.04)", 
 	"twst_405", "Twister (4.05)", 
 	"tx1", "TX-1 (World)", 
+	"tx1_sound", "TX-1 Custom", 
 	"tx1jb", "TX-1 (Japan rev. B)", 
 	"tx1jc", "TX-1 (Japan rev. C)", 
 	"txsector", "TX-Sector", 
@@ -28284,6 +29378,7 @@ const char* mameNameToRealName[] = {
 	"tz_p3", "Twilight Zone (P-3)", 
 	"tz_p4", "Twilight Zone (P-4)", 
 	"tz_pa1", "Twilight Zone (PA-1)", 
+	"u8106", "U8106", 
 	"uballoon", "Ultra Balloon", 
 	"uboat65", "U-boat 65", 
 	"uccops", "Undercover Cops (World)", 
@@ -28328,6 +29423,14 @@ const char* mameNameToRealName[] = {
 	"untoucha", "Untouchable (Japan)", 
 	"uopoko", "Puzzle Uo Poko (International)", 
 	"uopokoj", "Puzzle Uo Poko (Japan)", 
+	"upd4701", "NEC uPD4701 Encoder", 
+	"upd4990a", "uPD4990A", 
+	"upd4992", "uPD4992", 
+	"upd7756", "uPD7756", 
+	"upd7759", "uPD7759", 
+	"upd7807", "uPD7807", 
+	"upd7810", "uPD7810", 
+	"upd96050", "uPD96050", 
 	"upndown", "Up'n Down (315-5030)", 
 	"upndownu", "Up'n Down (not encrypted)", 
 	"upscope", "Up Scope", 
@@ -28347,6 +29450,12 @@ const char* mameNameToRealName[] = {
 	"usgames", "Games V25.4X", 
 	"usvsthem", "Us vs. Them", 
 	"utoukond", "Ultra Toukon Densetsu (Japan)", 
+	"v20", "V20", 
+	"v25", "V25", 
+	"v30", "V30", 
+	"v3021", "v3021", 
+	"v33", "V33", 
+	"v35", "V35", 
 	"v4addlad", "Adders and Ladders (v2.1) (MPU4 Video)", 
 	"v4addlad20", "Adders and Ladders (v2.0) (MPU4 Video)", 
 	"v4barqs2", "Barquest 2 (v0.3) (MPU4 Video)", 
@@ -28425,6 +29534,10 @@ const char* mameNameToRealName[] = {
 	"v4vgpok", "Vegas Poker (prototype, release 2) (MPU4 Video)", 
 	"v4wize", "Wize Move (v1.3d) (MPU4 Video)", 
 	"v4wizea", "Wize Move (v1.2) (MPU4 Video)", 
+	"v60", "V60", 
+	"v70", "V70", 
+	"v810", "V810", 
+	"v9938", "V9938", 
 	"valkyrie", "Valkyrie No Densetsu (Japan)", 
 	"valtric", "Valtric", 
 	"vamphalf", "Vamf x1/2 (Europe)", 
@@ -28437,6 +29550,7 @@ const char* mameNameToRealName[] = {
 	"vandykejal", "Vandyke (Jaleco, set 1)", 
 	"vandykejal2", "Vandyke (Jaleco, set 2)", 
 	"vangrd2", "Vanguard II", 
+	"vangrdce", "Vanguard (Centuri)",
 	"vanguard", "Vanguard (SNK)", 
 	"vanguardc", "Vanguard (Centuri)", 
 	"vanguardj", "Vanguard (Japan)", 
@@ -28444,9 +29558,11 @@ const char* mameNameToRealName[] = {
 	"vanvan", "Van-Van Car", 
 	"vanvanb", "Van-Van Car (Karateco set 2)", 
 	"vanvank", "Van-Van Car (Karateco set 1)", 
+	"vanvans", "Van Van Car (Sanritsu)",
 	"vaportra", "Vapor Trail - Hyper Offence Formation (World revision 1)", 
 	"vaportra3", "Vapor Trail - Hyper Offence Formation (World revision 3?)", 
 	"vaportrau", "Vapor Trail - Hyper Offence Formation (US)", 
+	"vaportru", "Vapor Trail - Hyper Offence Formation (US)",
 	"vaportrx", "Vapor TRX", 
 	"vaportrxp", "Vapor TRX (prototype)", 
 	"varth", "Varth: Operation Thunderstorm (World 920714)", 
@@ -28478,6 +29594,7 @@ const char* mameNameToRealName[] = {
 	"vcop3", "Virtua Cop 3 (Rev A) (GDX-0003A)", 
 	"vcopa", "Virtua Cop (Revision A)", 
 	"vector", "Vector", 
+	"vector_device", "VECTOR", 
 	"vega", "Vega", 
 	"vegas", "Vegas", 
 	"vegasfst", "Royal Vegas Joker Card (fast deal)", 
@@ -28486,15 +29603,18 @@ const char* mameNameToRealName[] = {
 	"vegasmil", "Royal Vegas Joker Card (fast deal, Mile)", 
 	"vegasslw", "Royal Vegas Joker Card (slow deal)", 
 	"vegast", "Vegas (Taito)", 
+	"vendett2", "Vendetta (Asia set 2)",
 	"vendetta", "Vendetta (World 4 Players ver. T)", 
 	"vendetta2p", "Vendetta (World 2 Players ver. W)", 
 	"vendetta2pd", "Vendetta (Asia 2 Players ver. D)", 
 	"vendetta2pu", "Vendetta (Asia 2 Players ver. U)", 
 	"vendettaj", "Crime Fighters 2 (Japan 2 Players ver. P)", 
 	"vendettar", "Vendetta (World 4 Players ver. R)", 
+	"vendettj", "Crime Fighters 2 (Japan)",
 	"venture", "Venture (version 5 set 1)", 
 	"venture2", "Venture (version 5 set 2)", 
 	"venture4", "Venture (version 4)", 
+	"venture_sound", "Exidy SFX+PSG", 
 	"venus", "Venus (bootleg of Gyruss)", 
 	"version4", "Version 4 (Version 4.3R CGA)", 
 	"version4d2", "Version 4 (Version 4.3E CGA)", 
@@ -28526,6 +29646,7 @@ const char* mameNameToRealName[] = {
 	"vformula", "Virtua Formula", 
 	"vfremix", "Virtua Fighter Remix (JUETBKAL 950428 V1.000)", 
 	"vfurlong", "Net Select Keiba Victory Furlong", 
+	"vga", "VGA", 
 	"vgoalsca", "V Goal Soccer (set 2)", 
 	"vgoalsoc", "V Goal Soccer (set 1)", 
 	"vhunt2", "Vampire Hunter 2: Darkstalkers Revenge (Japan 970929)", 
@@ -28535,6 +29656,7 @@ const char* mameNameToRealName[] = {
 	"vhuntjr1", "Vampire Hunter: Darkstalkers' Revenge (Japan 950307)", 
 	"vhuntjr1s", "Vampire Hunter: Darkstalkers' Revenge (Japan 950307 stop version)", 
 	"vhuntjr2", "Vampire Hunter: Darkstalkers' Revenge (Japan 950302)", 
+	"via6522", "6522 VIA", 
 	"victlapw", "Ace Driver: Victory Lap (Rev. ADV2)", 
 	"victnine", "Victorious Nine", 
 	"victor21", "Victor 21", 
@@ -28544,6 +29666,7 @@ const char* mameNameToRealName[] = {
 	"victor6b", "Victor 6 (v1.2)", 
 	"victorba", "Victor Banana", 
 	"victory", "Victory", 
+	"victory_sound", "Exidy SFX+PSG+Speech", 
 	"victoryp", "Victory (Pinball)", 
 	"victroad", "Victory Road", 
 	"videocba", "Video Cordoba", 
@@ -28561,9 +29684,12 @@ const char* mameNameToRealName[] = {
 	"vigilantj", "Vigilante (Japan)", 
 	"vigilantu", "Vigilante (US)", 
 	"vigilantu2", "Vigilante (US) - Rev. G", 
+	"vigilntj", "Vigilante (Japan)",
+	"vigilntu", "Vigilante (US)",
 	"viking", "Viking", 
 	"vikingt", "Viking Treasure", 
 	"vimana", "Vimana (World, set 1)", 
+	"vimana2", "Vimana (set 2)",
 	"vimanaj", "Vimana (Japan)", 
 	"vimanan", "Vimana (World, set 2)", 
 	"vindctr2", "Vindicators Part II (rev 3)", 
@@ -28610,6 +29736,7 @@ const char* mameNameToRealName[] = {
 	"vlcno_ax", "Volcano", 
 	"vliner", "V-Liner (set 1)", 
 	"vlinero", "V-Liner (set 2)", 
+	"vlm5030", "VLM5030", 
 	"vmahjong", "Virtual Mahjong (J 961214 V1.000)", 
 	"vmetal", "Varia Metal", 
 	"vmetaln", "Varia Metal (New Ways Trading Co.)", 
@@ -28627,12 +29754,20 @@ const char* mameNameToRealName[] = {
 	"von254g", "Virtual On 2: Oratorio Tangram (ver 5.4g)", 
 	"vonj", "Cyber Troopers Virtual-On (Japan, Revision B)", 
 	"vonot", "Virtual On Oratorio Tangram M.S.B.S. ver5.66 2000 Edition", 
+	"voodoo_1", "3dfx Voodoo Graphics", 
+	"voodoo_2", "3dfx Voodoo 2", 
+	"voodoo_3", "3dfx Voodoo 3", 
+	"voodoo_banshee", "3dfx Voodoo Banshee", 
 	"vortex", "Vortex", 
 	"vortexp", "Vortex (Pinball)", 
 	"voyager", "Star Trek: Voyager", 
 	"vpoker", "Videotronics Poker", 
 	"vpool", "Video Pool (bootleg on Moon Cresta hardware)", 
 	"vr", "Virtua Racing", 
+	"vr0video", "VRender0 Video", 
+	"vr4300be_drc", "VR4300 (big) DRC", 
+	"vr4310le_drc", "VR4310 (little) DRC", 
+	"vrender0", "VRender0", 
 	"vrkon_l1", "Varkon (L-1)", 
 	"vrnwrld", "Verne's World", 
 	"vroulet", "Vegas Roulette", 
@@ -28693,6 +29828,11 @@ const char* mameNameToRealName[] = {
 	"vstrik3cb", "Virtua Striker 3 (USA, EXP, KOR, AUS) (Cart, Rev B)", 
 	"vstriker", "Virtua Striker (Revision A)", 
 	"vstrikero", "Virtua Striker", 
+	"vsyard", "10 Yard Fight (Vs. version 11/05/84)",
+	"vsyard2", "10 Yard Fight (Vs. version, set 2)",
+	"vsystem_spr", "vsystem_spr_device", 
+	"vsystem_spr2", "vsystem_spr2_device", 
+	"vt83c461", "VIA VT83C461", 
 	"vtenis2c", "Virtua Tennis 2 / Power Smash 2 (JPN) (USA, EXP, KOR, AUS) (Cart, Rev A)", 
 	"vtennis", "Virtua Tennis (USA, EXP, KOR, AUS) / Power Smash (JPN)", 
 	"vtennis2", "Virtua Tennis 2 / Power Smash 2 (Rev A) (GDS-0015A)", 
@@ -28701,6 +29841,7 @@ const char* mameNameToRealName[] = {
 	"vulcana", "Vulcan Venture (Old)", 
 	"vulcanb", "Vulcan Venture (Oldest)", 
 	"vulgus", "Vulgus (set 1)", 
+	"vulgus2", "Vulgus (set 2)",
 	"vulgusa", "Vulgus (set 2)", 
 	"vulgusj", "Vulgus (Japan?)", 
 	"wackadoo", "Wack-A-Doodle-Doo (Redemption)", 
@@ -28721,14 +29862,18 @@ const char* mameNameToRealName[] = {
 	"wargods", "War Gods (HD 10/09/1996 - Dual Resolution)", 
 	"wargodsa", "War Gods (HD 08/15/1996)", 
 	"wargodsb", "War Gods (HD 12/11/1995)", 
+	"warlord", "Warlords",
 	"warlords", "Warlords", 
 	"warofbug", "War of the Bugs or Monsterous Manouvers in a Mushroom Maze", 
 	"warofbugg", "War of the Bugs or Monsterous Manouvers in a Mushroom Maze (German)", 
 	"warofbugu", "War of the Bugs or Monsterous Manouvers in a Mushroom Maze (US)", 
 	"warpsped", "Warp Speed (prototype)", 
+	"warpwar2", "Warp Warp (Rock-ola set 2)",
 	"warpwarp", "Warp &amp; Warp", 
+	"warpwarp_sound", "Warp Warp Custom", 
 	"warpwarpr", "Warp Warp (Rock-Ola set 1)", 
 	"warpwarpr2", "Warp Warp (Rock-Ola set 2)", 
+	"warpwarr", "Warp Warp (Rock-ola set 1)",
 	"warrior", "Warrior", 
 	"warriorb", "Warrior Blade - Rastan Saga Episode III (Japan)", 
 	"warzard", "Warzard (Japan 961121)", 
@@ -28745,7 +29890,9 @@ const char* mameNameToRealName[] = {
 	"wb33", "Wonder Boy III - Monster Lair (set 3, World, System 16B, FD1094 317-0089)", 
 	"wb34", "Wonder Boy III - Monster Lair (set 4, Japan, System 16B, FD1094 317-0087)", 
 	"wb35", "Wonder Boy III - Monster Lair (set 5, Japan, System 16A, FD1089A 317-0086)", 
+	"wb3a", "Wonder Boy III - Monster Lair (set 2)",
 	"wb3bbl", "Wonder Boy III - Monster Lair (bootleg)", 
+	"wb3bl", "Wonder Boy III - Monster Lair (bootleg)",
 	"wbbc97", "Beach Festival World Championship 1997", 
 	"wbdeluxe", "Wonder Boy Deluxe", 
 	"wbeachvl", "World Beach Volley (set 1)", 
@@ -28755,14 +29902,18 @@ const char* mameNameToRealName[] = {
 	"wbmlb", "Wonder Boy in Monster Land (English bootleg set 1)", 
 	"wbmlbg", "Wonder Boy in Monster Land (English bootleg set 2)", 
 	"wbmlbge", "Wonder Boy in Monster Land (English bootleg set 3)", 
+	"wbmlj", "Wonder Boy in Monster Land (Japan set 1)",
+	"wbmlj2", "Wonder Boy in Monster Land (Japan set 2)",
 	"wbmljb", "Wonder Boy in Monster Land (Japan bootleg)", 
 	"wbmljo", "Wonder Boy in Monster Land (Japan Old Ver., MC-8123, 317-0043)", 
+	"wbmlju", "Wonder Boy in Monster Land (Japan not encrypted)",
 	"wbmlvc", "Wonder Boy in Monster Land (English, Virtual Console)", 
 	"wboy", "Wonder Boy (set 1, 315-5177)", 
 	"wboy2", "Wonder Boy (set 2, 315-5178)", 
 	"wboy2u", "Wonder Boy (set 2, not encrypted)", 
 	"wboy3", "Wonder Boy (set 3, 315-5135)", 
 	"wboy4", "Wonder Boy (315-5162, 4-D Warriors Conversion)", 
+	"wboy4u", "Wonder Boy (set 4 not encrypted)",
 	"wboy5", "Wonder Boy (set 5, bootleg)", 
 	"wboyo", "Wonder Boy (set 1, 315-5135)", 
 	"wboysys2", "Wonder Boy (system 2)", 
@@ -28799,6 +29950,7 @@ const char* mameNameToRealName[] = {
 	"wcsoccerd2", "World Challenge Soccer (disp.rev.2)", 
 	"wcup90", "World Cup 90", 
 	"wcvol95", "World Cup Volley '95 (Japan v1.0)", 
+	"wd33c93", "33C93 SCSI", 
 	"wd_03r", "Who Dunnit (0.3 R)", 
 	"wd_048r", "Who Dunnit (0.48 R)", 
 	"wd_10f", "Who Dunnit (1.0 French)", 
@@ -28816,6 +29968,7 @@ const char* mameNameToRealName[] = {
 	"westgun2", "Western Gun Part II", 
 	"weststry", "West Story (bootleg of Blood Bros.)", 
 	"westvent", "Western Venture (Ver. AA.02.D)", 
+	"wexpresb", "Western Express (bootleg)",
 	"wexpress", "Western Express (Japan, rev 4)", 
 	"wexpressb1", "Western Express (bootleg set 1)", 
 	"wexpressb2", "Western Express (bootleg set 2)", 
@@ -28883,6 +30036,7 @@ const char* mameNameToRealName[] = {
 	"wipeormt", "Wipeout (Ramtek) [TTL]", 
 	"wipeout", "Wipeout (rev.2)", 
 	"wiping", "Wiping", 
+	"wiping_sound", "Wiping Custom", 
 	"wiseguy", "Wise Guy", 
 	"witch", "Witch", 
 	"witchb", "Witch (With ranking)", 
@@ -28950,8 +30104,11 @@ const char* mameNameToRealName[] = {
 	"wmg", "Williams Multigame", 
 	"wms", "WMS SetUp/Clear Chips (set 1)", 
 	"wmsa", "WMS SetUp/Clear Chips (set 2)", 
+	"wmsadpcm", "Williams ADPCM Sound Board", 
 	"wmsb", "WMS SetUp/Clear Chips (set 3)", 
 	"wmsboom", "Boom (Russia)", 
+	"wmscvsd", "Williams CVSD Sound Board", 
+	"wmsnarc", "Williams NARC Sound Board", 
 	"wmstopb", "Top Banana (Russia)", 
 	"wndrmomo", "Wonder Momo", 
 	"wndrplnt", "Wonder Planet (Japan)", 
@@ -28976,6 +30133,8 @@ const char* mameNameToRealName[] = {
 	"wow", "Wizard of Wor", 
 	"wowg", "Wizard of Wor (with German Language ROM)", 
 	"wownfant", "WOW New Fantasia", 
+	"wpc", "Williams WPC ASIC", 
+	"wpcsnd", "Williams WPC Sound", 
 	"wpksoc", "World PK Soccer", 
 	"wpksocv2", "World PK Soccer V2 (ver 1.1)", 
 	"wrally", "World Rally (set 1)", 
@@ -29000,6 +30159,7 @@ const char* mameNameToRealName[] = {
 	"wschampb", "Wing Shooting Championship V1.00", 
 	"wseries", "World Series: The Season", 
 	"wsf", "World Soccer Finals", 
+	"wsf_80186_sound", "WSF 80186 DAC", 
 	"wsjr", "Who Shot Johnny Rock? v1.6", 
 	"wsjr15", "Who Shot Johnny Rock? v1.5", 
 	"wsports", "Winter Sports", 
@@ -29038,6 +30198,7 @@ const char* mameNameToRealName[] = {
 	"ww_p8", "White Water (P-8 P-2 sound)", 
 	"wwallyj", "Wally wo Sagase! (rev B, Japan, FD1094 317-0197B)", 
 	"wwallyja", "Wally wo Sagase! (rev A, Japan, FD1094 317-0197A)", 
+	"wwester1", "Wild Western (set 2)",
 	"wwestern", "Wild Western (set 1)", 
 	"wwestern1", "Wild Western (set 2)", 
 	"wwfmania", "WWF: Wrestlemania (rev 1.30 08/10/95)", 
@@ -29059,9 +30220,13 @@ const char* mameNameToRealName[] = {
 	"wwjgtin", "Wai Wai Jockey Gate-In!", 
 	"wyvernwg", "Wyvern Wings (set 1)", 
 	"wyvernwga", "Wyvern Wings (set 2)", 
+	"x1_010", "X1-010", 
+	"x2212", "X2212 NVRAM", 
 	"x2222", "X2222 (final debug?)", 
 	"x2222o", "X2222 (5-level prototype)", 
 	"x5jokers", "X Five Jokers (Version 1.12)", 
+	"x76f041", "X76F041 Flash", 
+	"x76f100", "X76F100 Flash", 
 	"xday2", "X-Day 2 (Japan)", 
 	"xenon", "Xenon", 
 	"xenonf", "Xenon (French)", 
@@ -29141,6 +30306,8 @@ const char* mameNameToRealName[] = {
 	"xybotsg", "Xybots (German, rev 3)", 
 	"xymg", "Xing Yun Man Guan (China, V651C)", 
 	"xyonix", "Xyonix", 
+	"y2404", "Y2404", 
+	"y8950", "Y8950", 
 	"yachtmn", "Yachtsman", 
 	"yamagchi", "Go Go Mr. Yamaguchi / Yuke Yuke Yamaguchi-kun", 
 	"yamato", "Yamato (US)", 
@@ -29148,18 +30315,38 @@ const char* mameNameToRealName[] = {
 	"yamyam", "Yam! Yam!?", 
 	"yanchamr", "Kaiketsu Yanchamaru (Japan)", 
 	"yankeedo", "Yankee DO!", 
+	"yard", "10 Yard Fight",
 	"yarunara", "Mahjong Yarunara (Japan)", 
 	"yellowcbb", "Yellow Cab (bootleg)", 
 	"yellowcbj", "Yellow Cab (Japan)", 
 	"yesnoj", "Yes/No Sinri Tokimeki Chart", 
+	"ygv608", "YGV608", 
 	"yiear", "Yie Ar Kung-Fu (program code I)", 
 	"yiear2", "Yie Ar Kung-Fu (program code G)", 
 	"yieartf", "Yie Ar Kung-Fu (GX361 conversion)", 
+	"ym2149", "YM2149", 
+	"ym2151", "YM2151", 
+	"ym2203", "YM2203", 
+	"ym2413", "YM2413", 
+	"ym2608", "YM2608", 
+	"ym2610", "YM2610", 
+	"ym2610b", "YM2610B", 
+	"ym2612", "YM2612", 
+	"ym3438", "YM3438", 
+	"ym3526", "YM3526", 
+	"ym3812", "YM3812", 
+	"ymf262", "YMF262", 
+	"ymf271", "YMF271", 
+	"ymf278b", "YMF278B", 
+	"ymz280b", "YMZ280B", 
+	"ymz770", "Yamaha YMZ770", 
+	"yokaidko", "Yokai Douchuuki (Japan old version)",
 	"yosakdon", "Yosaku To Donbei (set 1)", 
 	"yosakdona", "Yosaku To Donbei (set 2)", 
 	"yosimotm", "Mahjong Yoshimoto Gekijou [BET] (Japan)", 
 	"yosimoto", "Mahjong Yoshimoto Gekijou (Japan)", 
 	"youjyudn", "Youjyuden (Japan)", 
+	"youkaidk", "Yokai Douchuuki (Japan new version)",
 	"youkaidk1", "Yokai Douchuuki (Japan, old version (YD1))", 
 	"youkaidk2", "Yokai Douchuuki (Japan, new version (YD2, Rev B))", 
 	"youma", "Youma Ninpou Chou (Japan)", 
@@ -29175,6 +30362,13 @@ const char* mameNameToRealName[] = {
 	"yumefuda", "Yumefuda [BET]", 
 	"yuyugogo", "Yuuyu no Quiz de GO!GO! (Japan)", 
 	"yuyuhaku", "The Battle of Yu Yu Hakusho: Shitou! Ankoku Bujutsukai!", 
+	"z180", "Z180", 
+	"z80", "Z80", 
+	"z8002", "Z8002", 
+	"z80ctc", "Z80 CTC", 
+	"z80dma", "Z8410 DMA", 
+	"z80pio", "Z8420 PIO", 
+	"z80sio", "Z80 SIO", 
 	"zankor", "Zankor (Italian speech)", 
 	"zaryavos", "Zarya Vostoka", 
 	"zarza", "Zarza", 
@@ -29227,7 +30421,9 @@ const char* mameNameToRealName[] = {
 	"zingzipbl", "Zing Zing Zip (bootleg)", 
 	"zintrckb", "Zintrick / Oshidashi Zentrix (hack)", 
 	"zipzap", "Zip &amp; Zap", 
+	"zndip", "ZNDIP", 
 	"znpwfv", "Zen Nippon Pro-Wrestling Featuring Virtua (J 971123 V1.000)", 
+	"znsec", "ZNSEC", 
 	"zoar", "Zoar", 
 	"zodiack", "Zodiack", 
 	"zokumahj", "Zoku Mahjong Housoukyoku (Japan)", 
@@ -29243,1210 +30439,19 @@ const char* mameNameToRealName[] = {
 	"zoom909", "Zoom 909", 
 	"zooo", "Zooo (V2.01J)", 
 	"zortonbr", "Zorton Brothers (Los Justicieros)", 
+	"zs01", "ZS01", 
+	"zsg2", "ZSG-2", 
 	"zunkyou", "Zunzunkyou No Yabou (Japan)", 
 	"zunou", "Touch De Zunou (Rev A)", 
 	"zupapa", "Zupapa!", 
 	"zwackery", "Zwackery", 
 	"zzblock", "Zun Zun Block [TTL]", 
+	"zzyzzyx2", "Zzyzzyxx (set 2)",
 	"zzyzzyxx", "Zzyzzyxx (set 1)", 
 	"zzyzzyxx2", "Zzyzzyxx (set 2)", 
-	"z80", "Z80", 
-	"gfxdecode", "gfxdecode", 
-	"palette", "palette", 
-	"screen", "Video Screen", 
-	"speaker", "Speaker", 
-	"i8255", "8255 PPI", 
-	"samples", "Samples", 
-	"sega005_sound", "005 Custom", 
-	"m6803", "M6803", 
-	"irem_audio", "Irem Audio", 
-	"ay8910", "AY-3-8910A", 
-	"msm5205", "MSM5205", 
-	"vr4300be_drc", "VR4300 (big) DRC", 
-	"rsp_drc", "RSP DRC", 
-	"dmadac", "DMA-driven DAC", 
-	"n64_periphs", "N64 Periphal Chips", 
-	"sh4", "SH-4 (little)", 
-	"timer", "Timer", 
-	"arm7", "ARM7", 
-	"maple_dc", "MAPLE_DC", 
-	"93c46_16", "Serial EEPROM 93C46 (64x16)", 
-	"powervr2", "PowerVR 2", 
-	"aica", "AICA", 
-	"aicartc", "AICA RTC", 
-	"mie", "MIE", 
-	"mie_jvs", "MIE-JVS", 
-	"sega_837_13551", "SEGA-837-13551", 
-	"93c46_8", "Serial EEPROM 93C46 (128x8)", 
-	"x76f100", "X76F100 Flash", 
-	"naomi_m2_board", "NAOMI-M2-BOARD", 
-	"m68000", "M68000", 
-	"ym2151", "YM2151", 
-	"okim6295", "OKI6295", 
-	"netlist_sound", "Netlist sound device", 
-	"netlist_analog_input", "netlist analog input", 
-	"ym2203", "YM2203", 
-	"qsound", "Q-Sound", 
-	"dsp16", "DSP16", 
-	"pxa255", "PXA255", 
-	"93c66_16", "Serial EEPROM 93C66 (256x16)", 
-	"cxd8530cq", "CXD8530CQ", 
-	"psxirq", "PSX IRQ", 
-	"psxdma", "PSX DMA", 
-	"psxmdec", "PSX MDEC", 
-	"psxrcnt", "PSX RCNT", 
-	"psxsio0", "PSX SIO-0", 
-	"znsec", "ZNSEC", 
-	"zndip", "ZNDIP", 
-	"psxsio1", "PSX SIO-1", 
-	"ram", "RAM", 
-	"cxd8561q", "CXD8561Q", 
-	"spu", "SPU", 
-	"at28c16", "AT28C16", 
-	"ym2610", "YM2610", 
-	"upd4990a", "uPD4990A", 
-	"nvram", "NVRAM", 
-	"z180", "Z180", 
-	"namco", "Namco", 
-	"dac", "DAC", 
-	"amd_29lv200t", "AMD 29LV200T Flash", 
-	"i8080", "8080", 
-	"mb14241", "MB14241", 
-	"ym2610b", "YM2610B", 
-	"mc68hc11", "MC68HC11", 
-	"m6809", "M6809", 
-	"via6522", "6522 VIA", 
-	"pia6821", "6821 PIA", 
-	"c6545_1", "C6545-1 CRTC", 
-	"mc146818", "MC146818", 
-	"arm7_be", "ARM7 (big endian)", 
-	"cdrom_image", "CD-ROM Image", 
-	"nb1413m3", "Nichibutsu NB1413M3", 
-	"kaneko_pandora", "Kaneko Pandora - PX79C480FP-3", 
-	"upd7810", "uPD7810", 
-	"ym2413", "YM2413", 
-	"vsystem_spr", "vsystem_spr_device", 
-	"i8088", "I8088", 
-	"gotsndr2", "Gottlieb Sound rev. 2", 
-	"m6502", "M6502", 
-	"ay8913", "AY-3-8913A", 
-	"sp0250", "SP0250", 
-	"m68705", "M68705", 
-	"buggychl_mcu", "BuggyChl MCU", 
-	"msm5232", "MSM5232", 
-	"v70", "V70", 
-	"ymf271", "YMF271", 
-	"sn76489a", "SN76489A", 
-	"z80pio", "Z8420 PIO", 
-	"isa8", "ISA8", 
-	"isa8_slot", "ISA8_SLOT", 
-	"4enlinea_cga", "ISA8_CGA_4ENLINEA", 
-	"mc6845", "MC6845 CRTC", 
-	"7474", "7474 TTL", 
-	"galaxian_sound", "Galaxian Custom", 
-	"discrete", "DISCRETE", 
-	"tmp68301", "TMP68301", 
-	"z80ctc", "Z80 CTC", 
-	"ym3812", "YM3812", 
-	"mc65c02", "M65C02", 
-	"r4650be_drc", "IDT R4650 (big) DRC", 
-	"h83002", "H8/3002", 
-	"h8h_intc", "H8H INTC", 
-	"h8_adc_3337", "H8 ADC 3337", 
-	"h8_digital_port", "H8 digital port", 
-	"h8_timer16", "H8 16-bits timer", 
-	"h8h_16bits_timer_channel", "H8H 16-bits timer channel", 
-	"h8_sci", "H8 Serial Communications Interface", 
-	"namco_settings", "Namco settings device", 
-	"rtc4543", "Epson R4543", 
-	"devcb2_line_dispatch", "Line dispatcher (2 slots)", 
-	"c352", "C352", 
-	"ptm6840", "6840 PTM", 
-	"t11", "T11", 
-	"2804", "Parallel EEPROM 2804 (512x8)", 
-	"tilemap", "Tilemap", 
-	"atarimo", "Atari Motion Objects", 
-	"atarscom", "Atari Sound Communications", 
-	"pokey", "POKEY", 
-	"tms5220c", "TMS5220C", 
-	"decospr", "decospr_device", 
-	"h46505", "H46505 CRTC", 
-	"konami_cpu", "KONAMI", 
-	"k052109", "Konami 052109", 
-	"k051960", "Konami 051960", 
-	"k051316", "Konami 051316", 
-	"upd7759", "uPD7759", 
-	"s2650", "S2650", 
-	"s2636", "Signetics 2636", 
-	"tms5100", "TMS5100", 
-	"i8257", "DMA8257", 
-	"latch8", "8 bit latch", 
-	"mb8884", "MB8884", 
-	"sn76496", "SN76496", 
-	"pentium", "PENTIUM", 
-	"pit8259", "8259 PIC", 
-	"am9517a", "AM9517A", 
-	"pit8254", "8254 PIT", 
-	"kbdc8042", "Keyboard Controller 8042", 
-	"at_keyb", "AT Keyboard", 
-	"pci_bus_legacy", "PCI Bus Legacy", 
-	"vga", "VGA", 
-	"tms34010", "TMS34010", 
-	"tms32026", "TMS32026", 
-	"tlc34076", "TLC34076", 
-	"r3041", "R3041", 
-	"jaguargpu", "Jaguar GPU", 
-	"jaguardsp", "Jaguar DSP", 
-	"vt83c461", "VIA VT83C461", 
-	"ata_slot", "ATA Connector", 
-	"cojag_hdd", "cojag HDD", 
-	"harddisk_image", "Harddisk", 
-	"mediagx", "MEDIAGX", 
-	"ide_controller", "IDE Controller (32 bit)", 
-	"hdd", "IDE Hard Disk", 
-	"ramdac", "ramdac", 
-	"cdrom", "ATAPI CDROM", 
-	"ppc403gcx", "PowerPC 403GCX", 
-	"ymz280b", "YMZ280B", 
-	"i80186", "I80186", 
-	"leland_80186_sound", "Leland 80186 DAC", 
-	"decocpu3", "Data East Pinball CPU Board Type 3", 
-	"m6808", "M6808", 
-	"decobsmt", "Data East/Sega/Stern BSMT2000 Sound Board", 
-	"bsmt2000", "BSMT2000", 
-	"tms32015", "TMS32015", 
-	"decodmd2", "Data East Pinball Dot Matrix Display Type 2", 
-	"m6809e", "M6809E", 
-	"m6800", "M6800", 
-	"h83048", "H8/3048", 
-	"fd1094", "FD1094", 
-	"sega_315_5248", "Sega 315-5248 Multiplier", 
-	"sega_315_5249", "Sega 315-5249 Divider", 
-	"sega_315_5250", "Sega 315-5250 Compare/Timer", 
-	"sega_xboard_sprite", "Sega X-Board Sprites", 
-	"segaic16_video", "Sega 16-bit Video", 
-	"segaic16_road", "Sega 16-bit Road Generator", 
-	"segapcm", "Sega PCM", 
-	"sega_315_5195", "Sega 315-5195 Memory Mapper", 
-	"sega_16bit_sprite", "Sega System 16B Sprites", 
-	"n7751", "N7751", 
-	"i8243", "I8243", 
-	"sega_sys16a_sprite", "Sega System 16A Sprites", 
-	"m68020", "M68020", 
-	"tms32025", "TMS32025", 
-	"m37702", "M37702", 
-	"2864", "Parallel EEPROM 2864 (8192x8)", 
-	"arm920t", "ARM920T", 
-	"serflash", "SERFLASH", 
-	"nmk004", "NMK004", 
-	"h6280", "H6280", 
-	"deco_bac06", "decbac06_device", 
-	"deco_mxc06", "decmxc06_device", 
-	"pic16c57", "PIC16C57", 
-	"tmsprom", "TMSPROM", 
-	"tms5110a", "TMS5110A", 
-	"mc68307", "MC68307", 
-	"mc68681", "MC68681", 
-	"mc68681_channel", "DUART 68681 channel", 
-	"bfm_bda", "BFM BDA VFD controller", 
-	"mc68340", "MC68340", 
-	"mcf5206e", "MCF5206E", 
-	"mcf5206e_peripheral", "MCF5206E Peripheral", 
-	"m68ec020", "M68EC020", 
-	"m37710", "M37710", 
-	"arm", "ARM", 
-	"aakart", "AAKART", 
-	"vsystem_spr2", "vsystem_spr2_device", 
-	"vector_device", "VECTOR", 
-	"dvg", "DVG", 
-	"fd1089a", "FD1089A", 
-	"sn76494", "SN76494", 
-	"wpc", "Williams WPC ASIC", 
-	"adsp2105", "ADSP-2105", 
-	"tc0220ioc", "Taito TC0220IOC", 
-	"tc0080vco", "Taito TC0080VCO", 
-	"tc0140syt", "Taito TC0140SYT", 
-	"v33", "V33", 
-	"v35", "V35", 
-	"iremga20", "Irem GA20", 
-	"hd63705", "HD63705", 
-	"c140", "C140", 
-	"v30", "V30", 
-	"m72_audio", "M72 Custom", 
-	"naomi_rom_board", "NAOMI-ROM-BOARD", 
-	"tms32010", "TMS32010", 
-	"seibu_sound", "Seibu Sound System", 
-	"k007232", "K007232", 
-	"msm6242", "msm6242", 
-	"taito_en", "Taito Ensoniq Sound System", 
-	"mb87078", "Fujitsu MB87078", 
-	"es5505", "ES5505", 
-	"buffered_spriteram", "Buffered Sprite RAM", 
-	"k007121", "Konami 007121", 
-	"k051649", "K051649", 
-	"sega315_5313", "Sega 315-5313 (Genesis VDP)", 
-	"ym2612", "YM2612", 
-	"segapsg", "SEGA VDP PSG", 
-	"hc55516", "HC-55516", 
-	"ldp1450", "Sony LDP-1450", 
-	"amiga_paula", "Amiga Paula", 
-	"legacy_mos8520", "LEGACY_MOS8520", 
-	"amiga_fdc", "Amiga FDC", 
-	"m6802", "M6802", 
-	"v60", "V60", 
-	"ym3438", "YM3438", 
-	"rf5c68", "RF5C68", 
-	"ymf278b", "YMF278B", 
-	"huc6260", "HuC6260 VCE", 
-	"huc6270", "HuC6270 VDC", 
-	"c6280", "HuC6280", 
-	"sn76477", "SN76477", 
-	"address_map_bank", "Address Map Bank", 
-	"hd63701", "HD63701", 
-	"fd1089b", "FD1089B", 
-	"gaelco_gae1", "Gaelco GAE1", 
-	"m6504", "M6504", 
-	"ym3526", "YM3526", 
-	"avg_mhavoc", "AVG_MHAVOC", 
-	"cdp1802", "CDP1802", 
-	"cdp1852", "CDP1852", 
-	"cdp1869", "RCA CDP1869", 
-	"i8751", "I8751", 
-	"ay8912", "AY-3-8912A", 
-	"i8086", "I8086", 
-	"r6545_1", "R6545-1 CRTC", 
-	"sn76489", "SN76489", 
-	"ticket_dispenser", "Ticket Dispenser", 
-	"gamtor_vga", "GAMTOR_VGA", 
-	"ttl74123", "TTL 74123", 
-	"okim9810", "OKI9810", 
-	"macronix_29l001mc", "Macronix 29L001MC Flash", 
-	"aw_rom_board", "AW-ROM-BOARD", 
-	"dcctrl", "DC_CONTROLLER", 
-	"netlist_cpu", "Netlist cpu device", 
-	"fixfreq", "FIXFREQ", 
-	"e132xn", "E1-32XN", 
-	"v20", "V20", 
-	"m65sc02", "M65SC02", 
-	"tc0100scn", "Taito TC0100SCN", 
-	"tc0150rod", "Taito TC0150ROD", 
-	"tc0110pcr", "Taito TC0110PCR", 
-	"filter_volume", "Volume Filter", 
-	"cxd8661r", "CXD8661R", 
-	"cxd8654q", "CXD8654Q", 
-	"mb8841", "MB8841", 
-	"tms9118", "TMS9118 VDP", 
-	"speaker_sound", "Filtered 1-bit DAC", 
-	"seta001", "seta001_device", 
-	"x1_010", "X1-010", 
-	"atari2804", "Atari EEPROM Interface (2804)", 
-	"tmp90841", "TMP90841", 
-	"nmk112", "NMK 112", 
-	"wmscvsd", "Williams CVSD Sound Board", 
-	"gotsndr1", "Gottlieb Sound rev. 1", 
-	"riot6532", "6532 RIOT", 
-	"ym2149", "YM2149", 
-	"tms34061", "TMS34061 VSC", 
-	"ccpu", "Cinematronics CPU", 
-	"n2a03", "N2A03", 
-	"nesapu", "N2A03 APU", 
-	"vlm5030", "VLM5030", 
-	"tc0180vcu", "Taito TC0180VCU", 
-	"naomi_m4_board", "NAOMI-M4-BOARD", 
-	"pps4", "PPS4", 
-	"atari_vg_earom", "ATARI VG EAROM", 
-	"er5911_8", "Serial EEPROM ER5911 (128x8)", 
-	"k056832", "Konami 056832", 
-	"k05324x", "Konami 053244 &amp; 053245", 
-	"k053251", "Konami 053251", 
-	"k053260", "K053260", 
-	"sh2_drc", "SH-2 DRC", 
-	"scudsp", "SCUDSP", 
-	"scsp", "SCSP", 
-	"cdda", "CD/DA", 
-	"i8035", "I8035", 
-	"sega_speech_sound", "Sega Speech Sound Board", 
-	"sega315_5124", "Sega 315-5124", 
-	"ldv1000", "Pioneer LD-V1000", 
-	"pc090oj", "Taito PC090OJ", 
-	"ymf262", "YMF262", 
-	"93c56_16", "Serial EEPROM 93C56 (128x16)", 
-	"wsf_80186_sound", "WSF 80186 DAC", 
-	"m68010", "M68010", 
-	"ataxx_80186_sound", "Ataxx 80186 DAC", 
-	"trackfld_audio", "Track And Field Audio", 
-	"hyprolyb_adpcm", "Hyper Olympics Audio", 
-	"i8039", "I8039", 
-	"mos656x_attack_ufo", "MOS656X", 
-	"ppc603", "PowerPC 603", 
-	"naomi_gdrom_board", "NAOMI-GDROM-BOARD", 
-	"i8085a", "8085A", 
-	"tms36xx", "TMS36XX", 
-	"phoenix_sound", "Phoenix Custom", 
-	"roc10937", "Rockwell 10937 VFD controller and compatible", 
-	"acia6850", "6850 ACIA", 
-	"clock", "Clock", 
-	"i8031", "I8031", 
-	"tms9928a", "TMS9928A VDP", 
-	"deco16ic", "Data East IC 55 / 56 / 74 / 141", 
-	"microtouch_serial", "Microtouch Serial Touchscreen", 
-	"h63484", "H63484", 
-	"atari2816", "Atari EEPROM Interface (2816)", 
-	"2816", "Parallel EEPROM 2816 (2048x8)", 
-	"cclimber_audio", "cclimber Sound Board", 
-	"kaneko_view2_tilemap", "kaneko_view2_tilemap_device", 
-	"kaneko16_sprite", "kaneko16_sprite_device", 
-	"ppu2c04", "2C04 PPU", 
-	"gaelco_cg1v", "Gaelco CG1V", 
-	"ppc603e", "PowerPC 603e", 
-	"scsibus", "SCSI bus", 
-	"lsi53c810", "53C810 SCSI", 
-	"k573cassslotserial", "KONAMI 573 CASSETTE SLOT (SERIAL)", 
-	"mb89371", "MB89371", 
-	"ata_interface", "ATA Interface", 
-	"cr589", "Matsushita CR589", 
-	"k573cassslot", "KONAMI 573 CASSETTE SLOT", 
-	"k573cassx", "KONAMI 573 CASSETTE X", 
-	"x76f041", "X76F041 Flash", 
-	"fujitsu_29f016a", "Fujitsu 29F016A Flash", 
-	"pccard", "PCCARD SLOT", 
-	"m48t58", "M48T58", 
-	"adc0834", "ADC0834", 
-	"upd4701", "NEC uPD4701 Encoder", 
-	"i386", "I386", 
-	"ds2404", "DS2404", 
-	"intel_e28f008sa", "Intel E28F008SA Flash", 
-	"fifo7200", "IDT7200 FIFO", 
-	"tmp95c063", "TMP95C063", 
-	"atarivad", "Atari VAD", 
-	"atjsa3", "Atari JSA III Sound Board", 
-	"decocpu3b", "Data East Pinball CPU Board Type 3B", 
-	"decodmd3", "Data East Pinball Dot Matrix Display Type 3", 
-	"adsp2181", "ADSP-2181", 
-	"gp9001vdp", "GP9001_VDP", 
-	"v25", "V25", 
-	"upd7807", "uPD7807", 
-	"namco51", "Namco 51xx", 
-	"mb8843", "MB8843", 
-	"namco06xx", "Namco 06xx", 
-	"hd6309", "HD6309", 
-	"k007342", "Konami 007342", 
-	"k007420", "Konami 007420", 
-	"93c66_8", "Serial EEPROM 93C66 (512x8)", 
-	"arm9", "ARM9", 
-	"s3c2410", "Samsung S3C2410", 
-	"qs1000", "QS1000", 
-	"i8052", "I8052", 
-	"i2cmem", "I2CMEM", 
-	"s11c_bg", "Williams System 11C background music", 
-	"asap", "ASAP", 
-	"beezer_sound", "beezer SFX", 
-	"i960kb", "i960kb", 
-	"segas24_tile", "S24TILE", 
-	"y8950", "Y8950", 
-	"ttl74181", "TTL 74181", 
-	"s14001a", "S14001A", 
-	"exidy_sfx", "Exidy SFX", 
-	"v9938", "V9938", 
-	"r65c02", "R65C02", 
-	"hd61830", "HD61830 LCDC", 
-	"timeplt_audio", "Time Pilot Audio", 
-	"filter_rc", "RC Filter", 
-	"tiamc1_sound", "TIA-MC1 Custom", 
-	"saa1099", "SAA1099", 
-	"r5000le_drc", "R5000 (little) DRC", 
-	"bus_master_ide_controller", "Bus Master IDE Controller", 
-	"voodoo_1", "3dfx Voodoo Graphics", 
-	"adsp2115", "ADSP-2115", 
-	"k054338", "Konami 054338", 
-	"k055555", "Konami 055555", 
-	"h83044", "H8/3044", 
-	"i486", "I486", 
-	"k051733", "Konami 051733", 
-	"midsg", "Midway Sounds Good Sound Board", 
-	"seibu_crtc", "Seibu CRT Controller", 
-	"es5506", "ES5506", 
-	"kaneko_toybox", "kaneko_toybox_device", 
-	"kaneko_hit", "kaneko_hit_device", 
-	"atjsa1", "Atari JSA I Sound Board", 
-	"k054000", "Konami 054000", 
-	"k053936", "Konami 053936", 
-	"k054539", "K054539", 
-	"rtc65271", "RTC65271", 
-	"pc16552d", "National Semiconductor PC16552D", 
-	"ns16550", "National Semiconductor NS16550", 
-	"scsicd", "SCSICD", 
-	"am53cf96", "53CF96 SCSI", 
-	"rf5c400", "RF5C400", 
-	"decoc10707", "DECO C10707", 
-	"segas24_sprite", "S24SPRITE", 
-	"segas24_mixer", "S24MIXER", 
-	"warpwarp_sound", "Warp Warp Custom", 
-	"cirrus_vga", "Cirrus Logic VGA", 
-	"ns16450", "National Semiconductor NS16450", 
-	"decocomn", "Data East Common Video Functions", 
-	"deco104", "DECO104PROT", 
-	"deco16", "DECO16", 
-	"deco222", "DECO 222", 
-	"e116t", "E1-16T", 
-	"wpcsnd", "Williams WPC Sound", 
-	"namco50", "Namco 50xx", 
-	"mb8842", "MB8842", 
-	"namco52", "Namco 52xx", 
-	"namco54", "Namco 54xx", 
-	"mb8844", "MB8844", 
-	"am29000", "AMD Am29000", 
-	"i8051", "I8051", 
-	"mc68901", "Motorola MC68901", 
-	"micro3d_sound", "Microprose Custom", 
-	"h83008", "H8/3008", 
-	"h8_adc_3006", "H8 ADC 3006", 
-	"mpc8240", "PowerPC MPC8240", 
-	"voodoo_3", "3dfx Voodoo 3", 
-	"avg_bzone", "AVG_BZONE", 
-	"mathbox", "MATHBOX", 
-	"kaneko_calc3", "kaneko_calc3_device", 
-	"okim6376", "OKI6376", 
-	"deco_karnovsprites", "karnovsprites_device", 
-	"tms9128", "TMS9128 VDP", 
-	"cxd8530bq", "CXD8530BQ", 
-	"cxd8514q", "CXD8514Q", 
-	"sharp_lh28f400", "Sharp LH28F400 Flash", 
-	"decocpu7", "DECO CPU-7", 
-	"ppc602", "PowerPC 602", 
-	"decodmd1", "Data East Pinball Dot Matrix Display Type 1", 
-	"tms34020", "TMS34020", 
-	"m6801", "M6801", 
-	"k005289", "K005289", 
-	"i8279", "8279 KDC", 
-	"k053252", "Konami 053252", 
-	"k053247", "Konami 053246 &amp; 053247", 
-	"buggyboy_sound", "Buggy Boy Custom", 
-	"ppc403ga", "PowerPC 403GA", 
-	"ppc604", "PowerPC 604", 
-	"k001604", "Konami 001604", 
-	"cobra_jvs_host", "COBRA_JVS_HOST", 
-	"cobra_jvs", "COBRA_JVS", 
-	"alpha8301", "ALPHA-8301", 
-	"avg", "AVG", 
-	"seibu_adpcm", "Seibu ADPCM", 
-	"i8041", "I8041", 
-	"decocass_tape", "DECO Cassette Tape", 
-	"trident_vga", "Trident VGA", 
-	"smc91c94", "SMC91C94", 
-	"tc0280grd", "Taito TC0280GRD &amp; TC0430GRW", 
-	"tc0360pri", "Taito TC0360PRI", 
-	"e132n", "E1-32N", 
-	"i8032", "I8032", 
-	"deco146", "DECO146PROT", 
-	"i80c32", "I80C32", 
-	"vr4310le_drc", "VR4310 (little) DRC", 
-	"voodoo_banshee", "3dfx Voodoo Banshee", 
-	"74148", "TTL 74148", 
-	"74153", "TTL 74153", 
-	"rm7000le_drc", "RM7000 (little) DRC", 
-	"m48t37", "M48T37", 
-	"hd6303y", "HD6303Y", 
-	"exidy440_sound", "Exidy 440 CVSD", 
-	"tc0480scp", "Taito TC0480SCP", 
-	"x2212", "X2212 NVRAM", 
-	"akiko", "CBM AKIKO", 
-	"microtouch", "Microtouch Touchscreen", 
-	"scc68070", "SCC68070", 
-	"mcd212", "MCD212", 
-	"cdi68070", "CDI68070", 
-	"cdicdic", "CDICDIC", 
-	"cdislave", "CDISLAVE", 
-	"m48t08", "MK48T08", 
-	"alpha8201", "ALPHA-8201", 
-	"pentium3", "Pentium III", 
-	"ataflash", "ATA Flash PCCARD", 
-	"mb3773", "MB3773", 
-	"intel_te28f160", "Intel TE28F160 Flash", 
-	"intel_e28f400b", "Intel E28F400B Flash", 
-	"taito_zoom", "Taito Zoom Sound System", 
-	"mn1020012a", "MN1020012A", 
-	"zsg2", "ZSG-2", 
-	"ide_baseboard", "IDE Baseboard", 
-	"tc8830f", "TC8830F", 
-	"cxd8606bq", "CXD8606BQ", 
-	"cxd8561cq", "CXD8561CQ", 
-	"i8742", "I8742", 
-	"pr8210", "Pioneer PR-8210", 
-	"i8049", "I8049", 
-	"wiping_sound", "Wiping Custom", 
-	"naomi_m1_board", "NAOMI-M1-BOARD", 
-	"h83337", "H8/3337", 
-	"h8_intc", "H8 INTC", 
-	"h8_8bits_timer_channel", "H8 8-bits timer channel", 
-	"h8_16bits_timer_channel", "H8 16-bits timer channel", 
-	"h83007", "H8/3007", 
-	"sh1_drc", "SH-1 DRC", 
-	"tms9980a", "TMS9980A", 
-	"wd33c93", "33C93 SCSI", 
-	"cps3_custom", "CPS3 Custom", 
-	"midssio", "Midway SSIO Sound Board", 
-	"gms30c2132", "GMS30C2132", 
-	"h83334", "H8/3334", 
-	"tms32032", "TMS32032", 
-	"adsp2104", "ADSP-2104", 
-	"m48t35", "M48T35", 
-	"tms32031", "TMS32031", 
-	"tms57002", "TMS57002", 
-	"scsihd", "SCSIHD", 
-	"cxd8538q", "CXD8538Q", 
-	"k056800", "Konami 056800 MIRAC", 
-	"se3208", "SE3208", 
-	"vr0video", "VRender0 Video", 
-	"ds1302", "DS1302", 
-	"vrender0", "VRender0", 
-	"cem3394", "CEM3394", 
-	"tms9927", "TMS9927 VTC", 
-	"cquestrot", "Cube Quest Rotate CPU", 
-	"cquestlin", "Cube Quest Line CPU", 
-	"cquestsnd", "Cube Quest Sound CPU", 
-	"simutrek", "Simutrek Modified PR-8210", 
-	"i8748", "I8748", 
-	"st0016", "ST0016", 
-	"seibu_cop_legacy", "Seibu COP Legacy", 
-	"atjsa2", "Atari JSA II Sound Board", 
-	"sknsspr", "sknsspr_device", 
-	"k055673", "Konami 055673", 
-	"keycus_c431", "KEYCUS C431", 
-	"m68040", "M68040", 
-	"tms32051", "TMS32051", 
-	"tc0640fio", "Taito TC0640FIO", 
-	"93c56_8", "Serial EEPROM 93C56 (256x8)", 
-	"pc080sn", "Taito PC080SN", 
-	"toshiba_t5182", "T5182", 
-	"ppc603r", "PowerPC 603R", 
-	"mb86233", "MB86233", 
-	"segam1audio", "Sega Model 1 Sound Board", 
-	"multipcm", "Sega/Yamaha 315-5560", 
-	"tc0510nio", "Taito TC0510NIO", 
-	"v3021", "v3021", 
-	"ics2115", "ICS2115", 
-	"rtc9701", "rtc9701", 
-	"ymz770", "Yamaha YMZ770", 
-	"epic12", "epic12_device", 
-	"sh3be", "SH-3 (big)", 
-	"linearflash16mb", "Linear Flash PCCARD (16MB)", 
-	"k573mcr", "Konami Memory Card Reader", 
-	"k573cassyi", "KONAMI 573 CASSETTE YI", 
-	"ds2401", "DS2401", 
-	"linearflash32mb", "Linear Flash PCCARD (32MB)", 
-	"k573dio", "Konami 573 digital I/O board", 
-	"mas3507d", "MAS3507D", 
-	"k573casszi", "KONAMI 573 CASSETTE ZI", 
-	"zs01", "ZS01", 
-	"k573cassxi", "KONAMI 573 CASSETTE XI", 
-	"m68301", "M68301", 
-	"midtcs", "Midway Turbo Chip Squeak Sound Board", 
-	"5a22", "5A22", 
-	"spc700", "SPC700", 
-	"snes_sound", "SNES Custom DSP (SPC700)", 
-	"beep", "Beep", 
-	"tc0091lvc", "TC0091LVC", 
-	"namco53", "Namco 53xx", 
-	"58xx", "Namco 58xx", 
-	"56xx", "Namco 56xx", 
-	"i80c51", "I80C51", 
-	"z80dma", "Z8410 DMA", 
-	"pr7820", "Pioneer PR-7820", 
-	"z80sio", "Z80 SIO", 
-	"22vp932", "Phillips 22VP932", 
-	"adsp21062", "ADSP21062", 
-	"ds1204", "DS1204", 
-	"midsnt", "Midway Squawk 'n' Talk Sound Board", 
-	"tms5200", "TMS5200", 
-	"cop402", "COP402", 
-	"pic16c55", "PIC16C55", 
-	"igs_025_022", "IGS025", 
-	"igs022", "IGS022", 
-	"upd96050", "uPD96050", 
-	"k573msu", "Konami Multi Session Unit", 
-	"adc0838", "ADC0838", 
-	"keycus_c410", "KEYCUS C410", 
-	"astrocade", "Astrocade", 
-	"i8251", "I8251", 
-	"sega_sharrier_sprite", "Sega Space Harrier Sprites", 
-	"avg_starwars", "AVG_STARWARS", 
-	"tms5220", "TMS5220", 
-	"i80188", "I80188", 
-	"snk6502_sound", "snk6502 Custom", 
-	"venture_sound", "Exidy SFX+PSG", 
-	"nscsi_bus", "NSCSI Bus", 
-	"nscsi_connector", "NSCSI device connector abstraction", 
-	"scsi_harddisk", "SCSI HARDDISK", 
-	"ncr537xx", "53C7xx SCSI", 
-	"pit8253", "8253 PIT", 
-	"filetto_cga", "ISA8_CGA_FILETTO", 
-	"tetriskr_cga", "ISA8_CGA_TETRISKR", 
-	"namco_c45_road", "Namco C45 Road", 
-	"e132t", "E1-32T", 
-	"tms9995", "TMS9995", 
-	"22vp931", "Phillips 22VP931", 
-	"i4004", "Intel I4004", 
-	"hd6845", "HD6845 CRTC", 
-	"flower_sound", "Flower Custom Sound", 
-	"e132xt", "E1-32XT", 
-	"toaplan_scu", "toaplan_scu_device", 
-	"nsc8105", "NSC8105", 
-	"i8741", "I8741", 
-	"funcube_touchscrene", "Funcube Touchscreen", 
-	"namco62", "Namco 62xx", 
-	"93c76_8", "Serial EEPROM 93C76 (1024x8)", 
-	"kaneko_grap2", "kaneko_grap2_device", 
-	"upd7756", "uPD7756", 
-	"voodoo_2", "3dfx Voodoo 2", 
-	"taito8741_4pack", "Taito 8741 MCU 4 pack", 
-	"msm6585", "MSM6585", 
-	"st0020", "st0020_device", 
-	"geebee_sound", "Gee Bee Custom", 
-	"namco_63701x", "Namco 63701X", 
-	"sega_yboard_sprite", "Sega Y-Board Sprites", 
-	"huc6202", "HuC6202 VPC", 
-	"i8155", "8155 RIOT", 
-	"bfm_bd1", "BFM BD1 VFD controller", 
-	"bfm_adder2", "BFM ADDER2", 
-	"gomoku_sound", "Gomoku Custom", 
-	"k033906", "Konami 033906", 
-	"k037122", "Konami 0371222", 
-	"adc12138", "ADC12138", 
-	"mb_vcu", "Mazer Blazer custom VCU", 
-	"gridlee_sound", "Gridlee Custom", 
-	"ym2608", "YM2608", 
-	"m48t02", "M48T02", 
-	"k573npu", "Konami Network PCB Unit", 
-	"adc1038", "ADC1038", 
-	"k056230", "Konami 056230", 
-	"atari_rle", "Atari RLE Motion Objects", 
-	"asic65", "ASIC65", 
-	"ins8050", "INS 8050 SC/MP", 
-	"sega_hangon_sprite", "Sega Hang On Sprites", 
-	"adsp2100", "ADSP-2100", 
-	"adsp2101", "ADSP-2101", 
-	"dsp32c", "DSP32C", 
-	"i8080a", "8080A", 
-	"k573cassy", "KONAMI 573 CASSETTE Y", 
-	"h8s2394", "H8S/2394", 
-	"h8s_intc", "H8S INTC", 
-	"h8_adc_2357", "H8 ADC 2357", 
-	"h8s_16bits_timer_channel", "H8S 16-bits timer channel", 
-	"segausbrom", "Sega Universal Sound Board with ROM", 
-	"tms9902", "TMS9902 ACC", 
-	"ppu2c05_01", "2C05_01 PPU", 
-	"janshi_vdp", "JANSHIVDP", 
-	"wmsadpcm", "Williams ADPCM Sound Board", 
-	"josvolly8741_4pack", "joshi Vollyball 8741 MCU 4 pack", 
-	"v810", "V810", 
-	"midi_kbd", "Generic MIDI Keyboard", 
-	"r4600le_drc", "R4600 (little) DRC", 
-	"hd63484", "HD63484 CRTC", 
-	"renegade_adpcm", "Renegade Custom ADPCM", 
-	"tms3615", "TMS3615", 
-	"er2055", "ER2055", 
-	"pentium4", "Pentium 4", 
-	"indervd", "Inder / Dinamic TMS Video", 
-	"cop420", "COP420", 
-	"decocpu1", "Data East Pinball CPU Board Type 1", 
-	"snkwave", "SNK Wave", 
-	"r5000be_drc", "R5000 (big) DRC", 
-	"tmp91640", "TMP91640", 
-	"saa5050", "SAA5050", 
-	"m58715", "M58715", 
-	"indersb", "Inder 4xDAC Sound Board", 
-	"sega315_5246", "Sega 315-5246", 
-	"cartslot_image", "Cartslot", 
-	"software_list", "Software list", 
-	"k053250", "K053250", 
-	"ppu2c05_02", "2C05_02 PPU", 
-	"gms30c2116", "GMS30C2116", 
-	"mjkjidai_adpcm", "Custom ADPCM", 
-	"decocpu2", "Data East Pinball CPU Board Type 2", 
-	"atjsa3s", "Atari JSA IIIs Sound Board", 
-	"es5503", "Ensoniq ES5503", 
-	"u8106", "U8106", 
-	"mc3417", "MC3417", 
-	"keycus_c443", "KEYCUS C443", 
-	"wmsnarc", "Williams NARC Sound Board", 
-	"naughtyb_sound", "Naughty Boy Custom", 
-	"ygv608", "YGV608", 
-	"m50458", "m50458", 
-	"s3520cf", "s3520cf", 
-	"rp5h01", "RP5H01", 
-	"m6m80011ap", "M6M80011AP EEPROM", 
-	"igs028", "IGS028", 
-	"upd4992", "uPD4992", 
-	"sega_outrun_sprite", "Sega Out Run Sprites", 
-	"er5911_16", "Serial EEPROM ER5911 (64x16)", 
-	"y2404", "Y2404", 
-	"59xx", "Namco 59xx", 
-	"e116xt", "E1-16XT", 
-	"bootleg_sys16a_sprite", "Bootleg System 16A Sprites", 
-	"es8712", "ES8712", 
-	"ppu2c03b", "2C03B PPU", 
-	"segausb", "Sega Universal Sound Board", 
-	"pleiads_sound", "Pleiads Custom", 
-	"dsp56156", "DSP56156", 
-	"linearflash64mb", "Linear Flash PCCARD (64MB)", 
-	"keycus_c432", "KEYCUS C432", 
-	"z8002", "Z8002", 
-	"polepos_sound", "Pole Position Custom", 
-	"netlist_analog_output", "netlist analog output", 
-	"popflame_sound", "Pop Flamer Custom", 
-	"keycus_c411", "KEYCUS C411", 
-	"decocpu6", "DECO CPU-6", 
-	"mb90082", "mb90082", 
-	"puzzlet_io", "Puzzlet Coin/Start I/O", 
-	"pentium2", "Pentium II", 
-	"avg_quantum", "AVG_QUANTUM", 
-	"i5000snd", "I5000", 
-	"m58819", "M58819", 
-	"m58817", "M58817", 
-	"gaelco_serial", "gaelco_serial", 
-	"at89c4051", "AT89C4051", 
-	"redbaron_custom", "Red Baron Custom", 
-	"redline_80186_sound", "Redline Racer 80186 DAC", 
-	"sp0256", "SP0256", 
-	"s3_vga", "S3 Graphics VGA", 
-	"ibm8514a", "IBM8514A", 
-	"bfm_dm01", "Bellfruit Dotmatrix 01", 
-	"digitalker", "Digitalker", 
-	"dsbz80", "Sega Z80-based Digital Sound Board", 
-	"dm9368", "DM9368", 
-	"m3745x", "Mitsubishi M37450", 
-	"i860xr", "i860XR", 
-	"i80c31", "I80C31", 
-	"m68ec030", "M68EC030", 
-	"keycus_c409", "KEYCUS C409", 
-	"r3051", "R3051", 
-	"gms30c2232", "GMS30C2232", 
-	"midcsd", "Midway Chip Squeak Deluxe Sound Board", 
-	"nile", "NiLe", 
-	"keycus_c442", "KEYCUS C442", 
-	"cxd8530aq", "CXD8530AQ", 
-	"keycus_c406", "KEYCUS C406", 
-	"avg_tempest", "AVG_TEMPEST", 
-	"cop421", "COP421", 
-	"avg_tomcat", "AVG_TOMCAT", 
-	"ppu2c05_04", "2C05_04 PPU", 
-	"tia_ntsc_video", "TIA Video (NTSC)", 
-	"tia_sound", "TIA", 
-	"esrip", "ESRIP", 
-	"turrett_hdd", "Turrett Tower HDD", 
-	"ttsnd", "Turret Tower Sound", 
-	"tx1_sound", "TX-1 Custom", 
-	"scn2674_device", "scn2674_device", 
-	"ins8154", "INS8154", 
-	"victory_sound", "Exidy SFX+PSG+Speech", 
-	"ppu2c05_03", "2C05_03 PPU", 
-	"r4700le_drc", "R4700 (little) DRC", 
-	"ds5002fp", "DS5002FP", 
-	"keycus_c430", "KEYCUS C430", 
-
-	// additional rom names from mame4all 0.37b5
-	"64streej", "64th. Street - A Detective Story (Japan)",
-	"720b", "720 Degrees (set 2)",
-	"99lstwra", "'99 The Last War (alternate)",
-	"actfanc1", "Act-Fancer Cybernetick Hyper Weapon (World revision 1)",
-	"actfancj", "Act-Fancer Cybernetick Hyper Weapon (Japan revision 1)",
-	"alexkida", "Alex Kidd (set 2)",
-	"aliensya", "Alien Syndrome (set 2)",
-	"aliensyb", "Alien Syndrome (set 3)",
-	"aliensyj", "Alien Syndrome (Japan)",
-	"altbeas2", "Altered Beast (Version 2)",
-	"archriv2", "Arch Rivals (rev 2.0)",
-	"ark2jp", "Arkanoid - Revenge of DOH (Japan)",
-	"ark2us", "Arkanoid - Revenge of DOH (US)",
-	"arkanoi2", "Arkanoid - Revenge of DOH (World)",
-	"arkbl2", "Arkanoid (Japanese bootleg Set 2)",
-	"arknoidj", "Arkanoid (Japan)",
-	"arknoidu", "Arkanoid (US)",
-	"armorca2", "Armored Car (set 2)",
-	"astdelu1", "Asteroids Deluxe (rev 1)",
-	"asteroi1", "Asteroids (rev 1)",
-	"asteroib", "Asteroids (bootleg on Lunar Lander hardware)",
-	"astorm2p", "Alien Storm (2 Player)",
-	"atetckt2", "Tetris (Cocktail set 2)",
-	"atetcktl", "Tetris (Cocktail set 1)",
-	"atlants2", "Battle of Atlantis (set 2)",
-	"auraila", "Aurail (set 2)",
-	"avenger2", "Avengers (set 2)",
-	"battlan2", "Battle Lane Vol. 5 (set 2)",
-	"battlan3", "Battle Lane Vol. 5 (set 3)",
-	"battlntj", "Battlantis (Japan)",
-	"batugnsp", "Batsugun Special Ver.",
-	"bayrouta", "Bay Route (set 2)",
-	"bayrtbl1", "Bay Route (bootleg set 1)",
-	"bayrtbl2", "Bay Route (bootleg set 2)",
-	"berlwalt", "Berlin Wall, The (set 2)",
-	"bermudaa", "Bermuda Triangle (US early version)",
-	"bermudaj", "Bermuda Triangle (Japan)",
-	"bktigerb", "Black Tiger (bootleg)",
-	"bladstle", "Blades of Steel (version E)",
-	"blckgalb", "Block Gal (bootleg)",
-	"blckout2", "Block Out (set 2)",
-	"blkdrgnb", "Black Dragon (bootleg)",
-	"blsthead", "Blasteroids (with heads)",
-	"blstroi2", "Blasteroids (version 2)",
-	"blueprnj", "Blue Print (Jaleco)",
-	"bombjac2", "Bomb Jack (set 2)",
-	"bubbobr1", "Bubble Bobble (US)",
-	"bublbobr", "Bubble Bobble (US with mode select)",
-	"bullfgtj", "Tougyuu, The (Japan)",
-	"burningh", "Burning Fight (set 2)",
-	"bzone2", "Battle Zone (set 2)",
-	"cabal2", "Cabal (US set 2)",
-	"cameltru", "Camel Try (US)",
-	"canbprot", "Canyon Bomber (prototype)",
-	"captcomj", "Captain Commando (Japan)",
-	"captcomu", "Captain Commando (US)",
-	"carnvckt", "Carnival (cocktail)",
-	"ccastle2", "Crystal Castles (set 2)",
-	"cclimbrj", "Crazy Climber (Japan)",
-	"centipb2", "Centipede (bootleg set 2)",
-	"centipd2", "Centipede (revision 2)",
-	"champbbj", "Champion Baseball (Japan)",
-	"checkmaj", "Checkman (Japan)",
-	"chplft", "Choplifter",
-	"chplftb", "Choplifter (alternate)",
-	"chplftbl", "Choplifter (bootleg)",
-	"ckonga", "Crazy Kong (set 2)",
-	"ckongjeu", "Crazy Kong (Jeutel bootleg)",
-	"cninja0", "Caveman Ninja (World revision 0)",
-	"cobracmj", "Cobra-Command (Japan)",
-	"combasc", "Combat School (joystick)",
-	"combascb", "Combat School (bootleg)",
-	"combascj", "Combat School (Japan trackball)",
-	"combasct", "Combat School (trackball)",
-	"commandj", "Senjo no Ookami",
-	"commandu", "Commando (US)",
-	"contrajb", "Contra (Japan bootleg)",
-	"cosmognj", "Cosmo Gang the Video (Japan)",
-	"crbalon2", "Crazy Balloon (set 2)",
-	"crimfgt2", "Crime Fighters (World 2 Players)",
-	"crimfgtj", "Crime Fighters (Japan 2 Players)",
-	"cyberb2p", "Cyberball 2072 (2 player)",
-	"cyberba2", "Cyberball (Version 2)",
-	"cyberbt", "Tournament Cyberball 2072",
-	"darksea1", "Dark Seal (World revision 1)",
-	"darkseaj", "Dark Seal (Japan)",
-	"dbldyn", "Double Dynamites, The",
-	"ddrago3b", "Double Dragon 3 - The Rosetta Stone (bootleg)",
-	"deadconj", "Dead Connection (Japan)",
-	"defendg", "Defender (Green label)",
-	"defendw", "Defender (White label)",
-	"destderb", "Demolition Derby",
-	"destderm", "Demolition Derby (2-Player Mono Board Version)",
-	"devstor2", "Devastators (version X)",
-	"devstor3", "Devastators (version V)",
-	"digdug2a", "Dig Dug II (set 2)",
-	"digdugb", "Dig Dug (set 2)",
-	"dkjrbl", "Donkey Kong Junior (bootleg?)",
-	"dkjrjp", "Donkey Kong Junior (Japan)",
-	"dkngjrjp", "Donkey Kong Jr. (Original Japanese)",
-	"dkongjp", "Donkey Kong (Japan set 1)",
-	"dkongjpo", "Donkey Kong (Japan set 2)",
-	"docastl2", "Mr. Do's Castle (set 2)",
-	"dorunru2", "Do! Run Run (set 2)",
-	"dorunruc", "Do! Run Run (Do's Castle hardware)",
-	"dotriku2", "Dottori Kun (old version)",
-	"dspirito", "Dragon Spirit (old version)",
-	"dwj", "Tenchi wo Kurau (Japan)",
-	"earthinv", "Super Earth Invasion",
-	"einnings", "Extra Innings",
-	"elecyoy2", "Electric Yo-Yo, The (set 2)",
-	"elevatob", "Elevator Action (bootleg)",
-	"espiale", "Espial (Europe)",
-	"exctscca", "Exciting Soccer (alternate music)",
-	"exctsccb", "Exciting Soccer (bootleg)",
-	"exerizrb", "Exerizer (Japan) (bootleg)",
-	"fantzono", "Fantasy Zone (Old Ver.)",
-	"finalizb", "Finalizer - Super Transformation (bootleg)",
-	"firetpbl", "Fire Trap (Japan bootleg)",
-	"flicky2", "Flicky (set 2)",
-	"froggrmc", "Frogger (modified Moon Cresta hardware)",
-	"frogseg1", "Frogger (Sega set 1)",
-	"frogseg2", "Frogger (Sega set 2)",
-	"ftsoccer", "Fighting Soccer",
-	"galag88b", "Galaga '88 (set 2)",
-	"galag88j", "Galaga '88 (Japan)",
-	"galaga84", "Galaga '84",
-	"galagab2", "Galaga (bootleg)",
-	"galagads", "Galaga (fast shoot)",
-	"galaxb", "Galaxian (bootleg)",
-	"galmidw", "Galaxian (Midway)",
-	"gangwarb", "Gang Wars (bootleg)",
-	"gatedom1", "Gate of Doom (US revision 1)",
-	"gaunt2p", "Gauntlet (2 Players)",
-	"gauntir1", "Gauntlet (Intermediate Release 1)",
-	"gauntir2", "Gauntlet (Intermediate Release 2)",
-	"getstar", "Guardian",
-	"getstarb", "Get Star (bootleg)",
-	"ghoulsj", "Dai Makai-Mura (Japan)",
-	"goldnabl", "Golden Axe (bootleg)",
-	"goldnaxa", "Golden Axe (Version 2)",
-	"goldnaxb", "Golden Axe (Version 2 317-0110)",
-	"goldnaxc", "Golden Axe (Version 2 317-0122)",
-	"goldnaxj", "Golden Axe (Version 1, Japan)",
-	"gravitr2", "Gravitar (version 2)",
-	"grdius2a", "Gradius II - Gofer no Yabou (Japan set 2)",
-	"grdius2b", "Gradius II - Gofer no Yabou (Japan set 3)",
-	"grdius3a", "Gradius III (Asia)",
-	"gundeala", "Gun Dealer (set 2)",
-	"gunforcu", "Gunforce - Battle Fire Engulfed Terror Island (US)",
-	"gunfronj", "Gun Frontier (Japan)",
-	"gunsmoka", "Gun.Smoke (US set 2)",
-	"gunsmokj", "Gun.Smoke (Japan)",
-	"gunsmrom", "Gun.Smoke (US set 1)",
-	"hardhedb", "Hard Head (Bootleg)",
-	"hcastlea", "Haunted Castle (set 2)",
-	"hcastlej", "Akuma-Jou Dracula (Japan)",
-	"helifira", "HeliFire (revision A)",
-	"hitnmis2", "Hit 'n Miss (version 2.0)",
-	"hyprolyb", "Hyper Olympic (bootleg)",
-	"indytem2", "Indiana Jones and the Temple of Doom (set 2)",
-	"indytem3", "Indiana Jones and the Temple of Doom (set 3)",
-	"indytem4", "Indiana Jones and the Temple of Doom (set 4)",
-	"intrepi2", "Intrepid (set 2)",
-	"invrvnga", "Invader's Revenge (Dutchford)",
-	"jackrab2", "Jack Rabbit (set 2)",
-	"jackrabs", "Jack Rabbit (special)",
-	"junglkj2", "Jungle King (Japan, earlier)",
-	"junofstg", "Juno First (Gottlieb)",
-	"jyuohki", "Jyuohki (Japan)",
-	"kangaroa", "Kangaroo (Atari)",
-	"kangarob", "Kangaroo (bootleg)",
-	"karatblu", "Karate Blazers (US)",
-	"kicka", "Kick (cocktail)",
-	"kingbalj", "King & Balloon (Japan)",
-	"kodure", "Kodure Ookami (Japan)",
-	"kungfud", "Kung Fu Master (Data East)",
-	"kuniokub", "Nekketsu Kouha Kunio-kun (Japan bootleg)",
-	"kurikina", "Kuri Kinton (prototype?)",
-	"kyukaido", "Kyuukai Douchuuki (Japan old version)",
-	"lastmiss", "Last Mission (US revision 6)",
-	"lastmss2", "Last Mission (US revision 5)",
-	"lifefrcj", "Lifeforce (Japan)",
-	"losttmbh", "Lost Tomb (hard)",
-	"lstduela", "Last Duel (US set 2)",
-	"lstduelb", "Last Duel (bootleg)",
-	"lwingsjp", "Ales no Tsubasa (Japan)",
-	"mainevt2", "Main Event, The (version F)",
-	"makaimuc", "Makai-Mura (Revision C)",
-	"makaimug", "Makai-Mura (Revision G)",
-	"mappyjp", "Mappy (Japan)",
-	"marblea", "Marble Madness (set 3)",
-	"mariojp", "Mario Bros. (Japan)",
-	"marvlanj", "Marvel Land (Japan)",
-	"megaznik", "Mega Zone (Kosuka)",
-	"minigol2", "Mini Golf (set 2)",
-	"mjnquesb", "Mahjong Quest (No Nudity)",
-	"mk2r32", "Mortal Kombat II (rev L3.2 (European))",
-	"monwar2a", "Moon War II (set 2)",
-	"mooncrsg", "Moon Cresta (Gremlin)",
-	"moonwalk", "Moon Walker (Set 1)",
-	"moonwar2", "Moon War II (set 1)",
-	"moonwlka", "Moon Walker (Set 2)",
-	"moonwlkb", "Moon Walker (bootleg)",
-	"mrvikinj", "Mister Viking (Japan)",
-	"mspacatk", "Ms. Pac-Man Plus",
-	"myheroj", "Seishun Scandal (Japan)",
-	"naughtya", "Naughty Boy (bootleg)",
-	"naughtyc", "Naughty Boy (Cinematronics)",
-	"navalone", "Navalone",
-	"nbajamt1", "NBA Jam TE (rev 1.0 01/17/94)",
-	"nbajamt2", "NBA Jam TE (rev 2.0 01/28/94)",
-	"nbajamt3", "NBA Jam TE (rev 3.0 03/04/94)",
-	"nbamaxht", "NBA Maximum Hangtime (rev 1.0)",
-	"nebulbee", "Nebulous Bee",
-	"nemesuk", "Nemesis (World?)",
-	"nibblera", "Nibbler (set 2)",
-	"ninjak2a", "Ninja Kid II (set 2)",
-	"ninjak2b", "Ninja Kid II (set 3)",
-	"nov2001u", "Nova 2001 (US)",
-	"npacmod", "PuckMan (harder?)",
-	"nprincsb", "Ninja Princess (bootleg?)",
-	"nprincsu", "Ninja Princess (not encrypted)",
-	"offtwalc", "Off the Wall (2-player cocktail)",
-	"oscarj0", "Psycho-Nics Oscar (Japan revision 0)",
-	"oscarj", "Psycho-Nics Oscar (Japan revision 2)",
-	"outruna", "Out Run (set 2)",
-	"outzonep", "Out Zone (bootleg)",
-	"pacland2", "Pac-Land (set 2)",
-	"pacland3", "Pac-Land (set 3)",
-	"pacmanij", "Pac-Mania (Japan)",
-	"pacmanjp", "PuckMan (Japan set 2)",
-	"pacmanm", "Pac-Man (Midway)",
-	"panica", "Space Panic (set 2)",
-	"pbactio2", "Pinball Action (set 2)",
-	"pipibibi", "Pipi & Bibis / Whoopee (Japan) [bootleg ?]",
-	"pitfallu", "Pitfall II (not encrypted)",
-	"pitfigh3", "Pit Fighter (version 3)",
-	"polepos1", "Pole Position (Atari version 1)",
-	"poleposa", "Pole Position (Atari version 2)",
-	"poleps2a", "Pole Position II (Atari)",
-	"poleps2b", "Pole Position II (Atari bootleg 1)",
-	"poleps2c", "Pole Position II (Atari bootleg 2)",
-	"popeye2", "Popeye (set 2)",
-	"popflama", "Pop Flamer (set 2)",
-	"poundfou", "Pound for Pound (US)",
-	"prehislu", "Prehistoric Isle in 1930 (US)",
-	"pulirulj", "PuLiRuLa (Japan)",
-	"punishrj", "Punisher, The (Japan)",
-	"punishru", "Punisher, The (US)",
-	"punksht2", "Punk Shot (2 Players)",
-	"puzbobb", "Puzzle Bobble (Japan, B-System)",
-	"qadj", "Quiz & Dragons (Japan)",
-	"qbertjp", "Q*bert (Japan)",
-	"qtono2", "Quiz Tonosama no Yabou 2 Zenkoku-ban (Japan)",
-	"quartetj", "Quartet (Japan)",
-	"quartrba", "Quarterback (set 2)",
-	"qwakprot", "Qwak (prototype)",
-	"rainbow", "Rainbow Islands",
-	"rainbowe", "Rainbow Islands (Extra)",
-	"rambo3a", "Rambo III (set 2, US)",
-	"ramprt2p", "Rampart (2-player Joystick)",
-	"rastanu2", "Rastan (US set 2)",
-	"rescrdsa", "Rescue Raider (Stand-Alone)",
-	"retofin1", "Return of the Invaders (bootleg set 1)",
-	"retofin2", "Return of the Invaders (bootleg set 2)",
-	"ringkin2", "Ring King (set 2)",
-	"ringkin3", "Ring King (set 3)",
-	"robocpu0", "Robocop (US revision 0)",
-	"robotryo", "Robotron (Yellow/Orange label)",
-	"rockragj", "Koi no Hotrock (Japan)",
-	"rocnropk", "Roc'n Rope (Kosuka)",
-	"rthundro", "Rolling Thunder (old version)",
-	"rtypepj", "R-Type (Japan prototype)",
-	"saturn", "Saturn",
-	"schasrcv", "Space Chaser (CV version)",
-	"scrambls", "Scramble (Stern)",
-	"sctionza", "Section Z (set 2)",
-	"sdioj", "SDI - Strategic Defense Initiative (Japan)",
-	"seganinu", "Sega Ninja (not encrypted)",
-	"sengokh", "Sengoku / Sengoku Denshou (set 2)",
-	"sercharu", "SAR - Search And Rescue (US)",
-	"sf1", "Street Fighter (World)",
-	"sf1jp", "Street Fighter (Japan)",
-	"sf1us", "Street Fighter (US)",
-	"sf2a", "Street Fighter II - The World Warrior (US 910206)",
-	"sf2b", "Street Fighter II - The World Warrior (US 910214)",
-	"sf2cea", "Street Fighter II' - Champion Edition (US rev A)",
-	"sf2ceb", "Street Fighter II' - Champion Edition (US rev B)",
-	"sf2cej", "Street Fighter II' - Champion Edition (Japan)",
-	"sf2e", "Street Fighter II - The World Warrior (US 910228)",
-	"sf2jb", "Street Fighter II - The World Warrior (Japan 910214)",
-	"sf2t", "Street Fighter II' - Hyper Fighting (US)",
-	"sf2tj", "Street Fighter II' Turbo - Hyper Fighting (Japan)",
-	"sfeverbw", "Space Fever (black and white)",
-	"shangonb", "Super Hang-On (bootleg)",
-	"shdancrj", "Shadow Dancer (Japan)",
-	"shinobia", "Shinobi (set 2)",
-	"shinobib", "Shinobi (set 3)",
-	"shinobl", "Shinobi (bootleg)",
-	"shootoub", "Shoot Out (Korean Bootleg)",
-	"shootouj", "Shoot Out (Japan)",
-	"sichuana", "Sichuan II (hack ?) (set 2)",
-	"sidearjp", "Side Arms - Hyper Dyne (Japan)",
-	"sidearmr", "Side Arms - Hyper Dyne (US)",
-	"sidepctb", "Side Pocket (bootleg)",
-	"sidepctj", "Side Pocket (Japan)",
-	"silkwrm2", "Silkworm (set 2)",
-	"simps2pj", "Simpsons, The (2 Players Japan)",
-	"simpsn2p", "Simpsons, The (2 Players)",
-	"sinista1", "Sinistar (prototype version)",
-	"sinista2", "Sinistar (revision 2)",
-	"skingam2", "Irem Skins Game, The (US set 2)",
-	"skullxb2", "Skull & Crossbones (set 2)",
-	"skykiddo", "Sky Kid Deluxe (set 2)",
-	"slapbtjp", "Slap Fight (Japan bootleg)",
-	"slapbtuk", "Slap Fight (English bootleg)",
-	"snowbroa", "Snow Bros. - Nick & Tom (set 2)",
-	"snowbrob", "Snow Bros. - Nick & Tom (set 3)",
-	"snowbroj", "Snow Bros. - Nick & Tom (Japan)",
-	"spacfura", "Space Fury (revision A)",
-	"spinlbrj", "Spinal Breakers (Japan)",
-	"spinlbru", "Spinal Breakers (US)",
-	"spnchotj", "Super Punch-Out!! (Japan)",
-	"sptrekct", "Space Trek (cocktail)",
-	"spyhnt2a", "Spy Hunter 2 (rev 1)",
-	"sqixbl", "Super Qix (bootleg)",
-	"srumblr2", "Speed Rumbler, The (set 2)",
-	"sspacat2", "Space Attack (upright, older)",
-	"sspacatc", "Space Attack (cocktail)",
-	"ssrdrabd", "Sunset Riders (Asia 2 Players ver. ABD)",
-	"ssrdrebc", "Sunset Riders (World 2 Players ver. EBC)",
-	"ssrdrebd", "Sunset Riders (World 2 Players ver. EBD)",
-	"ssrdrjbd", "Sunset Riders (Japan 2 Players ver. JBD)",
-	"ssrdruac", "Sunset Riders (US 4 Players ver. UAC)",
-	"ssrdrubc", "Sunset Riders (US 2 Players ver. UBC)",
-	"ssrdruda", "Sunset Riders (US 4 Players ver. UDA)",
-	"starfore", "Star Force (encrypted)",
-	"starjacs", "Star Jacker (Stern)",
-	"starwar1", "Star Wars (rev 1)",
-	"stratvxb", "Stratovox (bootleg)",
-	"streets1", "Street Smart (US version 1)",
-	"streetsj", "Street Smart (Japan version 1)",
-	"stridrja", "Strider Hiryu (Japan set 2)",
-	"supbtimj", "Super Burger Time (Japan)",
-	"superpcm", "Super Pac-Man (Midway)",
-	"superqix", "Super Qix",
-	"suprmou2", "Funny Mouse (bootleg?)",
-	"surpratk", "Surprise Attack (Japan)",
-	"tankfrcj", "Tank Force (Japan)",
-	"tatsujn2", "Truxton II / Tatsujin II / Tatsujin Oh (Japan)",
-	"terracra", "Terra Cresta (YM2203)",
-	"terracrb", "Terra Cresta (YM3526 set 2)",
-	"tetrisa", "Tetris (Sega Set 2)",
-	"thehustj", "Hustler, The (Japan version J)",
-	"thnderxj", "Thunder Cross (Japan)",
-	"tigerh2", "Tiger Heli (set 2)",
-	"timesol1", "Time Soldiers (US Rev 1)",
-	"timscanr", "Time Scanner",
-	"tmnt22p", "Teenage Mutant Ninja Turtles - Turtles in Time (2 Players US)",
-	"tndrcadj", "Tokusyu Butai UAG (Japan)",
-	"tnzs2", "NewZealand Story 2, The (World)",
-	"tnzsb", "NewZealand Story, The (World, bootleg)",
-	"todruagb", "Tower of Druaga (set 2)",
-	"toki2", "Toki (set 2)",
-	"toki3", "Toki (set 3)",
-	"tomahaw5", "Tomahawk 777 (Revision 5)",
-	"toobinp", "Toobin' (Prototype)",
-	"trackflc", "Track & Field (Centuri)",
-	"trogp", "Trog (prototype, rev 4.00 07/27/90)",
-	"tsamura2", "Samurai Nihon-ichi (set 2)",
-	"tumblep2", "Tumble Pop (bootleg set 2)",
-	"tumblepb", "Tumble Pop (bootleg set 1)",
-	"tutankst", "Tutankham (Stern)",
-	"twincobu", "Twin Cobra (US)",
-	"vangrdce", "Vanguard (Centuri)",
-	"vanvans", "Van Van Car (Sanritsu)",
-	"vaportru", "Vapor Trail - Hyper Offence Formation (US)",
-	"vendett2", "Vendetta (Asia set 2)",
-	"vendettj", "Crime Fighters 2 (Japan)",
-	"vigilntj", "Vigilante (Japan)",
-	"vigilntu", "Vigilante (US)",
-	"vimana2", "Vimana (set 2)",
-	"vsyard", "10 Yard Fight (Vs. version 11/05/84)",
-	"vsyard2", "10 Yard Fight (Vs. version, set 2)",
-	"vulgus2", "Vulgus (set 2)",
-	"warlord", "Warlords",
-	"warpwar2", "Warp Warp (Rock-ola set 2)",
-	"warpwarr", "Warp Warp (Rock-ola set 1)",
-	"wb3a", "Wonder Boy III - Monster Lair (set 2)",
-	"wb3bl", "Wonder Boy III - Monster Lair (bootleg)",
-	"wbmlj", "Wonder Boy in Monster Land (Japan set 1)",
-	"wbmlj2", "Wonder Boy in Monster Land (Japan set 2)",
-	"wbmlju", "Wonder Boy in Monster Land (Japan not encrypted)",
-	"wboy4u", "Wonder Boy (set 4 not encrypted)",
-	"wexpresb", "Western Express (bootleg)",
-	"wwester1", "Wild Western (set 2)",
-	"yard", "10 Yard Fight",
-	"yokaidko", "Yokai Douchuuki (Japan old version)",
-	"youkaidk", "Yokai Douchuuki (Japan new version)",
-	"zzyzzyx2", "Zzyzzyxx (set 2)",
 
 	NULL
 };
+
+// number of pairs, not counting the NULL terminator
+extern const unsigned int mameNameCount = sizeof(mameNameToRealName) / sizeof(mameNameToRealName[0]) / 2;
@@ -1,5 +1,10 @@
 #include "MetaData.h"
 #include <boost/assign.hpp>
+#include <cassert>
+#include <climits>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
 
 MetaDataDecl gameDecls[] = { 
 	// key,			type,					default,			statistic,	name in GuiMetaDataEd,	prompt in GuiMetaDataEd
@@ -49,6 +54,125 @@ const std::map<MetaDataListType, std::vector<MetaDataDecl> >& getMDDMap()
 	return MDD_map;
 }
 
+#define MD_NO_TIME LLONG_MIN
+
+// what a slot actually stores
+enum SlotStorage
+{
+	STORE_STRING,
+	STORE_INT,
+	STORE_FLOAT,
+	STORE_TIME
+};
+
+std::vector<SlotStorage> get_slot_storage()
+{
+	const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
+	assert(mdd.size() == MD_SLOT_COUNT);
+
+	std::vector<SlotStorage> storage;
+	for(auto it = mdd.begin(); it != mdd.end(); it++)
+	{
+		switch(it->type)
+		{
+		case MD_INT: storage.push_back(STORE_INT); break;
+		case MD_FLOAT:
+		case MD_RATING: storage.push_back(STORE_FLOAT); break;
+		case MD_DATE:
+		case MD_TIME: storage.push_back(STORE_TIME); break;
+		default: storage.push_back(STORE_STRING); break;
+		}
+	}
+	return storage;
+}
+
+inline SlotStorage slot_storage(MetaDataSlot slot)
+{
+	static const std::vector<SlotStorage> storage = get_slot_storage();
+	return storage[slot];
+}
+
+const boost::posix_time::ptime& epoch()
+{
+	static const boost::posix_time::ptime time(boost::gregorian::date(1970, 1, 1));
+	return time;
+}
+
+long long ptime_to_seconds(const boost::posix_time::ptime& time)
+{
+	if(time.is_special())
+		return MD_NO_TIME;
+	return (time - epoch()).total_seconds();
+}
+
+boost::posix_time::ptime seconds_to_ptime(long long seconds)
+{
+	if(seconds == MD_NO_TIME)
+		return boost::posix_time::ptime(boost::posix_time::not_a_date_time);
+	// in two steps, seconds() takes a long, which is 32 bits on some platforms
+	return epoch() + boost::gregorian::days(seconds / 86400) + boost::posix_time::seconds(seconds % 86400);
+}
+
+// SQLITE_TIME_STRING_FORMAT -> seconds, without going through a stringstream for the usual case
+long long parse_time(const char* str, size_t length)
+{
+	static const char* pattern = "0000-00-00 00:00:00";
+	if(length == strlen(pattern))
+	{
+		bool matches = true;
+		for(size_t i = 0; i < length && matches; i++)
+			matches = (pattern[i] == '0' ? (str[i] >= '0' && str[i] <= '9') : str[i] == pattern[i]);
+
+		if(matches)
+		{
+			auto num = [str] (int start, int digits) { int n = 0; for(int i = start; i < start + digits; i++) n = n * 10 + (str[i] - '0'); return n; };
+			try
+			{
+				boost::gregorian::date date(num(0, 4), num(5, 2), num(8, 2));
+				return ptime_to_seconds(boost::posix_time::ptime(date, boost::posix_time::time_duration(num(11, 2), num(14, 2), num(17, 2))));
+			}catch(std::exception&)
+			{
+				return MD_NO_TIME;
+			}
+		}
+	}
+
+	return ptime_to_seconds(string_to_ptime(std::string(str, length), SQLITE_TIME_STRING_FORMAT));
+}
+
+std::string format_time(long long seconds)
+{
+	if(seconds == MD_NO_TIME)
+		return "not-a-date-time";
+
+	const boost::posix_time::ptime time = seconds_to_ptime(seconds);
+	const boost::gregorian::date::ymd_type ymd = time.date().year_month_day();
+	const boost::posix_time::time_duration tod = time.time_of_day();
+
+	char buf[32];
+	snprintf(buf, sizeof(buf), "%04d-%02d-%02d %02d:%02d:%02d", (int)ymd.year, (int)ymd.month, (int)ymd.day, 
+		(int)tod.hours(), (int)tod.minutes(), (int)tod.seconds());
+	return buf;
+}
+
+// floats are written and read with the classic locale so the database never sees a decimal comma
+std::string format_float(float value)
+{
+	std::stringstream ss;
+	ss.imbue(std::locale::classic());
+	ss << value;
+	return ss.str();
+}
+
+float parse_float(const char* str)
+{
+	std::istringstream ss(str);
+	ss.imbue(std::locale::classic());
+	float value = 0.0f;
+	ss >> value;
+	return value;
+}
+
 MetaDataMap::MetaDataMap(MetaDataListType type)
 	: mType(type)
 {
@@ -62,13 +186,268 @@ MetaDataMap::MetaDataMap(MetaDataListType type, bool init)
 
 void MetaDataMap::setDefaults()
 {
+	// every map of the same type starts out sharing the same defaults
+	static std::map< MetaDataListType, std::shared_ptr<const Data> > defaults;
+	static std::mutex defaultsMutex;
+
+	std::lock_guard<std::mutex> lock(defaultsMutex);
+	auto it = defaults.find(mType);
+	if(it != defaults.end())
+	{
+		mData = it->second;
+		return;
+	}
+
 	//To enforce that subset constraint above, we intialize the map to have
 	//all the defaults of the gameDecls, with our specific defaults overriding.
+	mData.reset();
 	const std::vector<MetaDataDecl>& mddGame = getMDDMap().at(GAME_METADATA);
 	const std::vector<MetaDataDecl>& mdd = getMDD();
 	for(auto iter = mddGame.begin(); iter != mddGame.end(); iter++)
 		set(iter->key, iter->defaultValue); 
-	if(mType == GAME_METADATA) return;
-	for(auto iter = mdd.begin(); iter != mdd.end(); iter++)
-		set(iter->key, iter->defaultValue);
+	if(mType != GAME_METADATA)
+	{
+		for(auto iter = mdd.begin(); iter != mdd.end(); iter++)
+			set(iter->key, iter->defaultValue);
+	}
+
+	defaults[mType] = mData;
+}
+
+int MetaDataMap::getSlot(const char* key)
+{
+	const std::vector<MetaDataDecl>& mdd = getMDDMap().at(GAME_METADATA);
+	for(int i = 0; i < MD_SLOT_COUNT; i++)
+	{
+		if(mdd[i].key == key)
+			return i;
+	}
+	return -1;
+}
+
+MetaDataSlot MetaDataMap::checkedSlot(const char* key)
+{
+	int slot = getSlot(key);
+	if(slot == -1)
+		throw std::out_of_range(std::string("Unknown metadata key \"") + key + "\"");
+	return (MetaDataSlot)slot;
+}
+
+MetaDataMap::Data& MetaDataMap::mutableData()
+{
+	if(!mData)
+	{
+		std::shared_ptr<Data> data = std::make_shared<Data>();
+		data->textSlots = 0;
+		data->strings.push_back('\0'); // empty strings point here
+		for(int i = 0; i < MD_SLOT_COUNT; i++)
+		{
+			switch(slot_storage((MetaDataSlot)i))
+			{
+			case STORE_STRING: data->values[i].str.offset = 0; data->values[i].str.length = 0; break;
+			case STORE_INT: data->values[i].i = 0; break;
+			case STORE_FLOAT: data->values[i].f = 0.0f; break;
+			case STORE_TIME: data->values[i].time = MD_NO_TIME; break;
+			}
+		}
+		mData = data;
+	}else if(!mData.unique())
+	{
+		// copy, leaving out strings that have since been replaced
+		std::shared_ptr<Data> data = std::make_shared<Data>();
+		data->textSlots = mData->textSlots;
+		data->strings.reserve(mData->strings.size());
+		for(int i = 0; i < MD_SLOT_COUNT; i++)
+		{
+			data->values[i] = mData->values[i];
+			if(holdsString((MetaDataSlot)i))
+			{
+				const Value& value = mData->values[i];
+				data->values[i].str.offset = data->strings.size();
+				data->strings.append(mData->strings, value.str.offset, value.str.length + 1);
+			}
+		}
+		mData = data;
+	}
+
+	return const_cast<Data&>(*mData);
+}
+
+static_assert(MD_SLOT_COUNT <= 32, "MetaDataMap::Data::textSlots needs a bit per slot");
+
+bool MetaDataMap::holdsString(MetaDataSlot slot) const
+{
+	return slot_storage(slot) == STORE_STRING || (mData && (mData->textSlots & (1u << slot)));
+}
+
+void MetaDataMap::setString(MetaDataSlot slot, const char* value, size_t length)
+{
+	// numbers and dates are only stored as such if that doesn't change what get() returns
+	switch(slot_storage(slot))
+	{
+	case STORE_INT:
+	{
+		const int i = atoi(value);
+		if(std::to_string(i).compare(0, std::string::npos, value, length) == 0)
+		{
+			setInt(slot, i);
+			return;
+		}
+		break;
+	}
+	case STORE_FLOAT:
+	{
+		const float f = parse_float(value);
+		if(format_float(f).compare(0, std::string::npos, value, length) == 0)
+		{
+			setFloat(slot, f);
+			return;
+		}
+		break;
+	}
+	case STORE_TIME:
+	{
+		const long long time = parse_time(value, length);
+		if(format_time(time).compare(0, std::string::npos, value, length) == 0)
+		{
+			setTime(slot, time);
+			return;
+		}
+		break;
+	}
+	case STORE_STRING: break;
+	}
+
+	const bool hadString = holdsString(slot);
+	Data& data = mutableData();
+	Value& str = data.values[slot];
+	if(slot_storage(slot) != STORE_STRING)
+		data.textSlots |= (1u << slot);
+
+	// overwrite the old value if it fits, otherwise add it to the end
+	if(!hadString || length > str.str.length)
+	{
+		str.str.offset = data.strings.size();
+		data.strings.resize(data.strings.size() + length + 1);
+	}
+	data.strings.replace(str.str.offset, length, value, length);
+	data.strings[str.str.offset + length] = '\0';
+	str.str.length = length;
+}
+
+void MetaDataMap::setInt(MetaDataSlot slot, int value)
+{
+	switch(slot_storage(slot))
+	{
+	case STORE_INT:
+	{
+		Data& data = mutableData();
+		data.values[slot].i = value;
+		data.textSlots &= ~(1u << slot);
+		break;
+	}
+	case STORE_FLOAT: setFloat(slot, (float)value); break;
+	default: set(slot, std::to_string(value)); break;
+	}
+}
+
+void MetaDataMap::setFloat(MetaDataSlot slot, float value)
+{
+	switch(slot_storage(slot))
+	{
+	case STORE_FLOAT:
+	{
+		Data& data = mutableData();
+		data.values[slot].f = value;
+		data.textSlots &= ~(1u << slot);
+		break;
+	}
+	default: set(slot, format_float(value)); break;
+	}
+}
+
+void MetaDataMap::setTime(MetaDataSlot slot, long long time)
+{
+	switch(slot_storage(slot))
+	{
+	case STORE_TIME:
+	{
+		Data& data = mutableData();
+		data.values[slot].time = time;
+		data.textSlots &= ~(1u << slot);
+		break;
+	}
+	default: set(slot, format_time(time)); break;
+	}
+}
+
+std::string MetaDataMap::get(MetaDataSlot slot) const
+{
+	if(!mData)
+		throw std::out_of_range("MetaDataMap was never initialized");
+
+	const Value& value = mData->values[slot];
+	switch(holdsString(slot) ? STORE_STRING : slot_storage(slot))
+	{
+	case STORE_INT: return std::to_string(value.i);
+	case STORE_FLOAT: return format_float(value.f);
+	case STORE_TIME: return format_time(value.time);
+	case STORE_STRING: break;
+	}
+
+	return std::string(mData->strings.c_str() + value.str.offset, value.str.length);
+}
+
+template<>
+std::string MetaDataMap::get(MetaDataSlot slot) const
+{
+	return get(slot);
+}
+
+template<>
+int MetaDataMap::get(MetaDataSlot slot) const
+{
+	if(mData && slot_storage(slot) == STORE_INT && !holdsString(slot))
+		return mData->values[slot].i;
+	return atoi(get(slot).c_str());
+}
+
+template<>
+float MetaDataMap::get(MetaDataSlot slot) const
+{
+	if(mData && slot_storage(slot) == STORE_FLOAT && !holdsString(slot))
+		return mData->values[slot].f;
+	return parse_float(get(slot).c_str());
+}
+
+template<>
+boost::posix_time::ptime MetaDataMap::get(MetaDataSlot slot) const
+{
+	if(mData && slot_storage(slot) == STORE_TIME && !holdsString(slot))
+		return seconds_to_ptime(mData->values[slot].time);
+	return string_to_ptime(get(slot), SQLITE_TIME_STRING_FORMAT);
+}
+
+template<>
+void MetaDataMap::set(MetaDataSlot slot, const std::string& value)
+{
+	setString(slot, value.c_str(), value.size());
+}
+
+template<>
+void MetaDataMap::set(MetaDataSlot slot, const int& value)
+{
+	setInt(slot, value);
+}
+
+template<>
+void MetaDataMap::set(MetaDataSlot slot, const float& value)
+{
+	setFloat(slot, value);
+}
+
+template<>
+void MetaDataMap::set(MetaDataSlot slot, const boost::posix_time::ptime& time)
+{
+	setTime(slot, ptime_to_seconds(time));
 }
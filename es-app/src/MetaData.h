@@ -3,6 +3,8 @@
 #include "pugixml/pugixml.hpp"
 #include <string>
 #include <map>
+#include <memory>
+#include <cstring>
 #include "GuiComponent.h"
 #include "Util.h"
 #include <boost/date_time.hpp>
@@ -42,7 +44,30 @@ enum MetaDataListType
 
 const std::map< MetaDataListType, std::vector<MetaDataDecl> >& getMDDMap();
 
-// this is just a dumb map meant to hold metadata records
+// Where each game metadata field lives in a MetaDataMap - the same order as the game MetaDataDecls.
+// Folder and filter metadata are a subset of game metadata, so they use the same slots.
+enum MetaDataSlot
+{
+	MD_SLOT_NAME,
+	MD_SLOT_DESC,
+	MD_SLOT_IMAGE,
+	MD_SLOT_THUMBNAIL,
+	MD_SLOT_RATING,
+	MD_SLOT_RELEASEDATE,
+	MD_SLOT_DEVELOPER,
+	MD_SLOT_PUBLISHER,
+	MD_SLOT_GENRE,
+	MD_SLOT_PLAYERS,
+	MD_SLOT_PLAYCOUNT,
+	MD_SLOT_LASTPLAYED,
+
+	MD_SLOT_COUNT
+};
+
+// Holds one metadata record in a fixed slot per field (see MetaDataSlot).  Ints, floats and dates are stored as
+// such and only converted when read as a string; strings share one buffer.  A string set on a number or date slot
+// that wouldn't come back the same (players "1-4", rating "0.750000") is kept as that string.  Copies share the same storage until
+// one of them is changed, so passing a MetaDataMap around by value is cheap.
 class MetaDataMap
 {
 public:
@@ -52,16 +77,25 @@ public:
 	inline MetaDataListType getType() const { return mType; }
 	inline const std::vector<MetaDataDecl>& getMDD() const { return getMDDMap().at(getType()); }
 
-	const std::string& get(const std::string& key) const
+	// the slot for key, -1 if it's not a metadata field
+	static int getSlot(const char* key);
+
+	// any value as a string, the way it's stored in the database
+	std::string get(MetaDataSlot slot) const;
+	std::string get(const char* key) const { return get(checkedSlot(key)); }
+	std::string get(const std::string& key) const { return get(key.c_str()); }
+
+	// data getters (see .cpp file for specializations)
+	template<typename T>
+	T get(MetaDataSlot slot) const
 	{
-		return mMap.at(key);
+		return boost::lexical_cast<T>(get(slot));
 	}
 
-	// data getters (see .cpp file for specializations)
 	template<typename T>
 	T get(const char* key) const
 	{
-		return boost::lexical_cast<T>(mMap.at(key));
+		return get<T>(checkedSlot(key));
 	}
 
 	template<typename T>
@@ -71,10 +105,22 @@ public:
 	}
 
 	// data setters (see .cpp file for specializations)
+	// strings are converted to the type of the slot
+	void set(MetaDataSlot slot, const char* value) { setString(slot, value, strlen(value)); }
+	void set(MetaDataSlot slot, const std::string& value) { setString(slot, value.c_str(), value.size()); }
+	void set(const char* key, const char* value) { set(checkedSlot(key), value); }
+	void set(const std::string& key, const char* value) { set(key.c_str(), value); }
+
+	template<typename T>
+	void set(MetaDataSlot slot, const T& value)
+	{
+		set(slot, boost::lexical_cast<std::string>(value));
+	}
+
 	template<typename T>
 	void set(const char* key, const T& value)
 	{
-		mMap[key] = boost::lexical_cast<std::string>(value);
+		set<T>(checkedSlot(key), value);
 	}
 
 	template<typename T>
@@ -86,19 +132,43 @@ public:
 	void setDefaults();
 
 private:
+	// throws std::out_of_range for unknown keys, like the std::map this used to be
+	static MetaDataSlot checkedSlot(const char* key);
+
+	void setString(MetaDataSlot slot, const char* value, size_t length);
+	void setInt(MetaDataSlot slot, int value);
+	void setFloat(MetaDataSlot slot, float value);
+	void setTime(MetaDataSlot slot, long long time);
+
+	union Value
+	{
+		int i;
+		float f;
+		long long time; // seconds since 1970, MD_NO_TIME for not-a-date-time
+		struct { unsigned int offset; unsigned int length; } str; // in Data::strings
+	};
+
+	struct Data
+	{
+		Value values[MD_SLOT_COUNT];
+		unsigned int textSlots; // bit per number or date slot that holds a string instead (see setString)
+		std::string strings; // every string value, each followed by a '\0'
+	};
+
+	bool holdsString(MetaDataSlot slot) const;
+
+	Data& mutableData(); // copy-on-write
+
 	MetaDataListType mType;
-	std::map<std::string, std::string> mMap;
+	std::shared_ptr<const Data> mData; // NULL for an uninitialized map
 };
 
-template<>
-inline boost::posix_time::ptime MetaDataMap::get(const char* key) const
-{
-	return string_to_ptime(mMap.at(key), SQLITE_TIME_STRING_FORMAT);
-}
-
-template<>
-inline void MetaDataMap::set(const char* key, const boost::posix_time::ptime& time)
-{
-	mMap[key] = ptime_to_string(time, SQLITE_TIME_STRING_FORMAT);
-}
+template<> std::string MetaDataMap::get(MetaDataSlot slot) const;
+template<> int MetaDataMap::get(MetaDataSlot slot) const;
+template<> float MetaDataMap::get(MetaDataSlot slot) const;
+template<> boost::posix_time::ptime MetaDataMap::get(MetaDataSlot slot) const;
 
+template<> void MetaDataMap::set(MetaDataSlot slot, const std::string& value);
+template<> void MetaDataMap::set(MetaDataSlot slot, const int& value);
+template<> void MetaDataMap::set(MetaDataSlot slot, const float& value);
+template<> void MetaDataMap::set(MetaDataSlot slot, const boost::posix_time::ptime& time);
@@ -2,6 +2,7 @@
 #include <string.h>
 
 extern const char* mameNameToRealName[];
+extern const unsigned int mameNameCount;
 
 namespace PlatformIds
 {
@@ -89,14 +90,22 @@ namespace PlatformIds
 
 	const char* getCleanMameName(const char* from)
 	{
-		const char** mameNames = mameNameToRealName;
+		// mameNameToRealName is sorted by short name, so binary search it
+		unsigned int low = 0;
+		unsigned int high = mameNameCount;
+		while(low < high)
+		{
+			const unsigned int mid = low + (high - low) / 2;
+			const int cmp = strcmp(from, mameNameToRealName[mid * 2]);
+			if(cmp == 0)
+				return mameNameToRealName[mid * 2 + 1];
 
-		while(*mameNames != NULL && strcmp(from, *mameNames) != 0)
-			mameNames += 2;
+			if(cmp < 0)
+				high = mid;
+			else
+				low = mid + 1;
+		}
 
-		if(*mameNames)
-			return *(mameNames + 1);
-		
 		return from;
 	}
 }
@@ -116,6 +116,10 @@ void SystemData::launchGame(Window* window, const FileData& game) const
 	command = strreplace(command, "%ROM_RAW%", rom_raw);
 
 	LOG(LogInfo) << "	" << command;
+
+	// the emulator might never give control back
+	SystemManager::getInstance()->database().flushWrites();
+
 	std::cout << "==============================================\n";
 	int exitCode = runSystemCommand(command);
 	std::cout << "==============================================\n";
@@ -139,8 +143,7 @@ void SystemData::launchGame(Window* window, const FileData& game) const
 	boost::posix_time::ptime time = boost::posix_time::second_clock::universal_time();
 	metadata.set("lastplayed", time);
 
-	game.set_metadata(metadata);
-
+	game.update_metadata(metadata, { MD_SLOT_PLAYCOUNT, MD_SLOT_LASTPLAYED });
 }
 
 std::string SystemData::getThemePath() const
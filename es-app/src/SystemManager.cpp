@@ -3,6 +3,7 @@
 #include "ESException.h"
 #include "SystemData.h"
 #include <fstream>
+#include <sstream>
 #include <pugixml/pugixml.hpp>
 #include "Settings.h"
 #include "views/ViewController.h"
@@ -59,6 +60,7 @@ void SystemManager::loadConfig()
 	for(auto it = mSystems.begin(); it != mSystems.end(); it++)
 		delete *it;
 	mSystems.clear();
+	mSystemsById.clear();
 
 	const fs::path configPath = getConfigPath(false);
 
@@ -81,6 +83,9 @@ void SystemManager::loadConfig()
 	if(!systemList)
 		throw ESException() << "es_systems.cfg is missing the <systemList> tag!";
 
+	// systems that have nothing in the database yet
+	std::vector<SystemData*> needScan;
+
 	// load each system in the config file
 	for(pugi::xml_node system = systemList.child("system"); system; system = system.next_sibling("system"))
 	{
@@ -143,26 +148,42 @@ void SystemManager::loadConfig()
 		if(path.empty())
 			platformIds.push_back(PlatformIds::PLATFORM_IGNORE);
 
+		mDatabase.addSystem(name); // before anything asks the database about it
 		SystemData* newSys = new SystemData(name, fullname, path, extensions, cmd, platformIds, themeFolder, filter);
 
 		if(newSys->getGameCount() == 0)
 		{
 			LOG(LogWarning) << "System \"" << name << "\" has no games! Running file system scan.";
-			mDatabase.addMissingFiles(newSys);
-			if(newSys->getGameCount() == 0)
+			needScan.push_back(newSys);
+		}
+
+		mSystems.push_back(newSys);
+	}
+
+	if(!needScan.empty())
+	{
+		// scan every empty system in one go so the walk can run in parallel across systems
+		// (not trusting the snapshots: whatever they remember isn't in the database)
+		mDatabase.addMissingFiles(needScan, false);
+		for(auto it = needScan.begin(); it != needScan.end(); it++)
+		{
+			if((*it)->getGameCount() == 0)
 			{
-				LOG(LogWarning) << "System \"" << name << "\" still has no games! Ignoring it.";
-			
-				delete newSys;
-			}else{
-				mSystems.push_back(newSys);
-			}
+				LOG(LogWarning) << "System \"" << (*it)->getName() << "\" still has no games! Ignoring it.";
 
-		}else{
-			mSystems.push_back(newSys);
+				mSystems.erase(std::find(mSystems.begin(), mSystems.end(), *it));
+				delete *it;
+			}
 		}
 	}
 
+	for(auto it = mSystems.begin(); it != mSystems.end(); it++)
+	{
+		const int id = mDatabase.getSystemId(*it);
+		if(id >= (int)mSystemsById.size())
+			mSystemsById.resize(id + 1, NULL);
+		mSystemsById[id] = *it;
+	}
 }
 
 void SystemManager::writeExampleConfig(const fs::path& path)
@@ -207,7 +228,9 @@ void SystemManager::writeExampleConfig(const fs::path& path)
 		"		<!-- The extra constraints a file must satisfy to be shown.\n"
 		"		This tag is optional, and defaults to showing all files in the system.\n"
 		"		If the system has no path, extension, and command, and it has a non-empty filter string,\n"
-		"		then this system can show results from all systems. -->\n"
+		"		then this system can show results from all systems.\n"
+		"		It's an SQL condition, or \"search:\" followed by a full text search (e.g. search:zelda OR metroid).\n"
+		"		In SQL, systemid is a number: use systemid IN (SELECT id FROM systems WHERE name = 'nes') to match a system by name. -->\n"
 		"		<filter></filter>\n"
 		"	</system>\n"
 		"</systemList>\n";
@@ -262,6 +285,14 @@ bool SystemManager::isValidSystemName(const std::string& name)
 	return true;
 }
 
+SystemData* SystemManager::getSystemById(int id) const
+{
+	if(id < 0 || id >= (int)mSystemsById.size())
+		return NULL;
+
+	return mSystemsById[id];
+}
+
 SystemData* SystemManager::getSystemByName(const std::string& name) const
 {
 	for(auto it = mSystems.begin(); it != mSystems.end(); it++)
@@ -273,11 +304,9 @@ SystemData* SystemManager::getSystemByName(const std::string& name) const
 
 void SystemManager::updateDatabase()
 {
+	mDatabase.addMissingFiles(mSystems);
 	for(auto it = mSystems.begin(); it != mSystems.end(); it++)
-	{
-		mDatabase.addMissingFiles(*it);
 		mDatabase.updateExists(*it);
-	}
 }
 
 fs::path SystemManager::getGamelistXMLPath(const SystemData* sys, bool forWrite)
@@ -320,22 +349,61 @@ bool SystemManager::hasNewGamelistXML() const
 	return false;
 }
 
-void SystemManager::importGamelistXML(bool onlyNew)
+void SystemManager::importGamelistXML(bool onlyNew, Window* window)
 {
+	std::vector<SystemData*> systems;
+	std::vector< std::pair<const SystemData*, std::string> > gamelists;
 	for(auto it = mSystems.begin(); it != mSystems.end(); it++)
 	{
 		if(onlyNew && !hasNewGamelistXML(*it))
 			continue;
 
+		systems.push_back(*it);
+
 		boost::filesystem::path path = getGamelistXMLPath(*it, false);
 		if(boost::filesystem::exists(path))
-			database().importXML(*it, path.generic_string());
+			gamelists.push_back(std::make_pair(*it, path.generic_string()));
+	}
+
+	database().importXML(gamelists, [window] (const SystemData* system, int done, int total) {
+		if(window)
+		{
+			std::stringstream ss;
+			ss << "IMPORTING GAMELISTS (" << done << "/" << total << ")...";
+			window->renderLoadingScreen(ss.str());
+		}
+	});
 
+	for(auto it = systems.begin(); it != systems.end(); it++)
+	{
 		database().updateExists(*it);
 		ViewController::get()->onFilesChanged(*it);
 	}
 
+	if(window)
+		window->invalidate();
+
+	std::time_t now;
+	time(&now);
+	Settings::getInstance()->setTime("LastXMLImportTime", now);
+}
+
+void SystemManager::exportGamelistXML(Window* window)
+{
+	if(window)
+		window->renderLoadingScreen("EXPORTING GAMELISTS...");
+
+	std::vector< std::pair<const SystemData*, std::string> > gamelists;
+	for(auto it = mSystems.begin(); it != mSystems.end(); it++)
+		gamelists.push_back(std::make_pair(*it, getGamelistXMLPath(*it, true).generic_string()));
+
+	database().exportXML(gamelists);
+
+	// what we just wrote is already in the database, don't offer to import it again
 	std::time_t now;
 	time(&now);
 	Settings::getInstance()->setTime("LastXMLImportTime", now);
+
+	if(window)
+		window->invalidate();
 }
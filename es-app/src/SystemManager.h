@@ -6,6 +6,7 @@
 #include "GamelistDB.h"
 
 class SystemData;
+class Window;
 
 class SystemManager
 {
@@ -18,6 +19,7 @@ public:
 	inline const std::vector<SystemData*>& getSystems() const { return mSystems; }
 
 	SystemData* getSystemByName(const std::string& name) const;
+	SystemData* getSystemById(int id) const; // id from GamelistDB::getSystemId(), NULL if that system isn't loaded
 
 	// iterators
 	inline std::vector<SystemData*>::const_iterator getIterator(SystemData* system) const { return std::find(mSystems.begin(), mSystems.end(), system); };
@@ -35,13 +37,15 @@ public:
 	inline GamelistDB& database() { return mDatabase; }
 
 	bool hasNewGamelistXML() const;
-	void importGamelistXML(bool onlyNew);
+	void importGamelistXML(bool onlyNew, Window* window = NULL); // window is used to show progress, if set
+	void exportGamelistXML(Window* window = NULL); // writes every system's gamelist.xml from the database
 	static boost::filesystem::path getGamelistXMLPath(const SystemData* sys, bool forWrite);
 
 private:
 	static SystemManager* sInstance;
 	
 	std::vector<SystemData*> mSystems;
+	std::vector<SystemData*> mSystemsById; // indexed by database system ID
 	GamelistDB mDatabase;
 
 	static bool hasNewGamelistXML(const SystemData* sys);
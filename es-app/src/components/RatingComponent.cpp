@@ -28,6 +28,7 @@ void RatingComponent::setValue(const std::string& value)
 	mValueGiven = value;
 
 	updateVertices();
+	invalidate();
 }
 
 std::string RatingComponent::getValue() const
@@ -98,31 +99,11 @@ void RatingComponent::render(const Eigen::Affine3f& parentTrans)
 	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
 	Renderer::setMatrix(trans);
 
-	glEnable(GL_TEXTURE_2D);
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	GLubyte colors[6*4];
+	Renderer::buildGLColorArray(colors, 0xFFFFFF00 | getOpacity(), 6);
 
-	glColor4ub(255, 255, 255, getOpacity());
-
-	glEnableClientState(GL_VERTEX_ARRAY);
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-	
-	glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].pos);
-	glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].tex);
-	
-	mFilledTexture->bind();
-	glDrawArrays(GL_TRIANGLES, 0, 6);
-
-	mUnfilledTexture->bind();
-	glDrawArrays(GL_TRIANGLES, 6, 6);
-
-	glDisableClientState(GL_VERTEX_ARRAY);
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-	
-	glDisable(GL_TEXTURE_2D);
-	glDisable(GL_BLEND);
-
-	glColor4ub(255, 255, 255, 255);
+	Renderer::drawTriangles(&mVertices[0].pos, &mVertices[0].tex, sizeof(Vertex), colors, 6, mFilledTexture->getTextureID());
+	Renderer::drawTriangles(&mVertices[6].pos, &mVertices[6].tex, sizeof(Vertex), colors, 6, mUnfilledTexture->getTextureID());
 
 	renderChildren(trans);
 }
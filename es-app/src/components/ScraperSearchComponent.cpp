@@ -14,6 +14,9 @@
 #include "Util.h"
 #include "guis/GuiTextEditPopup.h"
 
+// how often to check on running scraper requests while nothing else is happening
+#define REQUEST_POLL_MS 50
+
 ScraperSearchComponent::ScraperSearchComponent(Window* window, SearchType type) : GuiComponent(window),
 	mGrid(window, Eigen::Vector2i(4, 3)), mBusyAnim(window), 
 	mSearchType(type), mLastSearch(NULL, FileData("", NULL, (FileType)0))
@@ -385,6 +388,10 @@ void ScraperSearchComponent::update(int deltaTime)
 		mBusyAnim.update(deltaTime);
 	}
 
+	// keep checking on requests that are still running
+	if(mThumbnailReq || mSearchHandle || mMDResolveHandle)
+		scheduleUpdate(REQUEST_POLL_MS);
+
 	if(mThumbnailReq && mThumbnailReq->status() != HttpReq::REQ_IN_PROGRESS)
 	{
 		updateThumbnail();
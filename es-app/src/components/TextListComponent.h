@@ -25,6 +25,7 @@ class TextListComponent : public IList<TextListData, T>
 {
 protected:
 	using IList<TextListData, T>::mEntries;
+	using IList<TextListData, T>::getEntry;
 	using IList<TextListData, T>::listUpdate;
 	using IList<TextListData, T>::listInput;
 	using IList<TextListData, T>::listRenderTitleOverlay;
@@ -36,6 +37,8 @@ protected:
 public:
 	using IList<TextListData, T>::size;
 	using IList<TextListData, T>::isScrolling;
+	using IList<TextListData, T>::invalidate;
+	using IList<TextListData, T>::scheduleUpdate;
 	using IList<TextListData, T>::stopScrolling;
 
 	TextListComponent(Window* window);
@@ -180,7 +183,7 @@ void TextListComponent<T>::render(const Eigen::Affine3f& parentTrans)
 
 	for(int i = startEntry; i < listCutoff; i++)
 	{
-		typename IList<TextListData, T>::Entry& entry = mEntries.at((unsigned int)i);
+		typename IList<TextListData, T>::Entry& entry = getEntry(i);
 
 		unsigned int color;
 		if(mCursor == i && mSelectedColor)
@@ -281,7 +284,7 @@ void TextListComponent<T>::update(int deltaTime)
 	if(!isScrolling() && size() > 0)
 	{
 		//if we're not scrolling and this object's text goes outside our size, marquee it!
-		const std::string& text = mEntries.at((unsigned int)mCursor).name;
+		const std::string& text = getEntry(mCursor).name;
 
 		Eigen::Vector2f textSize = mFont->sizeText(text);
 
@@ -293,7 +296,11 @@ void TextListComponent<T>::update(int deltaTime)
 			{
 				mMarqueeOffset += MARQUEE_RATE;
 				mMarqueeTime -= MARQUEE_SPEED;
+				invalidate();
 			}
+
+			// the marquee starts after a delay, then moves every MARQUEE_SPEED ms
+			scheduleUpdate(MARQUEE_SPEED - mMarqueeTime + 1);
 		}
 	}
 
@@ -46,10 +46,10 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 	mMenu.addWithLabel("SORT FOLDERS FIRST", mFoldersFirst);
 	if (system)
 	{
-
-/*
 		// jump to letter
-		char curChar = toupper(getGamelist()->getCursor().getName()[0]);
+		char curChar = 'A';
+		if(getGamelist()->validCursor() && !getGamelist()->getCursor().getName().empty())
+			curChar = toupper(getGamelist()->getCursor().getName()[0]);
 		if(curChar < 'A' || curChar > 'Z') // in the case of unicode characters, pretend it's an A
 			curChar = 'A';
 
@@ -72,8 +72,11 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 			return false;
 		};
 		mMenu.addRow(row);
-*/
 
+		// narrow the list down as a name is typed
+		addEntry("SEARCH BY NAME", 0x777777FF, true, std::bind(&GuiGamelistOptions::openNameSearch, this));
+		// list the best matches in the whole system for names, descriptions, developers etc.
+		addEntry("SEARCH EVERYTHING", 0x777777FF, true, std::bind(&GuiGamelistOptions::openFullTextSearch, this));
 
 		addEntry("EDIT", 0x777777FF, true,
 			[this] {
@@ -142,6 +145,7 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 			row.makeAcceptInputHandler([window] {
 				window->pushGui(new GuiMsgBox(window, "REALLY RESTART?", "YES", 
 				[] { 
+					SystemManager::getInstance()->database().flushWrites();
 					if(runRestartCommand() != 0)
 						LOG(LogWarning) << "Restart terminated with non-zero result!";
 				}, "NO", nullptr));
@@ -153,6 +157,7 @@ GuiGamelistOptions::GuiGamelistOptions(Window* window, SystemData* system) : Gui
 			row.makeAcceptInputHandler([window] {
 				window->pushGui(new GuiMsgBox(window, "REALLY SHUTDOWN?", "YES", 
 				[] { 
+					SystemManager::getInstance()->database().flushWrites();
 					if(runShutdownCommand() != 0)
 						LOG(LogWarning) << "Shutdown terminated with non-zero result!";
 				}, "NO", nullptr));
@@ -266,40 +271,33 @@ void GuiGamelistOptions::openFilterAdd(const FileData& fileParent, const std::st
 void GuiGamelistOptions::jumpToLetter()
 {
 	char letter = mJumpToLetterList->getSelected();
-	IGameListView* gamelist = getGamelist();
 
-	// this is a really shitty way to get a list of files
-	// TODO
-	/*
-	const std::vector<FileData>& files = gamelist->getCursor()->getParent()->getChildren();
-	
-	long min = 0;
-	long max = files.size() - 1;
-	long mid = 0;
+	// the database has an index on names, so this works for any sort and doesn't need the list loaded
+	getGamelist()->jumpToNamePrefix(std::string(1, letter));
 
-	while(max >= min)
-	{
-		mid = ((max - min) / 2) + min;
-
-		// game somehow has no first character to check
-		const std::string& name = files.at(mid).getName();
-		if(name.empty())
-			continue;
+	delete this;
+}
 
-		char checkLetter = toupper(name[0]);
+void GuiGamelistOptions::openNameSearch()
+{
+	IGameListView* gamelist = getGamelist();
+	const std::string oldPrefix = gamelist->getNamePrefix();
 
-		if(checkLetter < letter)
-			min = mid + 1;
-		else if(checkLetter > letter)
-			max = mid - 1;
-		else
-			break; //exact match found
-	}
+	auto popup = new GuiTextEditPopup(mWindow, "SEARCH", oldPrefix, [this](const std::string& prefix) { delete this; }, false);
+	popup->setTextChangedCallback([gamelist](const std::string& prefix) { gamelist->setNamePrefix(prefix); });
+	popup->setCancelCallback([gamelist, oldPrefix] { gamelist->setNamePrefix(oldPrefix); });
+	mWindow->pushGui(popup);
+}
 
-	gamelist->setCursor(files.at(mid));
-	*/
+void GuiGamelistOptions::openFullTextSearch()
+{
+	IGameListView* gamelist = getGamelist();
+	const std::string oldText = gamelist->getSearchText();
 
-	delete this;
+	auto popup = new GuiTextEditPopup(mWindow, "SEARCH EVERYTHING", oldText, [this](const std::string& text) { delete this; }, false);
+	popup->setTextChangedCallback([gamelist](const std::string& text) { gamelist->setSearchText(text); });
+	popup->setCancelCallback([gamelist, oldText] { gamelist->setSearchText(oldText); });
+	mWindow->pushGui(popup);
 }
 
 bool GuiGamelistOptions::input(InputConfig* config, Input input)
@@ -23,6 +23,8 @@ private:
 	void openFilterAddStart();
 	void openFilterAdd(const FileData& file, const std::string &filterid);
 	void jumpToLetter();
+	void openNameSearch();
+	void openFullTextSearch();
 	
 	MenuComponent mMenu;
 
@@ -43,7 +43,7 @@ GuiMenu::GuiMenu(Window* window) : GuiComponent(window), mMenu(window, "SETTINGS
 	};
 
 	auto importXMLAndClose = [this] {
-		SystemManager::getInstance()->importGamelistXML(false);
+		SystemManager::getInstance()->importGamelistXML(false, mWindow);
 
 		Window* windowCopy = this->mWindow;
 		while(windowCopy->peekGui() != ViewController::get())
@@ -113,6 +113,14 @@ GuiMenu::GuiMenu(Window* window) : GuiComponent(window), mMenu(window, "SETTINGS
 			row.addElement(import_xml, true);
 			s->addRow(row);
 
+			// export XML
+			row.elements.clear();
+			row.makeAcceptInputHandler([this] { SystemManager::getInstance()->exportGamelistXML(mWindow); });
+
+			auto export_xml = std::make_shared<TextComponent>(mWindow, "EXPORT TO XML", Font::get(FONT_SIZE_MEDIUM), 0x777777FF);
+			row.addElement(export_xml, true);
+			s->addRow(row);
+
 			mWindow->pushGui(s);
 	});
 
@@ -155,6 +163,12 @@ GuiMenu::GuiMenu(Window* window) : GuiComponent(window), mMenu(window, "SETTINGS
 			s->addWithLabel("SHOW FRAMERATE", framerate);
 			s->addSaveFunc([framerate] { Settings::getInstance()->setBool("DrawFramerate", framerate->getState()); });
 
+			// texture memory budget
+			auto max_vram = std::make_shared<SliderComponent>(mWindow, 0.f, 1000.f, 10.f, "Mb");
+			max_vram->setValue((float)(Settings::getInstance()->getInt("MaxVRAM")));
+			s->addWithLabel("VRAM LIMIT", max_vram);
+			s->addSaveFunc([max_vram] { Settings::getInstance()->setInt("MaxVRAM", (int)round(max_vram->getValue())); });
+
 			// show help
 			auto show_help = std::make_shared<SwitchComponent>(mWindow);
 			show_help->setState(Settings::getInstance()->getBool("ShowHelpPrompts"));
@@ -189,6 +189,7 @@ void GuiMetaDataEd::save()
 	}
 
 	mFile.set_metadata(mMetaData);
+	SystemManager::getInstance()->database().flushWrites(); // the callback lists the files again
 
 	if(mSavedCallback)
 		mSavedCallback();
@@ -28,6 +28,11 @@ GuiRefreshDatabase::GuiRefreshDatabase(Window* window) : GuiComponent(window),
 	mAddFiles->setState(true);
 	mMenu.addWithLabel("Look for new files", mAddFiles);
 
+	//Folders that haven't changed since the last scan are normally skipped.
+	mFullRescan = std::make_shared<SwitchComponent>(mWindow);
+	mFullRescan->setState(false);
+	mMenu.addWithLabel("Rescan unchanged folders", mFullRescan);
+
 	//Mostly useful when Remove Nonexisting is enabled
 	mCheckExists = std::make_shared<SwitchComponent>(mWindow);
 	mCheckExists->setState(false);
@@ -61,6 +66,7 @@ void GuiRefreshDatabase::pressedStart()
 void GuiRefreshDatabase::start()
 {
 	bool addFiles = mAddFiles->getState();
+	bool fullRescan = mFullRescan->getState();
 	bool checkExists = mCheckExists->getState();
 	bool removeNonexisting = checkExists && mRemoveNonexisting->getState();
 	std::vector<SystemData*> systems = mSystems->getSelectedObjects();
@@ -72,9 +78,9 @@ void GuiRefreshDatabase::start()
 	}else{
 		auto databaseptr = &SystemManager::getInstance()->database();
 		int start = databaseptr->totalChanges();
+		if(addFiles) databaseptr->addMissingFiles(systems, !fullRescan);
 		for(auto sys = systems.begin(); sys != systems.end(); sys++)
 		{
-			if(addFiles) databaseptr->addMissingFiles(*sys);
 			if(checkExists) databaseptr->updateExists(*sys);
 			if(removeNonexisting) databaseptr->removeNonexisting(*sys);
 			ViewController::get()->getGameListView(*sys).get()->onFilesChanged();
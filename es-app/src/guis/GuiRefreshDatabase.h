@@ -28,6 +28,7 @@ private:
 
 	std::shared_ptr< OptionListComponent<SystemData*> > mSystems;
 	std::shared_ptr<SwitchComponent> mAddFiles;
+	std::shared_ptr<SwitchComponent> mFullRescan;
 	std::shared_ptr<SwitchComponent> mCheckExists;
 	std::shared_ptr<SwitchComponent> mRemoveNonexisting;
 
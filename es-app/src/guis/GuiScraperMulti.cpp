@@ -71,7 +71,8 @@ GuiScraperMulti::GuiScraperMulti(Window* window, const std::queue<ScraperSearchP
 
 GuiScraperMulti::~GuiScraperMulti()
 {
-	// view type probably changed (basic -> detailed)
+	// view type probably changed (basic -> detailed), which is decided from what's committed
+	SystemManager::getInstance()->database().flushWrites();
 	for(auto it = SystemManager::getInstance()->getSystems().begin(); it != SystemManager::getInstance()->getSystems().end(); it++)
 		ViewController::get()->reloadGameListView(*it, false);
 }
@@ -271,7 +271,7 @@ int main(int argc, char* argv[])
 			{
 				window.pushGui(new GuiMsgBox(&window,
 					"NEW GAMELIST.XML DATA FOUND. IMPORT NOW?",
-					"YES", [] { SystemManager::getInstance()->importGamelistXML(true); },
+					"YES", [&window] { SystemManager::getInstance()->importGamelistXML(true, &window); },
 					"NO", [] { 
 						// don't ask again
 						std::time_t now;
@@ -317,8 +317,9 @@ int main(int argc, char* argv[])
 
 		if(window.isSleeping())
 		{
+			// give up our CPU time until something wakes us up
+			SDL_WaitEvent(NULL);
 			lastTime = SDL_GetTicks();
-			SDL_Delay(1); // this doesn't need to be accurate, we're just giving up our CPU time until something wakes us up
 			continue;
 		}
 
@@ -331,8 +332,25 @@ int main(int argc, char* argv[])
 			deltaTime = 1000;
 
 		window.update(deltaTime);
-		window.render();
-		Renderer::swapBuffers();
+
+		if(window.isDirty())
+		{
+			window.render();
+			Renderer::swapBuffers();
+		}else{
+			// nothing changed, wait until there's input or something is due
+			SDL_WaitEventTimeout(NULL, window.getIdleTimeout());
+
+			// catch up on the time we waited now, so it doesn't get applied to whatever the input starts
+			curTime = SDL_GetTicks();
+			deltaTime = curTime - lastTime;
+			lastTime = curTime;
+			if(deltaTime > 1000 || deltaTime < 0)
+				deltaTime = 1000;
+
+			window.addIdleTime(deltaTime);
+			window.update(deltaTime);
+		}
 
 		Log::flush();
 	}
@@ -5,6 +5,118 @@
 #include "ThemeData.h"
 #include "SystemData.h"
 #include "Settings.h"
+#include "SystemManager.h"
+#include <algorithm>
+
+// same case folding as the database does for name prefixes (ASCII only)
+static bool hasNamePrefix(const std::string& name, const std::string& prefix)
+{
+	if(name.size() < prefix.size())
+		return false;
+
+	for(unsigned int i = 0; i < prefix.size(); i++)
+	{
+		if(tolower((unsigned char)name[i]) != tolower((unsigned char)prefix[i]))
+			return false;
+	}
+	return true;
+}
+
+// the most search results that are listed
+#define SEARCH_RESULT_LIMIT 500
+
+// Lists the children of a folder (or search results) straight from the database, a window at a time.
+// Only the row IDs of the whole list are kept in memory.
+class GameListDataSource : public IList<TextListData, FileData>::DataSource
+{
+public:
+	GameListDataSource(const FileData& folder, const std::string& namePrefix) 
+		: mSystem(folder.getSystem()), mFolder(folder), mRowIds(folder.getChildRowIds(NULL, namePrefix))
+	{
+		buildRowIndex();
+	}
+
+	GameListDataSource(SystemData* system, const std::string& searchText)
+		: mSystem(system), mRowIds(SystemManager::getInstance()->database().searchFiles(system, searchText, SEARCH_RESULT_LIMIT))
+	{
+		buildRowIndex();
+	}
+
+	void buildRowIndex()
+	{
+		mRowIndex.reserve(mRowIds.size());
+		for(unsigned int i = 0; i < mRowIds.size(); i++)
+			mRowIndex.push_back(std::make_pair(mRowIds[i], (int)i));
+		std::sort(mRowIndex.begin(), mRowIndex.end());
+	}
+
+	int size() override { return mRowIds.size(); }
+
+	void getEntries(int start, int count, std::vector<IList<TextListData, FileData>::Entry>& out) override
+	{
+		if(count <= 0)
+			return;
+
+		std::vector<FileData> files = SystemManager::getInstance()->database().getFilesByRowId(&mRowIds[start], count, mSystem);
+
+		IList<TextListData, FileData>::Entry entry;
+		for(auto it = files.begin(); it != files.end(); it++)
+		{
+			entry.name = it->getName();
+			entry.object = *it;
+			entry.data.colorId = (it->getType() == FOLDER || it->getType() == FILTER);
+			out.push_back(entry);
+		}
+	}
+
+	int indexOf(const FileData& file) override
+	{
+		sqlite3_int64 rowId = SystemManager::getInstance()->database().getFileRowId(file);
+		auto it = std::lower_bound(mRowIndex.begin(), mRowIndex.end(), std::make_pair(rowId, 0));
+		if(rowId == 0 || it == mRowIndex.end() || it->first != rowId)
+			return -1;
+		return it->second;
+	}
+
+	// index of the first file whose name starts with prefix, or -1
+	// (only looks at the matching rows, which the database finds with an index whatever the sort is)
+	int indexOfNamePrefix(const std::string& prefix)
+	{
+		if(!mFolder.getSystem())
+			return -1; // search results
+
+		std::vector<sqlite3_int64> matches = mFolder.getChildRowIds(NULL, prefix);
+
+		int first = -1;
+		for(auto match = matches.begin(); match != matches.end(); match++)
+		{
+			auto it = std::lower_bound(mRowIndex.begin(), mRowIndex.end(), std::make_pair(*match, 0));
+			if(it != mRowIndex.end() && it->first == *match && (first == -1 || it->second < first))
+				first = it->second;
+		}
+		return first;
+	}
+
+	// row ID of the entry at index (wraps around)
+	sqlite3_int64 getRowId(int index) const
+	{
+		index %= (int)mRowIds.size();
+		if(index < 0)
+			index += mRowIds.size();
+		return mRowIds.at(index);
+	}
+
+	FileData getFile(int index)
+	{
+		return SystemManager::getInstance()->database().getFilesByRowId(&mRowIds.at(index), 1, mSystem).at(0);
+	}
+
+private:
+	SystemData* mSystem;
+	FileData mFolder; // FileData() for search results
+	std::vector<sqlite3_int64> mRowIds;
+	std::vector< std::pair<sqlite3_int64, int> > mRowIndex; // sorted by row ID
+};
 
 BasicGameListView::BasicGameListView(Window* window, const FileData& root)
 	: ISimpleGameListView(window, root), mList(window)
@@ -13,7 +125,7 @@ BasicGameListView::BasicGameListView(Window* window, const FileData& root)
 	mList.setPosition(0, mSize.y() * 0.2f);
 	addChild(&mList);
 
-	populateList(mCursorStack.top().getChildren());
+	populateList(mCursorStack.top());
 }
 
 void BasicGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& theme)
@@ -35,18 +147,51 @@ void BasicGameListView::onMetaDataChanged(const FileData& file)
 	ViewController::get()->reloadGameListView(this);
 }
 
-void BasicGameListView::populateList(const std::vector<FileData>& files)
+void BasicGameListView::populateList(const FileData& folder)
 {
-	mList.clear();
+	if(!mSearchText.empty())
+		mHeaderText.setText(mRoot.getSystem()->getFullName() + ": " + mSearchText);
+	else if(!mNamePrefix.empty())
+		mHeaderText.setText(mRoot.getSystem()->getFullName() + ": " + mNamePrefix);
+	else
+		mHeaderText.setText(mRoot.getSystem()->getFullName());
+
+	if(!mSearchText.empty())
+	{
+		mDataSource = std::make_shared<GameListDataSource>(mRoot.getSystem(), mSearchText);
+		mList.setDataSource(mDataSource);
+		return;
+	}
+
+	if(folder.getType() != FILTER)
+	{
+		mDataSource = std::make_shared<GameListDataSource>(folder, mNamePrefix);
+		mList.setDataSource(mDataSource);
+		return;
+	}
 
-	mHeaderText.setText(mRoot.getSystem()->getFullName());
+	// filter results aren't a plain folder query, these still get loaded up front
+	mDataSource.reset();
+	mList.clear();
 
+	const std::vector<FileData> files = folder.getChildren();
 	for(auto it = files.begin(); it != files.end(); it++)
 	{
-		mList.add(it->getName(), *it, (it->getType() == FOLDER || it->getType() == FILTER));
+		if(hasNamePrefix(it->getName(), mNamePrefix))
+			mList.add(it->getName(), *it, (it->getType() == FOLDER || it->getType() == FILTER));
 	}
 }
 
+bool BasicGameListView::getRowIdsAhead(int count, int dir, std::vector<sqlite3_int64>& out)
+{
+	if(!mDataSource || mList.size() == 0)
+		return false;
+
+	for(int i = 1; i <= count; i++)
+		out.push_back(mDataSource->getRowId(mList.getCursorIndex() + i * dir));
+	return true;
+}
+
 const FileData& BasicGameListView::getCursor()
 {
 	return mList.getSelected();
@@ -75,6 +220,31 @@ void BasicGameListView::setCursor(const FileData& cursor)
 	}
 }
 
+bool BasicGameListView::jumpToNamePrefix(const std::string& prefix)
+{
+	if(mDataSource)
+	{
+		int index = mDataSource->indexOfNamePrefix(prefix);
+		if(index < 0)
+			return false;
+
+		setCursor(mDataSource->getFile(index));
+		return true;
+	}
+
+	// a filter, the list is small enough to just look through it
+	const std::vector<FileData> files = mCursorStack.top().getChildren();
+	for(auto it = files.begin(); it != files.end(); it++)
+	{
+		if(hasNamePrefix(it->getName(), mNamePrefix) && hasNamePrefix(it->getName(), prefix))
+		{
+			setCursor(*it);
+			return true;
+		}
+	}
+	return false;
+}
+
 void BasicGameListView::launch(const FileData& game)
 {
 	ViewController::get()->launch(game);
@@ -3,6 +3,8 @@
 #include "views/gamelist/ISimpleGameListView.h"
 #include "components/TextListComponent.h"
 
+class GameListDataSource;
+
 class BasicGameListView : public ISimpleGameListView
 {
 public:
@@ -21,14 +23,20 @@ public:
 	virtual const bool validCursor() override;
 	virtual const bool validParentCursor() override;
 	virtual void setCursor(const FileData& file) override;
+	virtual bool jumpToNamePrefix(const std::string& prefix) override;
 
 	virtual const char* getName() const override { return "basic"; }
 
 	virtual std::vector<HelpPrompt> getHelpPrompts() override;
 
 protected:
-	virtual void populateList(const std::vector<FileData>& files) override;
+	virtual void populateList(const FileData& folder) override;
 	virtual void launch(const FileData& game) override;
 
+	// Appends the database row IDs of the count entries after the cursor in direction dir (wrapping around),
+	// without loading them.  Returns false if the list isn't backed by a data source (filters).
+	bool getRowIdsAhead(int count, int dir, std::vector<sqlite3_int64>& out);
+
 	TextListComponent<FileData> mList;
+	std::shared_ptr<GameListDataSource> mDataSource; // what mList is showing, NULL for filters
 };
@@ -1,8 +1,23 @@
 #include "views/gamelist/DetailedGameListView.h"
 #include "views/ViewController.h"
 #include "Window.h"
+#include "SystemManager.h"
+#include "Log.h"
+#include "ThreadPool.h"
 #include "animations/LambdaAnimation.h"
 
+// number of images ahead of the cursor to load in the background, per scroll tier
+#define PREFETCH_COUNT 2
+// how often update() checks whether the images to prefetch have been looked up
+#define PREFETCH_POLL_MS 10
+
+// one thread looks up images to prefetch for every view, there's one view per system
+static ThreadPool& getPrefetchPool()
+{
+	static ThreadPool pool(1);
+	return pool;
+}
+
 DetailedGameListView::DetailedGameListView(Window* window, const FileData& root) : 
 	BasicGameListView(window, root), 
 	mDescContainer(window), mDescription(window), 
@@ -12,7 +27,9 @@ DetailedGameListView::DetailedGameListView(Window* window, const FileData& root)
 	mLblGenre(window), mLblPlayers(window), mLblLastPlayed(window), mLblPlayCount(window),
 
 	mRating(window), mReleaseDate(window), mDeveloper(window), mPublisher(window), 
-	mGenre(window), mPlayers(window), mLastPlayed(window), mPlayCount(window)
+	mGenre(window), mPlayers(window), mLastPlayed(window), mPlayCount(window), 
+
+	mPrefetchResult(std::make_shared<PrefetchResult>()), mPrefetchPending(false)
 {
 	//mHeaderImage.setPosition(mSize.x() * 0.25f, 0);
 
@@ -21,7 +38,7 @@ DetailedGameListView::DetailedGameListView(Window* window, const FileData& root)
 	mList.setPosition(mSize.x() * (0.50f + padding), mList.getPosition().y());
 	mList.setSize(mSize.x() * (0.50f - padding), mList.getSize().y());
 	mList.setAlignment(TextListComponent<FileData>::ALIGN_LEFT);
-	mList.setCursorChangedCallback([&](const CursorState& state) { updateInfoPanel(); });
+	mList.setCursorChangedCallback([&](const CursorState& state) { updateInfoPanel(); prefetchImages(); });
 
 	// image
 	mImage.setOrigin(0.5f, 0.5f);
@@ -70,6 +87,16 @@ DetailedGameListView::DetailedGameListView(Window* window, const FileData& root)
 	updateInfoPanel();
 }
 
+DetailedGameListView::~DetailedGameListView()
+{
+	// drop our queued lookups and wait out a running one, the pool outlives us
+	{
+		std::lock_guard<std::mutex> lock(mPrefetchResult->mutex);
+		mPrefetchResult->requested++;
+	}
+	getPrefetchPool().wait();
+}
+
 void DetailedGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& theme)
 {
 	BasicGameListView::onThemeChanged(theme);
@@ -176,6 +203,107 @@ void DetailedGameListView::initMDValues()
 	mDescContainer.setSize(mDescContainer.getSize().x(), mSize.y() - mDescContainer.getPosition().y());
 }
 
+// Starts loading the images of the next few entries in the direction we're scrolling, so they're
+// (hopefully) ready by the time the cursor gets there.  The faster we scroll, the further we look ahead.
+// Requests from before a change of direction are dropped, which cancels them if they're still loading.
+// The image paths are looked up on the prefetch thread (one query, plus checking the files exist), so moving
+// the cursor doesn't wait for the database; update() starts the loads once they're known.
+void DetailedGameListView::prefetchImages()
+{
+	const int count = std::min(PREFETCH_COUNT * (mList.getScrollTier() + 1), mList.size() - 1);
+	const int dir = mList.getScrollDirection();
+
+	int request;
+	{
+		std::lock_guard<std::mutex> lock(mPrefetchResult->mutex);
+		request = ++mPrefetchResult->requested;
+	}
+
+	std::vector<sqlite3_int64> rowIds;
+	if(!getRowIdsAhead(count, dir, rowIds))
+	{
+		// filter results are all in memory (and keep their metadata once it's read), no need for the thread
+		std::vector< std::shared_ptr<TextureResource> > prefetched;
+		const Eigen::Vector2i maxSize = mImage.getTextureMaxSize();
+		for(int i = 1; i <= count; i++)
+		{
+			const std::string image = mList.getRelative(i * dir).get_metadata().get(MD_SLOT_IMAGE);
+			if(!image.empty() && ResourceManager::getInstance()->fileExists(image))
+				prefetched.push_back(TextureResource::get(image, false, true, maxSize));
+		}
+
+		mPrefetched.swap(prefetched);
+		mPrefetchPending = false;
+		return;
+	}
+
+	mPrefetchPending = true;
+
+	std::shared_ptr<PrefetchResult> result = mPrefetchResult;
+	getPrefetchPool().queueWorkItem([result, request, rowIds] {
+		{
+			std::lock_guard<std::mutex> lock(result->mutex);
+			if(request != result->requested)
+				return; // the cursor moved on already
+		}
+
+		std::vector<std::string> images;
+		try
+		{
+			images = SystemManager::getInstance()->database().getImagePaths(rowIds);
+		}catch(std::exception& e)
+		{
+			LOG(LogWarning) << "Could not look up images to prefetch: " << e.what();
+		}
+
+		for(auto it = images.begin(); it != images.end(); it++)
+		{
+			if(!it->empty() && !ResourceManager::getInstance()->fileExists(*it))
+				it->clear();
+		}
+
+		std::lock_guard<std::mutex> lock(result->mutex);
+		if(request != result->requested)
+			return;
+
+		result->finished = request;
+		result->images.swap(images);
+	});
+
+	scheduleUpdate(PREFETCH_POLL_MS);
+}
+
+void DetailedGameListView::update(int deltaTime)
+{
+	BasicGameListView::update(deltaTime);
+
+	if(!mPrefetchPending)
+		return;
+
+	std::vector<std::string> images;
+	{
+		std::lock_guard<std::mutex> lock(mPrefetchResult->mutex);
+		if(mPrefetchResult->finished != mPrefetchResult->requested)
+		{
+			scheduleUpdate(PREFETCH_POLL_MS);
+			return;
+		}
+
+		images.swap(mPrefetchResult->images);
+	}
+	mPrefetchPending = false;
+
+	std::vector< std::shared_ptr<TextureResource> > prefetched;
+	const Eigen::Vector2i maxSize = mImage.getTextureMaxSize();
+	for(auto it = images.begin(); it != images.end(); it++)
+	{
+		if(!it->empty())
+			prefetched.push_back(TextureResource::get(*it, false, true, maxSize));
+	}
+
+	mPrefetched.swap(prefetched);
+}
+
 void DetailedGameListView::updateInfoPanel()
 {
 	const FileData* file = (mList.size() == 0 || mList.isScrolling()) ? NULL : &mList.getSelected();
@@ -187,23 +315,23 @@ void DetailedGameListView::updateInfoPanel()
 		//mDescription.setText("");
 		fadingOut = true;
 	}else{
-		MetaDataMap metadata = file->get_metadata();
+		const MetaDataMap metadata = file->get_metadata();
 
-		mImage.setImage(metadata.get("image"));
-		mDescription.setText(metadata.get("desc"));
+		mImage.setImage(metadata.get(MD_SLOT_IMAGE), false, true);
+		mDescription.setText(metadata.get(MD_SLOT_DESC));
 		mDescContainer.reset();
 
 		if(file->getType() == GAME)
 		{
 			mLastPlayed.setDisplayMode(DateTimeComponent::DISP_RELATIVE_TO_NOW);
-			mRating.setValue(metadata.get("rating"));
-			mReleaseDate.setValue(metadata.get("releasedate"));
-			mDeveloper.setValue(metadata.get("developer"));
-			mPublisher.setValue(metadata.get("publisher"));
-			mGenre.setValue(metadata.get("genre"));
-			mPlayers.setValue(metadata.get("players"));
-			mLastPlayed.setValue(metadata.get("lastplayed"));
-			mPlayCount.setValue(metadata.get("playcount"));
+			mRating.setValue(metadata.get(MD_SLOT_RATING));
+			mReleaseDate.setValue(metadata.get(MD_SLOT_RELEASEDATE));
+			mDeveloper.setValue(metadata.get(MD_SLOT_DEVELOPER));
+			mPublisher.setValue(metadata.get(MD_SLOT_PUBLISHER));
+			mGenre.setValue(metadata.get(MD_SLOT_GENRE));
+			mPlayers.setValue(metadata.get(MD_SLOT_PLAYERS));
+			mLastPlayed.setValue(metadata.get(MD_SLOT_LASTPLAYED));
+			mPlayCount.setValue(metadata.get(MD_SLOT_PLAYCOUNT));
 		}else{
 			mLastPlayed.setDisplayMode(DateTimeComponent::DISP_DATE_TIME);
 			mRating.setValue("");
@@ -271,9 +399,9 @@ void DetailedGameListView::onStatisticsChanged(const FileData& file)
 	updateInfoPanel();
 }
 
-void DetailedGameListView::populateList(const std::vector<FileData>& files)
+void DetailedGameListView::populateList(const FileData& folder)
 {
-	BasicGameListView::populateList(files);
+	BasicGameListView::populateList(folder);
 	updateInfoPanel();
 }
 std::vector<TextComponent*> DetailedGameListView::getMDLabels()
@@ -4,11 +4,13 @@
 #include "components/ScrollableContainer.h"
 #include "components/RatingComponent.h"
 #include "components/DateTimeComponent.h"
+#include <mutex>
 
 class DetailedGameListView : public BasicGameListView
 {
 public:
 	DetailedGameListView(Window* window, const FileData& root);
+	virtual ~DetailedGameListView();
 
 	virtual void onThemeChanged(const std::shared_ptr<ThemeData>& theme) override;
 
@@ -16,19 +18,34 @@ public:
 	virtual void onMetaDataChanged(const FileData& file) override;
 	virtual void onStatisticsChanged(const FileData& file) override;
 
+	virtual void update(int deltaTime) override;
+
 	virtual const char* getName() const override { return "detailed"; }
 
 protected:
 	virtual void launch(const FileData& game) override;
-	virtual void populateList(const std::vector<FileData>& files) override;
+	virtual void populateList(const FileData& folder) override;
 
 private:
 	void updateInfoPanel();
+	void prefetchImages();
 
 	void initMDLabels();
 	void initMDValues();
 
 	ImageComponent mImage;
+	std::vector< std::shared_ptr<TextureResource> > mPrefetched; // images of the entries we're scrolling towards
+
+	// image paths looked up on the prefetch thread, picked up by update()
+	struct PrefetchResult
+	{
+		std::mutex mutex;
+		int requested = 0; // newest lookup, older ones are dropped
+		int finished = -1; // lookup that images belongs to
+		std::vector<std::string> images;
+	};
+	std::shared_ptr<PrefetchResult> mPrefetchResult;
+	bool mPrefetchPending;
 
 	TextComponent mLblRating, mLblReleaseDate, mLblDeveloper, mLblPublisher, mLblGenre, mLblPlayers, mLblLastPlayed, mLblPlayCount;
 
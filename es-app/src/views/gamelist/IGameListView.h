@@ -33,6 +33,18 @@ public:
 	virtual const bool validParentCursor() = 0;
 	virtual void setCursor(const FileData& file) = 0;
 
+	// Moves the cursor to the first file in the current folder (in the current sort order) whose name
+	// starts with prefix, ignoring case.  Returns false if there is none.
+	virtual bool jumpToNamePrefix(const std::string& prefix) = 0;
+	// Only lists the files in the current folder whose name starts with prefix, "" lists all of them again.
+	// Cleared when the folder changes.
+	virtual void setNamePrefix(const std::string& prefix) = 0;
+	virtual const std::string& getNamePrefix() const = 0;
+	// Lists the best matches for text in the whole system instead of the current folder (see GamelistDB::searchFiles),
+	// "" goes back to the folder.
+	virtual void setSearchText(const std::string& text) = 0;
+	virtual const std::string& getSearchText() const = 0;
+
 	virtual bool input(InputConfig* config, Input input) override;
 
 	virtual const char* getName() const = 0;
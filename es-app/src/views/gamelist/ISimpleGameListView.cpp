@@ -48,13 +48,33 @@ void ISimpleGameListView::onThemeChanged(const std::shared_ptr<ThemeData>& theme
 // but this shouldn't happen very often so we'll just always repopulate
 void ISimpleGameListView::onFilesChanged()
 {
-        if(!validCursor()) { populateList(mCursorStack.top().getChildren()); return;};
+        if(!validCursor()) { populateList(mCursorStack.top()); return;};
 	FileData cursor = getCursor();
 	FileData parent = mCursorStack.top();
-	populateList(parent.getChildren());
+	populateList(parent);
 	setCursor(cursor);
 }
 
+void ISimpleGameListView::setNamePrefix(const std::string& prefix)
+{
+	if(prefix == mNamePrefix)
+		return;
+
+	mNamePrefix = prefix;
+	mSearchText.clear();
+	populateList(mCursorStack.top());
+}
+
+void ISimpleGameListView::setSearchText(const std::string& text)
+{
+	if(text == mSearchText)
+		return;
+
+	mSearchText = text;
+	mNamePrefix.clear();
+	populateList(mCursorStack.top());
+}
+
 void ISimpleGameListView::onMetaDataChanged(const FileData& file)
 {
 	onFilesChanged();
@@ -78,22 +98,32 @@ bool ISimpleGameListView::input(InputConfig* config, Input input)
 				launch(cursor);
 			}else{
 				// it's a folder or filter
-				auto children = cursor.getChildren();
-				//if(children.size() > 0)
-				//{
-					mCursorStack.push(cursor);
-					populateList(children);
-				//}
+				// (copy it first, populateList() replaces the entry it refers to)
+				FileData folder = cursor;
+				mCursorStack.push(folder);
+				mNamePrefix.clear();
+				mSearchText.clear();
+				populateList(folder);
 			}
 
 			return true;
 		}else if(config->isMappedTo("b", input))
 		{
-			if(mCursorStack.size() > 1)
+			if(!mSearchText.empty())
+			{
+				// leave the search first, search results aren't necessarily in this folder
+				setSearchText("");
+			}else if(!mNamePrefix.empty())
+			{
+				FileData old_cursor = validCursor() ? getCursor() : FileData();
+				setNamePrefix("");
+				if(old_cursor.getSystem())
+					setCursor(old_cursor);
+			}else if(mCursorStack.size() > 1)
 			{
 				FileData old_cursor = mCursorStack.top();
 				mCursorStack.pop();
-				populateList(mCursorStack.top().getChildren());
+				populateList(mCursorStack.top());
 				setCursor(old_cursor);
 				
 				Sound::getFromTheme(getTheme(), getName(), "back")->play();
@@ -21,10 +21,15 @@ public:
 	virtual const FileData& getCursor() = 0;
 	virtual void setCursor(const FileData& file) = 0;
 
+	virtual void setNamePrefix(const std::string& prefix) override;
+	virtual const std::string& getNamePrefix() const override { return mNamePrefix; }
+	virtual void setSearchText(const std::string& text) override;
+	virtual const std::string& getSearchText() const override { return mSearchText; }
+
 	virtual bool input(InputConfig* config, Input input) override;
 
 protected:
-	virtual void populateList(const std::vector<FileData>& files) = 0;
+	virtual void populateList(const FileData& folder) = 0;
 	virtual void launch(const FileData& game) = 0;
 
 	TextComponent mHeaderText;
@@ -32,4 +37,7 @@ protected:
 	ImageComponent mBackground;
 	
 	ThemeExtras mThemeExtras;
+
+	std::string mNamePrefix; // see setNamePrefix(), populateList() has to honor it
+	std::string mSearchText; // see setSearchText(), same
 };
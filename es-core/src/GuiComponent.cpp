@@ -39,7 +39,10 @@ bool GuiComponent::input(InputConfig* config, Input input)
 void GuiComponent::updateSelf(int deltaTime)
 {
 	for(unsigned char i = 0; i < MAX_ANIMATIONS; i++)
-		advanceAnimation(i, deltaTime);
+	{
+		if(advanceAnimation(i, deltaTime))
+			invalidate(); // animations change something every frame
+	}
 }
 
 void GuiComponent::updateChildren(int deltaTime)
@@ -78,12 +81,14 @@ Eigen::Vector3f GuiComponent::getPosition() const
 void GuiComponent::setPosition(const Eigen::Vector3f& offset)
 {
 	mPosition = offset;
+	invalidate();
 	onPositionChanged();
 }
 
 void GuiComponent::setPosition(float x, float y, float z)
 {
 	mPosition << x, y, z;
+	invalidate();
 	onPositionChanged();
 }
 
@@ -95,12 +100,14 @@ Eigen::Vector2f GuiComponent::getSize() const
 void GuiComponent::setSize(const Eigen::Vector2f& size)
 {
     mSize = size;
+    invalidate();
     onSizeChanged();
 }
 
 void GuiComponent::setSize(float w, float h)
 {
 	mSize << w, h;
+    invalidate();
     onSizeChanged();
 }
 
@@ -169,6 +176,9 @@ unsigned char GuiComponent::getOpacity() const
 
 void GuiComponent::setOpacity(unsigned char opacity)
 {
+	if(mOpacity != opacity)
+		invalidate();
+
 	mOpacity = opacity;
 	for(auto it = mChildren.begin(); it != mChildren.end(); it++)
 	{
@@ -209,6 +219,8 @@ void GuiComponent::setAnimation(Animation* anim, int delay, std::function<void()
 
 	if(oldAnim)
 		delete oldAnim;
+
+	invalidate();
 }
 
 bool GuiComponent::stopAnimation(unsigned char slot)
@@ -335,6 +347,16 @@ void GuiComponent::updateHelpPrompts()
 		mWindow->setHelpPrompts(prompts, getHelpStyle());
 }
 
+void GuiComponent::invalidate()
+{
+	mWindow->invalidate();
+}
+
+void GuiComponent::scheduleUpdate(int ms)
+{
+	mWindow->scheduleUpdate(ms);
+}
+
 HelpStyle GuiComponent::getHelpStyle()
 {
 	return HelpStyle();
@@ -97,6 +97,12 @@ public:
 
 	// Called whenever help prompts change.
 	void updateHelpPrompts();
+
+	// The window only redraws when something changed.  Call this whenever something about us that's visible changes
+	// outside of input handling (input always causes a redraw), e.g. in update().
+	void invalidate();
+	// Asks for update() to be called within ms milliseconds even if nothing changes (e.g. for a timer that's running).
+	void scheduleUpdate(int ms);
 	
 	virtual HelpStyle getHelpStyle();
 
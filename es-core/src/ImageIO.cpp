@@ -1,13 +1,88 @@
 #include "ImageIO.h"
 
 #include <memory.h>
+#include <algorithm>
 
 #include "Log.h"
 
+// IMAGEIO_NO_SIMD leaves only the plain loops (benchmarks/ builds it both ways)
+#if defined(IMAGEIO_NO_SIMD)
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define IMAGEIO_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define IMAGEIO_NEON
+#endif
 
-std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height)
+void ImageIO::swizzleRedBlue(const unsigned char* src, unsigned char* dst, size_t count)
+{
+	size_t i = 0;
+#if defined(IMAGEIO_SSE2)
+	// SSE2 has no byte shuffle, but within each 32-bit pixel B and R are just 16 bits apart
+	const __m128i maskGA = _mm_set1_epi32(0xFF00FF00);
+	const __m128i maskRB = _mm_set1_epi32(0x00FF00FF);
+	for(; i + 4 <= count; i += 4)
+	{
+		const __m128i px = _mm_loadu_si128((const __m128i*)(src + i * 4));
+		const __m128i rb = _mm_and_si128(px, maskRB);
+		const __m128i swapped = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+		_mm_storeu_si128((__m128i*)(dst + i * 4), _mm_or_si128(_mm_and_si128(px, maskGA), _mm_and_si128(swapped, maskRB)));
+	}
+#elif defined(IMAGEIO_NEON)
+	for(; i + 16 <= count; i += 16)
+	{
+		uint8x16x4_t px = vld4q_u8(src + i * 4);
+		const uint8x16_t b = px.val[0];
+		px.val[0] = px.val[2];
+		px.val[2] = b;
+		vst4q_u8(dst + i * 4, px);
+	}
+#endif
+	for(; i < count; i++)
+	{
+		const unsigned char b = src[i * 4 + 0];
+		dst[i * 4 + 0] = src[i * 4 + 2];
+		dst[i * 4 + 1] = src[i * 4 + 1];
+		dst[i * 4 + 2] = b;
+		dst[i * 4 + 3] = src[i * 4 + 3];
+	}
+}
+
+// swaps the contents of two non-overlapping rows of length bytes
+static void swapRows(unsigned char* a, unsigned char* b, size_t length)
+{
+	size_t i = 0;
+#if defined(IMAGEIO_SSE2)
+	for(; i + 16 <= length; i += 16)
+	{
+		const __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+		const __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+		_mm_storeu_si128((__m128i*)(a + i), vb);
+		_mm_storeu_si128((__m128i*)(b + i), va);
+	}
+#elif defined(IMAGEIO_NEON)
+	for(; i + 16 <= length; i += 16)
+	{
+		const uint8x16_t va = vld1q_u8(a + i);
+		const uint8x16_t vb = vld1q_u8(b + i);
+		vst1q_u8(a + i, vb);
+		vst1q_u8(b + i, va);
+	}
+#endif
+	for(; i < length; i++)
+	{
+		const unsigned char temp = a[i];
+		a[i] = b[i];
+		b[i] = temp;
+	}
+}
+
+std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height, size_t maxWidth, size_t maxHeight, bool * scaled)
 {
 	std::vector<unsigned char> rawData;
+	if (scaled != nullptr)
+		*scaled = false;
 	width = 0;
 	height = 0;
 	FIMEMORY * fiMemory = FreeImage_OpenMemory((BYTE *)data, size);
@@ -32,34 +107,43 @@ std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * d
 						fiBitmap = fiConverted;
 					}
 				}
+				//scale it down if it's bigger than it needs to be
+				if (fiBitmap != nullptr && (maxWidth || maxHeight))
+				{
+					const size_t srcWidth = FreeImage_GetWidth(fiBitmap);
+					const size_t srcHeight = FreeImage_GetHeight(fiBitmap);
+					float scale = 1.0f;
+					if (maxWidth && srcWidth > maxWidth)
+						scale = (float)maxWidth / srcWidth;
+					if (maxHeight && srcHeight > maxHeight)
+						scale = std::min(scale, (float)maxHeight / srcHeight);
+
+					if (scale < 1.0f)
+					{
+						FIBITMAP * fiScaled = FreeImage_Rescale(fiBitmap, std::max(1, (int)(srcWidth * scale + 0.5f)), std::max(1, (int)(srcHeight * scale + 0.5f)), FILTER_BILINEAR);
+						if (fiScaled != nullptr)
+						{
+							FreeImage_Unload(fiBitmap);
+							fiBitmap = fiScaled;
+							if (scaled != nullptr)
+								*scaled = true;
+						}
+					}
+				}
 				if (fiBitmap != nullptr)
 				{
 					width = FreeImage_GetWidth(fiBitmap);
 					height = FreeImage_GetHeight(fiBitmap);
-					unsigned int pitch = FreeImage_GetPitch(fiBitmap);
-					//loop through scanlines and add all pixel data to the return vector
-					//this is necessary, because width*height*bpp might not be == pitch
-					unsigned char * tempData = new unsigned char[width * height * 4];
+					//copy the scanlines straight into the return vector, converting from BGRA to RGBA on the way
+					//(row by row, because width*height*bpp might not be == pitch)
+					rawData.resize(width * height * 4);
 					for (size_t i = 0; i < height; i++)
 					{
 						const BYTE * scanLine = FreeImage_GetScanLine(fiBitmap, i);
-						memcpy(tempData + (i * width * 4), scanLine, width * 4);
-					}
-					//convert from BGRA to RGBA
-					for(size_t i = 0; i < width*height; i++)
-					{
-						RGBQUAD bgra = ((RGBQUAD *)tempData)[i];
-						RGBQUAD rgba;
-						rgba.rgbBlue = bgra.rgbRed;
-						rgba.rgbGreen = bgra.rgbGreen;
-						rgba.rgbRed = bgra.rgbBlue;
-						rgba.rgbReserved = bgra.rgbReserved;
-						((RGBQUAD *)tempData)[i] = rgba;
+						swizzleRedBlue(scanLine, rawData.data() + (i * width * 4), width);
 					}
-					rawData = std::vector<unsigned char>(tempData, tempData + width * height * 4);
 					//free bitmap data
 					FreeImage_Unload(fiBitmap);
-					delete[] tempData;
 				}
 			}
 			else
@@ -79,15 +163,7 @@ std::vector<unsigned char> ImageIO::loadFromMemoryRGBA32(const unsigned char * d
 
 void ImageIO::flipPixelsVert(unsigned char* imagePx, const size_t& width, const size_t& height)
 {
-	unsigned int temp;
-	unsigned int* arr = (unsigned int*)imagePx;
+	const size_t rowLength = width * 4;
 	for(size_t y = 0; y < height / 2; y++)
-	{
-		for(size_t x = 0; x < width; x++)
-		{
-			temp = arr[x + (y * width)];
-			arr[x + (y * width)] = arr[x + (height * width) - ((y + 1) * width)];
-			arr[x + (height * width) - ((y + 1) * width)] = temp;
-		}
-	}
+		swapRows(imagePx + (y * rowLength), imagePx + ((height - y - 1) * rowLength), rowLength);
 }
@@ -6,6 +6,11 @@
 class ImageIO
 {
 public:
-	static std::vector<unsigned char> loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height);
+	// if maxWidth/maxHeight are non-zero, images bigger than that are scaled down to fit (keeping their aspect ratio)
+	// and scaled (if given) is set to whether that happened
+	static std::vector<unsigned char> loadFromMemoryRGBA32(const unsigned char * data, const size_t size, size_t & width, size_t & height, size_t maxWidth = 0, size_t maxHeight = 0, bool * scaled = nullptr);
 	static void flipPixelsVert(unsigned char* imagePx, const size_t& width, const size_t& height);
+
+	// copies count pixels from src to dst, swapping the red and blue channels (BGRA <-> RGBA), src and dst may be the same buffer
+	static void swizzleRedBlue(const unsigned char* src, unsigned char* dst, size_t count);
 };
\ No newline at end of file
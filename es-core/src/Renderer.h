@@ -34,6 +34,23 @@ namespace Renderer
 
 	void drawRect(int x, int y, int w, int h, unsigned int color, GLenum blend_sfactor = GL_SRC_ALPHA, GLenum blend_dfactor = GL_ONE_MINUS_SRC_ALPHA);
 	void drawRect(float x, float y, float w, float h, unsigned int color, GLenum blend_sfactor = GL_SRC_ALPHA, GLenum blend_dfactor = GL_ONE_MINUS_SRC_ALPHA);
+
+	//Draws count vertices as a list of triangles with the current matrix.  pos and tex are read with stride bytes between
+	//vertices (like glVertexPointer), colors has 4 bytes per vertex.  A texture of 0 draws untextured.
+	//Fragments with an alpha <= alphaThreshold are discarded (alpha test), 0 disables the test.
+	//Nothing is sent to GL right away: draws are batched up and merged with other draws that use the same state.
+	void drawTriangles(const Eigen::Vector2f* pos, const Eigen::Vector2f* tex, size_t stride, const GLubyte* colors, unsigned int count, 
+		GLuint texture, GLenum blend_sfactor = GL_SRC_ALPHA, GLenum blend_dfactor = GL_ONE_MINUS_SRC_ALPHA, GLfloat alphaThreshold = 0.0f);
+
+	//Sends all batched draws to GL.  Must be called before drawing with GL directly or deleting a texture that might still be batched.
+	void flush();
+
+	//Flushes and starts counting draw calls for the next frame (called by swapBuffers).
+	void endFrame();
+
+	//Number of draw calls and vertices sent to GL during the last frame.
+	unsigned int getDrawCallCount();
+	unsigned int getVertexCount();
 }
 
 #endif
@@ -6,11 +6,207 @@
 #include <boost/filesystem.hpp>
 #include "Log.h"
 #include <stack>
+#include <cfloat>
+#include <cstring>
+#include <algorithm>
 #include "Util.h"
 
+// how many batches back a draw may be moved to join one with the same state
+#define MAX_BATCH_LOOKBACK 8
+
 namespace Renderer {
 	std::stack<Eigen::Vector4i> clipStack;
 
+	// Draws are collected into batches of triangles that share the same texture, blend mode and alpha test.
+	// Vertices are transformed to screen space on the CPU so draws with different matrices can be merged.
+	// A draw may join an earlier batch (instead of starting a new one) as long as it doesn't overlap
+	// anything drawn in between, so the result looks exactly like drawing everything in order.
+	// Changing the clip rect, drawing directly with GL or finishing the frame flushes everything.
+	struct BatchVertex
+	{
+		GLfloat pos[2];
+		GLfloat tex[2];
+		GLubyte color[4];
+	};
+
+	struct Batch
+	{
+		GLuint texture;
+		GLenum sfactor;
+		GLenum dfactor;
+		GLfloat alphaThreshold;
+		Eigen::Vector4f bounds; // min x, min y, max x, max y
+		std::vector<BatchVertex> verts;
+	};
+
+	Eigen::Affine3f currentMatrix = Eigen::Affine3f::Identity();
+	std::vector<Batch> batches; // only the first batchCount are in use, the rest keep their memory around
+	unsigned int batchCount = 0;
+	std::vector<BatchVertex> transformed; // reused by drawTriangles
+
+	unsigned int frameDrawCalls = 0;
+	unsigned int frameVertices = 0;
+	unsigned int lastFrameDrawCalls = 0;
+	unsigned int lastFrameVertices = 0;
+
+	static bool overlaps(const Eigen::Vector4f& a, const Eigen::Vector4f& b)
+	{
+		return a[0] < b[2] && b[0] < a[2] && a[1] < b[3] && b[1] < a[3];
+	}
+
+	void drawTriangles(const Eigen::Vector2f* pos, const Eigen::Vector2f* tex, size_t stride, const GLubyte* colors, unsigned int count, 
+		GLuint texture, GLenum blend_sfactor, GLenum blend_dfactor, GLfloat alphaThreshold)
+	{
+		if(count == 0)
+			return;
+
+		// transform to screen space, we only ever draw flat on the screen so z can be ignored
+		const Eigen::Matrix4f& m = currentMatrix.matrix();
+		const unsigned char* posPtr = (const unsigned char*)pos;
+		const unsigned char* texPtr = (const unsigned char*)tex;
+
+		transformed.resize(count);
+		Eigen::Vector4f bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for(unsigned int i = 0; i < count; i++)
+		{
+			const Eigen::Vector2f& p = *(const Eigen::Vector2f*)(posPtr + i * stride);
+			BatchVertex& v = transformed[i];
+			v.pos[0] = m(0, 0) * p.x() + m(0, 1) * p.y() + m(0, 3);
+			v.pos[1] = m(1, 0) * p.x() + m(1, 1) * p.y() + m(1, 3);
+
+			if(texture)
+			{
+				const Eigen::Vector2f& t = *(const Eigen::Vector2f*)(texPtr + i * stride);
+				v.tex[0] = t.x();
+				v.tex[1] = t.y();
+			}else{
+				v.tex[0] = v.tex[1] = 0;
+			}
+
+			memcpy(v.color, colors + i * 4, 4);
+
+			bounds[0] = std::min(bounds[0], v.pos[0]);
+			bounds[1] = std::min(bounds[1], v.pos[1]);
+			bounds[2] = std::max(bounds[2], v.pos[0]);
+			bounds[3] = std::max(bounds[3], v.pos[1]);
+		}
+
+		// look for an earlier batch with the same state that we can join without skipping over something we overlap
+		Batch* target = NULL;
+		for(int i = (int)batchCount - 1; i >= 0 && i >= (int)batchCount - MAX_BATCH_LOOKBACK; i--)
+		{
+			Batch& batch = batches[i];
+			if(batch.texture == texture && batch.sfactor == blend_sfactor && batch.dfactor == blend_dfactor && batch.alphaThreshold == alphaThreshold)
+			{
+				target = &batch;
+				break;
+			}
+
+			if(overlaps(batch.bounds, bounds))
+				break;
+		}
+
+		if(!target)
+		{
+			if(batchCount == batches.size())
+				batches.push_back(Batch());
+
+			target = &batches[batchCount++];
+			target->texture = texture;
+			target->sfactor = blend_sfactor;
+			target->dfactor = blend_dfactor;
+			target->alphaThreshold = alphaThreshold;
+			target->bounds = bounds;
+			target->verts.clear();
+		}else{
+			target->bounds[0] = std::min(target->bounds[0], bounds[0]);
+			target->bounds[1] = std::min(target->bounds[1], bounds[1]);
+			target->bounds[2] = std::max(target->bounds[2], bounds[2]);
+			target->bounds[3] = std::max(target->bounds[3], bounds[3]);
+		}
+
+		target->verts.insert(target->verts.end(), transformed.begin(), transformed.end());
+	}
+
+	void flush()
+	{
+		if(batchCount == 0)
+			return;
+
+		// everything is already in screen space
+		glLoadIdentity();
+
+		glEnable(GL_BLEND);
+		glEnableClientState(GL_VERTEX_ARRAY);
+		glEnableClientState(GL_COLOR_ARRAY);
+
+		for(unsigned int i = 0; i < batchCount; i++)
+		{
+			const Batch& batch = batches[i];
+			const BatchVertex* verts = batch.verts.data();
+
+			if(batch.texture)
+			{
+				glBindTexture(GL_TEXTURE_2D, batch.texture);
+				glEnable(GL_TEXTURE_2D);
+				glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+				glTexCoordPointer(2, GL_FLOAT, sizeof(BatchVertex), verts->tex);
+			}
+
+			if(batch.alphaThreshold > 0.0f)
+			{
+				glEnable(GL_ALPHA_TEST);
+				glAlphaFunc(GL_GREATER, batch.alphaThreshold);
+			}
+
+			glBlendFunc(batch.sfactor, batch.dfactor);
+			glVertexPointer(2, GL_FLOAT, sizeof(BatchVertex), verts->pos);
+			glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(BatchVertex), verts->color);
+
+			glDrawArrays(GL_TRIANGLES, 0, batch.verts.size());
+
+			if(batch.texture)
+			{
+				glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+				glDisable(GL_TEXTURE_2D);
+			}
+
+			if(batch.alphaThreshold > 0.0f)
+				glDisable(GL_ALPHA_TEST);
+
+			frameDrawCalls++;
+			frameVertices += batch.verts.size();
+		}
+
+		glDisableClientState(GL_VERTEX_ARRAY);
+		glDisableClientState(GL_COLOR_ARRAY);
+		glDisable(GL_BLEND);
+
+		glLoadMatrixf(currentMatrix.data());
+
+		batchCount = 0;
+	}
+
+	void endFrame()
+	{
+		flush();
+
+		lastFrameDrawCalls = frameDrawCalls;
+		lastFrameVertices = frameVertices;
+		frameDrawCalls = 0;
+		frameVertices = 0;
+	}
+
+	unsigned int getDrawCallCount()
+	{
+		return lastFrameDrawCalls;
+	}
+
+	unsigned int getVertexCount()
+	{
+		return lastFrameVertices;
+	}
+
 	void setColor4bArray(GLubyte* array, unsigned int color)
 	{
 		array[0] = (color & 0xff000000) >> 24;
@@ -62,6 +258,7 @@ namespace Renderer {
 		if(box[3] < 0)
 			box[3] = 0;
 
+		flush();
 		clipStack.push(box);
 		glScissor(box[0], box[1], box[2], box[3]);
 		glEnable(GL_SCISSOR_TEST);
@@ -75,6 +272,7 @@ namespace Renderer {
 			return;
 		}
 
+		flush();
 		clipStack.pop();
 		if(clipStack.empty())
 		{
@@ -92,44 +290,25 @@ namespace Renderer {
 
 	void drawRect(int x, int y, int w, int h, unsigned int color, GLenum blend_sfactor, GLenum blend_dfactor)
 	{
-#ifdef USE_OPENGL_ES
-		GLshort points[12];
-#else
-		GLint points[12];
-#endif
+		Eigen::Vector2f points[6];
 
-		points[0] = x; points [1] = y;
-		points[2] = x; points[3] = y + h;
-		points[4] = x + w; points[5] = y;
+		points[0] << x, y;
+		points[1] << x, y + h;
+		points[2] << x + w, y;
 
-		points[6] = x + w; points[7] = y;
-		points[8] = x; points[9] = y + h;
-		points[10] = x + w; points[11] = y + h;
+		points[3] << x + w, y;
+		points[4] << x, y + h;
+		points[5] << x + w, y + h;
 
 		GLubyte colors[6*4];
 		buildGLColorArray(colors, color, 6);
 
-		glEnable(GL_BLEND);
-		glBlendFunc(blend_sfactor, blend_dfactor);
-		glEnableClientState(GL_VERTEX_ARRAY);
-		glEnableClientState(GL_COLOR_ARRAY);
-
-#ifdef USE_OPENGL_ES
-		glVertexPointer(2, GL_SHORT, 0, points);
-#else
-		glVertexPointer(2, GL_INT, 0, points);
-#endif
-		glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors);
-
-		glDrawArrays(GL_TRIANGLES, 0, 6);
-
-		glDisable(GL_BLEND);
-		glDisableClientState(GL_VERTEX_ARRAY);
-		glDisableClientState(GL_COLOR_ARRAY);
+		drawTriangles(points, NULL, sizeof(Eigen::Vector2f), colors, 6, 0, blend_sfactor, blend_dfactor);
 	}
 
 	void setMatrix(float* matrix)
 	{
+		currentMatrix.matrix() = Eigen::Map<Eigen::Matrix4f>(matrix);
 		glLoadMatrixf(matrix);
 	}
 
@@ -116,6 +116,7 @@ namespace Renderer
 
 	void swapBuffers()
 	{
+		endFrame();
 		SDL_GL_SwapWindow(sdlWindow);
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
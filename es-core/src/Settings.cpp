@@ -70,8 +70,21 @@ void Settings::setDefaults()
 	mIntMap["ScraperResizeHeight"] = 0;
 	mIntMap["SortTypeIndex"] = 0;
 
+	// texture memory budget (in MB), unused textures are kept around until it's reached
+#ifdef _RPI_
+	mIntMap["MaxVRAM"] = 80;
+#else
+	mIntMap["MaxVRAM"] = 200;
+#endif
+
+	// disk space (in MB) the thumbnail cache may use, the least recently used thumbnails are deleted past that
+	mIntMap["ThumbnailCacheSize"] = 512;
+
 	mBoolMap["SortFoldersFirst"] = false;
 
+	// render fonts from one distance field per typeface instead of a bitmap per size (needs a restart)
+	mBoolMap["SignedDistanceFonts"] = false;
+
 	mStringMap["TransitionStyle"] = "fade";
 	mStringMap["ThemeSet"] = "";
 	mStringMap["ScreenSaverBehavior"] = "dim";
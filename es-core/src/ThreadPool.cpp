@@ -0,0 +1,138 @@
+#include "ThreadPool.h"
+#include "Log.h"
+
+ThreadPool::ThreadPool(unsigned int threads) : mNextWorker(0), mQueued(0), mPending(0), mRunning(true)
+{
+	if(threads == 0)
+		threads = std::thread::hardware_concurrency();
+	if(threads == 0)
+		threads = 1;
+
+	for(unsigned int i = 0; i < threads; i++)
+		mWorkers.push_back(std::unique_ptr<Worker>(new Worker()));
+
+	// hold the lock so no worker can look up thread IDs before they've all been assigned
+	std::lock_guard<std::mutex> lock(mMutex);
+	for(unsigned int i = 0; i < threads; i++)
+		mWorkers[i]->thread = std::thread(&ThreadPool::run, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+	wait();
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mRunning = false;
+	}
+	mWorkAvailable.notify_all();
+
+	for(auto it = mWorkers.begin(); it != mWorkers.end(); it++)
+		(*it)->thread.join();
+}
+
+int ThreadPool::getCurrentWorkerIndex() const
+{
+	const std::thread::id id = std::this_thread::get_id();
+	for(unsigned int i = 0; i < mWorkers.size(); i++)
+	{
+		if(mWorkers[i]->thread.get_id() == id)
+			return i;
+	}
+
+	return -1;
+}
+
+void ThreadPool::queueWorkItem(work_function work)
+{
+	// keep work queued by a worker on that worker's queue, spread everything else round-robin
+	int index = getCurrentWorkerIndex();
+	if(index == -1)
+		index = mNextWorker++ % mWorkers.size();
+
+	mPending++;
+	{
+		Worker& worker = *mWorkers[index];
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		worker.queue.push_back(work);
+	}
+	mQueued++;
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	mWorkAvailable.notify_one();
+}
+
+bool ThreadPool::popWork(unsigned int index, work_function& out)
+{
+	// newest item from our own queue first (depth-first, keeps queues short)...
+	{
+		Worker& worker = *mWorkers[index];
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		if(!worker.queue.empty())
+		{
+			out = worker.queue.back();
+			worker.queue.pop_back();
+			mQueued--;
+			return true;
+		}
+	}
+
+	// ...otherwise steal the oldest item from someone else
+	for(unsigned int i = 1; i < mWorkers.size(); i++)
+	{
+		Worker& victim = *mWorkers[(index + i) % mWorkers.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if(!victim.queue.empty())
+		{
+			out = victim.queue.front();
+			victim.queue.pop_front();
+			mQueued--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::run(unsigned int index)
+{
+	// wait for the constructor to finish starting everyone
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+	}
+
+	work_function work;
+	while(true)
+	{
+		if(popWork(index, work))
+		{
+			try
+			{
+				work();
+			}catch(std::exception& e)
+			{
+				LOG(LogError) << "Uncaught exception in worker thread: " << e.what();
+			}
+			work = nullptr;
+
+			if(--mPending == 0)
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mWorkDone.notify_all();
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mMutex);
+		mWorkAvailable.wait(lock, [this] { return !mRunning || mQueued > 0; });
+		if(!mRunning && mQueued <= 0)
+			return;
+	}
+}
+
+void ThreadPool::wait()
+{
+	// note: calling this from inside a work item would deadlock
+	std::unique_lock<std::mutex> lock(mMutex);
+	mWorkDone.wait(lock, [this] { return mPending == 0; });
+}
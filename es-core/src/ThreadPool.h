@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed-size pool of worker threads.
+// Each worker owns a queue. Work queued from inside a worker goes on that worker's own queue
+// (so recursive jobs like directory walks stay local), and idle workers steal from the others.
+class ThreadPool
+{
+public:
+	typedef std::function<void()> work_function;
+
+	// threads = 0 uses one worker per hardware thread
+	ThreadPool(unsigned int threads = 0);
+	virtual ~ThreadPool(); // waits for all queued work to finish
+
+	void queueWorkItem(work_function work);
+
+	// blocks until every queued work item (including ones queued while waiting) has finished
+	void wait();
+
+	inline unsigned int getThreadCount() const { return (unsigned int)mWorkers.size(); }
+
+private:
+	struct Worker
+	{
+		std::thread thread;
+		std::mutex mutex;
+		std::deque<work_function> queue;
+	};
+
+	void run(unsigned int index);
+	bool popWork(unsigned int index, work_function& out);
+	int getCurrentWorkerIndex() const;
+
+	std::vector< std::unique_ptr<Worker> > mWorkers;
+	std::atomic<unsigned int> mNextWorker; // round-robin target for work queued from outside the pool
+
+	std::mutex mMutex;
+	std::condition_variable mWorkAvailable;
+	std::condition_variable mWorkDone;
+	std::atomic<int> mQueued; // queued but not yet started
+	std::atomic<int> mPending; // queued or running
+	bool mRunning;
+};
@@ -5,10 +5,19 @@
 #include "Log.h"
 #include "Settings.h"
 #include <iomanip>
+#include <algorithm>
 #include "components/HelpComponent.h"
 #include "components/ImageComponent.h"
 
+// the longest the main loop waits for input while idle, in case something forgot to schedule an update
+#define MAX_IDLE_WAIT_MS 1000
+// how often to check on textures that are being decoded in the background
+#define ASYNC_LOAD_POLL_MS 10
+// how often the framerate display is refreshed
+#define FRAMERATE_UPDATE_MS 500
+
 Window::Window() : mNormalizeNextUpdate(false), mFrameTimeElapsed(0), mFrameCountElapsed(0), mAverageDeltaTime(10), 
+	mRenderCountElapsed(0), mIdleTimeElapsed(0), mDirty(true), mUpdateDeadline(0), 
 	mAllowSleep(true), mSleeping(false), mTimeSinceLastInput(0)
 {
 	mHelp = new HelpComponent(this);
@@ -29,6 +38,7 @@ Window::~Window()
 
 void Window::pushGui(GuiComponent* gui)
 {
+	invalidate();
 	mGuiStack.push_back(gui);
 	gui->updateHelpPrompts();
 }
@@ -39,6 +49,7 @@ void Window::removeGui(GuiComponent* gui)
 	{
 		if(*i == gui)
 		{
+			invalidate();
 			i = mGuiStack.erase(i);
 
 			if(i == mGuiStack.end() && mGuiStack.size()) // we just popped the stack and the stack is not empty
@@ -83,11 +94,15 @@ bool Window::init(unsigned int width, unsigned int height)
 	if(peekGui())
 		peekGui()->updateHelpPrompts();
 
+	invalidate();
 	return true;
 }
 
 void Window::deinit()
 {
+	// no point in reloading textures nobody is using when we come back
+	TextureResource::clearUnusedCache();
+
 	InputManager::getInstance()->deinit();
 	ResourceManager::getInstance()->unloadAll();
 	Renderer::deinit();
@@ -95,12 +110,16 @@ void Window::deinit()
 
 void Window::textInput(const char* text)
 {
+	invalidate();
 	if(peekGui())
 		peekGui()->textInput(text);
 }
 
 void Window::input(InputConfig* config, Input input)
 {
+	// whatever the input does, it probably changes something on screen
+	invalidate();
+
 	if(mSleeping)
 	{
 		// wake up
@@ -138,9 +157,17 @@ void Window::update(int deltaTime)
 			deltaTime = mAverageDeltaTime;
 	}
 
+	mUpdateDeadline = MAX_IDLE_WAIT_MS;
+
+	// finish any textures that were decoded in the background since last time
+	if(TextureResource::processAsyncUploads())
+		invalidate();
+	if(TextureResource::hasPendingAsyncLoads())
+		scheduleUpdate(ASYNC_LOAD_POLL_MS);
+
 	mFrameTimeElapsed += deltaTime;
 	mFrameCountElapsed++;
-	if(mFrameTimeElapsed > 500)
+	if(mFrameTimeElapsed > FRAMERATE_UPDATE_MS)
 	{
 		mAverageDeltaTime = mFrameTimeElapsed / mFrameCountElapsed;
 		
@@ -148,9 +175,10 @@ void Window::update(int deltaTime)
 		{
 			std::stringstream ss;
 			
-			// fps
-			ss << std::fixed << std::setprecision(1) << (1000.0f * (float)mFrameCountElapsed / (float)mFrameTimeElapsed) << "fps, ";
-			ss << std::fixed << std::setprecision(2) << ((float)mFrameTimeElapsed / (float)mFrameCountElapsed) << "ms";
+			// fps (frames actually drawn, idle frames are skipped)
+			ss << std::fixed << std::setprecision(1) << (1000.0f * (float)mRenderCountElapsed / (float)mFrameTimeElapsed) << "fps, ";
+			ss << std::fixed << std::setprecision(2) << ((float)mFrameTimeElapsed / (float)mFrameCountElapsed) << "ms, ";
+			ss << std::fixed << std::setprecision(1) << (100.0f * (float)mIdleTimeElapsed / (float)mFrameTimeElapsed) << "% idle";
 
 			// vram
 			float textureVramUsageMb = TextureResource::getTotalMemUsage() / 1000.0f / 1000.0f;;
@@ -158,23 +186,67 @@ void Window::update(int deltaTime)
 			float totalVramUsageMb = textureVramUsageMb + fontVramUsageMb;
 			ss << "\nVRAM: " << totalVramUsageMb << "mb (texs: " << textureVramUsageMb << "mb, fonts: " << fontVramUsageMb << "mb)";
 
+			// what the last frame sent to GL
+			ss << "\nDraw calls: " << Renderer::getDrawCallCount() << ", vertices: " << Renderer::getVertexCount();
+
 			mFrameDataText = std::unique_ptr<TextCache>(mDefaultFonts.at(1)->buildTextCache(ss.str(), 50.f, 50.f, 0xFF00FFFF));
+			invalidate();
 		}
 
 		mFrameTimeElapsed = 0;
 		mFrameCountElapsed = 0;
+		mRenderCountElapsed = 0;
+		mIdleTimeElapsed = 0;
 	}
 
+	if(Settings::getInstance()->getBool("DrawFramerate"))
+		scheduleUpdate(FRAMERATE_UPDATE_MS - mFrameTimeElapsed + 1);
+
 	mTimeSinceLastInput += deltaTime;
 
+	// the screensaver kicks in at the end of render()
+	unsigned int screensaverTime = (unsigned int)Settings::getInstance()->getInt("ScreenSaverTime");
+	if(screensaverTime != 0 && mAllowSleep && !mSleeping)
+	{
+		if(mTimeSinceLastInput >= screensaverTime)
+			invalidate();
+		else
+			scheduleUpdate(screensaverTime - mTimeSinceLastInput);
+	}
+
 	if(peekGui())
 		peekGui()->update(deltaTime);
 }
 
+void Window::invalidate()
+{
+	mDirty = true;
+}
+
+void Window::scheduleUpdate(int ms)
+{
+	if(ms < mUpdateDeadline)
+		mUpdateDeadline = std::max(ms, 0);
+}
+
+int Window::getIdleTimeout() const
+{
+	return mDirty ? 0 : mUpdateDeadline;
+}
+
+void Window::addIdleTime(int ms)
+{
+	mIdleTimeElapsed += ms;
+}
+
 void Window::render()
 {
 	Eigen::Affine3f transform = Eigen::Affine3f::Identity();
 
+	// anything that changes while we're drawing will need another frame
+	mDirty = false;
+	mRenderCountElapsed++;
+
 	mRenderedHelpPrompts = false;
 
 	// draw only bottom and top of GuiStack (if they are different)
@@ -224,7 +296,7 @@ void Window::setAllowSleep(bool sleep)
 	mAllowSleep = sleep;
 }
 
-void Window::renderLoadingScreen()
+void Window::renderLoadingScreen(const std::string& text)
 {
 	Eigen::Affine3f trans = Eigen::Affine3f::Identity();
 	Renderer::setMatrix(trans);
@@ -237,7 +309,7 @@ void Window::renderLoadingScreen()
 	splash.render(trans);
 
 	auto& font = mDefaultFonts.at(1);
-	TextCache* cache = font->buildTextCache("LOADING...", 0, 0, 0x656565FF);
+	TextCache* cache = font->buildTextCache(text, 0, 0, 0x656565FF);
 	trans = trans.translate(Eigen::Vector3f(round((Renderer::getScreenWidth() - cache->metrics.size.x()) / 2.0f), 
 		round(Renderer::getScreenHeight() * 0.835f), 0.0f));
 	Renderer::setMatrix(trans);
@@ -320,6 +392,7 @@ void Window::setHelpPrompts(const std::vector<HelpPrompt>& prompts, const HelpSt
 	});
 
 	mHelp->setPrompts(addPrompts);
+	invalidate();
 }
 
 
@@ -332,5 +405,6 @@ void Window::onSleep()
 
 void Window::onWake()
 {
+	invalidate();
 
 }
@@ -28,11 +28,19 @@ public:
 
 	void normalizeNextUpdate();
 
+	// The screen is only redrawn when something invalidated it since the last render().
+	// Otherwise the main loop waits for input for up to getIdleTimeout() milliseconds before calling update() again.
+	void invalidate();
+	inline bool isDirty() const { return mDirty; }
+	void scheduleUpdate(int ms); // make sure update() is called again within ms milliseconds
+	int getIdleTimeout() const; // 0 if we need to render right away
+	void addIdleTime(int ms); // time the main loop spent waiting, for the framerate display
+
 	inline bool isSleeping() const { return mSleeping; }
 	bool getAllowSleep();
 	void setAllowSleep(bool sleep);
 	
-	void renderLoadingScreen();
+	void renderLoadingScreen(const std::string& text = "LOADING...");
 
 	void renderHelpPromptsEarly(); // used to render HelpPrompts before a fade
 	void setHelpPrompts(const std::vector<HelpPrompt>& prompts, const HelpStyle& style);
@@ -51,6 +59,11 @@ private:
 	int mFrameTimeElapsed;
 	int mFrameCountElapsed;
 	int mAverageDeltaTime;
+	int mRenderCountElapsed;
+	int mIdleTimeElapsed;
+
+	bool mDirty;
+	int mUpdateDeadline; // ms after the last update() when the next one is due
 
 	std::unique_ptr<TextCache> mFrameDataText;
 
@@ -73,7 +73,11 @@ void AnimatedImageComponent::update(int deltaTime)
 		}
 
 		mFrameAccumulator -= mFrames.at(mCurrentFrame).second;
+		invalidate();
 	}
+
+	if(mEnabled)
+		scheduleUpdate(mFrames.at(mCurrentFrame).second - mFrameAccumulator);
 }
 
 void AnimatedImageComponent::render(const Eigen::Affine3f& trans)
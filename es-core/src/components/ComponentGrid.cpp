@@ -375,6 +375,8 @@ void ComponentGrid::render(const Eigen::Affine3f& parentTrans)
 	// draw cell separators
 	if(mLines.size())
 	{
+		// lines aren't batched
+		Renderer::flush();
 		Renderer::setMatrix(trans);
 
 		glEnable(GL_BLEND);
@@ -128,7 +128,10 @@ void DateTimeComponent::update(int deltaTime)
 		{
 			mRelativeUpdateAccumulator = 0;
 			updateTextCache();
+			invalidate();
 		}
+
+		scheduleUpdate(1000 - mRelativeUpdateAccumulator + 1);
 	}
 
 	GuiComponent::update(deltaTime);
@@ -167,6 +170,7 @@ void DateTimeComponent::setValue(const std::string& val)
 {
 	mTime = string_to_ptime(val, SQLITE_TIME_STRING_FORMAT);
 	updateTextCache();
+	invalidate();
 }
 
 std::string DateTimeComponent::getValue() const
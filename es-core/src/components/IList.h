@@ -47,6 +47,9 @@ const ScrollTier SLOW_SCROLL_TIERS[] = {
 };
 const ScrollTierList LIST_SCROLL_STYLE_SLOW = { 2, SLOW_SCROLL_TIERS };
 
+// how many entries around the cursor a list with a data source keeps loaded
+#define LIST_DATA_SOURCE_WINDOW 128
+
 template <typename EntryData, typename UserData>
 class IList : public GuiComponent
 {
@@ -58,11 +61,23 @@ public:
 		EntryData data;
 	};
 
+	// Supplies the entries of a list on demand, for lists too big to keep every entry around (see setDataSource).
+	class DataSource
+	{
+	public:
+		virtual ~DataSource() {}
+
+		virtual int size() = 0;
+		virtual void getEntries(int start, int count, std::vector<Entry>& out) = 0; // appends entries [start, start + count) to out
+		virtual int indexOf(const UserData& obj) = 0; // -1 if obj isn't in the list
+	};
+
 protected:
 	int mCursor;
 
 	int mScrollTier;
 	int mScrollVelocity;
+	int mScrollDirection; // direction of the last cursor move (-1 or 1), kept after scrolling stops
 
 	int mScrollTierAccumulator;
 	int mScrollCursorAccumulator;
@@ -75,7 +90,15 @@ protected:
 	const ScrollTierList& mTierList;
 	const ListLoopType mLoopType;
 
-	std::vector<Entry> mEntries;
+	// with a data source this only holds the entries around the cursor (starting at index mEntriesStart),
+	// so always go through getEntry() unless you know there is no data source
+	mutable std::vector<Entry> mEntries;
+
+	std::shared_ptr<DataSource> mDataSource;
+	int mDataSourceSize;
+	mutable int mEntriesStart;
+	mutable std::vector<Entry> mFarEntry; // an entry outside the window that was asked for
+	mutable int mFarEntryIndex;
 	
 public:
 	IList(Window* window, const ScrollTierList& tierList = LIST_SCROLL_STYLE_QUICK, const ListLoopType& loopType = LIST_PAUSE_AT_END) : GuiComponent(window), 
@@ -84,8 +107,13 @@ public:
 		mCursor = 0;
 		mScrollTier = 0;
 		mScrollVelocity = 0;
+		mScrollDirection = 1;
 		mScrollTierAccumulator = 0;
 		mScrollCursorAccumulator = 0;
+
+		mDataSourceSize = 0;
+		mEntriesStart = 0;
+		mFarEntryIndex = -1;
 		
 		mTitleOverlayOpacity = 0x00;
 		mTitleOverlayColor = 0xFFFFFF00;
@@ -99,6 +127,20 @@ public:
 		return (mScrollVelocity != 0 && mScrollTier > 0);
 	}
 
+	inline int getScrollTier() const { return mScrollTier; }
+	inline int getScrollDirection() const { return mScrollDirection; }
+	inline int getCursorIndex() const { return mCursor; }
+
+	// the entry offset entries away from the cursor (wraps around)
+	inline const UserData& getRelative(int offset) const
+	{
+		assert(size() > 0);
+		int index = (mCursor + offset) % size();
+		if(index < 0)
+			index += size();
+		return getEntry(index).object;
+	}
+
 	void stopScrolling()
 	{
 		listInput(0);
@@ -108,38 +150,70 @@ public:
 	void clear()
 	{
 		mEntries.clear();
+		mDataSource.reset();
+		mDataSourceSize = 0;
+		mEntriesStart = 0;
+		mFarEntry.clear();
+		mFarEntryIndex = -1;
 		mCursor = 0;
+		invalidate();
 		listInput(0);
 		onCursorChanged(CURSOR_STOPPED);
 	}
 
+	// Replaces the entries with the ones of source, which are loaded a window at a time around the cursor
+	// (and dropped again when the cursor moves away).  add() and remove() can't be used until clear() is called.
+	void setDataSource(const std::shared_ptr<DataSource>& source)
+	{
+		clear();
+		mDataSource = source;
+		mDataSourceSize = source->size();
+		invalidate();
+		onCursorChanged(CURSOR_STOPPED);
+	}
+
 	inline const std::string& getSelectedName()
 	{
 		assert(size() > 0);
-		return mEntries.at(mCursor).name;
+		return getEntry(mCursor).name;
 	}
 
 	inline const UserData& getSelected() const
 	{
 		assert(size() > 0);
-		return mEntries.at(mCursor).object;
+		return getEntry(mCursor).object;
 	}
 
 	void setCursor(typename std::vector<Entry>::iterator& it)
 	{
+		assert(!mDataSource);
 		assert(it != mEntries.end());
 		mCursor = it - mEntries.begin();
+		invalidate();
 		onCursorChanged(CURSOR_STOPPED);
 	}
 
 	// returns true if successful (select is in our list), false if not
 	bool setCursor(const UserData& obj)
 	{
+		if(mDataSource)
+		{
+			const int index = mDataSource->indexOf(obj);
+			if(index < 0)
+				return false;
+
+			mCursor = index;
+			invalidate();
+			onCursorChanged(CURSOR_STOPPED);
+			return true;
+		}
+
 		for(auto it = mEntries.begin(); it != mEntries.end(); it++)
 		{
 			if((*it).object == obj)
 			{
 				mCursor = it - mEntries.begin();
+				invalidate();
 				onCursorChanged(CURSOR_STOPPED);
 				return true;
 			}
@@ -151,11 +225,14 @@ public:
 	// entry management
 	void add(const Entry& e)
 	{
+		assert(!mDataSource);
 		mEntries.push_back(e);
+		invalidate();
 	}
 
 	bool remove(const UserData& obj)
 	{
+		assert(!mDataSource);
 		for(auto it = mEntries.begin(); it != mEntries.end(); it++)
 		{
 			if((*it).object == obj)
@@ -168,11 +245,44 @@ public:
 		return false;
 	}
 
-	inline int size() const { return mEntries.size(); }
+	inline int size() const { return mDataSource ? mDataSourceSize : mEntries.size(); }
 
 protected:
+	// Entry at index.  With a data source, the window around the cursor is loaded if needed; the reference is valid
+	// until the cursor moves.  Entries outside the window are loaded one at a time, those are only valid until the
+	// next call.
+	Entry& getEntry(int index) const
+	{
+		if(!mDataSource)
+			return mEntries.at(index);
+
+		const int windowSize = std::min(LIST_DATA_SOURCE_WINDOW, mDataSourceSize);
+		if(index < mEntriesStart || index >= mEntriesStart + (int)mEntries.size())
+		{
+			const int start = std::max(0, std::min(mCursor - windowSize / 2, mDataSourceSize - windowSize));
+			if(index < start || index >= start + windowSize)
+			{
+				if(index != mFarEntryIndex)
+				{
+					mFarEntry.clear();
+					mDataSource->getEntries(index, 1, mFarEntry);
+					mFarEntryIndex = index;
+				}
+
+				return mFarEntry.at(0);
+			}
+
+			mEntries.clear();
+			mDataSource->getEntries(start, windowSize, mEntries);
+			mEntriesStart = start;
+		}
+
+		return mEntries.at(index - mEntriesStart);
+	}
+
 	void remove(typename std::vector<Entry>::iterator& it)
 	{
+		assert(!mDataSource);
 		if(mCursor > 0 && it - mEntries.begin() <= mCursor)
 		{
 			mCursor--;
@@ -180,6 +290,7 @@ protected:
 		}
 
 		mEntries.erase(it);
+		invalidate();
 	}
 
 
@@ -204,6 +315,7 @@ protected:
 		// update the title overlay opacity
 		const int dir = (mScrollTier >= mTierList.count - 1) ? 1 : -1; // fade in if scroll tier is >= 1, otherwise fade out
 		int op = mTitleOverlayOpacity + deltaTime*dir; // we just do a 1-to-1 time -> opacity, no scaling
+		const unsigned char oldOpacity = mTitleOverlayOpacity;
 		if(op >= 255)
 			mTitleOverlayOpacity = 255;
 		else if(op <= 0)
@@ -211,6 +323,9 @@ protected:
 		else
 			mTitleOverlayOpacity = (unsigned char)op;
 
+		if(mTitleOverlayOpacity != oldOpacity)
+			invalidate();
+
 		if(mScrollVelocity == 0 || size() < 2)
 			return;
 
@@ -236,6 +351,11 @@ protected:
 		// actually perform the scrolling
 		for(int i = 0; i < scrollCount; i++)
 			scroll(mScrollVelocity);
+
+		// still holding the button, next step is due when the accumulator catches up
+		scheduleUpdate(mTierList.tiers[mScrollTier].scrollDelay - mScrollCursorAccumulator);
+		if(mScrollTier < mTierList.count - 1)
+			scheduleUpdate(mTierList.tiers[mScrollTier].length - mScrollTierAccumulator);
 	}
 
 	void listRenderTitleOverlay(const Eigen::Affine3f& trans)
@@ -293,9 +413,13 @@ protected:
 		}
 
 		if(cursor != mCursor)
+		{
+			mScrollDirection = amt < 0 ? -1 : 1;
 			onScroll(absAmt);
+		}
 
 		mCursor = cursor;
+		invalidate();
 		onCursorChanged((mScrollTier > 0) ? CURSOR_SCROLLING : CURSOR_STOPPED);
 	}
 
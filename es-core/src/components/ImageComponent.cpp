@@ -23,7 +23,7 @@ Eigen::Vector2f ImageComponent::getCenter() const
 }
 
 ImageComponent::ImageComponent(Window* window) : GuiComponent(window), 
-	mTargetIsMax(false), mFlipX(false), mFlipY(false), mOrigin(0.0, 0.0), mTargetSize(0, 0), mColorShift(0xFFFFFFFF)
+	mTargetIsMax(false), mFlipX(false), mFlipY(false), mOrigin(0.0, 0.0), mTargetSize(0, 0), mColorShift(0xFFFFFFFF), mWaitingForTexture(false)
 {
 	updateColors();
 }
@@ -105,22 +105,27 @@ void ImageComponent::onSizeChanged()
 	updateVertices();
 }
 
-void ImageComponent::setImage(std::string path, bool tile)
+void ImageComponent::setImage(std::string path, bool tile, bool async)
 {
+	// replacing the texture also cancels the old one if it was still loading
 	if(path.empty() || !ResourceManager::getInstance()->fileExists(path))
 		mTexture.reset();
 	else
-		mTexture = TextureResource::get(path, tile);
+		mTexture = TextureResource::get(path, tile, async, async ? getTextureMaxSize() : Eigen::Vector2i::Zero());
 
+	mWaitingForTexture = mTexture && mTexture->isLoading();
+	invalidate();
 	resize();
 }
 
 void ImageComponent::setImage(const char* path, size_t length, bool tile)
 {
 	mTexture.reset();
+	mWaitingForTexture = false;
 
 	mTexture = TextureResource::get("", tile);
 	mTexture->initFromMemory(path, length);
+	invalidate();
 	
 	resize();
 }
@@ -128,9 +133,20 @@ void ImageComponent::setImage(const char* path, size_t length, bool tile)
 void ImageComponent::setImage(const std::shared_ptr<TextureResource>& texture)
 {
 	mTexture = texture;
+	mWaitingForTexture = mTexture && mTexture->isLoading();
+	invalidate();
 	resize();
 }
 
+Eigen::Vector2i ImageComponent::getTextureMaxSize() const
+{
+	// a stretched image needs all of its pixels
+	if(!mTargetIsMax)
+		return Eigen::Vector2i::Zero();
+
+	return Eigen::Vector2i((int)ceil(mTargetSize.x()), (int)ceil(mTargetSize.y()));
+}
+
 void ImageComponent::setOrigin(float originX, float originY)
 {
 	mOrigin << originX, originY;
@@ -167,6 +183,7 @@ void ImageComponent::setColorShift(unsigned int color)
 {
 	mColorShift = color;
 	updateColors();
+	invalidate();
 }
 
 void ImageComponent::setOpacity(unsigned char opacity)
@@ -174,6 +191,7 @@ void ImageComponent::setOpacity(unsigned char opacity)
 	mOpacity = opacity;
 	mColorShift = (mColorShift >> 8 << 8) | mOpacity;
 	updateColors();
+	invalidate();
 }
 
 void ImageComponent::updateVertices()
@@ -239,36 +257,25 @@ void ImageComponent::updateColors()
 
 void ImageComponent::render(const Eigen::Affine3f& parentTrans)
 {
+	if(mWaitingForTexture && !mTexture->isLoading())
+	{
+		// async load finished, now we know the real size
+		mWaitingForTexture = false;
+		resize();
+	}
+
 	Eigen::Affine3f trans = roundMatrix(parentTrans * getTransform());
 	Renderer::setMatrix(trans);
 	
 	if(mTexture && mOpacity > 0)
 	{
-		if(mTexture->isInitialized())
+		if(mTexture->isLoading())
+		{
+			// placeholder: keep our size, but there's nothing to draw yet
+		}else if(mTexture->isInitialized())
 		{
 			// actually draw the image
-			mTexture->bind();
-
-			glEnable(GL_TEXTURE_2D);
-			glEnable(GL_BLEND);
-			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-			glEnableClientState(GL_VERTEX_ARRAY);
-			glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-			glEnableClientState(GL_COLOR_ARRAY);
-
-			glVertexPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].pos);
-			glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &mVertices[0].tex);
-			glColorPointer(4, GL_UNSIGNED_BYTE, 0, mColors);
-
-			glDrawArrays(GL_TRIANGLES, 0, 6);
-
-			glDisableClientState(GL_VERTEX_ARRAY);
-			glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-			glDisableClientState(GL_COLOR_ARRAY);
-
-			glDisable(GL_TEXTURE_2D);
-			glDisable(GL_BLEND);
+			Renderer::drawTriangles(&mVertices[0].pos, &mVertices[0].tex, sizeof(Vertex), mColors, 6, mTexture->getTextureID());
 		}else{
 			LOG(LogError) << "Image texture is not initialized!";
 			mTexture.reset();
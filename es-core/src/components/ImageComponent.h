@@ -16,7 +16,8 @@ public:
 	virtual ~ImageComponent();
 
 	//Loads the image at the given filepath. Will tile if tile is true (retrieves texture as tiling, creates vertices accordingly).
-	void setImage(std::string path, bool tile = false);
+	//If async is true, the image is decoded in the background and nothing is drawn until it's ready.
+	void setImage(std::string path, bool tile = false, bool async = false);
 	//Loads an image from memory.
 	void setImage(const char* image, size_t length, bool tile = false);
 	//Use an already existing texture.
@@ -56,6 +57,9 @@ public:
 
 	bool hasImage();
 
+	// The size textures are scaled down to when they're loaded (zero if they aren't), i.e. our max size rounded up.
+	Eigen::Vector2i getTextureMaxSize() const;
+
 	void render(const Eigen::Affine3f& parentTrans) override;
 
 	virtual void applyTheme(const std::shared_ptr<ThemeData>& theme, const std::string& view, const std::string& element, unsigned int properties) override;
@@ -85,6 +89,7 @@ private:
 	unsigned int mColorShift;
 
 	std::shared_ptr<TextureResource> mTexture;
+	bool mWaitingForTexture; // resize once the async load finishes
 };
 
 #endif
@@ -58,6 +58,8 @@ void ScrollableContainer::setScrollPos(const Eigen::Vector2f& pos)
 
 void ScrollableContainer::update(int deltaTime)
 {
+	const Eigen::Vector2f oldScrollPos = mScrollPos;
+
 	if(mAutoScrollSpeed != 0)
 	{
 		mAutoScrollAccumulator += deltaTime;
@@ -100,6 +102,15 @@ void ScrollableContainer::update(int deltaTime)
 			reset();
 	}
 
+	if(mScrollPos != oldScrollPos)
+		invalidate();
+
+	// wake up for the next scroll step (or to start over once we've been at the end for a while)
+	if(mAtEnd)
+		scheduleUpdate(AUTO_SCROLL_RESET_DELAY - mAutoScrollResetAccumulator);
+	else if(mAutoScrollSpeed != 0)
+		scheduleUpdate(mAutoScrollSpeed - mAutoScrollAccumulator);
+
 	GuiComponent::update(deltaTime);
 }
 
@@ -122,6 +133,9 @@ Eigen::Vector2f ScrollableContainer::getContentSize()
 
 void ScrollableContainer::reset()
 {
+	if(!mScrollPos.isZero())
+		invalidate();
+
 	mScrollPos << 0, 0;
 	mAutoScrollResetAccumulator = 0;
 	mAutoScrollAccumulator = -mAutoScrollDelay + mAutoScrollSpeed;
@@ -56,6 +56,8 @@ void SliderComponent::update(int deltaTime)
 			setValue(mValue + mMoveRate);
 			mMoveAccumulator -= MOVE_REPEAT_RATE;
 		}
+
+		scheduleUpdate(MOVE_REPEAT_RATE - mMoveAccumulator);
 	}
 	
 	GuiComponent::update(deltaTime);
@@ -90,6 +92,7 @@ void SliderComponent::setValue(float value)
 	else if(mValue > mMax)
 		mValue = mMax;
 
+	invalidate();
 	onValueChanged();
 }
 
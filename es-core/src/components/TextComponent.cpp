@@ -37,6 +37,7 @@ void TextComponent::setFont(const std::shared_ptr<Font>& font)
 void TextComponent::setColor(unsigned int color)
 {
 	mColor = color;
+	invalidate();
 
 	unsigned char opacity = mColor & 0x000000FF;
 	GuiComponent::setOpacity(opacity);
@@ -133,6 +134,7 @@ void TextComponent::calculateExtent()
 
 void TextComponent::onTextChanged()
 {
+	invalidate();
 	calculateExtent();
 
 	if(!mFont || mText.empty())
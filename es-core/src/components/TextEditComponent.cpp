@@ -46,6 +46,7 @@ void TextEditComponent::onSizeChanged()
 void TextEditComponent::setValue(const std::string& val)
 {
 	mText = val;
+	invalidate();
 	onTextChanged();
 }
 
@@ -75,6 +76,9 @@ void TextEditComponent::textInput(const char* text)
 
 	onTextChanged();
 	onCursorChanged();
+
+	if(mEditing && mTextChangedCallback)
+		mTextChangedCallback(mText);
 }
 
 void TextEditComponent::startEditing()
@@ -170,6 +174,8 @@ void TextEditComponent::updateCursorRepeat(int deltaTime)
 		moveCursor(mCursorRepeatDir);
 		mCursorRepeatTimer -= CURSOR_REPEAT_SPEED;
 	}
+
+	scheduleUpdate(CURSOR_REPEAT_SPEED - mCursorRepeatTimer);
 }
 
 void TextEditComponent::moveCursor(int amt)
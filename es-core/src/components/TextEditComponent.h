@@ -26,6 +26,8 @@ public:
 	std::string getValue() const override;
 
 	void setAutoEdit(const bool value) { mAutoEdit = value; };
+	// called with the new value whenever the user edits the text
+	inline void setTextChangedCallback(const std::function<void(const std::string&)>& func) { mTextChangedCallback = func; }
 
 	inline bool isEditing() const { return mEditing; };
 	inline const std::shared_ptr<Font>& getFont() const { return mFont; }
@@ -54,6 +56,8 @@ private:
 	bool mAutoEdit = false; //Start editing upon focus
 	int mCursor; // cursor position in characters
 
+	std::function<void(const std::string&)> mTextChangedCallback;
+
 	int mCursorRepeatTimer;
 	int mCursorRepeatDir;
 
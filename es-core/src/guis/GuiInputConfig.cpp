@@ -200,6 +200,8 @@ void GuiInputConfig::update(int deltaTime)
 				text->setText(ss.str());
 				text->setColor(0x777777FF);
 			}
+
+			scheduleUpdate(std::min(HOLD_TO_SKIP_MS - mHeldTime, 1000 - mHeldTime % 1000));
 		}
 	}
 }
@@ -21,7 +21,7 @@ GuiTextEditPopup::GuiTextEditPopup(Window* window, const std::string& title, con
 
 	std::vector< std::shared_ptr<ButtonComponent> > buttons;
 	buttons.push_back(std::make_shared<ButtonComponent>(mWindow, acceptBtnText, acceptBtnText, [this, okCallback] { okCallback(mText->getValue()); delete this; }));
-	buttons.push_back(std::make_shared<ButtonComponent>(mWindow, "CANCEL", "discard changes", [this] { delete this; }));
+	buttons.push_back(std::make_shared<ButtonComponent>(mWindow, "CANCEL", "discard changes", [this] { cancel(); }));
 
 	mButtonGrid = makeButtonGrid(mWindow, buttons);
 
@@ -58,13 +58,20 @@ bool GuiTextEditPopup::input(InputConfig* config, Input input)
 	// pressing back when not text editing closes us
 	if(config->isMappedTo("b", input) && input.value)
 	{
-		delete this;
+		cancel();
 		return true;
 	}
 
 	return false;
 }
 
+void GuiTextEditPopup::cancel()
+{
+	if(mCancelCallback)
+		mCancelCallback();
+	delete this;
+}
+
 std::vector<HelpPrompt> GuiTextEditPopup::getHelpPrompts()
 {
 	std::vector<HelpPrompt> prompts = mGrid.getHelpPrompts();
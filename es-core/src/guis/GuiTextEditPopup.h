@@ -12,11 +12,17 @@ public:
 	GuiTextEditPopup(Window* window, const std::string& title, const std::string& initValue, 
 		const std::function<void(const std::string&)>& okCallback, bool multiLine, const char* acceptBtnText = "OK");
 
+	// for popups that apply the text as it's typed (e.g. search)
+	inline void setTextChangedCallback(const std::function<void(const std::string&)>& func) { mText->setTextChangedCallback(func); }
+	inline void setCancelCallback(const std::function<void()>& func) { mCancelCallback = func; }
+
 	bool input(InputConfig* config, Input input);
 	void onSizeChanged();
 	std::vector<HelpPrompt> getHelpPrompts() override;
 
 private:
+	void cancel();
+
 	NinePatchComponent mBackground;
 	ComponentGrid mGrid;
 
@@ -25,4 +31,5 @@ private:
 	std::shared_ptr<ComponentGrid> mButtonGrid;
 
 	bool mMultiLine;
+	std::function<void()> mCancelCallback;
 };
@@ -1,17 +1,38 @@
 #include "resources/Font.h"
 #include <iostream>
 #include <algorithm>
+#include <cstring>
 #include <vector>
 #include <boost/filesystem.hpp>
 #include "Renderer.h"
 #include "Log.h"
 #include "Util.h"
+#include "Settings.h"
 
 FT_Library Font::sLibrary = NULL;
 
 int Font::getSize() const { return mSize; }
 
 std::map< std::pair<std::string, int>, std::weak_ptr<Font> > Font::sFontMap;
+std::map< std::string, std::weak_ptr<Font> > Font::sSdfFontMap;
+std::vector< std::unique_ptr<Font::FontTexture> > Font::sTextures;
+
+Font::TextLayoutList Font::sTextLayoutList;
+std::unordered_map<Font::TextLayoutKey, Font::TextLayoutList::iterator, Font::TextLayoutKeyHash> Font::sTextLayoutMap;
+size_t Font::sTextLayoutMemUsage = 0;
+
+// vertices (and text) of the recently built TextCaches we keep around
+#define TEXT_LAYOUT_CACHE_MAX_MEM (4 * 1024 * 1024)
+
+#define FONT_TEXTURE_WIDTH 1024
+#define FONT_TEXTURE_MIN_HEIGHT 128
+#define FONT_TEXTURE_MAX_HEIGHT 1024
+
+// distance field glyphs are rendered at this size and scaled to everything else
+#define SDF_GLYPH_SIZE 64
+// texels of empty space around each distance field glyph, the field falls off to 0 SDF_RADIUS / 2 outside the edge
+#define SDF_PADDING 4
+#define SDF_RADIUS 8
 
 
 // utf8 stuff
@@ -165,7 +186,7 @@ size_t Font::getMemUsage() const
 {
 	size_t memUsage = 0;
 	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
-		memUsage += it->textureSize.x() * it->textureSize.y() * 4;
+		memUsage += (*it)->textureSize.x() * (*it)->textureSize.y() * 4;
 
 	for(auto it = mFaceCache.begin(); it != mFaceCache.end(); it++)
 		memUsage += it->second->data.length;
@@ -177,6 +198,10 @@ size_t Font::getTotalMemUsage()
 {
 	size_t total = 0;
 
+	// pages are shared, so count them once instead of through each font
+	for(auto it = sTextures.begin(); it != sTextures.end(); it++)
+		total += (*it)->textureSize.x() * (*it)->textureSize.y() * 4;
+
 	auto it = sFontMap.begin();
 	while(it != sFontMap.end())
 	{
@@ -186,14 +211,17 @@ size_t Font::getTotalMemUsage()
 			continue;
 		}
 
-		total += it->second.lock()->getMemUsage();
+		const std::shared_ptr<Font> font = it->second.lock();
+		for(auto face = font->mFaceCache.begin(); face != font->mFaceCache.end(); face++)
+			total += face->second->data.length;
 		it++;
 	}
 
 	return total;
 }
 
-Font::Font(int size, const std::string& path) : mSize(size), mPath(path)
+Font::Font(int size, const std::string& path, bool sdf, const std::shared_ptr<Font>& sdfBase) : mSdf(sdf), mSdfBase(sdfBase), 
+	mScale(sdfBase ? (float)size / sdfBase->mSize : 1.0f), mSize(size), mPath(path)
 {
 	assert(mSize > 0);
 	
@@ -211,7 +239,26 @@ Font::Font(int size, const std::string& path) : mSize(size), mPath(path)
 
 Font::~Font()
 {
-	unload(ResourceManager::getInstance());
+	// our cached layouts point at our glyphs
+	auto layout = sTextLayoutList.begin();
+	while(layout != sTextLayoutList.end())
+	{
+		auto next = std::next(layout);
+		if(layout->first.font == this)
+			eraseTextLayout(layout);
+		layout = next;
+	}
+
+	// pages nobody has glyphs on anymore are freed
+	// (space used by our glyphs on pages that are still in use isn't reclaimed)
+	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
+	{
+		if(--(*it)->users > 0)
+			continue;
+
+		FontTexture* tex = *it;
+		sTextures.erase(std::find_if(sTextures.begin(), sTextures.end(), [tex] (const std::unique_ptr<FontTexture>& t) { return t.get() == tex; }));
+	}
 }
 
 void Font::reload(std::shared_ptr<ResourceManager>& rm)
@@ -236,26 +283,48 @@ std::shared_ptr<Font> Font::get(int size, const std::string& path)
 			return foundFont->second.lock();
 	}
 
-	std::shared_ptr<Font> font = std::shared_ptr<Font>(new Font(def.second, def.first));
+	std::shared_ptr<Font> font;
+	if(Settings::getInstance()->getBool("SignedDistanceFonts"))
+		font = std::shared_ptr<Font>(new Font(def.second, def.first, false, getSdfBase(def.first)));
+	else
+		font = std::shared_ptr<Font>(new Font(def.second, def.first));
+
 	sFontMap[def] = std::weak_ptr<Font>(font);
 	ResourceManager::getInstance()->addReloadable(font);
 	return font;
 }
 
-void Font::unloadTextures()
+std::shared_ptr<Font> Font::getSdfBase(const std::string& path)
 {
-	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
+	auto foundFont = sSdfFontMap.find(path);
+	if(foundFont != sSdfFontMap.end())
 	{
-		it->deinitTexture();
+		if(!foundFont->second.expired())
+			return foundFont->second.lock();
 	}
+
+	std::shared_ptr<Font> font = std::shared_ptr<Font>(new Font(SDF_GLYPH_SIZE, path, true));
+	sSdfFontMap[path] = std::weak_ptr<Font>(font);
+	ResourceManager::getInstance()->addReloadable(font);
+	return font;
+}
+
+void Font::unloadTextures()
+{
+	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
+		(*it)->deinitTexture();
 }
 
-Font::FontTexture::FontTexture()
+Font::FontTexture::FontTexture(bool sdf) : sdf(sdf)
 {
 	textureId = 0;
-	textureSize << 2048, 512;
-	writePos = Eigen::Vector2i::Zero();
-	rowHeight = 0;
+	textureSize << FONT_TEXTURE_WIDTH, FONT_TEXTURE_MIN_HEIGHT;
+	pixels.resize(textureSize.x() * textureSize.y(), 0);
+
+	SkylineNode node = { 0, 0, textureSize.x() };
+	skyline.push_back(node);
+
+	users = 0;
 }
 
 Font::FontTexture::~FontTexture()
@@ -263,39 +332,132 @@ Font::FontTexture::~FontTexture()
 	deinitTexture();
 }
 
+int Font::FontTexture::fitSkyline(size_t node, int width, int height) const
+{
+	if(skyline[node].x + width > textureSize.x())
+		return -1;
+
+	// the rect rests on the highest node it spans
+	int y = skyline[node].y;
+	int widthLeft = width;
+	while(widthLeft > 0)
+	{
+		y = std::max(y, skyline[node].y);
+		if(y + height > textureSize.y())
+			return -1;
+
+		widthLeft -= skyline[node].width;
+		node++;
+	}
+
+	return y;
+}
+
 bool Font::FontTexture::findEmpty(const Eigen::Vector2i& size, Eigen::Vector2i& cursor_out)
 {
-	if(size.x() >= textureSize.x() || size.y() >= textureSize.y())
+	// leave 1px of space between glyphs
+	const int width = size.x() + 1;
+	const int height = size.y() + 1;
+
+	// bottom-left: pick the spot that keeps the skyline lowest, then the narrowest node to waste less space
+	int bestIndex = -1;
+	int bestTop = textureSize.y() + 1;
+	int bestWidth = textureSize.x() + 1;
+	int bestY = 0;
+	for(size_t i = 0; i < skyline.size(); i++)
+	{
+		const int y = fitSkyline(i, width, height);
+		if(y < 0)
+			continue;
+
+		if(y + height < bestTop || (y + height == bestTop && skyline[i].width < bestWidth))
+		{
+			bestIndex = (int)i;
+			bestTop = y + height;
+			bestWidth = skyline[i].width;
+			bestY = y;
+		}
+	}
+
+	if(bestIndex < 0)
 		return false;
 
-	if(writePos.x() + size.x() >= textureSize.x() &&
-		writePos.y() + rowHeight + size.y() + 1 < textureSize.y())
+	cursor_out << skyline[bestIndex].x, bestY;
+
+	// raise the skyline under the new rect
+	SkylineNode node = { cursor_out.x(), bestY + height, width };
+	skyline.insert(skyline.begin() + bestIndex, node);
+
+	// shrink or remove the nodes it now covers
+	size_t i = bestIndex + 1;
+	while(i < skyline.size())
 	{
-		// row full, but it should fit on the next row
-		// move cursor to next row
-		writePos << 0, writePos.y() + rowHeight + 1; // leave 1px of space between glyphs
-		rowHeight = 0;
+		const int prevRight = skyline[i - 1].x + skyline[i - 1].width;
+		if(skyline[i].x >= prevRight)
+			break;
+
+		const int shrink = prevRight - skyline[i].x;
+		skyline[i].x += shrink;
+		skyline[i].width -= shrink;
+		if(skyline[i].width > 0)
+			break;
+
+		skyline.erase(skyline.begin() + i);
 	}
 
-	if(writePos.x() + size.x() >= textureSize.x() ||
-		writePos.y() + size.y() >= textureSize.y())
+	// merge neighbours at the same height
+	i = 0;
+	while(i + 1 < skyline.size())
 	{
-		// nope, still won't fit
-		return false;
+		if(skyline[i].y == skyline[i + 1].y)
+		{
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+		}else{
+			i++;
+		}
 	}
 
-	cursor_out = writePos;
-	writePos[0] += size.x() + 1; // leave 1px of space between glyphs
+	return true;
+}
+
+bool Font::FontTexture::grow()
+{
+	if(textureSize.y() * 2 > FONT_TEXTURE_MAX_HEIGHT)
+		return false;
 
-	if(size.y() > rowHeight)
-		rowHeight = size.y();
+	// rows are stored top to bottom, so the existing glyphs stay where they are
+	textureSize[1] *= 2;
+	pixels.resize(textureSize.x() * textureSize.y(), 0);
+
+	// TextCaches fix their texture coordinates up when they're rendered next (see renderTextCache)
+	if(textureId != 0)
+	{
+		deinitTexture();
+		initTexture();
+	}
 
 	return true;
 }
 
+void Font::FontTexture::writeGlyph(const Eigen::Vector2i& cursor, const Eigen::Vector2i& size, const unsigned char* bitmap, int pitch)
+{
+	for(int y = 0; y < size.y(); y++)
+		memcpy(&pixels[(cursor.y() + y) * textureSize.x() + cursor.x()], bitmap + y * pitch, size.x());
+
+	if(textureId == 0)
+		return;
+
+	// whole rows are contiguous in pixels, GLES can't upload a sub-rectangle with a different row length
+	glBindTexture(GL_TEXTURE_2D, textureId);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, cursor.y(), textureSize.x(), size.y(), GL_ALPHA, GL_UNSIGNED_BYTE, &pixels[cursor.y() * textureSize.x()]);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 void Font::FontTexture::initTexture()
 {
-	assert(textureId == 0);
+	if(textureId != 0)
+		return;
 
 	glGenTextures(1, &textureId);
 	glBindTexture(GL_TEXTURE_2D, textureId);
@@ -303,19 +465,22 @@ void Font::FontTexture::initTexture()
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	// distance fields are interpolated, bitmaps are drawn at their real size anyway
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, sdf ? GL_LINEAR : GL_NEAREST);
+	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, sdf ? GL_LINEAR : GL_NEAREST);
 
 	glPixelStorei(GL_PACK_ALIGNMENT, 1);
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, textureSize.x(), textureSize.y(), 0, GL_ALPHA, GL_UNSIGNED_BYTE, NULL);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, textureSize.x(), textureSize.y(), 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels.data());
+	glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 void Font::FontTexture::deinitTexture()
 {
 	if(textureId != 0)
 	{
+		Renderer::flush(); // might still be waiting to be drawn
 		glDeleteTextures(1, &textureId);
 		textureId = 0;
 	}
@@ -323,27 +488,65 @@ void Font::FontTexture::deinitTexture()
 
 void Font::getTextureForNewGlyph(const Eigen::Vector2i& glyphSize, FontTexture*& tex_out, Eigen::Vector2i& cursor_out)
 {
-	if(mTextures.size())
+	tex_out = NULL;
+
+	// free space on any page with the same kind of glyphs, newest first (older ones are probably full)
+	FontTexture* newest = NULL;
+	for(auto it = sTextures.rbegin(); it != sTextures.rend() && !tex_out; it++)
 	{
-		// check if the most recent texture has space
-		tex_out = &mTextures.back();
+		if((*it)->sdf != mSdf)
+			continue;
 
-		// will this one work?
-		if(tex_out->findEmpty(glyphSize, cursor_out))
-			return; // yes
+		if(!newest)
+			newest = it->get();
+
+		if((*it)->findEmpty(glyphSize, cursor_out))
+			tex_out = it->get();
 	}
 
-	// current textures are full,
-	// make a new one
-	mTextures.push_back(FontTexture());
-	tex_out = &mTextures.back();
-	tex_out->initTexture();
-	
-	bool ok = tex_out->findEmpty(glyphSize, cursor_out);
-	if(!ok)
+	// grow the newest page
+	if(!tex_out && newest)
+	{
+		FontTexture* tex = newest;
+		while(tex->grow())
+		{
+			if(tex->findEmpty(glyphSize, cursor_out))
+			{
+				tex_out = tex;
+				break;
+			}
+		}
+	}
+
+	// everything is full, make a new page
+	if(!tex_out)
+	{
+		sTextures.push_back(std::unique_ptr<FontTexture>(new FontTexture(mSdf)));
+		FontTexture* tex = sTextures.back().get();
+		tex->initTexture();
+
+		do
+		{
+			if(tex->findEmpty(glyphSize, cursor_out))
+			{
+				tex_out = tex;
+				break;
+			}
+		} while(tex->grow());
+
+		if(!tex_out)
+		{
+			LOG(LogError) << "Glyph too big to fit on a new texture (glyph size > " << tex->textureSize.x() << ", " << tex->textureSize.y() << ")!";
+			if(tex->users == 0)
+				sTextures.pop_back();
+			return;
+		}
+	}
+
+	if(std::find(mTextures.begin(), mTextures.end(), tex_out) == mTextures.end())
 	{
-		LOG(LogError) << "Glyph too big to fit on a new texture (glyph size > " << tex_out->textureSize.x() << ", " << tex_out->textureSize.y() << ")!";
-		tex_out = NULL;
+		tex_out->users++;
+		mTextures.push_back(tex_out);
 	}
 }
 
@@ -430,10 +633,116 @@ FT_Face Font::getFaceForChar(UnicodeChar id)
 void Font::clearFaceCache()
 {
 	mFaceCache.clear();
+
+	if(mSdfBase)
+		mSdfBase->clearFaceCache();
+}
+
+#define SDF_INF 1e20
+
+// 1D squared euclidean distance transform (Felzenszwalb & Huttenlocher) of the n values at grid[offset + i * stride]
+static void distanceTransform(double* grid, int offset, int stride, int n, std::vector<double>& f, std::vector<double>& z, std::vector<int>& v)
+{
+	for(int q = 0; q < n; q++)
+		f[q] = grid[offset + q * stride];
+
+	// lower envelope of the parabolas rooted at each q
+	int k = 0;
+	v[0] = 0;
+	z[0] = -SDF_INF;
+	z[1] = SDF_INF;
+	for(int q = 1; q < n; q++)
+	{
+		double s;
+		do
+		{
+			const int r = v[k];
+			s = ((f[q] + q * q) - (f[r] + r * r)) / (2 * q - 2 * r);
+		} while(s <= z[k] && --k >= 0);
+
+		k++;
+		v[k] = q;
+		z[k] = s;
+		z[k + 1] = SDF_INF;
+	}
+
+	k = 0;
+	for(int q = 0; q < n; q++)
+	{
+		while(z[k + 1] < q)
+			k++;
+
+		const int r = v[k];
+		grid[offset + q * stride] = (q - r) * (q - r) + f[r];
+	}
+}
+
+static void distanceTransform(std::vector<double>& grid, int width, int height)
+{
+	const int n = std::max(width, height);
+	std::vector<double> f(n), z(n + 1);
+	std::vector<int> v(n);
+
+	for(int x = 0; x < width; x++)
+		distanceTransform(grid.data(), x, width, height, f, z, v);
+	for(int y = 0; y < height; y++)
+		distanceTransform(grid.data(), y * width, 1, width, f, z, v);
+}
+
+// turns a coverage bitmap into a distance field of (size + SDF_PADDING * 2), 0.5 is the edge
+// partially covered pixels put the edge inside the pixel so the outline stays as smooth as the antialiased bitmap
+static std::vector<unsigned char> buildDistanceField(const unsigned char* bitmap, int pitch, const Eigen::Vector2i& size)
+{
+	const int width = size.x() + SDF_PADDING * 2;
+	const int height = size.y() + SDF_PADDING * 2;
+
+	std::vector<double> outer(width * height, SDF_INF); // squared distance to the glyph from outside
+	std::vector<double> inner(width * height, 0); // squared distance to the background from inside
+
+	for(int y = 0; y < size.y(); y++)
+	{
+		for(int x = 0; x < size.x(); x++)
+		{
+			const double a = bitmap[y * pitch + x] / 255.0;
+			const int i = (y + SDF_PADDING) * width + x + SDF_PADDING;
+			if(a >= 1.0)
+			{
+				outer[i] = 0;
+				inner[i] = SDF_INF;
+			}else if(a > 0.0)
+			{
+				const double d = 0.5 - a;
+				outer[i] = d > 0 ? d * d : 0;
+				inner[i] = d < 0 ? d * d : 0;
+			}
+		}
+	}
+
+	distanceTransform(outer, width, height);
+	distanceTransform(inner, width, height);
+
+	std::vector<unsigned char> field(width * height);
+	for(int i = 0; i < width * height; i++)
+	{
+		const double d = sqrt(outer[i]) - sqrt(inner[i]); // > 0 outside
+		const double value = 255.0 * (0.5 - d / SDF_RADIUS) + 0.5; // + 0.5 to round
+		field[i] = (unsigned char)std::max(0.0, std::min(255.0, value));
+	}
+
+	return field;
+}
+
+int Font::getGlyphPadding(const Glyph* glyph) const
+{
+	return glyph->texture->sdf ? SDF_PADDING : 0;
 }
 
 Font::Glyph* Font::getGlyph(UnicodeChar id)
 {
+	// scaled sizes share the glyphs of their base font
+	if(mSdfBase)
+		return mSdfBase->getGlyph(id);
+
 	// is it already loaded?
 	auto it = mGlyphMap.find(id);
 	if(it != mGlyphMap.end())
@@ -457,9 +766,15 @@ Font::Glyph* Font::getGlyph(UnicodeChar id)
 
 	Eigen::Vector2i glyphSize(g->bitmap.width, g->bitmap.rows);
 
+	// distance fields need some room around the glyph to fall off
+	std::vector<unsigned char> field;
+	const Eigen::Vector2i texSize = mSdf ? Eigen::Vector2i(glyphSize + Eigen::Vector2i(SDF_PADDING * 2, SDF_PADDING * 2)) : glyphSize;
+	if(mSdf)
+		field = buildDistanceField(g->bitmap.buffer, g->bitmap.pitch, glyphSize);
+
 	FontTexture* tex = NULL;
 	Eigen::Vector2i cursor;
-	getTextureForNewGlyph(glyphSize, tex, cursor);
+	getTextureForNewGlyph(texSize, tex, cursor);
 
 	// getTextureForNewGlyph can fail if the glyph is bigger than the max texture size (absurdly large font size)
 	if(tex == NULL)
@@ -472,16 +787,17 @@ Font::Glyph* Font::getGlyph(UnicodeChar id)
 	Glyph& glyph = mGlyphMap[id];
 	
 	glyph.texture = tex;
-	glyph.texPos << cursor.x() / (float)tex->textureSize.x(), cursor.y() / (float)tex->textureSize.y();
-	glyph.texSize << glyphSize.x() / (float)tex->textureSize.x(), glyphSize.y() / (float)tex->textureSize.y();
+	glyph.texPos = cursor;
+	glyph.texSize = texSize;
 
 	glyph.advance << (float)g->metrics.horiAdvance / 64.0f, (float)g->metrics.vertAdvance / 64.0f;
 	glyph.bearing << (float)g->metrics.horiBearingX / 64.0f, (float)g->metrics.horiBearingY / 64.0f;
 
-	// upload glyph bitmap to texture
-	glBindTexture(GL_TEXTURE_2D, tex->textureId);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, cursor.x(), cursor.y(), glyphSize.x(), glyphSize.y(), GL_ALPHA, GL_UNSIGNED_BYTE, g->bitmap.buffer);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	// copy glyph bitmap to the page (and upload it)
+	if(mSdf)
+		tex->writeGlyph(cursor, texSize, field.data(), texSize.x());
+	else
+		tex->writeGlyph(cursor, glyphSize, g->bitmap.buffer, g->bitmap.pitch);
 
 	// update max glyph height
 	if(glyphSize.y() > mMaxGlyphHeight)
@@ -491,36 +807,11 @@ Font::Glyph* Font::getGlyph(UnicodeChar id)
 	return &glyph;
 }
 
-// completely recreate the texture data for all textures based on mGlyphs information
+// recreate the OpenGL textures of our pages from the glyph bitmaps kept in RAM
 void Font::rebuildTextures()
 {
-	// recreate OpenGL textures
 	for(auto it = mTextures.begin(); it != mTextures.end(); it++)
-	{
-		it->initTexture();
-	}
-
-	// reupload the texture data
-	for(auto it = mGlyphMap.begin(); it != mGlyphMap.end(); it++)
-	{
-		FT_Face face = getFaceForChar(it->first);
-		FT_GlyphSlot glyphSlot = face->glyph;
-
-		// load the glyph bitmap through FT
-		FT_Load_Char(face, it->first, FT_LOAD_RENDER);
-
-		FontTexture* tex = it->second.texture;
-		
-		// find the position/size
-		Eigen::Vector2i cursor(it->second.texPos.x() * tex->textureSize.x(), it->second.texPos.y() * tex->textureSize.y());
-		Eigen::Vector2i glyphSize(it->second.texSize.x() * tex->textureSize.x(), it->second.texSize.y() * tex->textureSize.y());
-		
-		// upload to texture
-		glBindTexture(GL_TEXTURE_2D, tex->textureId);
-		glTexSubImage2D(GL_TEXTURE_2D, 0, cursor.x(), cursor.y(), glyphSize.x(), glyphSize.y(), GL_ALPHA, GL_UNSIGNED_BYTE, glyphSlot->bitmap.buffer);
-	}
-
-	glBindTexture(GL_TEXTURE_2D, 0);
+		(*it)->initTexture();
 }
 
 void Font::renderTextCache(TextCache* cache)
@@ -533,31 +824,25 @@ void Font::renderTextCache(TextCache* cache)
 
 	for(auto it = cache->vertexLists.begin(); it != cache->vertexLists.end(); it++)
 	{
-		assert(*it->textureIdPtr != 0);
-
-		auto vertexList = *it;
-
-		glBindTexture(GL_TEXTURE_2D, *it->textureIdPtr);
-		glEnable(GL_TEXTURE_2D);
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-		glEnableClientState(GL_VERTEX_ARRAY);
-		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-		glEnableClientState(GL_COLOR_ARRAY);
+		assert(it->texture->textureId != 0);
 
-		glVertexPointer(2, GL_FLOAT, sizeof(TextCache::Vertex), it->verts[0].pos.data());
-		glTexCoordPointer(2, GL_FLOAT, sizeof(TextCache::Vertex), it->verts[0].tex.data());
-		glColorPointer(4, GL_UNSIGNED_BYTE, 0, it->colors.data());
+		if(it->verts.empty())
+			continue;
 
-		glDrawArrays(GL_TRIANGLES, 0, it->verts.size());
+		// the page grew since this cache was built, texels moved in texture space
+		if(it->textureHeight != it->texture->textureSize.y())
+		{
+			const float scale = (float)it->textureHeight / it->texture->textureSize.y();
+			for(auto vert = it->verts.begin(); vert != it->verts.end(); vert++)
+				vert->tex[1] *= scale;
+			it->textureHeight = it->texture->textureSize.y();
+		}
 
-		glDisableClientState(GL_VERTEX_ARRAY);
-		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-		glDisableClientState(GL_COLOR_ARRAY);
+		// distance fields: cut at the edge (0.5), scaled by the text's alpha so fading text keeps its shape
+		const GLfloat alphaThreshold = it->texture->sdf ? 0.5f * it->colors[3] / 255.0f : 0.0f;
 
-		glDisable(GL_TEXTURE_2D);
-		glDisable(GL_BLEND);
+		Renderer::drawTriangles(&it->verts[0].pos, &it->verts[0].tex, sizeof(TextCache::Vertex), it->colors.data(), it->verts.size(), 
+			it->texture->textureId, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, alphaThreshold);
 	}
 }
 
@@ -586,7 +871,7 @@ Eigen::Vector2f Font::sizeText(std::string text, float lineSpacing)
 
 		Glyph* glyph = getGlyph(character);
 		if(glyph)
-			lineWidth += glyph->advance.x();
+			lineWidth += glyph->advance.x() * mScale;
 	}
 
 	if(lineWidth > highestWidth)
@@ -597,6 +882,9 @@ Eigen::Vector2f Font::sizeText(std::string text, float lineSpacing)
 
 float Font::getHeight(float lineSpacing) const
 {
+	if(mSdfBase)
+		return mSdfBase->mMaxGlyphHeight * mScale * lineSpacing;
+
 	return mMaxGlyphHeight * lineSpacing;
 }
 
@@ -604,55 +892,93 @@ float Font::getLetterHeight()
 {
 	Glyph* glyph = getGlyph((UnicodeChar)'S');
 	assert(glyph);
-	return glyph->texSize.y() * glyph->texture->textureSize.y();
+	return (glyph->texSize.y() - getGlyphPadding(glyph) * 2) * mScale;
 }
 
-//the worst algorithm ever written
-//breaks up a normal string with newlines to make it fit xLen
-std::string Font::wrapText(std::string text, float xLen)
+void Font::layoutText(const std::string& text, float xLen, std::vector<TextLine>& lines)
 {
-	std::string out;
+	lines.clear();
 
-	std::string line, word, temp;
-	size_t space;
+	TextLine line = { 0, 0, 0.0f };
+	size_t cursor = 0;
+	while(cursor < text.length())
+	{
+		// measure the next word, including the space or tab that ends it
+		const size_t wordStart = cursor;
+		size_t wordEnd = cursor;
+		float wordWidth = 0.0f;
+		bool newline = false;
+		while(cursor < text.length())
+		{
+			const size_t charStart = cursor;
+			const UnicodeChar character = readUnicodeChar(text, cursor); // advances cursor
 
-	Eigen::Vector2f textSize;
+			if(character == (UnicodeChar)'\n')
+			{
+				newline = true;
+				wordEnd = charStart;
+				break;
+			}
 
-	while(text.length() > 0) //while there's text or we still have text to render
-	{
-		space = text.find_first_of(" \t\n");
-		if(space == std::string::npos)
-			space = text.length() - 1;
+			wordEnd = cursor;
 
-		word = text.substr(0, space + 1);
-		text.erase(0, space + 1);
+			Glyph* glyph = (character != 0 ? getGlyph(character) : NULL);
+			if(glyph)
+				wordWidth += glyph->advance.x() * mScale;
 
-		temp = line + word;
+			if(character == (UnicodeChar)' ' || character == (UnicodeChar)'\t')
+				break;
+		}
 
-		textSize = sizeText(temp);
+		// doesn't fit, start a new line (unless the word is all we have, it can't be broken up)
+		if(xLen > 0 && line.end > line.start && line.width + wordWidth > xLen)
+		{
+			lines.push_back(line);
+			line.start = wordStart;
+			line.width = 0.0f;
+		}
 
-		// if the word will fit on the line, add it to our line, and continue
-		if(textSize.x() <= xLen)
+		line.end = wordEnd;
+		line.width += wordWidth;
+
+		if(newline)
 		{
-			line = temp;
-			continue;
-		}else{
-			// the next word won't fit, so break here
-			out += line + '\n';
-			line = word;
+			lines.push_back(line);
+			line.start = line.end = cursor;
+			line.width = 0.0f;
 		}
 	}
 
-	// whatever's left should fit
-	out += line;
+	lines.push_back(line);
+}
+
+std::string Font::wrapText(std::string text, float xLen)
+{
+	std::vector<TextLine> lines;
+	layoutText(text, xLen, lines);
+
+	std::string out;
+	out.reserve(text.length() + lines.size());
+	for(auto it = lines.begin(); it != lines.end(); it++)
+	{
+		if(it != lines.begin())
+			out += '\n';
+		out.append(text, it->start, it->end - it->start);
+	}
 
 	return out;
 }
 
 Eigen::Vector2f Font::sizeWrappedText(std::string text, float xLen, float lineSpacing)
 {
-	text = wrapText(text, xLen);
-	return sizeText(text, lineSpacing);
+	std::vector<TextLine> lines;
+	layoutText(text, xLen, lines);
+
+	float highestWidth = 0.0f;
+	for(auto it = lines.begin(); it != lines.end(); it++)
+		highestWidth = std::max(highestWidth, it->width);
+
+	return Eigen::Vector2f(highestWidth, lines.size() * getHeight(lineSpacing));
 }
 
 Eigen::Vector2f Font::getWrappedTextCursorOffset(std::string text, float xLen, size_t stop, float lineSpacing)
@@ -689,7 +1015,7 @@ Eigen::Vector2f Font::getWrappedTextCursorOffset(std::string text, float xLen, s
 
 		Glyph* glyph = getGlyph(character);
 		if(glyph)
-			lineWidth += glyph->advance.x();
+			lineWidth += glyph->advance.x() * mScale;
 	}
 
 	return Eigen::Vector2f(lineWidth, y);
@@ -699,27 +1025,6 @@ Eigen::Vector2f Font::getWrappedTextCursorOffset(std::string text, float xLen, s
 //TextCache
 //=============================================================================================================
 
-float Font::getNewlineStartOffset(const std::string& text, const unsigned int& charStart, const float& xLen, const Alignment& alignment)
-{
-	switch(alignment)
-	{
-	case ALIGN_LEFT:
-		return 0;
-	case ALIGN_CENTER:
-		{
-			unsigned int endChar = text.find('\n', charStart);
-			return (xLen - sizeText(text.substr(charStart, endChar != std::string::npos ? endChar - charStart : endChar)).x()) / 2.0f;
-		}
-	case ALIGN_RIGHT:
-		{
-			unsigned int endChar = text.find('\n', charStart);
-			return xLen - (sizeText(text.substr(charStart, endChar != std::string::npos ? endChar - charStart : endChar)).x());
-		}
-	default:
-		return 0;
-	}
-}
-
 inline float font_round(float v)
 {
 	return round(v);
@@ -727,96 +1032,163 @@ inline float font_round(float v)
 
 TextCache* Font::buildTextCache(const std::string& text, Eigen::Vector2f offset, unsigned int color, float xLen, Alignment alignment, float lineSpacing)
 {
-	float x = offset[0] + (xLen != 0 ? getNewlineStartOffset(text, 0, xLen, alignment) : 0);
-	
-	float yTop = getGlyph((UnicodeChar)'S')->bearing.y();
+	// laid out before?
+	const TextLayoutKey key = { this, text, offset, xLen, alignment, lineSpacing };
+	auto found = sTextLayoutMap.find(key);
+	if(found != sTextLayoutMap.end())
+	{
+		sTextLayoutList.splice(sTextLayoutList.begin(), sTextLayoutList, found->second);
+
+		TextCache* cache = new TextCache(*found->second->second);
+		cache->setColor(color);
+		return cache;
+	}
+
+	// splits the text into lines and measures them, also loads all glyphs
+	// (a new glyph can grow its page and change the texture coordinates of the others, so that has to happen first)
+	std::vector<TextLine> lines;
+	layoutText(text, 0, lines);
+
+	float yTop = getGlyph((UnicodeChar)'S')->bearing.y() * mScale;
 	float yBot = getHeight(lineSpacing);
 	float y = offset[1] + (yBot + yTop)/2.0f;
 
 	// vertices by texture
 	std::map< FontTexture*, std::vector<TextCache::Vertex> > vertMap;
 
-	size_t cursor = 0;
-	UnicodeChar character;
-	Glyph* glyph;
-	while(cursor < text.length())
+	float highestWidth = 0.0f;
+	for(auto line = lines.begin(); line != lines.end(); line++)
 	{
-		character = readUnicodeChar(text, cursor); // also advances cursor
-
-		// invalid character
-		if(character == 0)
-			continue;
+		highestWidth = std::max(highestWidth, line->width);
 
-		if(character == (UnicodeChar)'\n')
+		float x = offset[0];
+		if(xLen != 0)
 		{
-			y += getHeight(lineSpacing);
-			x = offset[0] + (xLen != 0 ? getNewlineStartOffset(text, cursor /* cursor is already advanced */, xLen, alignment) : 0);
-			continue;
+			if(alignment == ALIGN_CENTER)
+				x += (xLen - line->width) / 2.0f;
+			else if(alignment == ALIGN_RIGHT)
+				x += xLen - line->width;
 		}
 
-		glyph = getGlyph(character);
-		if(glyph == NULL)
-			continue;
+		size_t cursor = line->start;
+		while(cursor < line->end)
+		{
+			const UnicodeChar character = readUnicodeChar(text, cursor); // also advances cursor
 
-		std::vector<TextCache::Vertex>& verts = vertMap[glyph->texture];
-		size_t oldVertSize = verts.size();
-		verts.resize(oldVertSize + 6);
-		TextCache::Vertex* tri = verts.data() + oldVertSize;
+			// invalid character
+			if(character == 0)
+				continue;
 
-		const float glyphStartX = x + glyph->bearing.x();
+			Glyph* glyph = getGlyph(character);
+			if(glyph == NULL)
+				continue;
 
-		const Eigen::Vector2i& textureSize = glyph->texture->textureSize;
+			std::vector<TextCache::Vertex>& verts = vertMap[glyph->texture];
+			size_t oldVertSize = verts.size();
+			verts.resize(oldVertSize + 6);
+			TextCache::Vertex* tri = verts.data() + oldVertSize;
 
-		// triangle 1
-		// round to fix some weird "cut off" text bugs
-		tri[0].pos << font_round(glyphStartX), font_round(y + (glyph->texSize.y() * textureSize.y() - glyph->bearing.y()));
-		tri[1].pos << font_round(glyphStartX + glyph->texSize.x() * textureSize.x()), font_round(y - glyph->bearing.y());
-		tri[2].pos << tri[0].pos.x(), tri[1].pos.y();
+			// the quad covers the padding around distance field glyphs too
+			const float padding = getGlyphPadding(glyph) * mScale;
+			const float glyphStartX = x + glyph->bearing.x() * mScale - padding;
+			const float glyphTop = y - glyph->bearing.y() * mScale - padding;
 
-		//tri[0].tex << 0, 0;
-		//tri[0].tex << 1, 1;
-		//tri[0].tex << 0, 1;
+			const Eigen::Vector2i& textureSize = glyph->texture->textureSize;
 
-		tri[0].tex << glyph->texPos.x(), glyph->texPos.y() + glyph->texSize.y();
-		tri[1].tex << glyph->texPos.x() + glyph->texSize.x(), glyph->texPos.y();
-		tri[2].tex << tri[0].tex.x(), tri[1].tex.y();
+			// triangle 1
+			// round to fix some weird "cut off" text bugs
+			tri[0].pos << font_round(glyphStartX), font_round(glyphTop + glyph->texSize.y() * mScale);
+			tri[1].pos << font_round(glyphStartX + glyph->texSize.x() * mScale), font_round(glyphTop);
+			tri[2].pos << tri[0].pos.x(), tri[1].pos.y();
 
-		// triangle 2
-		tri[3].pos = tri[0].pos;
-		tri[4].pos = tri[1].pos;
-		tri[5].pos << tri[1].pos.x(), tri[0].pos.y();
+			const Eigen::Vector2f texPos(glyph->texPos.x() / (float)textureSize.x(), glyph->texPos.y() / (float)textureSize.y());
+			const Eigen::Vector2f texSize(glyph->texSize.x() / (float)textureSize.x(), glyph->texSize.y() / (float)textureSize.y());
 
-		tri[3].tex = tri[0].tex;
-		tri[4].tex = tri[1].tex;
-		tri[5].tex << tri[1].tex.x(), tri[0].tex.y();
+			tri[0].tex << texPos.x(), texPos.y() + texSize.y();
+			tri[1].tex << texPos.x() + texSize.x(), texPos.y();
+			tri[2].tex << tri[0].tex.x(), tri[1].tex.y();
 
-		// advance
-		x += glyph->advance.x();
-	}
+			// triangle 2
+			tri[3].pos = tri[0].pos;
+			tri[4].pos = tri[1].pos;
+			tri[5].pos << tri[1].pos.x(), tri[0].pos.y();
 
-	//TextCache::CacheMetrics metrics = { sizeText(text, lineSpacing) };
+			tri[3].tex = tri[0].tex;
+			tri[4].tex = tri[1].tex;
+			tri[5].tex << tri[1].tex.x(), tri[0].tex.y();
+
+			// advance
+			x += glyph->advance.x() * mScale;
+		}
+
+		y += getHeight(lineSpacing);
+	}
 
 	TextCache* cache = new TextCache();
 	cache->vertexLists.resize(vertMap.size());
-	cache->metrics = { sizeText(text, lineSpacing) };
+	cache->metrics.size << highestWidth, lines.size() * getHeight(lineSpacing);
 
 	unsigned int i = 0;
 	for(auto it = vertMap.begin(); it != vertMap.end(); it++)
 	{
 		TextCache::VertexList& vertList = cache->vertexLists.at(i);
 
-		vertList.textureIdPtr = &it->first->textureId;
+		vertList.texture = it->first;
+		vertList.textureHeight = it->first->textureSize.y();
 		vertList.verts = it->second;
 
 		vertList.colors.resize(4 * it->second.size());
 		Renderer::buildGLColorArray(vertList.colors.data(), color, it->second.size());
+		i++;
 	}
 
 	clearFaceCache();
 
+	// remember a copy, the caller owns (and may recolor) the one we return
+	sTextLayoutList.push_front(std::make_pair(key, std::shared_ptr<TextCache>(new TextCache(*cache))));
+	sTextLayoutMap[key] = sTextLayoutList.begin();
+	sTextLayoutMemUsage += getTextLayoutMemUsage(key, *cache);
+
+	while(sTextLayoutMemUsage > TEXT_LAYOUT_CACHE_MAX_MEM && sTextLayoutList.size() > 1)
+		eraseTextLayout(std::prev(sTextLayoutList.end()));
+
 	return cache;
 }
 
+size_t Font::getTextLayoutMemUsage(const TextLayoutKey& key, const TextCache& cache)
+{
+	size_t memUsage = key.text.size();
+	for(auto it = cache.vertexLists.begin(); it != cache.vertexLists.end(); it++)
+		memUsage += it->verts.size() * (sizeof(TextCache::Vertex) + 4);
+
+	return memUsage;
+}
+
+void Font::eraseTextLayout(TextLayoutList::iterator it)
+{
+	sTextLayoutMemUsage -= getTextLayoutMemUsage(it->first, *it->second);
+	sTextLayoutMap.erase(it->first);
+	sTextLayoutList.erase(it);
+}
+
+size_t Font::TextLayoutKeyHash::operator()(const TextLayoutKey& key) const
+{
+	size_t h = std::hash<std::string>()(key.text);
+	h = h * 31 + std::hash<const Font*>()(key.font);
+	h = h * 31 + std::hash<float>()(key.offset.x());
+	h = h * 31 + std::hash<float>()(key.offset.y());
+	h = h * 31 + std::hash<float>()(key.xLen);
+	h = h * 31 + (size_t)key.alignment;
+	h = h * 31 + std::hash<float>()(key.lineSpacing);
+	return h;
+}
+
+bool Font::TextLayoutKey::operator==(const TextLayoutKey& other) const
+{
+	return font == other.font && offset == other.offset && xLen == other.xLen && alignment == other.alignment && 
+		lineSpacing == other.lineSpacing && text == other.text;
+}
+
 TextCache* Font::buildTextCache(const std::string& text, float offsetX, float offsetY, unsigned int color)
 {
 	return buildTextCache(text, Eigen::Vector2f(offsetX, offsetY), color, 0.0f);
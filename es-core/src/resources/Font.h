@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <list>
+#include <unordered_map>
 #include "platform.h"
 #include GLHEADER
 #include <ft2build.h>
@@ -29,6 +31,8 @@ enum Alignment
 
 //A TrueType Font renderer that uses FreeType and OpenGL.
 //The library is automatically initialized when it's needed.
+//With the "SignedDistanceFonts" setting, glyphs are rendered once per typeface as distance fields and every size
+//is drawn by scaling those (edges are cut with the alpha test), instead of rasterizing each size separately.
 class Font : public IReloadable
 {
 public:
@@ -60,7 +64,7 @@ public:
 
 	static std::shared_ptr<Font> getFromTheme(const ThemeData::ThemeElement* elem, unsigned int properties, const std::shared_ptr<Font>& orig);
 
-	size_t getMemUsage() const; // returns an approximation of VRAM used by this font's texture (in bytes)
+	size_t getMemUsage() const; // returns an approximation of VRAM used by the atlas pages this font uses, which may be shared with other fonts (in bytes)
 	static size_t getTotalMemUsage(); // returns an approximation of total VRAM used by font textures (in bytes)
 
 	// utf8 stuff
@@ -72,24 +76,44 @@ public:
 private:
 	static FT_Library sLibrary;
 	static std::map< std::pair<std::string, int>, std::weak_ptr<Font> > sFontMap;
+	static std::map< std::string, std::weak_ptr<Font> > sSdfFontMap; // distance field glyphs by path
 
-	Font(int size, const std::string& path);
+	// sdf: rasterize distance fields instead of coverage bitmaps
+	// sdfBase: don't rasterize anything, draw the glyphs of sdfBase scaled to size
+	Font(int size, const std::string& path, bool sdf = false, const std::shared_ptr<Font>& sdfBase = nullptr);
+	static std::shared_ptr<Font> getSdfBase(const std::string& path);
 
+	// Glyphs of every font are packed into shared atlas pages.  A page starts small and doubles in height when it
+	// fills up, a new page is only created once the newest one is at its maximum size.
+	// Pages keep a copy of their pixels in RAM so they can be re-uploaded after a game was launched without
+	// rasterizing every glyph again.
 	struct FontTexture
 	{
 		GLuint textureId;
 		Eigen::Vector2i textureSize;
 
-		Eigen::Vector2i writePos;
-		int rowHeight;
+		std::vector<unsigned char> pixels; // GL_ALPHA, textureSize.x() * textureSize.y()
 
-		FontTexture();
+		struct SkylineNode
+		{
+			int x, y, width;
+		};
+		std::vector<SkylineNode> skyline; // top edge of the packed area, left to right
+
+		bool sdf; // distance field glyphs, filtered linearly
+		int users; // number of fonts with glyphs on this page
+
+		FontTexture(bool sdf);
 		~FontTexture();
 		bool findEmpty(const Eigen::Vector2i& size, Eigen::Vector2i& cursor_out);
+		bool grow(); // doubles the height, returns false if we're already at the maximum size
+		void writeGlyph(const Eigen::Vector2i& cursor, const Eigen::Vector2i& size, const unsigned char* bitmap, int pitch);
 
-		// you must call initTexture() after creating a FontTexture to get a textureId
-		void initTexture(); // initializes the OpenGL texture according to this FontTexture's settings, updating textureId
-		void deinitTexture(); // deinitializes the OpenGL texture if any exists, is automatically called in the destructor
+		void initTexture(); // creates the OpenGL texture from pixels if it doesn't exist yet, updating textureId
+		void deinitTexture(); // deinitializes the OpenGL texture if any exists (pixels are kept), is automatically called in the destructor
+
+	private:
+		int fitSkyline(size_t node, int width, int height) const; // y to place a rect at skyline[node].x, -1 if it doesn't fit
 	};
 
 	struct FontFace
@@ -104,7 +128,8 @@ private:
 	void rebuildTextures();
 	void unloadTextures();
 
-	std::vector<FontTexture> mTextures;
+	static std::vector< std::unique_ptr<FontTexture> > sTextures; // all atlas pages
+	std::vector<FontTexture*> mTextures; // pages we have glyphs on
 
 	void getTextureForNewGlyph(const Eigen::Vector2i& glyphSize, FontTexture*& tex_out, Eigen::Vector2i& cursor_out);
 
@@ -116,8 +141,8 @@ private:
 	{
 		FontTexture* texture;
 		
-		Eigen::Vector2f texPos;
-		Eigen::Vector2f texSize; // in texels!
+		Eigen::Vector2i texPos; // in texels, texture coordinates change when the page grows
+		Eigen::Vector2i texSize;
 
 		Eigen::Vector2f advance;
 		Eigen::Vector2f bearing;
@@ -128,11 +153,50 @@ private:
 	Glyph* getGlyph(UnicodeChar id);
 
 	int mMaxGlyphHeight;
+
+	const bool mSdf;
+	const std::shared_ptr<Font> mSdfBase;
+	const float mScale; // glyph metrics -> our size, 1 unless we draw the glyphs of mSdfBase
+
+	int getGlyphPadding(const Glyph* glyph) const; // texels around the glyph on its texture (distance fields need room to fall off)
 	
 	const int mSize;
 	const std::string mPath;
 
-	float getNewlineStartOffset(const std::string& text, const unsigned int& charStart, const float& xLen, const Alignment& alignment);
+	// Single pass layout: splits text into lines at newlines and, if xLen > 0, before words that wouldn't fit anymore.
+	struct TextLine
+	{
+		size_t start, end; // bytes of the text on this line, without the newline
+		float width; // including trailing spaces
+	};
+	void layoutText(const std::string& text, float xLen, std::vector<TextLine>& lines);
+
+	// Recently built TextCaches, so showing the same text again (e.g. the description of a game we scrolled past)
+	// is just a copy.  The least recently used ones are dropped when they take up too much memory.
+	struct TextLayoutKey
+	{
+		const Font* font;
+		std::string text;
+		Eigen::Vector2f offset;
+		float xLen;
+		Alignment alignment;
+		float lineSpacing;
+
+		bool operator==(const TextLayoutKey& other) const;
+	};
+
+	struct TextLayoutKeyHash
+	{
+		size_t operator()(const TextLayoutKey& key) const;
+	};
+
+	typedef std::list< std::pair< TextLayoutKey, std::shared_ptr<TextCache> > > TextLayoutList; // most recently used first
+	static TextLayoutList sTextLayoutList;
+	static std::unordered_map<TextLayoutKey, TextLayoutList::iterator, TextLayoutKeyHash> sTextLayoutMap;
+	static size_t sTextLayoutMemUsage;
+
+	static size_t getTextLayoutMemUsage(const TextLayoutKey& key, const TextCache& cache);
+	static void eraseTextLayout(TextLayoutList::iterator it);
 
 	friend TextCache;
 };
@@ -152,7 +216,8 @@ protected:
 
 	struct VertexList
 	{
-		GLuint* textureIdPtr; // this is a pointer because the texture ID can change during deinit/reinit (when launching a game)
+		Font::FontTexture* texture; // the texture ID can change during deinit/reinit (when launching a game)
+		int textureHeight; // page height the texture coordinates were calculated for
 		std::vector<Vertex> verts;
 		std::vector<GLubyte> colors;
 	};
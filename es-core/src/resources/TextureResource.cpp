@@ -6,12 +6,45 @@
 #include "Renderer.h"
 #include "Util.h"
 #include "resources/SVGResource.h"
+#include "resources/ThumbnailCache.h"
+#include "ThreadPool.h"
+#include "Settings.h"
+#include <SDL.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+// how long processAsyncUploads() may spend uploading textures each frame
+#define ASYNC_UPLOAD_BUDGET_MS 4
 
 std::map< TextureResource::TextureKeyType, std::weak_ptr<TextureResource> > TextureResource::sTextureMap;
-std::list< std::weak_ptr<TextureResource> > TextureResource::sTextureList;
+size_t TextureResource::sTotalMemUsage = 0;
+TextureResource::TextureCacheList TextureResource::sTextureCache;
+std::unordered_map<const TextureResource*, TextureResource::TextureCacheList::iterator> TextureResource::sTextureCacheIndex;
+
+// an image decoded by a worker thread, waiting to be uploaded on the render thread
+struct DecodedImage
+{
+	std::weak_ptr<TextureResource> texture;
+	std::vector<unsigned char> pixels; // empty if decoding failed
+	size_t width;
+	size_t height;
+};
+
+static std::mutex sDecodedMutex;
+static std::list<DecodedImage> sDecoded;
+static std::atomic<int> sPendingLoads(0); // queued and not yet uploaded or dropped
+
+// created on first use, so it is destroyed (and waits for its work) before the queue above
+static ThreadPool& getDecodePool()
+{
+	// leave some room for the render thread
+	static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency() / 2));
+	return pool;
+}
 
-TextureResource::TextureResource(const std::string& path, bool tile) : 
-	mTextureID(0), mPath(path), mTextureSize(Eigen::Vector2i::Zero()), mTile(tile)
+TextureResource::TextureResource(const std::string& path, bool tile, const Eigen::Vector2i& maxSize) : 
+	mTextureID(0), mLoading(false), mPath(path), mTextureSize(Eigen::Vector2i::Zero()), mTile(tile), mMaxSize(maxSize)
 {
 }
 
@@ -27,8 +60,18 @@ void TextureResource::unload(std::shared_ptr<ResourceManager>& rm)
 
 void TextureResource::reload(std::shared_ptr<ResourceManager>& rm)
 {
-	if(!mPath.empty())
+	if(mPath.empty())
+		return;
+
+	if(!mMaxSize.isZero())
 	{
+		size_t width, height;
+		std::vector<unsigned char> imageRGBA = ThumbnailCache::load(mPath, mMaxSize.x(), mMaxSize.y(), width, height);
+		if(imageRGBA.empty())
+			LOG(LogError) << "Could not initialize texture, invalid data!  (file path: " << mPath << ")";
+		else
+			initFromPixels(imageRGBA.data(), width, height);
+	}else{
 		const ResourceData& data = rm->getFileData(mPath);
 		initFromMemory((const char*)data.ptr.get(), data.length);
 	}
@@ -54,6 +97,91 @@ void TextureResource::initFromPixels(const unsigned char* dataRGBA, size_t width
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapMode);
 
 	mTextureSize << width, height;
+	sTotalMemUsage += getMemUsage();
+}
+
+// Note: the worker never takes a strong reference, otherwise the texture could end up being
+// destroyed (and its GL texture deleted) on the worker thread.
+void TextureResource::loadAsync()
+{
+	mLoading = true;
+
+	std::weak_ptr<TextureResource> weak = sTextureMap[TextureKeyType(mPath, mTile, mMaxSize.x(), mMaxSize.y())];
+	const std::string path = mPath;
+	const Eigen::Vector2i maxSize = mMaxSize;
+	sPendingLoads++;
+	getDecodePool().queueWorkItem([weak, path, maxSize] {
+		// nobody wants this texture anymore
+		if(weak.expired())
+		{
+			sPendingLoads--;
+			return;
+		}
+
+		DecodedImage image;
+		image.texture = weak;
+		image.width = 0;
+		image.height = 0;
+		if(!maxSize.isZero())
+		{
+			image.pixels = ThumbnailCache::load(path, maxSize.x(), maxSize.y(), image.width, image.height);
+		}else{
+			const ResourceData data = ResourceManager::getInstance()->getFileData(path);
+			if(!weak.expired())
+				image.pixels = ImageIO::loadFromMemoryRGBA32(data.ptr.get(), data.length, image.width, image.height);
+		}
+
+		std::lock_guard<std::mutex> lock(sDecodedMutex);
+		sDecoded.push_back(std::move(image));
+	});
+}
+
+bool TextureResource::processAsyncUploads()
+{
+	const Uint32 start = SDL_GetTicks();
+	bool finished = false;
+
+	while(true)
+	{
+		DecodedImage image;
+		{
+			std::lock_guard<std::mutex> lock(sDecodedMutex);
+			if(sDecoded.empty())
+				return finished;
+
+			image = std::move(sDecoded.front());
+			sDecoded.pop_front();
+			sPendingLoads--;
+		}
+
+		std::shared_ptr<TextureResource> tex = image.texture.lock();
+		if(!tex || !tex->mLoading)
+			continue; // cancelled
+
+		tex->mLoading = false;
+		finished = true;
+
+		// may have been reloaded in the meantime
+		if(tex->isInitialized())
+			continue;
+
+		if(image.pixels.empty())
+		{
+			LOG(LogError) << "Could not initialize texture, invalid data!  (file path: " << tex->mPath << ")";
+			continue;
+		}
+
+		tex->initFromPixels(image.pixels.data(), image.width, image.height);
+		cacheTexture(tex);
+
+		if(SDL_GetTicks() - start >= ASYNC_UPLOAD_BUDGET_MS)
+			return finished;
+	}
+}
+
+bool TextureResource::hasPendingAsyncLoads()
+{
+	return sPendingLoads > 0;
 }
 
 void TextureResource::initFromMemory(const char* data, size_t length)
@@ -74,6 +202,8 @@ void TextureResource::deinit()
 {
 	if(mTextureID != 0)
 	{
+		sTotalMemUsage -= getMemUsage();
+		Renderer::flush(); // might still be waiting to be drawn
 		glDeleteTextures(1, &mTextureID);
 		mTextureID = 0;
 	}
@@ -89,6 +219,11 @@ bool TextureResource::isTiled() const
 	return mTile;
 }
 
+GLuint TextureResource::getTextureID() const
+{
+	return mTextureID;
+}
+
 void TextureResource::bind() const
 {
 	if(mTextureID != 0)
@@ -98,7 +233,7 @@ void TextureResource::bind() const
 }
 
 
-std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, bool tile)
+std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, bool tile, bool async, const Eigen::Vector2i& maxSize)
 {
 	std::shared_ptr<ResourceManager>& rm = ResourceManager::getInstance();
 
@@ -111,34 +246,40 @@ std::shared_ptr<TextureResource> TextureResource::get(const std::string& path, b
 		return tex;
 	}
 
-	TextureKeyType key(canonicalPath, tile);
+	TextureKeyType key(canonicalPath, tile, maxSize.x(), maxSize.y());
 	auto foundTexture = sTextureMap.find(key);
 	if(foundTexture != sTextureMap.end())
 	{
 		if(!foundTexture->second.expired())
-			return foundTexture->second.lock();
+		{
+			std::shared_ptr<TextureResource> tex = foundTexture->second.lock();
+			cacheTexture(tex);
+			return tex;
+		}
 	}
 
 	// need to create it
 	std::shared_ptr<TextureResource> tex;
 
 	// is it an SVG?
-	if(key.first.substr(key.first.size() - 4, std::string::npos) == ".svg")
+	if(canonicalPath.substr(canonicalPath.size() - 4, std::string::npos) == ".svg")
 	{
 		// probably
 		// don't add it to our map because 2 svgs might be rasterized at different sizes
-		tex = std::shared_ptr<SVGResource>(new SVGResource(key.first, tile));
-		sTextureList.push_back(tex); // add it to our list though
+		tex = std::shared_ptr<SVGResource>(new SVGResource(canonicalPath, tile));
 		rm->addReloadable(tex);
 		tex->reload(rm);
 		return tex;
 	}else{
 		// normal texture
-		tex = std::shared_ptr<TextureResource>(new TextureResource(key.first, tile));
+		tex = std::shared_ptr<TextureResource>(new TextureResource(canonicalPath, tile, maxSize));
 		sTextureMap[key] = std::weak_ptr<TextureResource>(tex);
-		sTextureList.push_back(tex);
 		rm->addReloadable(tex);
-		tex->reload(ResourceManager::getInstance());
+		if(async)
+			tex->loadAsync();
+		else
+			tex->reload(ResourceManager::getInstance());
+		cacheTexture(tex);
 		return tex;
 	}
 }
@@ -148,6 +289,11 @@ bool TextureResource::isInitialized() const
 	return mTextureID != 0;
 }
 
+bool TextureResource::isLoading() const
+{
+	return mLoading;
+}
+
 size_t TextureResource::getMemUsage() const
 {
 	if(!mTextureID || mTextureSize.x() == 0 || mTextureSize.y() == 0)
@@ -158,21 +304,58 @@ size_t TextureResource::getMemUsage() const
 
 size_t TextureResource::getTotalMemUsage()
 {
-	size_t total = 0;
+	return sTotalMemUsage;
+}
+
+void TextureResource::cacheTexture(const std::shared_ptr<TextureResource>& tex)
+{
+	// textures that are still loading only get cached once they're uploaded,
+	// otherwise the cache would keep them from being cancelled
+	if(tex->isLoading())
+		return;
 
-	auto it = sTextureList.begin();
-	while(it != sTextureList.end())
+	// move it to the front
+	auto found = sTextureCacheIndex.find(tex.get());
+	if(found != sTextureCacheIndex.end())
 	{
-		if((*it).expired())
-		{
-			// remove expired textures from the list
-			it = sTextureList.erase(it);
+		sTextureCache.splice(sTextureCache.begin(), sTextureCache, found->second);
+		return;
+	}
+
+	sTextureCache.push_front(tex);
+	sTextureCacheIndex[tex.get()] = sTextureCache.begin();
+	trimCache();
+}
+
+void TextureResource::trimCache()
+{
+	const size_t budget = (size_t)std::max(0, Settings::getInstance()->getInt("MaxVRAM")) * 1024 * 1024;
+
+	// evict the least recently used textures nobody else is holding on to
+	// (the ones still in use wouldn't free anything)
+	auto it = sTextureCache.end();
+	while(sTotalMemUsage > budget && it != sTextureCache.begin())
+	{
+		--it;
+		if(it->use_count() > 1)
 			continue;
-		}
 
-		total += (*it).lock()->getMemUsage();
-		it++;
+		sTextureCacheIndex.erase(it->get());
+		it = sTextureCache.erase(it); // (the texture's destructor takes it off sTotalMemUsage)
 	}
+}
 
-	return total;
+void TextureResource::clearUnusedCache()
+{
+	auto it = sTextureCache.begin();
+	while(it != sTextureCache.end())
+	{
+		if(it->use_count() > 1)
+		{
+			it++;
+		}else{
+			sTextureCacheIndex.erase(it->get());
+			it = sTextureCache.erase(it);
+		}
+	}
 }
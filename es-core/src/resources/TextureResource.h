@@ -2,7 +2,10 @@
 
 #include "resources/ResourceManager.h"
 
+#include <list>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <Eigen/Dense>
 #include "platform.h"
 #include GLHEADER
@@ -12,7 +15,19 @@
 class TextureResource : public IReloadable
 {
 public:
-	static std::shared_ptr<TextureResource> get(const std::string& path, bool tile = false);
+	// If async is true, the file is read and decoded on a worker thread and uploaded by processAsyncUploads()
+	// on a later frame (isLoading() is true until then).  Dropping every reference to a texture that is still
+	// loading cancels it.  SVGs are always loaded immediately.
+	// If maxSize is non-zero, bigger images are scaled down to fit it (keeping their aspect ratio) and the
+	// result is kept in the ThumbnailCache, so next time only the small version has to be read.
+	static std::shared_ptr<TextureResource> get(const std::string& path, bool tile = false, bool async = false,
+		const Eigen::Vector2i& maxSize = Eigen::Vector2i::Zero());
+
+	// Uploads textures that finished decoding in the background.  Call once per frame from the render thread;
+	// stops after a few milliseconds so big images don't cause a hitch (but always uploads at least one).
+	// Returns true if any texture finished loading (successfully or not).
+	static bool processAsyncUploads();
+	static bool hasPendingAsyncLoads(); // true while any async load hasn't been uploaded (or cancelled) yet
 
 	virtual ~TextureResource();
 
@@ -20,9 +35,11 @@ public:
 	virtual void reload(std::shared_ptr<ResourceManager>& rm) override;
 	
 	bool isInitialized() const;
+	bool isLoading() const; // true while an async load hasn't been uploaded yet
 	bool isTiled() const;
 	const Eigen::Vector2i& getSize() const;
 	void bind() const;
+	GLuint getTextureID() const; // 0 if not initialized
 	
 	// Warning: will NOT correctly reinitialize when this texture is reloaded (e.g. ES starts/stops playing a game).
 	virtual void initFromMemory(const char* file, size_t length);
@@ -33,19 +50,35 @@ public:
 	size_t getMemUsage() const; // returns an approximation of the VRAM used by this texture (in bytes)
 	static size_t getTotalMemUsage(); // returns an approximation of total VRAM used by textures (in bytes)
 
+	// Drops cached textures that aren't used by anything (e.g. before the renderer is deinitialized,
+	// so they don't all have to be reloaded afterwards).
+	static void clearUnusedCache();
+
 protected:
-	TextureResource(const std::string& path, bool tile);
+	TextureResource(const std::string& path, bool tile, const Eigen::Vector2i& maxSize = Eigen::Vector2i::Zero());
 	void deinit();
+	void loadAsync();
 
 	Eigen::Vector2i mTextureSize;
 	const std::string mPath;
 	const bool mTile;
+	const Eigen::Vector2i mMaxSize;
 
 private:
 	GLuint mTextureID;
+	bool mLoading;
 
-	typedef std::pair<std::string, bool> TextureKeyType;
+	// path, tile, max width, max height
+	typedef std::tuple<std::string, bool, int, int> TextureKeyType;
 	static std::map< TextureKeyType, std::weak_ptr<TextureResource> > sTextureMap; // map of textures, used to prevent duplicate textures
 
-	static std::list< std::weak_ptr<TextureResource> > sTextureList; // list of all textures, used for memory approximations
+	static size_t sTotalMemUsage; // getMemUsage() of every initialized texture, kept up to date by initFromPixels() and deinit()
+
+	// Recently used textures, most recent first.  Keeps them alive after the last component lets go of them,
+	// until total texture memory goes over the "MaxVRAM" setting.  Async textures are added once uploaded.
+	typedef std::list< std::shared_ptr<TextureResource> > TextureCacheList;
+	static TextureCacheList sTextureCache;
+	static std::unordered_map<const TextureResource*, TextureCacheList::iterator> sTextureCacheIndex; // where each one is in sTextureCache
+	static void cacheTexture(const std::shared_ptr<TextureResource>& tex);
+	static void trimCache();
 };
@@ -0,0 +1,208 @@
+#include "resources/ThumbnailCache.h"
+#include "resources/ResourceManager.h"
+#include "ImageIO.h"
+#include "Log.h"
+#include "platform.h"
+#include "Settings.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace fs = boost::filesystem;
+
+// bump when the file layout changes, old files are then treated as misses
+#define THUMBNAIL_MAGIC 0x31485445 // "ETH1"
+
+// pruning goes down to this percentage of the limit, so it doesn't happen again on the next few writes
+#define PRUNE_TARGET_PERCENT 80
+
+static std::mutex sCacheSizeMutex;
+static bool sCacheSizeKnown = false; // the directory is only measured once something is written
+static uintmax_t sCacheSize = 0; // bytes, including what other threads are still writing
+
+struct ThumbnailHeader
+{
+	unsigned int magic;
+	unsigned int width;
+	unsigned int height;
+	unsigned int keyLength; // followed by the key (to catch hash collisions), then width * height * 4 bytes of RGBA
+};
+
+std::string ThumbnailCache::getCacheDirectory()
+{
+	return getHomePath() + "/.emulationstation/cache/thumbnails";
+}
+
+// reads a cached thumbnail, returns false if it's missing or doesn't belong to key
+static bool read_thumbnail(const std::string& file, const std::string& key, std::vector<unsigned char>& pixels, size_t& width, size_t& height)
+{
+	std::ifstream stream(file, std::ios::binary);
+	if(!stream)
+		return false;
+
+	ThumbnailHeader header;
+	if(!stream.read((char*)&header, sizeof(header)) || header.magic != THUMBNAIL_MAGIC || header.keyLength != key.size())
+		return false;
+
+	std::string storedKey(header.keyLength, '\0');
+	if(!stream.read(&storedKey[0], storedKey.size()) || storedKey != key)
+		return false;
+
+	pixels.resize((size_t)header.width * header.height * 4);
+	if(pixels.empty() || !stream.read((char*)pixels.data(), pixels.size()))
+	{
+		pixels.clear();
+		return false;
+	}
+
+	width = header.width;
+	height = header.height;
+	return true;
+}
+
+static void write_thumbnail(const std::string& file, const std::string& key, const std::vector<unsigned char>& pixels, size_t width, size_t height)
+{
+	// write somewhere private first so other threads (or a crash) never see half a file
+	std::stringstream tmp;
+	tmp << file << "." << std::this_thread::get_id() << ".tmp";
+
+	{
+		std::ofstream stream(tmp.str(), std::ios::binary | std::ios::trunc);
+		if(!stream)
+		{
+			LOG(LogWarning) << "Could not write thumbnail cache file \"" << tmp.str() << "\"";
+			return;
+		}
+
+		ThumbnailHeader header = { THUMBNAIL_MAGIC, (unsigned int)width, (unsigned int)height, (unsigned int)key.size() };
+		stream.write((const char*)&header, sizeof(header));
+		stream.write(key.data(), key.size());
+		stream.write((const char*)pixels.data(), pixels.size());
+	}
+
+	boost::system::error_code ec;
+	fs::rename(tmp.str(), file, ec);
+	if(ec)
+		fs::remove(tmp.str(), ec);
+}
+
+void ThumbnailCache::addToCacheSize(uintmax_t size)
+{
+	const uintmax_t limit = (uintmax_t)std::max(0, Settings::getInstance()->getInt("ThumbnailCacheSize")) * 1024 * 1024;
+
+	std::lock_guard<std::mutex> lock(sCacheSizeMutex);
+	if(!sCacheSizeKnown)
+	{
+		sCacheSize = prune(limit);
+		sCacheSizeKnown = true;
+	}
+
+	sCacheSize += size;
+	if(sCacheSize > limit)
+		sCacheSize = prune(limit / 100 * PRUNE_TARGET_PERCENT);
+}
+
+uintmax_t ThumbnailCache::prune(uintmax_t maxSize)
+{
+	struct CacheFile
+	{
+		std::time_t lastUsed;
+		uintmax_t size;
+		fs::path path;
+
+		bool operator<(const CacheFile& rhs) const { return lastUsed < rhs.lastUsed; }
+	};
+
+	std::vector<CacheFile> files;
+	uintmax_t total = 0;
+
+	boost::system::error_code ec;
+	for(fs::directory_iterator it(getCacheDirectory(), ec), end; !ec && it != end; it.increment(ec))
+	{
+		CacheFile file;
+		file.path = it->path();
+		file.size = fs::file_size(file.path, ec);
+		file.lastUsed = fs::last_write_time(file.path, ec);
+		if(ec)
+		{
+			ec.clear();
+			continue;
+		}
+
+		// other threads' temporary files (or ones left by a crash) count, but aren't ours to delete
+		total += file.size;
+		if(file.path.extension() == ".rgba")
+			files.push_back(file);
+	}
+
+	if(total <= maxSize)
+		return total;
+
+	std::sort(files.begin(), files.end());
+
+	unsigned int removed = 0;
+	for(auto it = files.begin(); it != files.end() && total > maxSize; it++)
+	{
+		if(fs::remove(it->path, ec))
+		{
+			total -= it->size;
+			removed++;
+		}
+	}
+
+	LOG(LogInfo) << "Removed " << removed << " unused thumbnails from the cache";
+	return total;
+}
+
+std::vector<unsigned char> ThumbnailCache::load(const std::string& path, size_t maxWidth, size_t maxHeight, size_t& width, size_t& height)
+{
+	std::vector<unsigned char> pixels;
+	width = 0;
+	height = 0;
+
+	// embedded resources are never big enough to be worth it
+	const bool cacheable = (maxWidth || maxHeight) && path.substr(0, 2) != ":/";
+
+	boost::system::error_code ec;
+	std::string key;
+	std::string file;
+	if(cacheable)
+	{
+		const std::time_t mtime = fs::last_write_time(path, ec);
+		if(!ec)
+		{
+			std::stringstream ss;
+			ss << path << "|" << mtime << "|" << maxWidth << "x" << maxHeight;
+			key = ss.str();
+
+			std::stringstream name;
+			name << getCacheDirectory() << "/" << std::hex << std::hash<std::string>()(key) << ".rgba";
+			file = name.str();
+
+			if(read_thumbnail(file, key, pixels, width, height))
+			{
+				fs::last_write_time(file, std::time(NULL), ec); // marks it as used for pruning
+				return pixels;
+			}
+		}
+	}
+
+	const ResourceData data = ResourceManager::getInstance()->getFileData(path);
+	bool scaled = false;
+	pixels = ImageIO::loadFromMemoryRGBA32(data.ptr.get(), data.length, width, height, maxWidth, maxHeight, &scaled);
+
+	// only scaled images are cached, anything else would just be a bigger copy of the original file
+	if(scaled && !file.empty() && !pixels.empty())
+	{
+		fs::create_directories(getCacheDirectory(), ec);
+		write_thumbnail(file, key, pixels, width, height);
+		addToCacheSize(sizeof(ThumbnailHeader) + key.size() + pixels.size());
+	}
+
+	return pixels;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A disk cache of images that were decoded and scaled down to the size they're drawn at
+// (~/.emulationstation/cache/thumbnails), so big box art doesn't have to be decoded and scaled
+// again every time ES starts.  Entries are keyed by source path, modification time and the size
+// the image was scaled to fit, and hold raw RGBA pixels that can be uploaded as they are.
+// The cache is kept under the "ThumbnailCacheSize" setting: a hit bumps the file's modification time,
+// and the files that went unused the longest are deleted when a new thumbnail pushes it over.
+// Safe to use from multiple threads.
+class ThumbnailCache
+{
+public:
+	// Returns the RGBA pixels of the image at path, scaled down to fit maxWidth x maxHeight (0 = no limit on that axis).
+	// Images that already fit (and embedded resources) are just decoded and never cached.
+	// Returns an empty vector if the image couldn't be loaded.
+	static std::vector<unsigned char> load(const std::string& path, size_t maxWidth, size_t maxHeight, size_t& width, size_t& height);
+
+private:
+	static std::string getCacheDirectory();
+
+	// counts size more bytes against the limit, pruning the cache if it's over
+	static void addToCacheSize(uintmax_t size);
+	// deletes the least recently used files until the cache is down to maxSize bytes, returns the new size
+	static uintmax_t prune(uintmax_t maxSize);
+};